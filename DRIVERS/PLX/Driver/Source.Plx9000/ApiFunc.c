@@ -1308,6 +1308,8 @@ PlxNotificationRegisterFor(
     // Clear interrupt source
     pWaitObject->Source_Ints     = INTR_TYPE_NONE;
     pWaitObject->Source_Doorbell = 0;
+    pWaitObject->Timestamp_ns    = 0;
+    pWaitObject->Sequence        = 0;
 
     // Set interrupt notification flags
     PlxChipSetInterruptNotifyFlags(
@@ -1517,7 +1519,9 @@ PLX_STATUS
 PlxNotificationStatus(
     DEVICE_EXTENSION *pdx,
     VOID             *pUserWaitObject,
-    PLX_INTERRUPT    *pPlxIntr
+    PLX_INTERRUPT    *pPlxIntr,
+    U64              *pTimestamp_ns,
+    U64              *pSequence
     )
 {
     unsigned long       flags;
@@ -1551,6 +1555,10 @@ PlxNotificationStatus(
             IntData.Source_Ints     = pWaitObject->Source_Ints;
             IntData.Source_Doorbell = pWaitObject->Source_Doorbell;
 
+            // Return completion time & sequence of last notification
+            *pTimestamp_ns = pWaitObject->Timestamp_ns;
+            *pSequence     = pWaitObject->Sequence;
+
             // Reset interrupt sources
             pWaitObject->Source_Ints     = INTR_TYPE_NONE;
             pWaitObject->Source_Doorbell = 0;
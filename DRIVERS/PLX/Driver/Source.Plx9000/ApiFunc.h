@@ -239,7 +239,9 @@ PLX_STATUS
 PlxNotificationStatus(
     DEVICE_EXTENSION *pdx,
     VOID             *pUserWaitObject,
-    PLX_INTERRUPT    *pPlxIntr
+    PLX_INTERRUPT    *pPlxIntr,
+    U64              *pTimestamp_ns,
+    U64              *pSequence
     );
 
 PLX_STATUS
@@ -200,8 +200,9 @@ OnInterrupt(
     // Schedule deferred procedure (DPC) to complete interrupt processing
     //
 
-    // Provide interrupt source to DPC
-    pdx->Source_Ints = InterruptSource;
+    // Provide interrupt source and completion time to DPC
+    pdx->Source_Ints     = InterruptSource;
+    pdx->IsrTimestamp_ns = Plx_ktime_get_raw_ns();
 
     // If device is no longer started, do not schedule a DPC
     if (pdx->State != PLX_STATE_STARTED)
@@ -262,6 +263,10 @@ DpcForIsr(
     IntData.Source_Ints     = pdx->Source_Ints;
     IntData.Source_Doorbell = 0;
 
+    // Get completion time and number this DPC
+    IntData.Timestamp_ns = pdx->IsrTimestamp_ns;
+    IntData.Sequence     = ++pdx->DpcSequence;
+
     // Local Interrupt 1
     if (IntData.Source_Ints & INTR_TYPE_LOCAL_1)
     {
@@ -963,7 +963,9 @@ Dispatch_IoControl(
                 PlxNotificationStatus(
                     pdx,
                     PLX_INT_TO_PTR(pIoBuffer->value[0]),
-                    &(pIoBuffer->u.PlxIntr)
+                    &(pIoBuffer->u.PlxIntr),
+                    &(pIoBuffer->value[1]),
+                    &(pIoBuffer->value[2])
                     );
             break;
 
@@ -193,6 +193,8 @@ typedef struct _PLX_WAIT_OBJECT
     U32                Source_Ints;             // Interrupt(s) that caused notification
     U32                Source_Doorbell;         // Doorbells that caused notification
     PLX_STATE          state;                   // Current state of the object
+    U64                Timestamp_ns;            // CLOCK_MONOTONIC_RAW time of last notification
+    U64                Sequence;                // DPC sequence number of last notification
     atomic_t           SleepCount;              // Number of currently sleeping threads for this object
     wait_queue_head_t  WaitQueue;
 } PLX_WAIT_OBJECT;
@@ -204,6 +206,8 @@ typedef struct _PLX_INTERRUPT_DATA
     struct _DEVICE_EXTENSION *pdx;
     U32                       Source_Ints;
     U32                       Source_Doorbell;
+    U64                       Timestamp_ns;
+    U64                       Sequence;
 } PLX_INTERRUPT_DATA;
 
 
@@ -272,6 +276,8 @@ typedef struct _DEVICE_EXTENSION
     U8                     IrqPci;                        // Original PCI IRQ Line assigned to device
     U32                    Source_Ints;                   // Interrupts detected by ISR
     U32                    Source_Doorbell;               // Doorbell interrupts detected by ISR
+    U64                    IsrTimestamp_ns;               // CLOCK_MONOTONIC_RAW time ISR detected interrupt
+    U64                    DpcSequence;                   // Number of DPCs run since device start
     U8                    *pRegVa;                        // Virtual address to registers
 
     struct list_head       List_WaitObjects;              // List of registered notification objects
@@ -185,6 +185,10 @@ PlxSignalNotifications(
             pWaitObject->Source_Ints     |= SourceInt;
             pWaitObject->Source_Doorbell |= SourceDB;
 
+            // Save completion time & sequence of this notification
+            pWaitObject->Timestamp_ns = pIntData->Timestamp_ns;
+            pWaitObject->Sequence     = pIntData->Sequence;
+
             // Signal wait object
             wake_up_interruptible(
                 &(pWaitObject->WaitQueue)
@@ -420,6 +420,15 @@ PlxPci_NotificationStatus(
     PLX_INTERRUPT     *pPlxIntr
     );
 
+PLX_STATUS EXPORT
+PlxPci_NotificationStatusEx(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_NOTIFY_OBJECT *pEvent,
+    PLX_INTERRUPT     *pPlxIntr,
+    U64               *pTimestamp_ns,
+    U64               *pSequence
+    );
+
 PLX_STATUS EXPORT
 PlxPci_NotificationCancel(
     PLX_DEVICE_OBJECT *pDevice,
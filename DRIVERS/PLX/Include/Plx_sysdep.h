@@ -582,4 +582,31 @@
 
 
 
+/***********************************************************
+ * ktime_get_raw_ns
+ *
+ * Returns CLOCK_MONOTONIC_RAW time in nanoseconds. Used to
+ * timestamp interrupt/DMA completion. ktime_get_raw_ns was
+ * added in 3.17, getrawmonotonic is available since 2.6.28.
+ * Older kernels fall back to CLOCK_MONOTONIC.
+ **********************************************************/
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(3,17,0))
+    #include <linux/timekeeping.h>
+    #define Plx_ktime_get_raw_ns()      ((u64)ktime_get_raw_ns())
+#elif (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,28))
+    #include <linux/time.h>
+    static inline u64 Plx_ktime_get_raw_ns(void)
+    {
+        struct timespec ts;
+        getrawmonotonic( &ts );
+        return (u64)timespec_to_ns( &ts );
+    }
+#else
+    #include <linux/hrtimer.h>
+    #define Plx_ktime_get_raw_ns()      ((u64)ktime_to_ns( ktime_get() ))
+#endif
+
+
+
+
 #endif  // _PLX_SYSDEP_H_
@@ -3455,6 +3455,65 @@ PlxPci_NotificationStatus(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  PlxPci_NotificationStatusEx
+ *
+ * Description:  Returns the interrupt(s) that have caused notification events,
+ *               along with CLOCK_MONOTONIC_RAW time (ns) the last interrupt was
+ *               detected by the driver ISR and the driver DPC sequence number.
+ *               Timestamp & sequence are 0 if the driver does not record them.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_NotificationStatusEx(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_NOTIFY_OBJECT *pEvent,
+    PLX_INTERRUPT     *pPlxIntr,
+    U64               *pTimestamp_ns,
+    U64               *pSequence
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    // Verify parameters
+    if ((pPlxIntr == NULL) || (pEvent == NULL) ||
+        (pTimestamp_ns == NULL) || (pSequence == NULL))
+        return ApiNullParam;
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+        return ApiInvalidDeviceInfo;
+
+    // Verify event object
+    if (!IsObjectValid(pEvent))
+        return ApiFailed;
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.value[0] = pEvent->pWaitObject;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_NOTIFICATION_STATUS,
+        &IoBuffer
+        );
+
+    if (IoBuffer.ReturnCode == ApiSuccess)
+    {
+        // Return interrupt sources, completion time & sequence
+        *pPlxIntr      = IoBuffer.u.PlxIntr;
+        *pTimestamp_ns = IoBuffer.value[1];
+        *pSequence     = IoBuffer.value[2];
+    }
+
+    return IoBuffer.ReturnCode;
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  PlxPci_NotificationCancel
@@ -11,6 +11,9 @@
 #include <linux/uaccess.h>
 #include <linux/usb.h>
 #include <linux/mutex.h>
+#include <linux/rwsem.h>
+#include <linux/bitops.h>
+#include <linux/ktime.h>
 //our private ioctl calls
 #include "USB_IOCTL_LINUX.h"
 /*RSH USB devices' VID & PIDs*/
@@ -36,7 +39,7 @@
 #define LAUSB_MINOR_BASE	199
 /* MAX_TRANSFER is chosen so because the largest possible packet (tuning packet) is 8 bytes */
 #define MAX_TRANSFER            8
-/* arbitrarily chosen */
+/* arbitrarily chosen; size of preallocated write urb pool, must not exceed BITS_PER_LONG */
 #define WRITES_IN_FLIGHT        8
 
 #endif
@@ -21,11 +21,20 @@ typedef struct  __SendPacketGETID
     unsigned short  rev;
 } SendPacketGETID, *PSendPacketGETID;
 
+//! completion info of the block returned by the last read() call
+typedef struct  __BlockInfo
+{
+    unsigned long long sequence;   // number of completed bulk in transfers, starting from 1
+    unsigned long long timestamp;  // CLOCK_MONOTONIC_RAW time of transfer completion, ns
+    unsigned int       size;       // size in bytes
+} BlockInfo, *PBlockInfo;
+
 #pragma pack()
 
 #define IOCTL_BULK_GET_STATUS  _IOWR(MAGICK_NUMBER, 1, IOCTL_BUFFER)
 #define IOCTL_GET_CONFIG       _IOR(MAGICK_NUMBER, 2, SendPacketGETID)
 #define IOCTL_RESET_PIPE_WRITE _IO(MAGICK_NUMBER,  3)
 #define IOCTL_RESET_PIPE_READ  _IO(MAGICK_NUMBER, 4)
+#define IOCTL_GET_BLOCK_INFO   _IOR(MAGICK_NUMBER, 5, BlockInfo)
 
 #endif
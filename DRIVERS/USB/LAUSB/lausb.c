@@ -5,6 +5,18 @@
 #define usb_alloc_coherent(a, b, c, d) usb_buffer_alloc(a, b, c, d)
 #endif
 
+/* CLOCK_MONOTONIC_RAW time in ns, used to timestamp transfer completion */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 17, 0)
+#define lausb_timestamp_ns() ((u64)ktime_get_raw_ns())
+#else
+static inline u64 lausb_timestamp_ns(void)
+{
+	struct timespec ts;
+	getrawmonotonic(&ts);
+	return (u64)timespec_to_ns(&ts);
+}
+#endif
+
 static const char* driverVersion = "1.0.13300.1632";
 
 /* table of devices that work with this driver */
@@ -20,16 +32,32 @@ static const struct usb_device_id lausb_table[] = {
 };
 MODULE_DEVICE_TABLE(usb, lausb_table);
 
+struct lausb;
+
+/* preallocated write urb with its command buffer */
+struct lausb_write_slot {
+	struct lausb            *dev;
+	struct urb              *urb;
+	unsigned char           *buffer;                /* MAX_TRANSFER bytes, coherent */
+	int                     index;                  /* bit in lausb.write_free */
+};
+
 /* Structure to hold all of our device specific stuff */
 struct lausb {
 	struct usb_device       *udev;                  /* the usb device for this device */
 	struct usb_interface    *interface;             /* the interface for this device */
         struct semaphore        limit_sem;              /* limiting the number of writes in progress */
+	struct lausb_write_slot write_slots[WRITES_IN_FLIGHT]; /* write urb pool */
+	unsigned long           write_free;             /* bitmap of idle write slots */
+	struct rw_semaphore     write_rwsem;            /* shared by writers, exclusive for disconnect and reset */
 	struct usb_anchor       submitted;              /* in case we need to retract our submissions */
 	struct urb              *bulk_in_urb;           /* the urb to read data with */
 	unsigned char           *bulk_in_buffer;        /* the buffer to receive data */
 	size_t                  bulk_in_buffer_currSize;           /* the size of the receive buffer */
 	size_t			bulk_in_filled;
+	BlockInfo		bulk_in_info;		/* completion info of the filled buffer */
+	BlockInfo		bulk_in_info_read;	/* completion info of the last block copied to user */
+	unsigned long long	bulk_in_sequence;	/* number of completed reads */
 	
 	__u8                    bulk_in_endpointAddr;   /* the address of the bulk in endpoint; READ operations */
         __u8                    bulk_out_endpointAddr;   /* the address of the bulk out endpoint; WRITE operations */
@@ -50,10 +78,47 @@ struct lausb {
 static struct usb_driver lausb_driver;
 static void lausb_draw_down(struct lausb *dev);
 
+static void lausb_free_write_slots(struct lausb *dev)
+{
+	int i;
+
+	for (i = 0; i < WRITES_IN_FLIGHT; i++) {
+		struct lausb_write_slot *slot = &dev->write_slots[i];
+
+		if (slot->buffer)
+			usb_free_coherent(dev->udev, MAX_TRANSFER, slot->buffer, slot->urb->transfer_dma);
+		usb_free_urb(slot->urb);
+	}
+}
+
+/* allocate all write urbs and buffers once, so lausb_write() doesn't touch allocator */
+static int lausb_alloc_write_slots(struct lausb *dev)
+{
+	int i;
+
+	for (i = 0; i < WRITES_IN_FLIGHT; i++) {
+		struct lausb_write_slot *slot = &dev->write_slots[i];
+
+		slot->dev = dev;
+		slot->index = i;
+		slot->urb = usb_alloc_urb(0, GFP_KERNEL);
+		if (!slot->urb)
+			return -ENOMEM;
+		slot->buffer = usb_alloc_coherent(dev->udev, MAX_TRANSFER, GFP_KERNEL,
+						  &slot->urb->transfer_dma);
+		if (!slot->buffer)
+			return -ENOMEM;
+		slot->urb->transfer_flags |= URB_NO_TRANSFER_DMA_MAP;
+		set_bit(i, &dev->write_free);
+	}
+	return 0;
+}
+
 static void lausb_delete(struct kref *kref)
 {
         struct lausb *dev = to_lausb_dev(kref);
         
+	lausb_free_write_slots(dev);
 	usb_free_coherent(dev->udev, dev->bulk_in_buffer_currSize, dev->bulk_in_buffer, dev->bulk_in_urb->transfer_dma);
 	usb_free_urb(dev->bulk_in_urb);        
 	usb_put_dev(dev->udev);
@@ -164,6 +229,7 @@ static int lausb_flush(struct file *file, fl_owner_t id)
 static void lausb_read_bulk_callback(struct urb *urb)
 {
         struct lausb *dev;
+        u64 timestamp = lausb_timestamp_ns(); /* take it first to minimize jitter */
 
         dev = urb->context;
 
@@ -181,6 +247,9 @@ static void lausb_read_bulk_callback(struct urb *urb)
                 dev->errors = urb->status;
         } else {
 		dev->bulk_in_filled = urb->actual_length;
+		dev->bulk_in_info.sequence = ++dev->bulk_in_sequence;
+		dev->bulk_in_info.timestamp = timestamp;
+		dev->bulk_in_info.size = urb->actual_length;
 	}
         dev->ongoing_read = 0;
         spin_unlock(&dev->err_lock);
@@ -337,8 +406,10 @@ retry:
                                  dev->bulk_in_buffer,
                                  dev->bulk_in_filled))
                 	rv = -EFAULT;
-                else
+                else {
                         rv = dev->bulk_in_filled;
+			dev->bulk_in_info_read = dev->bulk_in_info;
+		}
 		dev->bulk_in_filled = 0;
 	} else {/* read some data */
         	rv = lausb_do_read_io(dev, count);
@@ -356,9 +427,8 @@ exit:
 
 static void lausb_write_bulk_callback(struct urb *urb)
 {
-        struct lausb *dev;
-
-        dev = urb->context;
+        struct lausb_write_slot *slot = urb->context;
+        struct lausb *dev = slot->dev;
 
         /* sync/async unlink faults aren't errors */
         if (urb->status) {
@@ -374,9 +444,8 @@ static void lausb_write_bulk_callback(struct urb *urb)
                 spin_unlock(&dev->err_lock);
         }
 
-        /* free up our allocated buffer */
-        usb_free_coherent(urb->dev, urb->transfer_buffer_length,
-                          urb->transfer_buffer, urb->transfer_dma);
+        /* give the slot back to the pool */
+        set_bit(slot->index, &dev->write_free);
         up(&dev->limit_sem);
 }
 
@@ -385,8 +454,8 @@ static ssize_t lausb_write(struct file *file, const char *user_buffer,
 {
         struct lausb *dev;
         int retval = 0;
-        struct urb *urb = NULL;
-        char *buf = NULL;
+        struct lausb_write_slot *slot = NULL;
+        int i;
 	/* MAX_TRANSFER - 8 bytes packet, change it if you need to write more than 8 bytes command packet */
         size_t writesize = min(count, (size_t)MAX_TRANSFER); 
 
@@ -397,8 +466,8 @@ static ssize_t lausb_write(struct file *file, const char *user_buffer,
                 goto exit;
 
         /*
-         * limit the number of URBs in flight to stop a user from using up all
-         * RAM
+         * limit the number of URBs in flight to the size of the pool,
+         * so a free slot is guaranteed after down()
          */
         if (!(file->f_flags & O_NONBLOCK)) {
                 if (down_interruptible(&dev->limit_sem)) {
@@ -424,66 +493,58 @@ static ssize_t lausb_write(struct file *file, const char *user_buffer,
         if (retval < 0)
                 goto error;
 
-        /* create a urb, and a buffer for it, and copy the data to the urb */
-        urb = usb_alloc_urb(0, GFP_KERNEL);
-        if (!urb) {
-                retval = -ENOMEM;
-                goto error;
+        /* take an idle slot from the pool */
+        for (i = 0; i < WRITES_IN_FLIGHT; i++) {
+                if (test_and_clear_bit(i, &dev->write_free)) {
+                        slot = &dev->write_slots[i];
+                        break;
+                }
         }
-
-        buf = usb_alloc_coherent(dev->udev, writesize, GFP_KERNEL,
-                                 &urb->transfer_dma);
-        if (!buf) {
-                retval = -ENOMEM;
+        if (!slot) {                    /* can't happen while limit_sem matches pool size */
+                retval = -EIO;
                 goto error;
         }
 
-        if (copy_from_user(buf, user_buffer, writesize)) {
+        if (copy_from_user(slot->buffer, user_buffer, writesize)) {
                 retval = -EFAULT;
                 goto error;
         }
 
-        /* this lock makes sure we don't submit URBs to gone devices */
-        mutex_lock(&dev->io_mutex);
+        /*
+         * writers share this lock, so several writes can be submitted at once;
+         * disconnect() and reset take it exclusively, so we don't submit URBs
+         * to gone devices
+         */
+        down_read(&dev->write_rwsem);
         if (!dev->interface) {          /* disconnect() was called */
-                mutex_unlock(&dev->io_mutex);
+                up_read(&dev->write_rwsem);
                 retval = -ENODEV;
                 goto error;
         }
 
         /* initialize the urb properly */
-        usb_fill_bulk_urb(urb, dev->udev,
+        usb_fill_bulk_urb(slot->urb, dev->udev,
                           usb_sndbulkpipe(dev->udev, dev->bulk_out_endpointAddr),
-                          buf, writesize, lausb_write_bulk_callback, dev);
-        urb->transfer_flags |= URB_NO_TRANSFER_DMA_MAP;
-        usb_anchor_urb(urb, &dev->submitted);
+                          slot->buffer, writesize, lausb_write_bulk_callback, slot);
+        usb_anchor_urb(slot->urb, &dev->submitted);
 
         /* send the data out the bulk port */
-        retval = usb_submit_urb(urb, GFP_KERNEL);
-        mutex_unlock(&dev->io_mutex);
+        retval = usb_submit_urb(slot->urb, GFP_KERNEL);
 	if (retval) {
 		dev_err(&dev->interface->dev,
 			"[%s] %s - failed submitting write urb, error %d", dev->deviceName,
 			__func__, retval);
-		goto error_unanchor;
+		usb_unanchor_urb(slot->urb);
 	}
-
-        /*
-         * release our reference to this urb, the USB core will eventually free
-         * it entirely
-         */
-        usb_free_urb(urb);
-
+        up_read(&dev->write_rwsem);
+        if (retval)
+                goto error;
 
         return writesize;
 
-error_unanchor:
-        usb_unanchor_urb(urb);
 error:
-        if (urb) {
-                usb_free_coherent(dev->udev, writesize, buf, urb->transfer_dma);
-                usb_free_urb(urb);
-        }
+        if (slot)
+                set_bit(slot->index, &dev->write_free);
         up(&dev->limit_sem);
 
 exit:
@@ -510,6 +571,21 @@ static long lausb_ioctl (struct file *file, unsigned int cmd, unsigned long arg)
 	    return 0;
 	} 
 	
+	if( cmd == IOCTL_GET_BLOCK_INFO )
+	{
+	    BlockInfo info;
+	    
+	    /* read() updates info under io_mutex */
+	    if (mutex_lock_interruptible(&dev->io_mutex))
+		return -ERESTARTSYS;
+	    info = dev->bulk_in_info_read;
+	    mutex_unlock(&dev->io_mutex);
+	    
+	    if (copy_to_user((void*)arg, &info, sizeof(BlockInfo)))
+		return -EFAULT;
+	    return 0;
+	}
+	
 	
 	ibuf = kmalloc(sizeof(IOCTL_BUFFER), GFP_KERNEL);
 	if(ibuf == NULL) return status;
@@ -614,6 +690,7 @@ static int lausb_probe(struct usb_interface *interface,
         kref_init(&dev->kref);
         sema_init(&dev->limit_sem, WRITES_IN_FLIGHT);
         mutex_init(&dev->io_mutex);
+        init_rwsem(&dev->write_rwsem);
         spin_lock_init(&dev->err_lock);
         init_usb_anchor(&dev->submitted);
         init_completion(&dev->bulk_in_completion);
@@ -622,8 +699,7 @@ static int lausb_probe(struct usb_interface *interface,
         dev->interface = interface;
 
 	/* prepare urb for reading to save us from overhead during time critical lausb_read
-	 * TODO: not important, but do all the allocation for writing (i.e. urb and buffer)
-	 * TODO: also not important, but in LDD it's advised to minimize USB probing time, so we can safely move 
+	 * TODO: not important, but in LDD it's advised to minimize USB probing time, so we can safely move 
          * all code from here to lausb_open, except for usb_register_dev and dev_info functions;
 	 */
         dev->bulk_in_urb = usb_alloc_urb(0, GFP_KERNEL);
@@ -634,6 +710,13 @@ static int lausb_probe(struct usb_interface *interface,
 	}
 	dev->bulk_in_urb->transfer_flags |= URB_NO_TRANSFER_DMA_MAP;
 
+	/* prepare urbs and buffers for writing, they are reused by lausb_write */
+	if (lausb_alloc_write_slots(dev)) {
+		dev_err(&interface->dev,
+			"Could not allocate write urbs!\n");
+		goto error;
+	}
+
 	dev->bulk_in_buffer 	     = NULL;
 	dev->bulk_in_buffer_currSize = 0;
 
@@ -731,7 +814,9 @@ static void lausb_disconnect(struct usb_interface *interface)
 
         /* prevent more I/O from starting */
         mutex_lock(&dev->io_mutex);
+        down_write(&dev->write_rwsem);
         dev->interface = NULL;
+        up_write(&dev->write_rwsem);
         mutex_unlock(&dev->io_mutex);
 
         usb_kill_anchored_urbs(&dev->submitted);
@@ -772,6 +857,7 @@ static int lausb_pre_reset(struct usb_interface *intf)
         struct lausb *dev = usb_get_intfdata(intf);
 
         mutex_lock(&dev->io_mutex);
+        down_write(&dev->write_rwsem);
         lausb_draw_down(dev);
 
         return 0;
@@ -783,6 +869,7 @@ static int lausb_post_reset(struct usb_interface *intf)
 
         /* we are sure no URBs are active - no locking needed */
         dev->errors = -EPIPE;
+        up_write(&dev->write_rwsem);
         mutex_unlock(&dev->io_mutex);
 
         return 0;
@@ -1,126 +1,225 @@
+/*
+ * udev helper: prints /dev/RSH symlink name for RSH USB device.
+ *
+ * usage: device_namer <pid> [serial]
+ *
+ * Name is <symlink_name><index>, index is 0 based and unique per pid.
+ * Devices with serial number always get the same index (assignments are
+ * stored in RSH_NAMER_MAP_FILE). Devices without serial get the lowest
+ * free index. All allocations are done under exclusive file lock, so
+ * devices appearing at once (e.g. hub with many devices) do not race.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
 #include "device_namer.h"
 
-#include <stdio.h>
+#define MAX_SERIAL 64
+#define MAX_ENTRIES 1024
 
-int main (int argc, char *argv[]) {
-	if(argc != 2) {
-		printf("ERROR! Wrong number of arguments!\n");
-		return 1;
+typedef struct {
+	char pid[8];
+	char serial[MAX_SERIAL];
+	int index;
+} map_entry;
+
+static map_entry entries[MAX_ENTRIES];
+static int entries_count = 0;
+
+static const rsh_device_name* find_device(const char *pid)
+{
+	const rsh_device_name *dev;
+
+	for (dev = rsh_device_names; dev->pid != NULL; dev++)
+		if (!strcmp(dev->pid, pid))
+			return dev;
+	return NULL;
+}
+
+/* keep serial safe to store in map file and to compare */
+static void sanitize_serial(const char *in, char *out)
+{
+	int i;
+
+	for (i = 0; in[i] != '\0' && i < MAX_SERIAL - 1; i++) {
+		char c = in[i];
+		if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+		    (c >= 'A' && c <= 'Z') || c == '-' || c == '_' || c == '.')
+			out[i] = c;
+		else
+			out[i] = '_';
 	}
-	if(!strcmp(argv[1], LA20USB_PID)) {	
-		char cmd[100];
-		char output[100];
-		char symlink_name[100];
-		FILE* fp = NULL;
-		sprintf(cmd, "ls %s%s* | wc -l", RSH_DEVICE_DIR, LA20USB_SYMLINK_NAME);
-		fp = popen(cmd, "r");
-		if(fp != NULL) {
-			if(fgets(output, 100, fp) != NULL) {
-				sprintf(symlink_name, "%s%s", LA20USB_SYMLINK_NAME, output);
-				fprintf(stdout, "%s", symlink_name);	
-			}	
-		}
-		pclose(fp);
-		return 0;
+	out[i] = '\0';
+}
+
+static void load_map(void)
+{
+	FILE *fp;
+	map_entry e;
+
+	fp = fopen(RSH_NAMER_MAP_FILE, "r");
+	if (fp == NULL)
+		return;
+
+	while (entries_count < MAX_ENTRIES &&
+	       fscanf(fp, "%7s %63s %d", e.pid, e.serial, &e.index) == 3)
+		entries[entries_count++] = e;
+
+	fclose(fp);
+}
+
+/* write to temporary file and rename, so map is never left half written */
+static int save_map(void)
+{
+	FILE *fp;
+	int i;
+
+	fp = fopen(RSH_NAMER_MAP_FILE ".tmp", "w");
+	if (fp == NULL)
+		return -1;
+
+	for (i = 0; i < entries_count; i++)
+		fprintf(fp, "%s %s %d\n", entries[i].pid, entries[i].serial, entries[i].index);
+
+	if (fflush(fp) != 0 || fsync(fileno(fp)) != 0) {
+		fclose(fp);
+		return -1;
 	}
-	else if(!strcmp(argv[1], LA50USB_PID)) {	
-		char cmd[100];
-		char output[100];
-		char symlink_name[100];
-		FILE* fp = NULL;
-		sprintf(cmd, "ls %s%s* | wc -l", RSH_DEVICE_DIR, LA50USB_SYMLINK_NAME);
-		fp = popen(cmd, "r");
-		if(fp != NULL) {
-			if(fgets(output, 100, fp) != NULL) {
-				sprintf(symlink_name, "%s%s", LA50USB_SYMLINK_NAME, output);
-				fprintf(stdout, "%s", symlink_name);	
-			}	
-		}
-		pclose(fp);
-		return 0;
+	fclose(fp);
+
+	return rename(RSH_NAMER_MAP_FILE ".tmp", RSH_NAMER_MAP_FILE);
+}
+
+static int map_find(const char *pid, const char *serial)
+{
+	int i;
+
+	for (i = 0; i < entries_count; i++)
+		if (!strcmp(entries[i].pid, pid) && !strcmp(entries[i].serial, serial))
+			return entries[i].index;
+	return -1;
+}
+
+static int map_reserved(const char *pid, int index)
+{
+	int i;
+
+	for (i = 0; i < entries_count; i++)
+		if (!strcmp(entries[i].pid, pid) && entries[i].index == index)
+			return 1;
+	return 0;
+}
+
+/* index is used if symlink exists or was recently handed out */
+static int index_in_use(const rsh_device_name *dev, int index)
+{
+	char path[256];
+	struct stat st;
+
+	snprintf(path, sizeof(path), "%s%s%d", RSH_DEVICE_DIR, dev->symlink_name, index);
+	if (lstat(path, &st) == 0)
+		return 1;
+
+	snprintf(path, sizeof(path), "%s%s%d", RSH_NAMER_CLAIM_DIR, dev->symlink_name, index);
+	if (stat(path, &st) == 0 && time(NULL) - st.st_mtime < RSH_NAMER_CLAIM_TIMEOUT)
+		return 1;
+
+	return 0;
+}
+
+/* mark index as handed out until udev creates symlink */
+static void claim_index(const rsh_device_name *dev, int index)
+{
+	char path[256];
+	int fd;
+
+	mkdir(RSH_NAMER_CLAIM_DIR, 0755);
+	snprintf(path, sizeof(path), "%s%s%d", RSH_NAMER_CLAIM_DIR, dev->symlink_name, index);
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd >= 0)
+		close(fd);
+}
+
+/* lowest index not reserved by known serial numbers and not in use */
+static int allocate_index(const rsh_device_name *dev)
+{
+	int index;
+
+	for (index = 0; index < RSH_NAMER_MAX_INDEX; index++) {
+		if (map_reserved(dev->pid, index))
+			continue;
+		if (!index_in_use(dev, index))
+			return index;
 	}
-	else if(!strcmp(argv[1], LA2USB_PID)) {	
-		char cmd[100];
-		char output[100];
-		char symlink_name[100];
-		FILE* fp = NULL;
-		sprintf(cmd, "ls %s%s* | wc -l", RSH_DEVICE_DIR, LA2USB_SYMLINK_NAME);
-		fp = popen(cmd, "r");
-		if(fp != NULL) {
-			if(fgets(output, 100, fp) != NULL) {
-				sprintf(symlink_name, "%s%s", LA2USB_SYMLINK_NAME, output);
-				fprintf(stdout, "%s", symlink_name);	
-			}	
-		}
-		pclose(fp);
-		return 0;
+	return -1;
+}
+
+int main (int argc, char *argv[]) {
+	const rsh_device_name *dev;
+	char serial[MAX_SERIAL];
+	int lock_fd;
+	int index = -1;
+
+	if(argc != 2 && argc != 3) {
+		printf("ERROR! Wrong number of arguments!\n");
+		return 1;
 	}
-		else if(!strcmp(argv[1], SIRIUS_PID)) {	
-		char cmd[100];
-		char output[100];
-		char symlink_name[100];
-		FILE* fp = NULL;
-		sprintf(cmd, "ls %s%s* | wc -l", RSH_DEVICE_DIR, SIRIUS_SYMLINK_NAME);
-		fp = popen(cmd, "r");
-		if(fp != NULL) {
-			if(fgets(output, 100, fp) != NULL) {
-				sprintf(symlink_name, "%s%s", SIRIUS_SYMLINK_NAME, output);
-				fprintf(stdout, "%s", symlink_name);	
-			}	
-		}
-		pclose(fp);
-		return 0;
+
+	dev = find_device(argv[1]);
+	if (dev == NULL) {
+		printf("ERROR! Wrong device PID!");
+		return 2;
 	}
-		else if(!strcmp(argv[1], LAN10_12USB_PID)) {	
-		char cmd[100];
-		char output[100];
-		char symlink_name[100];
-		FILE* fp = NULL;
-		sprintf(cmd, "ls %s%s* | wc -l", RSH_DEVICE_DIR, LAN10_12USB_SYMLINK_NAME);
-		fp = popen(cmd, "r");
-		if(fp != NULL) {
-			if(fgets(output, 100, fp) != NULL) {
-				sprintf(symlink_name, "%s%s", LAN10_12USB_SYMLINK_NAME, output);
-				fprintf(stdout, "%s", symlink_name);	
-			}	
-		}
-		pclose(fp);
-		return 0;
+
+	serial[0] = '\0';
+	if (argc == 3)
+		sanitize_serial(argv[2], serial);
+
+	/* serialize all instances started by udev */
+	mkdir(RSH_NAMER_STATE_DIR, 0755);
+	lock_fd = open(RSH_NAMER_LOCK_FILE, O_RDWR | O_CREAT, 0644);
+	if (lock_fd >= 0) {
+		while (flock(lock_fd, LOCK_EX) != 0 && errno == EINTR)
+			;
+		load_map();
 	}
-		else if(!strcmp(argv[1], LAI24USB_PID)) {	
-		char cmd[100];
-		char output[100];
-		char symlink_name[100];
-		FILE* fp = NULL;
-		sprintf(cmd, "ls %s%s* | wc -l", RSH_DEVICE_DIR, LAI24USB_SYMLINK_NAME);
-		fp = popen(cmd, "r");
-		if(fp != NULL) {
-			if(fgets(output, 100, fp) != NULL) {
-				sprintf(symlink_name, "%s%s", LAI24USB_SYMLINK_NAME, output);
-				fprintf(stdout, "%s", symlink_name);	
-			}	
+
+	if (serial[0] != '\0') {
+		index = map_find(dev->pid, serial);
+		if (index < 0) {
+			index = allocate_index(dev);
+			if (index >= 0 && entries_count < MAX_ENTRIES) {
+				strcpy(entries[entries_count].pid, dev->pid);
+				strcpy(entries[entries_count].serial, serial);
+				entries[entries_count].index = index;
+				entries_count++;
+				if (lock_fd < 0 || save_map() != 0)
+					fprintf(stderr, "device_namer: can't save %s\n", RSH_NAMER_MAP_FILE);
+			}
 		}
-		pclose(fp);
-		return 0;
 	}
-		else if(!strcmp(argv[1], GSPF053USB_PID)) {	
-		char cmd[100];
-		char output[100];
-		char symlink_name[100];
-		FILE* fp = NULL;
-		sprintf(cmd, "ls %s%s* | wc -l", RSH_DEVICE_DIR, GSPF053USB_SYMLINK_NAME);
-		fp = popen(cmd, "r");
-		if(fp != NULL) {
-			if(fgets(output, 100, fp) != NULL) {
-				sprintf(symlink_name, "%s%s", GSPF053USB_SYMLINK_NAME, output);
-				fprintf(stdout, "%s", symlink_name);	
-			}	
-		}
-		pclose(fp);
-		return 0;
+	else
+		index = allocate_index(dev);
+
+	if (index >= 0)
+		claim_index(dev, index);
+
+	if (lock_fd >= 0)
+		close(lock_fd); /* releases lock */
+
+	if (index < 0) {
+		printf("ERROR! No free index for %s!", dev->pid);
+		return 3;
 	}
-		else {
-			printf("ERROR! Wrong device PID!");
-			return 2;
-		}
+
+	fprintf(stdout, "%s%d\n", dev->symlink_name, index);
+	return 0;
 }
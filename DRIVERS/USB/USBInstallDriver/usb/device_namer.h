@@ -3,6 +3,18 @@
 
 #define RSH_DEVICE_DIR "/dev/RSH/"
 
+/* serial number -> index assignments, kept between reboots */
+#define RSH_NAMER_STATE_DIR "/var/lib/rsh/"
+#define RSH_NAMER_MAP_FILE RSH_NAMER_STATE_DIR "device_namer.map"
+#define RSH_NAMER_LOCK_FILE RSH_NAMER_STATE_DIR "device_namer.lock"
+
+/* claims of devices without serial number, cleared on reboot */
+#define RSH_NAMER_CLAIM_DIR "/run/rsh_device_namer/"
+/* claim is considered stale if udev did not create symlink during this time */
+#define RSH_NAMER_CLAIM_TIMEOUT 30
+
+#define RSH_NAMER_MAX_INDEX 256
+
 #define SIRIUS_PID "c389"
 #define SIRIUS_SYMLINK_NAME "c389534b"
 
@@ -24,4 +36,21 @@
 #define GSPF053USB_PID "c35f"
 #define GSPF053USB_SYMLINK_NAME "c35f534b"
 
+/* supported devices */
+typedef struct {
+	const char *pid;
+	const char *symlink_name;
+} rsh_device_name;
+
+static const rsh_device_name rsh_device_names[] = {
+	{ SIRIUS_PID,      SIRIUS_SYMLINK_NAME      },
+	{ LA20USB_PID,     LA20USB_SYMLINK_NAME     },
+	{ LA2USB_PID,      LA2USB_SYMLINK_NAME      },
+	{ LA50USB_PID,     LA50USB_SYMLINK_NAME     },
+	{ LAN10_12USB_PID, LAN10_12USB_SYMLINK_NAME },
+	{ LAI24USB_PID,    LAI24USB_SYMLINK_NAME    },
+	{ GSPF053USB_PID,  GSPF053USB_SYMLINK_NAME  },
+	{ NULL,            NULL                     }  /* Terminating entry */
+};
+
 #endif
@@ -33,6 +33,9 @@
 #include "RshSynchroChannel.cpp"
 #include "RshDeviceKey.cpp"
 #include "RshTime.cpp"
+#include "RshLinkStatistics.cpp"
+#include "RshBlockInfo.cpp"
+#include "RshDeviceMetrics.cpp"
 
 //Init structures
 #include "RshInitADC.cpp"
@@ -48,7 +51,30 @@
 #include "RshDllInterfaceKey.cpp"
 #include "RshDllClient.cpp"
 #include "RshError.cpp"
+#include "RshRandom.cpp"
 #include "RshFunctions.cpp"
+#include "RshThread.cpp"
+#include "RshPlxPerformance.cpp"
+#include "RshLinkStatisticsSampler.cpp"
+#include "RshDeviceEnumerator.cpp"
+#include "RshWaveformGenerator.cpp"
+#include "RshGspfStreamer.cpp"
+#include "RshSpectrumAnalyzer.cpp"
+#include "RshStatistics.cpp"
+#include "RshSoftwareTrigger.cpp"
+#include "RshDecimator.cpp"
+#include "RshDeviceGroup.cpp"
+#include "RshCompressor.cpp"
+#include "RshSimulator.cpp"
+#include "RshHistogram.cpp"
+#include "RshMonitoredDevice.cpp"
+#include "RshTrace.cpp"
+#include "RshMappedFile.cpp"
+#include "RshRecordingDevice.cpp"
+#include "RshReplayDevice.cpp"
+#include "RshInitSerializer.cpp"
+#include "RshIncrementalDevice.cpp"
+#include "RshCapsSnapshot.cpp"
 
 //Internal RSH API files
 #if defined (RSH_DEVICE_BUFFER_H)
@@ -31,9 +31,30 @@
 #include "RshConsts.h"
 
 #include "RshFunctions.h"
+#include "RshRandom.h"
 #include "IRshFactory.h"
 #include "IRshDevice.h"
 #include "RshDllClient.h"
+#include "RshLinkStatisticsSampler.h"
+#include "RshDeviceEnumerator.h"
+#include "RshWaveformGenerator.h"
+#include "RshGspfStreamer.h"
+#include "RshSpectrumAnalyzer.h"
+#include "RshStatistics.h"
+#include "RshSoftwareTrigger.h"
+#include "RshDecimator.h"
+#include "RshDeviceGroup.h"
+#include "RshCompressor.h"
+#include "RshSimulator.h"
+#include "RshHistogram.h"
+#include "RshMonitoredDevice.h"
+#include "RshTrace.h"
+#include "RshMappedFile.h"
+#include "RshRecordingDevice.h"
+#include "RshReplayDevice.h"
+#include "RshInitSerializer.h"
+#include "RshIncrementalDevice.h"
+#include "RshCapsSnapshot.h"
 #include "RshError.h"
 
 #endif //RSH_API_H
\ No newline at end of file
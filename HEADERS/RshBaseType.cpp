@@ -134,6 +134,9 @@ const char* RshBaseType::GetTypeName(const RshDataTypes typeCode)
 		case rshCalibrationItemButton: return "RshCalibrationItemButton";
 		case rshCalibrationItemFilePath: return "RshCalibrationItemFilePath";
 		case rshCalibrationItemRegOffset: return "RshCalibrationItemRegOffset";
+		case rshLinkStatistics: return "RshLinkStatistics";
+		case rshBlockInfo: return "RshBlockInfo";
+		case rshDeviceMetrics: return "RshDeviceMetrics";
 		case rshBoardInfoDMA: return "RshBoardInfoDMA";
 		case rshBoardInfoMemory: return "RshBoardInfoMemory";
 		case rshBoardInfoDAC: return "RshBoardInfoDAC";
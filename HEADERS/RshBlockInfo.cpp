@@ -0,0 +1,66 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshBlockInfo.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshBlockInfo class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshBlockInfo.
+ *
+ */
+
+#include "RshBlockInfo.h"
+
+RshBlockInfo::RshBlockInfo() :
+	RshBaseType(rshBlockInfo, sizeof (RshBlockInfo)),
+	sequence(0),
+	timestamp(0),
+	size(0)
+{ }
+
+RshBlockInfo::RshBlockInfo(const RshBlockInfo& obj) :
+	RshBaseType(rshBlockInfo, sizeof (RshBlockInfo))
+{
+	this->sequence = obj.sequence;
+	this->timestamp = obj.timestamp;
+	this->size = obj.size;
+}
+
+RshBlockInfo& RshBlockInfo::operator=(const RshBlockInfo& obj)
+{
+	if(this == &obj)
+		return *this;
+
+	this->sequence = obj.sequence;
+	this->timestamp = obj.timestamp;
+	this->size = obj.size;
+	return *this;
+}
+
+bool RshBlockInfo::operator==(const RshBlockInfo& obj) const
+{
+	return sequence == obj.sequence &&
+		timestamp == obj.timestamp &&
+		size == obj.size;
+}
+
+bool RshBlockInfo::operator!=(const RshBlockInfo& obj) const
+{
+	return !( operator==(obj) );
+}
+
+RshTimestamp RshBlockInfo::Completed() const
+{
+	return RshTimestamp(timestamp);
+}
+
+std::ostream& operator<< (std::ostream &out, const RshBlockInfo& obj)
+{
+	return out << "[sequence=" << obj.sequence << "; timestamp=" << obj.timestamp << "ns; size=" << obj.size << "]";
+}
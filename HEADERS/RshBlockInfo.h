@@ -0,0 +1,83 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshBlockInfo.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshBlockInfo class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshBlockInfo.
+ *
+ */
+
+#ifndef RSH_BLOCK_INFO_H
+#define RSH_BLOCK_INFO_H
+
+#include "RshBaseType.h"
+#include "RshTime.h"
+
+#include <ostream>
+
+#pragma pack(push, 8)
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Completion info of acquired data block.
+ *
+ * Kernel driver records time and sequence number when
+ * DMA transfer (PCI devices) or bulk transfer (USB devices)
+ * of block is completed. This info for the block last
+ * returned by IRshDevice::GetData() can be obtained
+ * using ::RSH_GET_BUFFER_BLOCK_INFO.\n
+ * Gap in sequence numbers means that some blocks were
+ * completed by driver, but not transferred to user.
+ *
+ * \see
+ * RSH_GET_BUFFER_BLOCK_INFO
+ *
+ * \~russian
+ * \brief
+ * Информация о завершении передачи блока данных.
+ *
+ * Драйвер устройства сохраняет время и порядковый номер
+ * в момент завершения передачи блока по DMA (PCI устройства)
+ * или по USB. Эту информацию для блока, последним полученного
+ * методом IRshDevice::GetData(), можно получить с помощью ::RSH_GET_BUFFER_BLOCK_INFO.\n
+ * Пропуск в порядковых номерах означает, что часть блоков
+ * была получена драйвером, но не передана пользователю.
+ *
+ * \see
+ * RSH_GET_BUFFER_BLOCK_INFO
+ *
+ */
+struct RshBlockInfo : public RshBaseType {
+
+	//! Driver sequence number of completed transfer, starting from 1. 0 if not available.
+	U64 sequence;
+	//! CLOCK_MONOTONIC_RAW (Linux) time of transfer completion in ns. 0 if not available.
+	U64 timestamp;
+	//! Block size in bytes
+	U32 size;
+
+	RshBlockInfo();
+	RshBlockInfo(const RshBlockInfo& obj);
+	RshBlockInfo& operator=(const RshBlockInfo& obj);
+	bool operator==(const RshBlockInfo& obj) const;
+	bool operator!=(const RshBlockInfo& obj) const;
+
+	//! Transfer completion time, latency of block is RshTimestamp::Now() - Completed()
+	RshTimestamp Completed() const;
+
+	friend std::ostream& operator<< (std::ostream &out, const RshBlockInfo& obj);
+};
+
+#pragma pack(pop)
+
+#endif //RSH_BLOCK_INFO_H
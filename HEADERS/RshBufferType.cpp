@@ -17,6 +17,7 @@
  
 #include "RshBufferType.h"
 #include "RshConsts_StatusCodes.h"
+#include "RshTrace.h"
 
 #include <list>
 #include <limits>
@@ -336,6 +337,7 @@ template <typename T, RshDataTypes dataCode>
 template <typename T, RshDataTypes dataCode>
 	U32 RshBufferType<T, dataCode>::ReadFromFile(const char* fileName, size_t elements)
 	{
+		RSH_TRACE_SCOPE("file", "ReadFromFile");
 		std::ifstream fileStream;
 
 		fileStream.open(fileName, std::fstream::in| std::fstream::binary);
@@ -397,6 +399,7 @@ template <typename T, RshDataTypes dataCode>
 template <typename T, RshDataTypes dataCode>
 	U32 RshBufferType<T, dataCode>::WriteToFile(const char* fileName, size_t elements) const
 	{
+		RSH_TRACE_SCOPE("file", "WriteToFile");
 	
 		size_t elementsToWrite = 0;
 		if(elements == 0)
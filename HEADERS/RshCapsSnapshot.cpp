@@ -0,0 +1,536 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshCapsSnapshot.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshCapsSnapshot class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshCapsSnapshot.
+ *
+ */
+
+#include "RshCapsSnapshot.h"
+#include "RshConsts.h"
+#include "RshScalarType.h"
+#include "RshBufferType.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#define RSH_CAPS_SNAPSHOT_MAGIC "RSHCAPS"
+
+// constant properties of device model and their data types
+static const struct
+{
+	U32 mode;
+	U32 type;
+} rshCapsSnapshotQueries[] =
+{
+	{ RSH_GET_DEVICE_PID, rshU32 },
+	{ RSH_GET_DEVICE_VID, rshU32 },
+	{ RSH_GET_DEVICE_NAME_VERBOSE, rshS8P },
+	{ RSH_GET_DEVICE_MIN_FREQUENCY, rshDouble },
+	{ RSH_GET_DEVICE_MAX_FREQUENCY, rshDouble },
+	{ RSH_GET_DEVICE_MIN_AMP_LSB, rshS32 },
+	{ RSH_GET_DEVICE_MAX_AMP_LSB, rshS32 },
+	{ RSH_GET_DEVICE_FREQUENCY_LIST, rshBufferTypeDouble },
+	{ RSH_GET_DEVICE_DATA_SIZE_BYTES, rshU32 },
+	{ RSH_GET_DEVICE_DATA_BITS, rshU32 },
+	{ RSH_GET_DEVICE_NUMBER_CHANNELS, rshU32 },
+	{ RSH_GET_DEVICE_NUMBER_CHANNELS_BASE, rshU32 },
+	{ RSH_GET_DEVICE_GAIN_LIST, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_GAIN_LIST_50_OHM, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_GAIN_LIST_1_MOHM, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_MEMORY_SIZE, rshU32 },
+	{ RSH_GET_DEVICE_SIZE_LIST, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_SIZE_LIST_SINGLE, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_SIZE_LIST_DOUBLE, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_SIZE_LIST_QUADRO, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_PACKET_LIST, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_INPUT_RANGE_VOLTS, rshDouble },
+	{ RSH_GET_DEVICE_OUTPUT_RANGE_VOLTS, rshDouble },
+	{ RSH_GET_DEVICE_EXT_SYNC_GAINLIST, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_EXT_SYNC_GAIN_LIST_50_OHM, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_EXT_SYNC_GAIN_LIST_1_MOHM, rshBufferTypeU32 },
+	{ RSH_GET_DEVICE_EXT_SYNC_INPUT_RANGE_VOLTS, rshDouble },
+	{ RSH_GET_DEVICE_SERIAL_NUMBER, rshU32 },
+	{ RSH_GET_DEVICE_PREHISTORY_SIZE, rshU32 },
+	{ RSH_GET_DEVICE_MIN_SAMPLES_PER_CHANNEL, rshU32 },
+	{ RSH_GET_DEVICE_MAX_SAMPLES_PER_CHANNEL, rshU32 }
+};
+
+// file starts with this header, followed by table of entries,
+// name, library version, U32 values and double values
+struct RshCapsSnapshotFileHeader
+{
+	char magic[8];
+	U32 version;
+	U32 headerSize;
+	U32 entrySize;
+	U32 notCapable;
+	U32 nameSize;
+	U32 libraryVersionSize;
+	U32 words;
+	U32 doubles;
+	U32 caps[RSH_CAPS_MAX / 32];
+};
+
+// device name as part of file name
+static std::string RshCapsSnapshotFileName(const std::string& name)
+{
+	std::string result;
+	for(size_t i = 0; i < name.size(); ++i)
+	{
+		const char c = name[i];
+		const bool allowed = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-';
+		result += allowed ? c : '_';
+	}
+	return result.empty() ? std::string("device") : result;
+}
+
+// data type of query cached in entry with this index, 0 if there is no such query
+static U32 RshCapsSnapshotType(U32 index)
+{
+	for(size_t i = 0; i < sizeof(rshCapsSnapshotQueries) / sizeof(rshCapsSnapshotQueries[0]); ++i)
+		if((rshCapsSnapshotQueries[i].mode & 0xFFFF) == index)
+			return rshCapsSnapshotQueries[i].type;
+	return 0;
+}
+
+RshCapsSnapshot::RshCapsSnapshot()
+{
+	Clear();
+}
+
+U32 RshCapsSnapshot::Probe(IRshDevice* device)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	Clear();
+
+	bool notCapable = false;
+	for(U32 caps = 0; caps < RSH_CAPS_MAX; ++caps)
+	{
+		RSH_U32 code(caps);
+		const U32 st = device->Get(RSH_GET_DEVICE_IS_CAPABLE, &code);
+		if(st == RSH_API_SUCCESS)
+		{
+			m_caps[caps >> 5] |= 1U << (caps & 31);
+		}
+		else if(!notCapable)
+		{
+			m_notCapable = st;
+			notCapable = true;
+		}
+	}
+
+	for(size_t i = 0; i < sizeof(rshCapsSnapshotQueries) / sizeof(rshCapsSnapshotQueries[0]); ++i)
+	{
+		const U32 mode = rshCapsSnapshotQueries[i].mode;
+		Entry& entry = m_entries[mode & 0xFFFF];
+		entry.type = rshCapsSnapshotQueries[i].type;
+
+		switch(entry.type)
+		{
+		case rshU32:
+			{
+				RSH_U32 value;
+				entry.status = device->Get(mode, &value);
+				if(entry.status == RSH_API_SUCCESS)
+				{
+					entry.offset = static_cast<U32>(m_words.size());
+					entry.count = 1;
+					m_words.push_back(value.data);
+				}
+			}
+			break;
+		case rshS32:
+			{
+				RSH_S32 value;
+				entry.status = device->Get(mode, &value);
+				if(entry.status == RSH_API_SUCCESS)
+				{
+					entry.offset = static_cast<U32>(m_words.size());
+					entry.count = 1;
+					m_words.push_back(static_cast<U32>(value.data));
+				}
+			}
+			break;
+		case rshDouble:
+			{
+				RSH_DOUBLE value;
+				entry.status = device->Get(mode, &value);
+				if(entry.status == RSH_API_SUCCESS)
+				{
+					entry.offset = static_cast<U32>(m_doubles.size());
+					entry.count = 1;
+					m_doubles.push_back(value.data);
+				}
+			}
+			break;
+		case rshBufferTypeU32:
+			{
+				RSH_BUFFER_U32 value;
+				entry.status = device->Get(mode, &value);
+				if(entry.status == RSH_API_SUCCESS)
+				{
+					entry.offset = static_cast<U32>(m_words.size());
+					entry.count = static_cast<U32>(value.Size());
+					m_words.insert(m_words.end(), value.ptr, value.ptr + value.Size());
+				}
+			}
+			break;
+		case rshBufferTypeDouble:
+			{
+				RSH_BUFFER_DOUBLE value;
+				entry.status = device->Get(mode, &value);
+				if(entry.status == RSH_API_SUCCESS)
+				{
+					entry.offset = static_cast<U32>(m_doubles.size());
+					entry.count = static_cast<U32>(value.Size());
+					m_doubles.insert(m_doubles.end(), value.ptr, value.ptr + value.Size());
+				}
+			}
+			break;
+		case rshS8P:
+			{
+				RSH_S8P value(0);
+				entry.status = device->Get(mode, &value);
+				if(entry.status == RSH_API_SUCCESS && value.data != 0)
+					m_name = reinterpret_cast<const char*>(value.data);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	m_libraryVersion = Text(device, RSH_GET_LIBRARY_VERSION_STR);
+	m_empty = false;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshCapsSnapshot::Acquire(IRshDevice* device, const char* directory)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(directory == 0 || *directory == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+
+	// these three queries identify snapshot, everything else is in file
+	const std::string name = Text(device, RSH_GET_DEVICE_NAME_VERBOSE);
+	const std::string version = Text(device, RSH_GET_LIBRARY_VERSION_STR);
+	RSH_U32 serial(0);
+	if(device->Get(RSH_GET_DEVICE_SERIAL_NUMBER, &serial) != RSH_API_SUCCESS)
+		serial.data = 0;
+
+	char suffix[32];
+	sprintf(suffix, "_%u.rshcaps", static_cast<unsigned int>(serial.data));
+	std::string fileName(directory);
+	const char last = fileName[fileName.size() - 1];
+	if(last != '/' && last != '\\')
+		fileName += '/';
+	fileName += RshCapsSnapshotFileName(name) + suffix;
+
+	if(Load(fileName.c_str()) == RSH_API_SUCCESS && m_name == name && Serial() == serial.data && m_libraryVersion == version)
+		return RSH_API_SUCCESS;
+
+	const U32 st = Probe(device);
+	if(st != RSH_API_SUCCESS)
+		return st;
+	Save(fileName.c_str());
+	return RSH_API_SUCCESS;
+}
+
+U32 RshCapsSnapshot::Save(const char* fileName) const
+{
+	if(fileName == 0 || *fileName == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+	if(m_empty)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+
+	RshCapsSnapshotFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, RSH_CAPS_SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = RSH_CAPS_SNAPSHOT_VERSION;
+	header.headerSize = sizeof(header);
+	header.entrySize = sizeof(Entry);
+	header.notCapable = m_notCapable;
+	header.nameSize = static_cast<U32>(m_name.size());
+	header.libraryVersionSize = static_cast<U32>(m_libraryVersion.size());
+	header.words = static_cast<U32>(m_words.size());
+	header.doubles = static_cast<U32>(m_doubles.size());
+	memcpy(header.caps, m_caps, sizeof(header.caps));
+
+	const std::string name(fileName);
+	const std::string temporary = name + ".tmp";
+	{
+		std::ofstream file(temporary.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!file.is_open())
+			return RSH_API_FILE_CANTCREATE;
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(m_entries), sizeof(m_entries));
+		file.write(m_name.data(), m_name.size());
+		file.write(m_libraryVersion.data(), m_libraryVersion.size());
+		if(!m_words.empty())
+			file.write(reinterpret_cast<const char*>(&m_words[0]), m_words.size() * sizeof(U32));
+		if(!m_doubles.empty())
+			file.write(reinterpret_cast<const char*>(&m_doubles[0]), m_doubles.size() * sizeof(double));
+		file.close();
+		if(file.fail())
+		{
+			remove(temporary.c_str());
+			return RSH_API_FILE_CANTWRITE;
+		}
+	}
+
+#if defined(RSH_MSWINDOWS)
+	// rename does not replace existing file
+	remove(name.c_str());
+#endif
+	if(rename(temporary.c_str(), name.c_str()) != 0)
+	{
+		remove(temporary.c_str());
+		return RSH_API_FILE_CANTWRITE;
+	}
+	return RSH_API_SUCCESS;
+}
+
+U32 RshCapsSnapshot::Load(const char* fileName)
+{
+	Clear();
+
+	if(fileName == 0 || *fileName == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+
+	std::ifstream file(fileName, std::ios::in | std::ios::binary);
+	if(!file.is_open())
+		return RSH_API_FILE_CANTOPEN;
+
+	file.seekg(0, std::ios::end);
+	const U64 fileSize = static_cast<U64>(file.tellg());
+	file.seekg(0, std::ios::beg);
+
+	RshCapsSnapshotFileHeader header;
+	if(fileSize < sizeof(header) || !file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		return RSH_API_FILE_CANTREAD;
+	if(memcmp(header.magic, RSH_CAPS_SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 ||
+		header.version != RSH_CAPS_SNAPSHOT_VERSION || header.headerSize != sizeof(header) ||
+		header.entrySize != sizeof(Entry))
+		return RSH_API_FILE_CANTREAD;
+
+	const U64 expected = static_cast<U64>(sizeof(header)) + sizeof(m_entries) + header.nameSize +
+		header.libraryVersionSize + static_cast<U64>(header.words) * sizeof(U32) + static_cast<U64>(header.doubles) * sizeof(double);
+	if(expected != fileSize)
+		return RSH_API_FILE_CANTREAD;
+
+	m_name.resize(header.nameSize);
+	m_libraryVersion.resize(header.libraryVersionSize);
+	m_words.resize(header.words);
+	m_doubles.resize(header.doubles);
+	file.read(reinterpret_cast<char*>(m_entries), sizeof(m_entries));
+	if(!m_name.empty())
+		file.read(&m_name[0], m_name.size());
+	if(!m_libraryVersion.empty())
+		file.read(&m_libraryVersion[0], m_libraryVersion.size());
+	if(!m_words.empty())
+		file.read(reinterpret_cast<char*>(&m_words[0]), m_words.size() * sizeof(U32));
+	if(!m_doubles.empty())
+		file.read(reinterpret_cast<char*>(&m_doubles[0]), m_doubles.size() * sizeof(double));
+	if(!file)
+	{
+		Clear();
+		return RSH_API_FILE_CANTREAD;
+	}
+
+	// each entry must have type of its query, values must be inside loaded tables
+	for(U32 i = 0; i < RSH_CAPS_SNAPSHOT_ENTRIES; ++i)
+	{
+		const Entry& entry = m_entries[i];
+		if(entry.type == 0)
+			continue;
+		if(entry.type != RshCapsSnapshotType(i))
+		{
+			Clear();
+			return RSH_API_FILE_CANTREAD;
+		}
+		size_t size = 0;
+		bool scalar = false;
+		switch(entry.type)
+		{
+		case rshS8P:
+			continue;
+		case rshU32:
+		case rshS32:
+			scalar = true;
+			size = m_words.size();
+			break;
+		case rshBufferTypeU32:
+			size = m_words.size();
+			break;
+		case rshDouble:
+			scalar = true;
+			size = m_doubles.size();
+			break;
+		case rshBufferTypeDouble:
+			size = m_doubles.size();
+			break;
+		}
+		if(entry.status == RSH_API_SUCCESS && (entry.offset > size || entry.count > size - entry.offset || (scalar && entry.count != 1)))
+		{
+			Clear();
+			return RSH_API_FILE_CANTREAD;
+		}
+	}
+
+	memcpy(m_caps, header.caps, sizeof(m_caps));
+	m_notCapable = header.notCapable;
+	m_empty = false;
+	return RSH_API_SUCCESS;
+}
+
+bool RshCapsSnapshot::IsEmpty() const
+{
+	return m_empty;
+}
+
+bool RshCapsSnapshot::IsCapable(U32 caps) const
+{
+	return caps < RSH_CAPS_MAX && ((m_caps[caps >> 5] >> (caps & 31)) & 1) != 0;
+}
+
+bool RshCapsSnapshot::IsCached(U32 mode)
+{
+	for(size_t i = 0; i < sizeof(rshCapsSnapshotQueries) / sizeof(rshCapsSnapshotQueries[0]); ++i)
+		if(rshCapsSnapshotQueries[i].mode == mode)
+			return true;
+	return false;
+}
+
+U32 RshCapsSnapshot::Get(U32 mode, RshBaseType* adr) const
+{
+	if(m_empty)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+
+	if(mode == RSH_GET_DEVICE_IS_CAPABLE)
+	{
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshU32)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		return IsCapable(static_cast<RSH_U32*>(adr)->data) ? static_cast<U32>(RSH_API_SUCCESS) : m_notCapable;
+	}
+
+	const Entry* entry = Find(mode);
+	if(entry == 0)
+		return RSH_API_PARAMETER_INVALID;
+	if(entry->status != RSH_API_SUCCESS)
+		return entry->status;
+	if(adr == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(adr->_type != entry->type)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	switch(entry->type)
+	{
+	case rshU32:
+		static_cast<RSH_U32*>(adr)->data = m_words[entry->offset];
+		break;
+	case rshS32:
+		static_cast<RSH_S32*>(adr)->data = static_cast<S32>(m_words[entry->offset]);
+		break;
+	case rshDouble:
+		static_cast<RSH_DOUBLE*>(adr)->data = m_doubles[entry->offset];
+		break;
+	case rshBufferTypeU32:
+		{
+			RSH_BUFFER_U32& list = *static_cast<RSH_BUFFER_U32*>(adr);
+			if(list.PSize() < entry->count)
+			{
+				const U32 st = list.Allocate(entry->count);
+				if(st != RSH_API_SUCCESS)
+					return st;
+			}
+			list.SetSize(entry->count);
+			if(entry->count != 0)
+				memcpy(list.ptr, &m_words[entry->offset], entry->count * sizeof(U32));
+		}
+		break;
+	case rshBufferTypeDouble:
+		{
+			RSH_BUFFER_DOUBLE& list = *static_cast<RSH_BUFFER_DOUBLE*>(adr);
+			if(list.PSize() < entry->count)
+			{
+				const U32 st = list.Allocate(entry->count);
+				if(st != RSH_API_SUCCESS)
+					return st;
+			}
+			list.SetSize(entry->count);
+			if(entry->count != 0)
+				memcpy(list.ptr, &m_doubles[entry->offset], entry->count * sizeof(double));
+		}
+		break;
+	case rshS8P:
+		static_cast<RSH_S8P*>(adr)->data = reinterpret_cast<S8*>(const_cast<char*>(m_name.c_str()));
+		break;
+	default:
+		return RSH_API_PARAMETER_INVALID;
+	}
+	return RSH_API_SUCCESS;
+}
+
+const std::string& RshCapsSnapshot::Name() const
+{
+	return m_name;
+}
+
+U32 RshCapsSnapshot::Serial() const
+{
+	const Entry* entry = Find(RSH_GET_DEVICE_SERIAL_NUMBER);
+	if(m_empty || entry == 0 || entry->status != RSH_API_SUCCESS)
+		return 0;
+	return m_words[entry->offset];
+}
+
+const std::string& RshCapsSnapshot::LibraryVersion() const
+{
+	return m_libraryVersion;
+}
+
+void RshCapsSnapshot::Clear()
+{
+	m_empty = true;
+	memset(m_caps, 0, sizeof(m_caps));
+	m_notCapable = RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+	memset(m_entries, 0, sizeof(m_entries));
+	m_words.clear();
+	m_doubles.clear();
+	m_name.clear();
+	m_libraryVersion.clear();
+}
+
+const RshCapsSnapshot::Entry* RshCapsSnapshot::Find(U32 mode) const
+{
+	// all cached codes are in device group, low part is index of entry
+	if((mode & 0xFFFF0000) != _RSH_GROUP_GET_DEVICE(0) || (mode & 0xFFFF) >= RSH_CAPS_SNAPSHOT_ENTRIES)
+		return 0;
+	const Entry& entry = m_entries[mode & 0xFFFF];
+	return (entry.type != 0) ? &entry : 0;
+}
+
+std::string RshCapsSnapshot::Text(IRshDevice* device, U32 mode)
+{
+	RSH_S8P value(0);
+	if(device->Get(mode, &value) != RSH_API_SUCCESS || value.data == 0)
+		return std::string();
+	return std::string(reinterpret_cast<const char*>(value.data));
+}
@@ -0,0 +1,283 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshCapsSnapshot.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshCapsSnapshot class.
+ *
+ * Cached capabilities and parameter lists of device.
+ *
+ * \~russian
+ * \brief
+ * Класс RshCapsSnapshot.
+ *
+ * Кэш возможностей и списков параметров устройства.
+ *
+ */
+
+#ifndef RSH_CAPS_SNAPSHOT_H
+#define RSH_CAPS_SNAPSHOT_H
+
+#include "RshDefChk.h"
+#include "RshBaseType.h"
+#include "RshConsts_CapsCodes.h"
+#include "IRshDevice.h"
+
+#include <string>
+#include <vector>
+
+//! Version of file written by RshCapsSnapshot::Save()
+#define RSH_CAPS_SNAPSHOT_VERSION 1
+
+//! Number of codes of device Get group which can be cached
+#define RSH_CAPS_SNAPSHOT_ENTRIES 64
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Snapshot of device capabilities and parameter lists
+ *
+ * Probe() asks device once for all ::RSH_CAPS codes and for constant
+ * properties of device model: lists of gains, sample rates, buffer
+ * sizes and packets, input and output ranges, resolution, number of
+ * channels, name and serial number. After that IsCapable() is one bit
+ * test and Get() answers these queries from flat table, with the same
+ * data types and status codes as device, without calls to device
+ * library. Unsupported queries are cached too.\n
+ * Snapshot is saved to file, and Acquire() loads it on next start of
+ * application instead of probing, when device name, serial number and
+ * library version are the same.
+ *
+ * \remarks
+ * Values which depend on initialization (for example
+ * ::RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER) are not cached, see
+ * IsCached(). File is written in byte order of computer, as cache
+ * for the same computer.
+ *
+ * \~russian
+ * \brief
+ * Снимок возможностей и списков параметров устройства
+ *
+ * Probe() один раз запрашивает у устройства все коды ::RSH_CAPS и
+ * постоянные свойства модели устройства: списки коэффициентов усиления,
+ * частот дискретизации, размеров буфера и пакетов, входной и выходной
+ * диапазоны, разрядность, число каналов, название и заводской номер.
+ * После этого IsCapable() - проверка одного бита, а Get() отвечает на
+ * эти запросы из плоской таблицы, с теми же типами данных и кодами
+ * возврата, что и устройство, без обращения к библиотеке абстракции.
+ * Неподдерживаемые запросы также кэшируются.\n
+ * Снимок сохраняется в файл, и Acquire() при следующем запуске
+ * приложения загружает его вместо опроса, если название устройства,
+ * заводской номер и версия библиотеки совпадают.
+ *
+ * \remarks
+ * Значения, зависящие от инициализации (например,
+ * ::RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER), не кэшируются, см.
+ * IsCached(). Файл записывается в порядке байт компьютера, как кэш
+ * для того же компьютера.
+ *
+ */
+class RshCapsSnapshot
+{
+public:
+
+	RshCapsSnapshot();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Fill snapshot by queries to device
+	 *
+	 * \param[in] device Connected device.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_PARAMETER_ZEROADDRESS.
+	 *
+	 * \~russian
+	 * \brief
+	 * Заполнение снимка запросами к устройству
+	 *
+	 * \param[in] device Подключенное устройство.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_PARAMETER_ZEROADDRESS.
+	 *
+	 */
+	U32 Probe(IRshDevice* device);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Load snapshot of device from directory, or probe and save it
+	 *
+	 * File name is made of device name and serial number. Snapshot is
+	 * probed again if file is missing, damaged or was written for
+	 * other library version.
+	 *
+	 * \param[in] device Connected device.
+	 * \param[in] directory Directory of snapshot files.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or error of Probe(). Error of Save() is not
+	 * returned, snapshot is usable anyway.
+	 *
+	 * \~russian
+	 * \brief
+	 * Загрузка снимка устройства из каталога или опрос и сохранение
+	 *
+	 * Имя файла составляется из названия устройства и заводского номера.
+	 * Снимок запрашивается заново, если файла нет, он поврежден или
+	 * записан для другой версии библиотеки.
+	 *
+	 * \param[in] device Подключенное устройство.
+	 * \param[in] directory Каталог файлов снимков.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ошибка Probe(). Ошибка Save() не
+	 * возвращается, снимок в любом случае можно использовать.
+	 *
+	 */
+	U32 Acquire(IRshDevice* device, const char* directory);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Save snapshot to file
+	 *
+	 * File is replaced atomically, so other process loading it at the
+	 * same time never sees partially written file.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_DEVICE_NOTINITIALIZED if snapshot is
+	 * empty, ::RSH_API_FILE_CANTCREATE or ::RSH_API_FILE_CANTWRITE.
+	 *
+	 * \~russian
+	 * \brief
+	 * Сохранение снимка в файл
+	 *
+	 * Файл заменяется атомарно, поэтому другой процесс, загружающий его
+	 * в это же время, никогда не видит частично записанный файл.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_DEVICE_NOTINITIALIZED, если снимок
+	 * пуст, ::RSH_API_FILE_CANTCREATE или ::RSH_API_FILE_CANTWRITE.
+	 *
+	 */
+	U32 Save(const char* fileName) const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Load snapshot from file
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_FILE_CANTOPEN or
+	 * ::RSH_API_FILE_CANTREAD if file is not valid snapshot.
+	 * On error snapshot is empty.
+	 *
+	 * \~russian
+	 * \brief
+	 * Загрузка снимка из файла
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_FILE_CANTOPEN или
+	 * ::RSH_API_FILE_CANTREAD, если файл не является снимком.
+	 * При ошибке снимок пуст.
+	 *
+	 */
+	U32 Load(const char* fileName);
+
+	//! True until Probe() or Load() succeeds
+	bool IsEmpty() const;
+
+	//! True if device has capability (one of ::RSH_CAPS codes)
+	bool IsCapable(U32 caps) const;
+
+	//! True if Get() answers query with this code
+	static bool IsCached(U32 mode);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Answer query from snapshot
+	 *
+	 * Same as IRshDevice::Get() of device for ::RSH_GET_DEVICE_IS_CAPABLE
+	 * and codes for which IsCached() is true. Lists are copied to
+	 * buffer, which is allocated if it is too small. String of
+	 * ::RSH_GET_DEVICE_NAME_VERBOSE is valid while snapshot exists.
+	 *
+	 * \return
+	 * Status returned by device, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED,
+	 * ::RSH_API_DEVICE_NOTINITIALIZED if snapshot is empty or
+	 * ::RSH_API_PARAMETER_INVALID if query is not cached.
+	 *
+	 * \~russian
+	 * \brief
+	 * Ответ на запрос из снимка
+	 *
+	 * То же, что IRshDevice::Get() устройства, для
+	 * ::RSH_GET_DEVICE_IS_CAPABLE и кодов, для которых IsCached()
+	 * истинно. Списки копируются в буфер, который выделяется, если он
+	 * слишком мал. Строка ::RSH_GET_DEVICE_NAME_VERBOSE действительна,
+	 * пока существует снимок.
+	 *
+	 * \return
+	 * Код, возвращенный устройством, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED,
+	 * ::RSH_API_DEVICE_NOTINITIALIZED, если снимок пуст, или
+	 * ::RSH_API_PARAMETER_INVALID, если запрос не кэшируется.
+	 *
+	 */
+	U32 Get(U32 mode, RshBaseType* adr) const;
+
+	//! Device name, empty if device did not return it
+	const std::string& Name() const;
+
+	//! Device serial number, 0 if device did not return it
+	U32 Serial() const;
+
+	//! Library version, empty if library did not return it
+	const std::string& LibraryVersion() const;
+
+private:
+
+	//! Cached answer to one query
+	struct Entry
+	{
+		//! Data type, 0 if query is not cached
+		U32 type;
+		//! Status returned by device
+		U32 status;
+		//! First value in m_words or m_doubles
+		U32 offset;
+		//! Number of values
+		U32 count;
+	};
+
+	void Clear();
+	const Entry* Find(U32 mode) const;
+	static std::string Text(IRshDevice* device, U32 mode);
+
+	bool m_empty;
+	U32 m_caps[RSH_CAPS_MAX / 32];
+	//! Status returned by device for missing capability
+	U32 m_notCapable;
+	Entry m_entries[RSH_CAPS_SNAPSHOT_ENTRIES];
+	std::vector<U32> m_words;
+	std::vector<double> m_doubles;
+	std::string m_name;
+	std::string m_libraryVersion;
+};
+
+#endif //RSH_CAPS_SNAPSHOT_H
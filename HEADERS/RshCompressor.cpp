@@ -0,0 +1,650 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshCompressor.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshCompressor class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshCompressor.
+ *
+ */
+
+#include "RshCompressor.h"
+#include "RshConsts.h"
+
+#include <cstring>
+#include <limits>
+
+// record header
+#define RSH_COMPRESSOR_SIGNATURE 0x43485352
+#define RSH_COMPRESSOR_VERSION 1
+#define RSH_COMPRESSOR_HEADER_SIZE 24
+#define RSH_COMPRESSOR_FLAG_SIGNED 0x1
+#define RSH_COMPRESSOR_FLAG_ZSTD 0x2
+
+// channel data starts with mode byte
+#define RSH_COMPRESSOR_MODE_PACKED 0
+#define RSH_COMPRESSOR_MODE_RAW 1
+
+// samples in group, each group has its own predictor and bit width
+#define RSH_COMPRESSOR_GROUP 64
+#define RSH_COMPRESSOR_PREDICT_MINIMUM 0
+#define RSH_COMPRESSOR_PREDICT_DELTA 1
+#define RSH_COMPRESSOR_PREDICT_LINEAR 2
+#define RSH_COMPRESSOR_MAX_WIDTH 40
+
+// zstd block gives at most 128 KB and takes at least 4 bytes
+#define RSH_COMPRESSOR_ZSTD_MAX_RATIO 32768
+
+typedef size_t (*RshZstdCompressBound)(size_t srcSize);
+typedef size_t (*RshZstdCompress)(void* dst, size_t dstCapacity, const void* src, size_t srcSize, int level);
+typedef size_t (*RshZstdDecompress)(void* dst, size_t dstCapacity, const void* src, size_t srcSize);
+typedef unsigned (*RshZstdIsError)(size_t code);
+
+// zstd is loaded once and stays loaded until process exits
+static RshMutex rshCompressorMutex;
+static bool rshCompressorZstdTried = false;
+static RshZstdCompressBound rshZstdCompressBound = 0;
+static RshZstdCompress rshZstdCompress = 0;
+static RshZstdDecompress rshZstdDecompress = 0;
+static RshZstdIsError rshZstdIsError = 0;
+
+static bool RshCompressorLoadZstd()
+{
+	RshMutexLocker locker(rshCompressorMutex);
+	if(!rshCompressorZstdTried)
+	{
+		rshCompressorZstdTried = true;
+#if defined(RSH_MSWINDOWS)
+		HMODULE library = ::LoadLibraryA("libzstd.dll");
+		if(library != 0)
+		{
+			rshZstdCompressBound = (RshZstdCompressBound)::GetProcAddress(library, "ZSTD_compressBound");
+			rshZstdCompress = (RshZstdCompress)::GetProcAddress(library, "ZSTD_compress");
+			rshZstdDecompress = (RshZstdDecompress)::GetProcAddress(library, "ZSTD_decompress");
+			rshZstdIsError = (RshZstdIsError)::GetProcAddress(library, "ZSTD_isError");
+		}
+#elif defined(RSH_LINUX)
+		void* library = dlopen("libzstd.so.1", RTLD_NOW | RTLD_LOCAL);
+		if(library != 0)
+		{
+			rshZstdCompressBound = (RshZstdCompressBound)dlsym(library, "ZSTD_compressBound");
+			rshZstdCompress = (RshZstdCompress)dlsym(library, "ZSTD_compress");
+			rshZstdDecompress = (RshZstdDecompress)dlsym(library, "ZSTD_decompress");
+			rshZstdIsError = (RshZstdIsError)dlsym(library, "ZSTD_isError");
+		}
+#endif
+	}
+	return rshZstdCompressBound != 0 && rshZstdCompress != 0 && rshZstdDecompress != 0 && rshZstdIsError != 0;
+}
+
+// signed residuals are mapped to unsigned: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+static inline U64 RshCompressorZigZag(S64 value)
+{
+	return (static_cast<U64>(value) << 1) ^ static_cast<U64>(value >> 63);
+}
+
+static inline S64 RshCompressorUnZigZag(U64 value)
+{
+	return static_cast<S64>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+static inline U32 RshCompressorWidth(U64 value)
+{
+	U32 width = 0;
+	for(; value != 0; value >>= 1)
+		++width;
+	return width;
+}
+
+static inline U32 RshCompressorVarintSize(U64 value)
+{
+	U32 size = 1;
+	for(; value >= 0x80; value >>= 7)
+		++size;
+	return size;
+}
+
+static inline void RshCompressorPutU32(U8* dst, U32 value)
+{
+	for(int i = 0; i < 4; ++i)
+		dst[i] = static_cast<U8>(value >> (8 * i));
+}
+
+static inline U32 RshCompressorGetU32(const U8* src)
+{
+	return static_cast<U32>(src[0]) | (static_cast<U32>(src[1]) << 8) | (static_cast<U32>(src[2]) << 16) | (static_cast<U32>(src[3]) << 24);
+}
+
+RshCompressor::RshCompressor(U32 channels) :
+	m_channelCount(1),
+	m_backend(None),
+	m_level(1),
+	m_decoding(false),
+	m_frames(0),
+	m_sampleBytes(0),
+	m_signed(false),
+	m_shift(0),
+	m_inputBytes(0),
+	m_outputBytes(0)
+{
+	SetChannels(channels);
+}
+
+U32 RshCompressor::SetChannels(U32 channels)
+{
+	if(channels == 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_channelCount = channels;
+	m_channels.resize(channels);
+	return RSH_API_SUCCESS;
+}
+
+U32 RshCompressor::SetThreads(U32 threads)
+{
+	return m_pool.SetThreads(threads);
+}
+
+U32 RshCompressor::SetBackend(U32 backend, int level)
+{
+	if(backend != None && backend != Zstd)
+		return RSH_API_PARAMETER_INVALID;
+	if(backend == Zstd && !RshCompressorLoadZstd())
+		return RSH_API_DLL_WASNOTLOADED;
+
+	m_backend = backend;
+	m_level = level;
+	return RSH_API_SUCCESS;
+}
+
+bool RshCompressor::IsBackendAvailable(U32 backend)
+{
+	if(backend == None)
+		return true;
+	if(backend == Zstd)
+		return RshCompressorLoadZstd();
+	return false;
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshCompressor::Compress(const RshBufferType<T, dataCode>& input, RSH_BUFFER_U8& output)
+{
+	if(!std::numeric_limits<T>::is_integer)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	if(input.Size() % m_channelCount != 0)
+		return RSH_API_BUFFER_WRONGSIZE;
+
+	const size_t frames = input.Size() / m_channelCount;
+	U64 bits = 0;
+	for(U32 c = 0; c < m_channelCount; ++c)
+	{
+		std::vector<S64>& values = m_channels[c].values;
+		values.resize(frames);
+		const T* src = input.ptr + c;
+		for(size_t i = 0; i < frames; ++i)
+		{
+			values[i] = static_cast<S64>(src[i * m_channelCount]);
+			bits |= static_cast<U64>(values[i]);
+		}
+	}
+
+	// low bits which are zero in all samples are not stored
+	U32 shift = 0;
+	for(; bits != 0 && (bits & 1) == 0; bits >>= 1)
+		++shift;
+
+	m_decoding = false;
+	m_frames = frames;
+	m_sampleBytes = sizeof(T);
+	m_signed = std::numeric_limits<T>::is_signed;
+	m_shift = shift;
+	RunWorkers();
+
+	U64 rawSize = 4 * static_cast<U64>(m_channelCount);
+	for(U32 c = 0; c < m_channelCount; ++c)
+		rawSize += m_channels[c].stream.size();
+	if(rawSize > 0xFFFFFFFF)
+		return RSH_API_BUFFER_SIZEISEXCEEDED;
+
+	const size_t payloadSize = static_cast<size_t>(rawSize);
+	const bool zstd = (m_backend == Zstd);
+	const size_t capacity = zstd ? rshZstdCompressBound(payloadSize) : payloadSize;
+	const size_t needed = RSH_COMPRESSOR_HEADER_SIZE + ((capacity > payloadSize) ? capacity : payloadSize);
+	if(output.PSize() < needed)
+	{
+		U32 st = output.Allocate(needed);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	// packed data goes to record directly or to temporary buffer for backend
+	if(zstd && m_payload.size() < payloadSize)
+		m_payload.resize(payloadSize);
+	U8* payload = zstd ? &m_payload[0] : output.ptr + RSH_COMPRESSOR_HEADER_SIZE;
+	size_t pos = 4 * static_cast<size_t>(m_channelCount);
+	for(U32 c = 0; c < m_channelCount; ++c)
+	{
+		const std::vector<U8>& stream = m_channels[c].stream;
+		RshCompressorPutU32(payload + 4 * c, static_cast<U32>(stream.size()));
+		memcpy(payload + pos, &stream[0], stream.size());
+		pos += stream.size();
+	}
+
+	U8 flags = m_signed ? RSH_COMPRESSOR_FLAG_SIGNED : 0;
+	size_t storedSize = payloadSize;
+	if(zstd)
+	{
+		const size_t packed = rshZstdCompress(output.ptr + RSH_COMPRESSOR_HEADER_SIZE, capacity, payload, payloadSize, m_level);
+		if(!rshZstdIsError(packed) && packed < payloadSize)
+		{
+			flags |= RSH_COMPRESSOR_FLAG_ZSTD;
+			storedSize = packed;
+		}
+		else
+		{
+			memcpy(output.ptr + RSH_COMPRESSOR_HEADER_SIZE, payload, payloadSize);
+		}
+	}
+
+	U8* header = output.ptr;
+	RshCompressorPutU32(header, RSH_COMPRESSOR_SIGNATURE);
+	header[4] = RSH_COMPRESSOR_VERSION;
+	header[5] = static_cast<U8>(m_sampleBytes);
+	header[6] = flags;
+	header[7] = static_cast<U8>(shift);
+	RshCompressorPutU32(header + 8, m_channelCount);
+	RshCompressorPutU32(header + 12, static_cast<U32>(frames));
+	RshCompressorPutU32(header + 16, static_cast<U32>(storedSize));
+	RshCompressorPutU32(header + 20, static_cast<U32>(payloadSize));
+	output.SetSize(RSH_COMPRESSOR_HEADER_SIZE + storedSize);
+
+	m_inputBytes += input.Size() * sizeof(T);
+	m_outputBytes += output.Size();
+	return RSH_API_SUCCESS;
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshCompressor::Decompress(const RSH_BUFFER_U8& input, RshBufferType<T, dataCode>& output, size_t offset, size_t* next)
+{
+	if(!std::numeric_limits<T>::is_integer)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	if(offset > input.Size() || input.Size() - offset < RSH_COMPRESSOR_HEADER_SIZE)
+		return RSH_API_BUFFER_NOTCOMPLETED;
+
+	const U8* header = input.ptr + offset;
+	if(RshCompressorGetU32(header) != RSH_COMPRESSOR_SIGNATURE || header[4] != RSH_COMPRESSOR_VERSION)
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+
+	const U32 sampleBytes = header[5];
+	const U8 flags = header[6];
+	const U32 shift = header[7];
+	const U32 channels = RshCompressorGetU32(header + 8);
+	const size_t frames = RshCompressorGetU32(header + 12);
+	const size_t storedSize = RshCompressorGetU32(header + 16);
+	const size_t payloadSize = RshCompressorGetU32(header + 20);
+
+	if(sampleBytes != sizeof(T) || ((flags & RSH_COMPRESSOR_FLAG_SIGNED) != 0) != std::numeric_limits<T>::is_signed)
+		return RSH_API_BUFFER_WRONGDATATYPE;
+	if(channels == 0 || shift >= 8 * sizeof(T))
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+	if(input.Size() - offset - RSH_COMPRESSOR_HEADER_SIZE < storedSize)
+		return RSH_API_BUFFER_NOTCOMPLETED;
+
+	const U8* payload = header + RSH_COMPRESSOR_HEADER_SIZE;
+	if(flags & RSH_COMPRESSOR_FLAG_ZSTD)
+	{
+		U32 st = Unpack(payload, storedSize, payloadSize);
+		if(st != RSH_API_SUCCESS)
+			return st;
+		payload = &m_payload[0];
+	}
+	else if(storedSize != payloadSize)
+	{
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+	}
+
+	if(payloadSize / 4 < channels)
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+	if(channels != m_channelCount)
+		SetChannels(channels);
+
+	size_t pos = 4 * static_cast<size_t>(channels);
+	for(U32 c = 0; c < channels; ++c)
+	{
+		const size_t size = RshCompressorGetU32(payload + 4 * c);
+		if(size > payloadSize - pos)
+			return RSH_API_BUFFER_PROCESSING_ERROR;
+		m_channels[c].source = payload + pos;
+		m_channels[c].sourceSize = size;
+		pos += size;
+	}
+	if(pos != payloadSize)
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+
+	m_decoding = true;
+	m_frames = frames;
+	m_sampleBytes = sampleBytes;
+	m_signed = std::numeric_limits<T>::is_signed;
+	m_shift = shift;
+	RunWorkers();
+
+	for(U32 c = 0; c < channels; ++c)
+		if(m_channels[c].status != RSH_API_SUCCESS)
+			return m_channels[c].status;
+
+	const size_t size = frames * channels;
+	if(output.PSize() < size)
+	{
+		U32 st = output.Allocate(size);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+	for(U32 c = 0; c < channels; ++c)
+	{
+		const S64* values = frames ? &m_channels[c].values[0] : 0;
+		T* dst = output.ptr + c;
+		for(size_t i = 0; i < frames; ++i)
+			dst[i * channels] = static_cast<T>(static_cast<S64>(static_cast<U64>(values[i]) << shift));
+	}
+	output.SetSize(size);
+
+	if(next != 0)
+		*next = offset + RSH_COMPRESSOR_HEADER_SIZE + storedSize;
+	return RSH_API_SUCCESS;
+}
+
+U64 RshCompressor::InputBytes() const
+{
+	return m_inputBytes;
+}
+
+U64 RshCompressor::OutputBytes() const
+{
+	return m_outputBytes;
+}
+
+double RshCompressor::Ratio() const
+{
+	return (m_outputBytes == 0) ? 0.0 : static_cast<double>(m_inputBytes) / static_cast<double>(m_outputBytes);
+}
+
+void RshCompressor::Routine(void* param, U32 part)
+{
+	static_cast<RshCompressor*>(param)->ProcessChannels(part);
+}
+
+void RshCompressor::RunWorkers()
+{
+	m_pool.Run(&RshCompressor::Routine, this, Workers());
+}
+
+U32 RshCompressor::Workers() const
+{
+	return (m_pool.Threads() < m_channelCount) ? m_pool.Threads() : m_channelCount;
+}
+
+void RshCompressor::ProcessChannels(U32 first)
+{
+	const size_t workers = Workers();
+
+	for(size_t c = first; c < m_channelCount; c += workers)
+	{
+		if(m_decoding)
+			m_channels[c].status = Decode(m_channels[c]);
+		else
+			Encode(m_channels[c]);
+	}
+}
+
+void RshCompressor::Encode(Channel& channel)
+{
+	const size_t frames = m_frames;
+	std::vector<U8>& out = channel.stream;
+	out.clear();
+	out.reserve(1 + frames * m_sampleBytes);
+
+	S64* x = frames ? &channel.values[0] : 0;
+	if(m_shift != 0)
+		for(size_t i = 0; i < frames; ++i)
+			x[i] >>= m_shift;
+
+	const S64 first = frames ? x[0] : 0;
+	out.push_back(RSH_COMPRESSOR_MODE_PACKED);
+	for(int i = 0; i < 8; ++i)
+		out.push_back(static_cast<U8>(static_cast<U64>(first) >> (8 * i)));
+
+	S64 p1 = first;
+	S64 p2 = first;
+	U64 residuals[RSH_COMPRESSOR_GROUP];
+
+	for(size_t pos = 0; pos < frames; pos += RSH_COMPRESSOR_GROUP)
+	{
+		const size_t n = (frames - pos < RSH_COMPRESSOR_GROUP) ? frames - pos : RSH_COMPRESSOR_GROUP;
+		const S64* v = x + pos;
+
+		// bit width of each predictor, width of OR is width of maximum
+		U64 deltaBits = 0;
+		U64 linearBits = 0;
+		S64 minValue = v[0];
+		S64 maxValue = v[0];
+		S64 a = p1;
+		S64 b = p2;
+		for(size_t i = 0; i < n; ++i)
+		{
+			deltaBits |= RshCompressorZigZag(v[i] - a);
+			linearBits |= RshCompressorZigZag(v[i] - 2 * a + b);
+			minValue = (v[i] < minValue) ? v[i] : minValue;
+			maxValue = (v[i] > maxValue) ? v[i] : maxValue;
+			b = a;
+			a = v[i];
+		}
+
+		const U64 base = RshCompressorZigZag(minValue - p1);
+		const U32 widths[3] = { RshCompressorWidth(static_cast<U64>(maxValue - minValue)), RshCompressorWidth(deltaBits), RshCompressorWidth(linearBits) };
+		const U64 costs[3] = { n * widths[0] + 8 * RshCompressorVarintSize(base), n * widths[1], n * widths[2] };
+		U32 predictor = RSH_COMPRESSOR_PREDICT_DELTA;
+		if(costs[RSH_COMPRESSOR_PREDICT_LINEAR] < costs[predictor])
+			predictor = RSH_COMPRESSOR_PREDICT_LINEAR;
+		if(costs[RSH_COMPRESSOR_PREDICT_MINIMUM] < costs[predictor])
+			predictor = RSH_COMPRESSOR_PREDICT_MINIMUM;
+		const U32 width = widths[predictor];
+
+		a = p1;
+		b = p2;
+		for(size_t i = 0; i < n; ++i)
+		{
+			if(predictor == RSH_COMPRESSOR_PREDICT_MINIMUM)
+				residuals[i] = static_cast<U64>(v[i] - minValue);
+			else if(predictor == RSH_COMPRESSOR_PREDICT_DELTA)
+				residuals[i] = RshCompressorZigZag(v[i] - a);
+			else
+				residuals[i] = RshCompressorZigZag(v[i] - 2 * a + b);
+			b = a;
+			a = v[i];
+		}
+		p1 = a;
+		p2 = b;
+
+		out.push_back(static_cast<U8>((predictor << 6) | width));
+		if(predictor == RSH_COMPRESSOR_PREDICT_MINIMUM)
+		{
+			U64 value = base;
+			for(; value >= 0x80; value >>= 7)
+				out.push_back(static_cast<U8>(value | 0x80));
+			out.push_back(static_cast<U8>(value));
+		}
+
+		// groups are byte aligned
+		const size_t at = out.size();
+		out.resize(at + (n * width + 7) / 8);
+		U8* dst = out.empty() ? 0 : &out[at];
+		U64 acc = 0;
+		U32 count = 0;
+		for(size_t i = 0; i < n; ++i)
+		{
+			acc |= residuals[i] << count;
+			count += width;
+			for(; count >= 8; count -= 8, acc >>= 8)
+				*dst++ = static_cast<U8>(acc);
+		}
+		if(count != 0)
+			*dst = static_cast<U8>(acc);
+	}
+
+	// noise in all bits, samples are stored as is
+	if(out.size() > 1 + frames * m_sampleBytes)
+	{
+		out.resize(1 + frames * m_sampleBytes);
+		out[0] = RSH_COMPRESSOR_MODE_RAW;
+		U8* dst = &out[1];
+		for(size_t i = 0; i < frames; ++i)
+			for(U32 k = 0; k < m_sampleBytes; ++k)
+				*dst++ = static_cast<U8>(static_cast<U64>(x[i]) >> (8 * k));
+	}
+}
+
+U32 RshCompressor::Decode(Channel& channel)
+{
+	const size_t frames = m_frames;
+	const U8* src = channel.source;
+	const size_t size = channel.sourceSize;
+
+	// number of frames comes from record, so it is checked against data before allocation
+	if(size == 0)
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+	if(src[0] == RSH_COMPRESSOR_MODE_RAW)
+	{
+		if((size - 1) % m_sampleBytes != 0 || (size - 1) / m_sampleBytes != frames)
+			return RSH_API_BUFFER_PROCESSING_ERROR;
+	}
+	else if(src[0] != RSH_COMPRESSOR_MODE_PACKED || size < 9 || (frames + RSH_COMPRESSOR_GROUP - 1) / RSH_COMPRESSOR_GROUP > size - 9)
+	{
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+	}
+
+	channel.values.resize(frames);
+	S64* x = frames ? &channel.values[0] : 0;
+
+	if(src[0] == RSH_COMPRESSOR_MODE_RAW)
+	{
+		const U32 bits = 8 * m_sampleBytes;
+		const U64 sign = (m_signed && bits < 64) ? (1ULL << (bits - 1)) : 0;
+		const U8* p = src + 1;
+		for(size_t i = 0; i < frames; ++i)
+		{
+			U64 value = 0;
+			for(U32 k = 0; k < m_sampleBytes; ++k)
+				value |= static_cast<U64>(*p++) << (8 * k);
+			if(value & sign)
+				value |= ~0ULL << bits;
+			x[i] = static_cast<S64>(value);
+		}
+		return RSH_API_SUCCESS;
+	}
+
+	U64 first = 0;
+	for(int i = 0; i < 8; ++i)
+		first |= static_cast<U64>(src[1 + i]) << (8 * i);
+
+	S64 p1 = static_cast<S64>(first);
+	S64 p2 = p1;
+	size_t pos = 9;
+	U64 residuals[RSH_COMPRESSOR_GROUP];
+
+	for(size_t done = 0; done < frames; done += RSH_COMPRESSOR_GROUP)
+	{
+		const size_t n = (frames - done < RSH_COMPRESSOR_GROUP) ? frames - done : RSH_COMPRESSOR_GROUP;
+		if(pos >= size)
+			return RSH_API_BUFFER_PROCESSING_ERROR;
+
+		const U32 predictor = src[pos] >> 6;
+		const U32 width = src[pos] & 0x3F;
+		++pos;
+		if(predictor > RSH_COMPRESSOR_PREDICT_LINEAR || width > RSH_COMPRESSOR_MAX_WIDTH)
+			return RSH_API_BUFFER_PROCESSING_ERROR;
+
+		S64 base = 0;
+		if(predictor == RSH_COMPRESSOR_PREDICT_MINIMUM)
+		{
+			U64 value = 0;
+			for(U32 s = 0; ; s += 7)
+			{
+				if(pos >= size || s > 63)
+					return RSH_API_BUFFER_PROCESSING_ERROR;
+				value |= static_cast<U64>(src[pos] & 0x7F) << s;
+				if((src[pos++] & 0x80) == 0)
+					break;
+			}
+			base = p1 + RshCompressorUnZigZag(value);
+		}
+
+		const size_t bytes = (n * width + 7) / 8;
+		if(bytes > size - pos)
+			return RSH_API_BUFFER_PROCESSING_ERROR;
+
+		const U8* p = src + pos;
+		const U64 mask = (width == 0) ? 0 : (~0ULL >> (64 - width));
+		U64 acc = 0;
+		U32 count = 0;
+		for(size_t i = 0; i < n; ++i)
+		{
+			for(; count < width; count += 8)
+				acc |= static_cast<U64>(*p++) << count;
+			residuals[i] = acc & mask;
+			acc >>= width;
+			count -= width;
+		}
+		pos += bytes;
+
+		S64* v = x + done;
+		const S64 previous = p1;
+		if(predictor == RSH_COMPRESSOR_PREDICT_MINIMUM)
+		{
+			for(size_t i = 0; i < n; ++i)
+				v[i] = base + static_cast<S64>(residuals[i]);
+		}
+		else if(predictor == RSH_COMPRESSOR_PREDICT_DELTA)
+		{
+			S64 a = p1;
+			for(size_t i = 0; i < n; ++i)
+				a = v[i] = a + RshCompressorUnZigZag(residuals[i]);
+		}
+		else
+		{
+			S64 a = p1;
+			S64 b = p2;
+			for(size_t i = 0; i < n; ++i)
+			{
+				v[i] = 2 * a - b + RshCompressorUnZigZag(residuals[i]);
+				b = a;
+				a = v[i];
+			}
+		}
+		p1 = v[n - 1];
+		p2 = (n > 1) ? v[n - 2] : previous;
+	}
+
+	return (pos == size) ? RSH_API_SUCCESS : RSH_API_BUFFER_PROCESSING_ERROR;
+}
+
+U32 RshCompressor::Unpack(const U8* data, size_t size, size_t payloadSize)
+{
+	if(!RshCompressorLoadZstd())
+		return RSH_API_DLL_WASNOTLOADED;
+	if(payloadSize / RSH_COMPRESSOR_ZSTD_MAX_RATIO > size)
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+
+	if(m_payload.size() < payloadSize)
+		m_payload.resize(payloadSize);
+	const size_t unpacked = rshZstdDecompress(&m_payload[0], payloadSize, data, size);
+	if(rshZstdIsError(unpacked) || unpacked != payloadSize)
+		return RSH_API_BUFFER_PROCESSING_ERROR;
+	return RSH_API_SUCCESS;
+}
@@ -0,0 +1,258 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshCompressor.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshCompressor class.
+ *
+ * Lossless compression of acquired data stream.
+ *
+ * \~russian
+ * \brief
+ * Класс RshCompressor.
+ *
+ * Сжатие без потерь потока данных.
+ *
+ */
+
+#ifndef RSH_COMPRESSOR_H
+#define RSH_COMPRESSOR_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshConsts.h"
+#include "RshThread.h"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Streaming lossless compressor for integer buffers
+ *
+ * Each block returned by IRshDevice::GetData() is compressed to self
+ * contained record, records can be written to file one after another
+ * and decompressed in any order. Samples of each channel are split in
+ * groups of 64, and for every group the best of three predictors is
+ * chosen: offset from group minimum, difference from previous sample or
+ * linear extrapolation of two previous samples. Residuals are packed
+ * with bit width of the largest one, so noise around baseline takes
+ * only as many bits as its amplitude needs. Low bits which are zero in
+ * all samples (codes of 12 or 14 bit ADC left justified in 16 bit words,
+ * see ::RSH_GET_DEVICE_DATA_BITS) are removed. Channel which does not
+ * compress is stored as is.\n
+ * Optionally, packed data is compressed further with zstd library,
+ * which is loaded at run time, so SDK does not depend on it.
+ * Channels are compressed and decompressed in parallel when more than
+ * one thread is set with SetThreads().
+ *
+ * \remarks
+ * Record format: 24 byte header (signature "RSHC", version, sample size,
+ * flags, zero bits removed, channels, samples per channel, stored and
+ * unpacked payload size, little endian), then table of channel sizes
+ * and channel data.
+ *
+ * \~russian
+ * \brief
+ * Потоковое сжатие без потерь для целочисленных буферов
+ *
+ * Каждый блок, полученный методом IRshDevice::GetData(), сжимается в
+ * самостоятельную запись, записи можно сохранять в файл одну за другой
+ * и распаковывать в любом порядке. Отсчеты каждого канала делятся на
+ * группы по 64, и для каждой группы выбирается лучший из трех
+ * предсказателей: смещение от минимума группы, разность с предыдущим
+ * отсчетом или линейная экстраполяция по двум предыдущим отсчетам.
+ * Остатки упаковываются с разрядностью наибольшего из них, поэтому шум
+ * около постоянного уровня занимает столько бит, сколько требует его
+ * амплитуда. Младшие разряды, равные нулю во всех отсчетах (коды 12 или
+ * 14 разрядного АЦП, выровненные по старшему разряду 16 разрядного слова,
+ * см. ::RSH_GET_DEVICE_DATA_BITS), удаляются. Канал, который не
+ * сжимается, сохраняется без изменений.\n
+ * Дополнительно упакованные данные могут сжиматься библиотекой zstd,
+ * которая загружается во время работы, поэтому SDK от нее не зависит.
+ * Каналы сжимаются и распаковываются параллельно, если методом
+ * SetThreads() задано больше одного потока.
+ *
+ * \remarks
+ * Формат записи: заголовок 24 байта (сигнатура "RSHC", версия, размер
+ * отсчета, флаги, число удаленных нулевых разрядов, число каналов,
+ * отсчетов на канал, размер сохраненных и распакованных данных,
+ * little endian), затем таблица размеров каналов и данные каналов.
+ *
+ */
+class RshCompressor
+{
+public:
+
+	//! Additional compression of packed data
+	enum Backend
+	{
+		//! Bit packing only
+		None = 0x0,
+		//! zstd library (libzstd.so.1 or libzstd.dll)
+		Zstd = 0x1
+	};
+
+	explicit RshCompressor(U32 channels = 1);
+
+	//! Set number of interleaved channels for Compress()
+	U32 SetChannels(U32 channels);
+
+	//! Number of threads processing channels, threads are started here and kept between blocks
+	U32 SetThreads(U32 threads);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Select additional compression
+	 *
+	 * \param[in] backend One of RshCompressor::Backend values.
+	 * \param[in] level Compression level of backend library.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID or
+	 * ::RSH_API_DLL_WASNOTLOADED if library is not found.
+	 *
+	 * \~russian
+	 * \brief
+	 * Выбор дополнительного сжатия
+	 *
+	 * \param[in] backend Одно из значений RshCompressor::Backend.
+	 * \param[in] level Уровень сжатия библиотеки.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID или
+	 * ::RSH_API_DLL_WASNOTLOADED, если библиотека не найдена.
+	 *
+	 */
+	U32 SetBackend(U32 backend, int level = 1);
+
+	//! True if library of \b backend can be loaded
+	static bool IsBackendAvailable(U32 backend);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Compress block
+	 *
+	 * \param[in] input Interleaved samples of all channels,
+	 * RshBufferType::Size() must be multiple of number of channels.
+	 * \param[out] output Compressed record, buffer is allocated if needed.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_WRONGSIZE or
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED for floating point buffer.
+	 *
+	 * \~russian
+	 * \brief
+	 * Сжатие блока
+	 *
+	 * \param[in] input Чередующиеся отсчеты всех каналов,
+	 * RshBufferType::Size() должен быть кратен числу каналов.
+	 * \param[out] output Сжатая запись, память выделяется при необходимости.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_WRONGSIZE или
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED для буфера чисел с плавающей точкой.
+	 *
+	 */
+	template<typename T, RshDataTypes dataCode>
+	U32 Compress(const RshBufferType<T, dataCode>& input, RSH_BUFFER_U8& output);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Decompress record
+	 *
+	 * Number of channels is taken from record.
+	 *
+	 * \param[in] input Buffer with one or more records.
+	 * \param[out] output Interleaved samples, buffer is allocated if needed.
+	 * \param[in] offset Position of record in \b input, bytes.
+	 * \param[out] next Position after record, bytes.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_NOTCOMPLETED if record is
+	 * truncated, ::RSH_API_BUFFER_WRONGDATATYPE if record was made
+	 * from other buffer type, ::RSH_API_BUFFER_PROCESSING_ERROR
+	 * if data is corrupted or ::RSH_API_DLL_WASNOTLOADED.
+	 *
+	 * \~russian
+	 * \brief
+	 * Распаковка записи
+	 *
+	 * Число каналов берется из записи.
+	 *
+	 * \param[in] input Буфер с одной или несколькими записями.
+	 * \param[out] output Чередующиеся отсчеты, память выделяется при необходимости.
+	 * \param[in] offset Позиция записи в \b input, байт.
+	 * \param[out] next Позиция после записи, байт.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_NOTCOMPLETED, если запись
+	 * неполная, ::RSH_API_BUFFER_WRONGDATATYPE, если запись сделана
+	 * из буфера другого типа, ::RSH_API_BUFFER_PROCESSING_ERROR,
+	 * если данные повреждены, или ::RSH_API_DLL_WASNOTLOADED.
+	 *
+	 */
+	template<typename T, RshDataTypes dataCode>
+	U32 Decompress(const RSH_BUFFER_U8& input, RshBufferType<T, dataCode>& output, size_t offset = 0, size_t* next = 0);
+
+	//! Bytes of samples passed to Compress()
+	U64 InputBytes() const;
+
+	//! Bytes of records made by Compress()
+	U64 OutputBytes() const;
+
+	//! InputBytes() / OutputBytes()
+	double Ratio() const;
+
+private:
+
+	RshCompressor(const RshCompressor&);
+	RshCompressor& operator=(const RshCompressor&);
+
+	struct Channel
+	{
+		Channel() : source(0), sourceSize(0), status(RSH_API_SUCCESS) {}
+
+		std::vector<S64> values;
+		std::vector<U8> stream;
+		const U8* source;
+		size_t sourceSize;
+		U32 status;
+	};
+
+	static void Routine(void* param, U32 part);
+	void ProcessChannels(U32 first);
+	void RunWorkers();
+	U32 Workers() const;
+	void Encode(Channel& channel);
+	U32 Decode(Channel& channel);
+	U32 Unpack(const U8* data, size_t size, size_t payloadSize);
+
+	U32 m_channelCount;
+	U32 m_backend;
+	int m_level;
+	// parameters of block being processed
+	bool m_decoding;
+	size_t m_frames;
+	U32 m_sampleBytes;
+	bool m_signed;
+	U32 m_shift;
+	std::vector<U8> m_payload;
+	U64 m_inputBytes;
+	U64 m_outputBytes;
+	std::vector<Channel> m_channels;
+	RshWorkerPool m_pool;
+};
+
+#endif //RSH_COMPRESSOR_H
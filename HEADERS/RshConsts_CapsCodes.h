@@ -1499,6 +1499,137 @@
 	  */
 	 RSH_CAPS_DEVICE_DIGITAL_PORT_DATA_WITH_ANALOG_DATA = 55,
 
+	 /*! 	  
+	  * 
+	  * \~english
+	  * \brief
+	  * Device driver collects bus link and DMA statistics.
+	  * 
+	  * Link utilization, payload sizes and DMA throughput counters
+	  * can be obtained using ::RSH_GET_DEVICE_LINK_STATISTICS.
+	  * 
+	  * \see
+	  * RSH_GET_DEVICE_LINK_STATISTICS
+	  * 
+	  * \~russian
+	  * \brief
+	  * Драйвер устройства собирает статистику шины и DMA.
+	  * 
+	  * Загрузка шины, размеры пакетов и счетчики пропускной способности DMA
+	  * могут быть получены с помощью ::RSH_GET_DEVICE_LINK_STATISTICS.
+	  * 
+	  * \see
+	  * RSH_GET_DEVICE_LINK_STATISTICS
+	  * 
+	  */
+	 RSH_CAPS_DEVICE_LINK_STATISTICS = 56,
+
+	 /*! 	  
+	  * 
+	  * \~english
+	  * \brief
+	  * Device driver timestamps completion of each data block.
+	  * 
+	  * Sequence number and completion time of the block last
+	  * returned by IRshDevice::GetData() can be obtained
+	  * using ::RSH_GET_BUFFER_BLOCK_INFO.
+	  * 
+	  * \see
+	  * RSH_GET_BUFFER_BLOCK_INFO
+	  * 
+	  * \~russian
+	  * \brief
+	  * Драйвер устройства фиксирует время завершения передачи каждого блока.
+	  * 
+	  * Порядковый номер и время завершения передачи блока, последним
+	  * полученного методом IRshDevice::GetData(), можно получить с помощью
+	  * ::RSH_GET_BUFFER_BLOCK_INFO.
+	  * 
+	  * \see
+	  * RSH_GET_BUFFER_BLOCK_INFO
+	  * 
+	  */
+	 RSH_CAPS_DEVICE_BLOCK_TIMESTAMP = 57,
+
+	 /*! 	  
+	  * 
+	  * \~english
+	  * \brief
+	  * Generator can be fed while playing.
+	  * 
+	  * Device abstraction library accepts ::RSH_DATA_MODE_GSPF_STREAM_BLOCK
+	  * flag and refills half of playback buffer which is not played now.
+	  * Current board libraries do not report it.
+	  * 
+	  * \see
+	  * RSH_DATA_MODE_GSPF_STREAM_BLOCK | RshGspfStreamer
+	  * 
+	  * \~russian
+	  * \brief
+	  * Генератор может получать данные во время проигрывания.
+	  * 
+	  * Библиотека абстракции поддерживает флаг ::RSH_DATA_MODE_GSPF_STREAM_BLOCK
+	  * и заполняет ту половину буфера проигрывания, которая сейчас не используется.
+	  * Существующие библиотеки устройств ее не сообщают.
+	  * 
+	  * \see
+	  * RSH_DATA_MODE_GSPF_STREAM_BLOCK | RshGspfStreamer
+	  * 
+	  */
+	 RSH_CAPS_DEVICE_STREAMING_PLAYBACK = 58,
+
+	 /*! 	  
+	  * 
+	  * \~english
+	  * \brief
+	  * Acquisition metrics are collected.
+	  * 
+	  * Counters of blocks and latency percentiles can be obtained
+	  * using ::RSH_GET_DEVICE_METRICS.
+	  * 
+	  * \see
+	  * RSH_GET_DEVICE_METRICS | RshMonitoredDevice
+	  * 
+	  * \~russian
+	  * \brief
+	  * Собираются метрики сбора данных.
+	  * 
+	  * Счетчики блоков и процентили задержек можно получить
+	  * с помощью ::RSH_GET_DEVICE_METRICS.
+	  * 
+	  * \see
+	  * RSH_GET_DEVICE_METRICS | RshMonitoredDevice
+	  * 
+	  */
+	 RSH_CAPS_DEVICE_METRICS = 59,
+
+	 /*! 	  
+	  * 
+	  * \~english
+	  * \brief
+	  * Device can be reconfigured incrementally.
+	  * 
+	  * Device abstraction library accepts ::RSH_INIT_MODE_UPDATE
+	  * and applies only changed parameters, without stopping
+	  * acquisition where possible.
+	  * 
+	  * \see
+	  * RSH_INIT_MODE_UPDATE | RshIncrementalDevice
+	  * 
+	  * \~russian
+	  * \brief
+	  * Устройство поддерживает инкрементальную перенастройку.
+	  * 
+	  * Библиотека абстракции поддерживает ::RSH_INIT_MODE_UPDATE
+	  * и применяет только измененные параметры, по возможности
+	  * не останавливая сбор данных.
+	  * 
+	  * \see
+	  * RSH_INIT_MODE_UPDATE | RshIncrementalDevice
+	  * 
+	  */
+	 RSH_CAPS_DEVICE_INIT_UPDATE = 60,
+
 	 /*! 	  
 	  * 
 	  * \~english
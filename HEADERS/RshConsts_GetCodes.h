@@ -93,6 +93,37 @@ typedef enum
 	 */
 	RSH_GET_BUFFER_READY = _RSH_GROUP_GET_BUFFER(0x1), // 0x10000
 
+	/*!
+	 * 
+	 * \~english
+	 * \brief
+	 * Get completion info of last data block.
+	 *
+	 * <b>Data type</b>: [out] ::RshBlockInfo\n
+	 * Returns kernel driver sequence number and completion time
+	 * of the block last returned by IRshDevice::GetData().
+	 * Timestamp is taken in interrupt (PCI) or transfer completion (USB)
+	 * handler, so it does not include user thread scheduling jitter.
+	 *
+	 * \see
+	 * RSH_CAPS_DEVICE_BLOCK_TIMESTAMP | RshBlockInfo
+	 * 
+	 * \~russian
+	 * \brief
+	 * Получение информации о завершении передачи последнего блока.
+	 *
+	 * <b>Тип данных</b>: [out] ::RshBlockInfo\n
+	 * Возвращает порядковый номер и время завершения передачи (по данным драйвера)
+	 * блока, последним полученного методом IRshDevice::GetData().
+	 * Время фиксируется в обработчике прерывания (PCI) или завершения
+	 * передачи (USB), поэтому не содержит задержек планирования потоков.
+	 *
+	 * \see
+	 * RSH_CAPS_DEVICE_BLOCK_TIMESTAMP | RshBlockInfo
+	 *
+	 */
+	RSH_GET_BUFFER_BLOCK_INFO = _RSH_GROUP_GET_BUFFER(0x2), // 0x10000
+
 	/*!
 	 * 
 	 * \~english
@@ -1412,6 +1443,60 @@ typedef enum
 	 */
 	RSH_GET_DEVICE_POWER_SOURCE_VOLTAGE = _RSH_GROUP_GET_DEVICE(0x37), // 0x30000
 
+	/*!
+	 * \~english
+	 * \brief
+	 * Get PCI/PCI Express link and DMA statistics
+	 *
+	 * <b>Data type</b>: [out] ::RshLinkStatistics\n
+	 * Get snapshot of bus link utilization, TLP payload sizes
+	 * and DMA throughput counters collected by the device driver.
+	 * Use RshLinkStatisticsSampler class to poll this value periodically.
+	 *
+	 * \see
+	 * RSH_CAPS_DEVICE_LINK_STATISTICS | RshLinkStatistics
+	 *
+	 * \~russian
+	 * \brief
+	 * Получение статистики шины PCI/PCI Express и DMA
+	 *
+	 * <b>Тип данных</b>: [out] ::RshLinkStatistics\n
+	 * Получение мгновенных значений загрузки шины, размеров пакетов (TLP)
+	 * и счетчиков пропускной способности DMA, собранных драйвером устройства.
+	 * Для периодического опроса используйте класс RshLinkStatisticsSampler.
+	 *
+	 * \see
+	 * RSH_CAPS_DEVICE_LINK_STATISTICS | RshLinkStatistics
+	 */
+	RSH_GET_DEVICE_LINK_STATISTICS = _RSH_GROUP_GET_DEVICE(0x38), // 0x30000
+
+	/*!
+	 * \~english
+	 * \brief
+	 * Get acquisition metrics of device
+	 *
+	 * <b>Data type</b>: [out] ::RshDeviceMetrics\n
+	 * Get counters of delivered and lost blocks and percentiles
+	 * of wait to GetData latency and GetData duration.
+	 * Supported by RshMonitoredDevice for any device.
+	 *
+	 * \see
+	 * RSH_CAPS_DEVICE_METRICS | RshDeviceMetrics | RshMonitoredDevice
+	 *
+	 * \~russian
+	 * \brief
+	 * Получение метрик сбора данных устройства
+	 *
+	 * <b>Тип данных</b>: [out] ::RshDeviceMetrics\n
+	 * Получение счетчиков полученных и потерянных блоков и процентилей
+	 * задержки от ожидания до GetData и длительности GetData.
+	 * Поддерживается классом RshMonitoredDevice для любого устройства.
+	 *
+	 * \see
+	 * RSH_CAPS_DEVICE_METRICS | RshDeviceMetrics | RshMonitoredDevice
+	 */
+	RSH_GET_DEVICE_METRICS = _RSH_GROUP_GET_DEVICE(0x39), // 0x30000
+
 		
 	/*!
 	 * \~english
@@ -131,7 +131,44 @@ typedef enum
 	 * и размером буфера.
 	 *
 	 */
-	RSH_DATA_MODE_GSPF_TTL = 0x10000
+	RSH_DATA_MODE_GSPF_TTL = 0x10000,
+
+	/*!
+	 * 
+	 * \~english
+	 * \brief
+	 * Stream block into half of GSPF playback buffer.
+	 * 
+	 * Used when generation is started in RshInitGSPF::PlayLoop mode
+	 * with buffer of 2*N samples. Buffer of N samples passed to
+	 * IRshDevice::GetData() with this flag is written to the half
+	 * of device memory which is not being played now, so playback
+	 * continues without interruption.\n
+	 * Call it once after each ::RSH_GET_WAIT_BUFFER_READY_EVENT.\n
+	 * Supported only by libraries with ::RSH_CAPS_DEVICE_STREAMING_PLAYBACK,
+	 * current board libraries do not implement it.
+	 * 
+	 * \see
+	 * RSH_CAPS_DEVICE_STREAMING_PLAYBACK | RshGspfStreamer
+	 * 
+	 * \~russian
+	 * \brief
+	 * Передача блока в половину буфера проигрывания ГСПФ.
+	 * 
+	 * Используется, когда генерация запущена в режиме RshInitGSPF::PlayLoop
+	 * с буфером из 2*N отсчетов. Буфер из N отсчетов, переданный в
+	 * IRshDevice::GetData() с этим флагом, записывается в ту половину
+	 * памяти устройства, которая сейчас не проигрывается, поэтому
+	 * генерация продолжается без перерыва.\n
+	 * Вызывается один раз после каждого события ::RSH_GET_WAIT_BUFFER_READY_EVENT.\n
+	 * Поддерживается только библиотеками с ::RSH_CAPS_DEVICE_STREAMING_PLAYBACK,
+	 * существующие библиотеки устройств его не реализуют.
+	 * 
+	 * \see
+	 * RSH_CAPS_DEVICE_STREAMING_PLAYBACK | RshGspfStreamer
+	 * 
+	 */
+	RSH_DATA_MODE_GSPF_STREAM_BLOCK = 0x20000
 
 } RSH_DATA_MODES;
 
@@ -114,7 +114,49 @@ typedef enum
 	 * Данная опция поддерживается не во всех библиотеках абстракции.
 	 *
 	 */
-	RSH_INIT_MODE_REINIT = 2
+	RSH_INIT_MODE_REINIT = 2,
+
+	/*!
+	 * \~english
+	 * \brief
+	 * Incremental reconfiguration
+	 *
+	 * If IRshDevice::Init() is used with this code, parameters are
+	 * checked and corrected as with ::RSH_INIT_MODE_INIT and compared
+	 * with parameters of previous initialization. Nothing is sent to
+	 * device if they are equal, otherwise only changed parameters are
+	 * applied. Running acquisition continues when all changed parameters
+	 * can be changed on the fly (for example, gain or sample rate),
+	 * otherwise device is stopped, initialized and started again.
+	 * Without previous initialization of the same structure type
+	 * this is ::RSH_INIT_MODE_INIT.
+	 *
+	 * \remarks
+	 * Supported by libraries with ::RSH_CAPS_DEVICE_INIT_UPDATE,
+	 * for other devices use RshIncrementalDevice.
+	 *
+	 *
+	 * \~russian
+	 * \brief
+	 * Инкрементальная перенастройка
+	 *
+	 * При вызове метода IRshDevice::Init() с этим параметром параметры
+	 * проверяются и корректируются, как при ::RSH_INIT_MODE_INIT, и
+	 * сравниваются с параметрами предыдущей инициализации. Если они
+	 * совпадают, в устройство ничего не передается, иначе применяются
+	 * только измененные параметры. Идущий сбор данных продолжается, если
+	 * все измененные параметры можно менять на ходу (например, коэффициент
+	 * усиления или частоту дискретизации), иначе устройство
+	 * останавливается, инициализируется и запускается снова.
+	 * Без предыдущей инициализации структурой того же типа действует
+	 * как ::RSH_INIT_MODE_INIT.
+	 *
+	 * \remarks
+	 * Поддерживается библиотеками с ::RSH_CAPS_DEVICE_INIT_UPDATE,
+	 * для других устройств используйте RshIncrementalDevice.
+	 *
+	 */
+	RSH_INIT_MODE_UPDATE = 3
 
 } RSH_INIT_MODES;
 
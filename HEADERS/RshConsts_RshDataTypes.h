@@ -156,6 +156,9 @@ typedef enum
 	rshCalibrationItemButton = _RSH_GROUP_TYPE_STUFF(0x18),
 	rshCalibrationItemFilePath = _RSH_GROUP_TYPE_STUFF(0x19),
 	rshCalibrationItemRegOffset = _RSH_GROUP_TYPE_STUFF(0x1A),
+	rshLinkStatistics = _RSH_GROUP_TYPE_STUFF(0x1B),
+	rshBlockInfo = _RSH_GROUP_TYPE_STUFF(0x1C),
+	rshDeviceMetrics = _RSH_GROUP_TYPE_STUFF(0x1D),
 
 	rshBoardInfoDMA = _RSH_GROUP_TYPE_INTERNAL(0x1), //0xadc06000
 	rshBoardInfoMemory = _RSH_GROUP_TYPE_INTERNAL(0x2),
@@ -0,0 +1,332 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDecimator.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDecimator class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDecimator.
+ *
+ */
+
+#include "RshDecimator.h"
+#include "RshConsts.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#define RSH_DECIMATOR_PI 3.1415926535897932384626433832795
+
+RshDecimator::RshDecimator(U32 channels) :
+	m_channelCount(1),
+	m_cicFactor(1),
+	m_cicOrder(0),
+	m_cicGain(1.0),
+	m_firFactor(1),
+	m_frames(0),
+	m_integer(false)
+{
+	SetChannels(channels);
+}
+
+U32 RshDecimator::SetChannels(U32 channels)
+{
+	if(channels == 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_channelCount = channels;
+	m_channels.assign(channels, Channel());
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshDecimator::SetCic(U32 factor, U32 order)
+{
+	if(factor == 0 || (factor > 1 && (order == 0 || order > 8)))
+		return RSH_API_PARAMETER_INVALID;
+
+	// register growth order * log2(factor) bits over 32 bit input must fit in 64 bits
+	U32 bits = 0;
+	while((1ULL << bits) < factor)
+		++bits;
+	if(factor > 1 && 32 + order * bits > 64)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_cicFactor = factor;
+	m_cicOrder = (factor > 1) ? order : 0;
+	m_cicGain = pow(static_cast<double>(factor), static_cast<double>(m_cicOrder));
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshDecimator::SetFir(const std::vector<double>& taps, U32 factor)
+{
+	if(factor == 0 || (taps.empty() && factor != 1))
+		return RSH_API_PARAMETER_INVALID;
+
+	m_taps.assign(taps.rbegin(), taps.rend());
+	m_firFactor = factor;
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshDecimator::SetLowpass(U32 factor, U32 taps, double passband)
+{
+	if(factor == 0 || passband <= 0.0 || passband > 1.0)
+		return RSH_API_PARAMETER_INVALID;
+
+	if(taps == 0)
+		taps = 16 * factor + 1;
+	return SetFir(DesignLowpass(taps, passband * 0.5 / factor), factor);
+}
+
+U32 RshDecimator::SetThreads(U32 threads)
+{
+	return m_pool.SetThreads(threads);
+}
+
+void RshDecimator::Reset()
+{
+	const size_t history = m_taps.empty() ? 0 : m_taps.size() - 1;
+	for(size_t c = 0; c < m_channels.size(); ++c)
+	{
+		Channel& channel = m_channels[c];
+		channel.integrators.assign(m_cicOrder, 0);
+		channel.combs.assign(m_cicOrder, 0);
+		channel.cicPhase = 0;
+		channel.line.assign(history, 0.0);
+		channel.next = history;
+		channel.produced = 0;
+	}
+}
+
+U32 RshDecimator::Factor() const
+{
+	return m_cicFactor * m_firFactor;
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshDecimator::Process(const RshBufferType<T, dataCode>& input, RshBufferType<T, dataCode>& output)
+{
+	if(input.Size() % m_channelCount != 0)
+		return RSH_API_BUFFER_WRONGSIZE;
+	m_integer = std::numeric_limits<T>::is_integer;
+	if(m_cicFactor > 1 && !m_integer)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	const size_t frames = input.Size() / m_channelCount;
+	for(U32 c = 0; c < m_channelCount; ++c)
+	{
+		Channel& channel = m_channels[c];
+		const T* src = input.ptr + c;
+		if(m_cicFactor > 1)
+		{
+			if(channel.codes.size() < frames)
+				channel.codes.resize(frames);
+			for(size_t i = 0; i < frames; ++i)
+				channel.codes[i] = static_cast<S64>(src[i * m_channelCount]);
+		}
+		else
+		{
+			if(channel.input.size() < frames)
+				channel.input.resize(frames);
+			for(size_t i = 0; i < frames; ++i)
+				channel.input[i] = static_cast<double>(src[i * m_channelCount]);
+		}
+	}
+	m_frames = frames;
+
+	RunWorkers();
+
+	// all channels get the same number of samples
+	const size_t produced = m_channels[0].produced;
+	const size_t size = produced * m_channelCount;
+	if(output.PSize() < size)
+	{
+		U32 st = output.Allocate(size);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	const double minValue = m_integer ? static_cast<double>(std::numeric_limits<T>::min()) : 0.0;
+	const double maxValue = m_integer ? static_cast<double>(std::numeric_limits<T>::max()) : 0.0;
+	for(U32 c = 0; c < m_channelCount; ++c)
+	{
+		const double* src = m_channels[c].output.empty() ? 0 : &m_channels[c].output[0];
+		T* dst = output.ptr + c;
+		if(m_integer)
+		{
+			for(size_t i = 0; i < produced; ++i)
+			{
+				const double v = floor(src[i] + 0.5);
+				dst[i * m_channelCount] = static_cast<T>((v < minValue) ? minValue : ((v > maxValue) ? maxValue : v));
+			}
+		}
+		else
+		{
+			for(size_t i = 0; i < produced; ++i)
+				dst[i * m_channelCount] = static_cast<T>(src[i]);
+		}
+	}
+	output.SetSize(size);
+	return RSH_API_SUCCESS;
+}
+
+std::vector<double> RshDecimator::DesignLowpass(U32 taps, double cutoff)
+{
+	std::vector<double> h(taps == 0 ? 1 : taps, 1.0);
+	if(h.size() == 1)
+		return h;
+
+	const double center = (h.size() - 1) / 2.0;
+	double sum = 0.0;
+	for(size_t n = 0; n < h.size(); ++n)
+	{
+		const double x = n - center;
+		const double sinc = (x == 0.0) ? 2.0 * cutoff : sin(2.0 * RSH_DECIMATOR_PI * cutoff * x) / (RSH_DECIMATOR_PI * x);
+		const double phase = 2.0 * RSH_DECIMATOR_PI * n / (h.size() - 1);
+		const double window = 0.42 - 0.5 * cos(phase) + 0.08 * cos(2.0 * phase);
+		h[n] = sinc * window;
+		sum += h[n];
+	}
+
+	// unity gain at zero frequency
+	for(size_t n = 0; n < h.size(); ++n)
+		h[n] /= sum;
+	return h;
+}
+
+void RshDecimator::Routine(void* param, U32 part)
+{
+	static_cast<RshDecimator*>(param)->ProcessChannels(part);
+}
+
+U32 RshDecimator::RunWorkers()
+{
+	m_pool.Run(&RshDecimator::Routine, this, Workers());
+	return RSH_API_SUCCESS;
+}
+
+U32 RshDecimator::Workers() const
+{
+	return (m_pool.Threads() < m_channelCount) ? m_pool.Threads() : m_channelCount;
+}
+
+void RshDecimator::ProcessChannels(U32 first)
+{
+	const size_t workers = Workers();
+
+	for(size_t c = first; c < m_channelCount; c += workers)
+	{
+		Channel& channel = m_channels[c];
+		if(m_cicFactor > 1)
+		{
+			const size_t count = RunCic(channel, m_frames);
+			RunFir(channel, channel.stage.empty() ? 0 : &channel.stage[0], count);
+		}
+		else
+		{
+			RunFir(channel, channel.input.empty() ? 0 : &channel.input[0], m_frames);
+		}
+	}
+}
+
+size_t RshDecimator::RunCic(Channel& channel, size_t count)
+{
+	if(count == 0)
+		return 0;
+
+	const U32 order = m_cicOrder;
+	const U32 factor = m_cicFactor;
+	const double gain = 1.0 / m_cicGain;
+	if(channel.stage.size() < count / factor + 1)
+		channel.stage.resize(count / factor + 1);
+
+	U64* integrators = &channel.integrators[0];
+	U64* combs = &channel.combs[0];
+	const S64* codes = &channel.codes[0];
+	double* stage = &channel.stage[0];
+	size_t produced = 0;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		U64 x = static_cast<U64>(codes[i]);
+		for(U32 k = 0; k < order; ++k)
+		{
+			integrators[k] += x;
+			x = integrators[k];
+		}
+
+		if(++channel.cicPhase != factor)
+			continue;
+		channel.cicPhase = 0;
+
+		// combs run at output rate, wrap around of integrators cancels here
+		for(U32 k = 0; k < order; ++k)
+		{
+			const U64 delayed = combs[k];
+			combs[k] = x;
+			x -= delayed;
+		}
+		stage[produced++] = static_cast<double>(static_cast<S64>(x)) * gain;
+	}
+	return produced;
+}
+
+void RshDecimator::RunFir(Channel& channel, const double* src, size_t count)
+{
+	channel.produced = 0;
+	if(count == 0)
+		return;
+
+	if(m_taps.empty())
+	{
+		if(channel.output.size() < count)
+			channel.output.resize(count);
+		memcpy(&channel.output[0], src, count * sizeof(double));
+		channel.produced = count;
+		return;
+	}
+
+	const size_t taps = m_taps.size();
+	const size_t history = taps - 1;
+	const size_t total = history + count;
+	const size_t full = taps - taps % 4;
+	const double* h = &m_taps[0];
+
+	channel.line.resize(total);
+	memcpy(&channel.line[history], src, count * sizeof(double));
+	if(channel.output.size() < count / m_firFactor + 1)
+		channel.output.resize(count / m_firFactor + 1);
+
+	const double* line = &channel.line[0];
+	double* output = &channel.output[0];
+	size_t produced = 0;
+
+	// only kept output samples are calculated (polyphase decimation)
+	for(; channel.next < total; channel.next += m_firFactor)
+	{
+		const double* x = line + channel.next - history;
+		double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+		for(size_t i = 0; i < full; i += 4)
+			for(int l = 0; l < 4; ++l)
+				sum[l] += x[i + l] * h[i + l];
+		for(size_t i = full; i < taps; ++i)
+			sum[0] += x[i] * h[i];
+		output[produced++] = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+	}
+	channel.produced = produced;
+
+	// keep last taps - 1 samples for next block
+	if(history != 0)
+		memmove(&channel.line[0], &channel.line[count], history * sizeof(double));
+	channel.line.resize(history);
+	channel.next -= count;
+}
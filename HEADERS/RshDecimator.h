@@ -0,0 +1,211 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDecimator.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDecimator class.
+ *
+ * Sample rate reduction of acquired data stream.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDecimator.
+ *
+ * Понижение частоты дискретизации потока данных.
+ *
+ */
+
+#ifndef RSH_DECIMATOR_H
+#define RSH_DECIMATOR_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshConsts.h"
+#include "RshThread.h"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Streaming multichannel decimator
+ *
+ * Blocks returned by IRshDevice::GetData() are passed to Process()
+ * as is, samples of channels are interleaved. Each channel goes
+ * through two optional stages:
+ * - CIC filter (cascaded integrator-comb) with decimation factor R,
+ * no multiplications, suitable for large factors;
+ * - FIR filter with decimation factor M in polyphase form: only
+ * output samples that are kept are calculated.
+ *
+ * Total decimation factor is R * M. Filter state is kept between
+ * calls, so output does not depend on block size. Output buffer
+ * has the same type as input, integer values are rounded and
+ * saturated.\n
+ * Channels are processed in parallel when more than one thread
+ * is set with SetThreads().
+ *
+ * \remarks
+ * CIC stage works in exact integer arithmetic and can be used only
+ * with integer buffers (::RSH_BUFFER_S16, ::RSH_BUFFER_S32).
+ * CIC gain R^N is compensated, passband droop is not.
+ *
+ * \~russian
+ * \brief
+ * Потоковый многоканальный дециматор
+ *
+ * Блоки, полученные методом IRshDevice::GetData(), передаются в
+ * Process() без изменений, отсчеты каналов чередуются. Каждый канал
+ * проходит через два необязательных каскада:
+ * - CIC фильтр (каскадный интегратор-гребенка) с коэффициентом
+ * децимации R, без умножений, подходит для больших коэффициентов;
+ * - КИХ фильтр с коэффициентом децимации M в полифазной форме:
+ * вычисляются только сохраняемые выходные отсчеты.
+ *
+ * Общий коэффициент децимации R * M. Состояние фильтров сохраняется
+ * между вызовами, поэтому результат не зависит от размера блока.
+ * Выходной буфер имеет тот же тип, что и входной, целые значения
+ * округляются и ограничиваются диапазоном типа.\n
+ * Каналы обрабатываются параллельно, если методом SetThreads()
+ * задано больше одного потока.
+ *
+ * \remarks
+ * CIC каскад работает в точной целочисленной арифметике и может
+ * использоваться только с целочисленными буферами (::RSH_BUFFER_S16,
+ * ::RSH_BUFFER_S32). Усиление CIC R^N компенсируется, спад АЧХ в
+ * полосе пропускания - нет.
+ *
+ */
+class RshDecimator
+{
+public:
+
+	explicit RshDecimator(U32 channels = 1);
+
+	//! Set number of interleaved channels, filter state is reset
+	U32 SetChannels(U32 channels);
+
+	//! CIC stage with \b factor and \b order (number of integrators), \b factor = 1 - no CIC stage
+	U32 SetCic(U32 factor, U32 order = 4);
+
+	//! FIR stage with given coefficients, empty \b taps - no FIR stage
+	U32 SetFir(const std::vector<double>& taps, U32 factor);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * FIR stage with lowpass filter designed for decimation
+	 *
+	 * \param[in] factor FIR decimation factor M.
+	 * \param[in] taps Number of coefficients, 0 - 16 * M + 1.
+	 * \param[in] passband Part of output Nyquist band passed without
+	 * attenuation, filter cutoff is \b passband / (2 * M) of FIR input rate.
+	 *
+	 * \~russian
+	 * \brief
+	 * КИХ каскад с фильтром нижних частот для децимации
+	 *
+	 * \param[in] factor Коэффициент децимации КИХ каскада M.
+	 * \param[in] taps Число коэффициентов, 0 - 16 * M + 1.
+	 * \param[in] passband Часть полосы Найквиста на выходе, пропускаемая
+	 * без ослабления, частота среза \b passband / (2 * M) от частоты входа КИХ каскада.
+	 *
+	 */
+	U32 SetLowpass(U32 factor, U32 taps = 0, double passband = 0.8);
+
+	//! Number of threads processing channels, threads are started here and kept between blocks
+	U32 SetThreads(U32 threads);
+
+	//! Clear filter state
+	void Reset();
+
+	//! Total decimation factor
+	U32 Factor() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Process acquired block
+	 *
+	 * \param[in] input Interleaved samples of all channels,
+	 * RshBufferType::Size() must be multiple of number of channels.
+	 * \param[out] output Decimated interleaved samples, buffer is
+	 * allocated if needed. Size can be 0 for short blocks.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_WRONGSIZE or
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED if CIC
+	 * stage is used with floating point buffer.
+	 *
+	 * \~russian
+	 * \brief
+	 * Обработка полученного блока
+	 *
+	 * \param[in] input Чередующиеся отсчеты всех каналов,
+	 * RshBufferType::Size() должен быть кратен числу каналов.
+	 * \param[out] output Прореженные чередующиеся отсчеты, память
+	 * выделяется при необходимости. Для коротких блоков размер может быть 0.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_WRONGSIZE или
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED, если CIC
+	 * каскад используется с буфером чисел с плавающей точкой.
+	 *
+	 */
+	template<typename T, RshDataTypes dataCode>
+	U32 Process(const RshBufferType<T, dataCode>& input, RshBufferType<T, dataCode>& output);
+
+	//! Windowed sinc lowpass filter with unity gain, \b cutoff is part of sample frequency (0 - 0.5)
+	static std::vector<double> DesignLowpass(U32 taps, double cutoff);
+
+private:
+
+	RshDecimator(const RshDecimator&);
+	RshDecimator& operator=(const RshDecimator&);
+
+	struct Channel
+	{
+		Channel() : cicPhase(0), next(0), produced(0) {}
+
+		std::vector<S64> codes;
+		std::vector<double> input;
+		std::vector<double> stage;
+		// CIC integrators and comb delays, unsigned to wrap around on overflow
+		std::vector<U64> integrators;
+		std::vector<U64> combs;
+		U32 cicPhase;
+		// FIR delay line: history of taps - 1 samples and new samples
+		std::vector<double> line;
+		size_t next;
+		std::vector<double> output;
+		size_t produced;
+	};
+
+	static void Routine(void* param, U32 part);
+	void ProcessChannels(U32 first);
+	size_t RunCic(Channel& channel, size_t count);
+	void RunFir(Channel& channel, const double* src, size_t count);
+	U32 RunWorkers();
+	U32 Workers() const;
+
+	U32 m_channelCount;
+	U32 m_cicFactor;
+	U32 m_cicOrder;
+	double m_cicGain;
+	U32 m_firFactor;
+	// coefficients in reverse order, so kernel is forward dot product
+	std::vector<double> m_taps;
+	size_t m_frames;
+	bool m_integer;
+	std::vector<Channel> m_channels;
+	RshWorkerPool m_pool;
+};
+
+#endif //RSH_DECIMATOR_H
@@ -60,6 +60,17 @@
 	#define __rshgetpid() _getpid()
 #endif
 
+//atomic counters and full memory barrier (return value before addition)
+#define __rshatomicadd32(p, v)  InterlockedExchangeAdd((volatile LONG*)(p), (LONG)(v))
+#define __rshatomicadd64(p, v)  InterlockedExchangeAdd64((volatile LONGLONG*)(p), (LONGLONG)(v))
+//atomic read of 64 bit value, also on 32 bit platforms
+#define __rshatomicload64(p)    ((U64)InterlockedExchangeAdd64((volatile LONGLONG*)(p), 0))
+//compare and swap, returns value before operation
+#define __rshatomiccas64(p, expected, desired)  InterlockedCompareExchange64((volatile LONGLONG*)(p), (LONGLONG)(desired), (LONGLONG)(expected))
+#define __rshmembarrier()       MemoryBarrier()
+//variable with separate instance in each thread
+#define __rshthreadlocal        __declspec(thread)
+
 #elif defined(RSH_LINUX)
 
 //default paths to rsh binaries
@@ -83,6 +94,17 @@
 #define __rshisfinite(a)     isfinite(a)
 #define __rshmssleep(a)      usleep(a * 1000)
 #define __rshgetpid()        getpid()
+
+//atomic counters and full memory barrier (return value before addition)
+#define __rshatomicadd32(p, v)  __sync_fetch_and_add((p), (v))
+#define __rshatomicadd64(p, v)  __sync_fetch_and_add((p), (v))
+//atomic read of 64 bit value, also on 32 bit platforms
+#define __rshatomicload64(p)    __sync_fetch_and_add((volatile U64*)(p), (U64)0)
+//compare and swap, returns value before operation
+#define __rshatomiccas64(p, expected, desired)  __sync_val_compare_and_swap((p), (expected), (desired))
+#define __rshmembarrier()       __sync_synchronize()
+//variable with separate instance in each thread
+#define __rshthreadlocal        __thread
 #endif
 
 
@@ -41,6 +41,7 @@ RshDeviceBaseInfo::RshDeviceBaseInfo(const RshDeviceBaseInfo& pi):
 		this->chip = pi.chip;
 		this->slot = pi.slot;
 		this->base = pi.base;
+		this->serialNumber = pi.serialNumber;
 	}
 
 RshDeviceBaseInfo::RshDeviceBaseInfo(RshDataTypes type, size_t typeSize):
@@ -77,6 +78,7 @@ RshDeviceBaseInfo& RshDeviceBaseInfo::operator=(const RshDeviceBaseInfo& obj)
 	this->chip = obj.chip;
 	this->slot = obj.slot;
 	this->base = obj.base;
+	this->serialNumber = obj.serialNumber;
 
 	return *this;
 }
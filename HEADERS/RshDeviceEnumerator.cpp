@@ -0,0 +1,348 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDeviceEnumerator.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDeviceEnumerator class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDeviceEnumerator.
+ *
+ */
+
+#include "RshDeviceEnumerator.h"
+#include "RshConsts.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+
+#if defined(RSH_LINUX)
+	#include <dirent.h>
+	#include <fcntl.h>
+	#include <sys/socket.h>
+	#include <linux/netlink.h>
+#endif
+
+RshMutex RshDeviceEnumerator::s_lock;
+std::vector<RshDeviceEnumerator::Device> RshDeviceEnumerator::s_cache;
+bool RshDeviceEnumerator::s_valid = false;
+int RshDeviceEnumerator::s_uevent = -1;
+
+U32 RshDeviceEnumerator::Enumerate(std::vector<Device>& list, bool rescan)
+{
+	RshMutexLocker locker(s_lock);
+
+	// drain hot-plug events before scan, so nothing is lost between them
+	if(HotPlugOccurred() || rescan)
+		s_valid = false;
+
+	if(!s_valid)
+	{
+		std::vector<Device> found;
+		U32 st = Scan(found);
+		if(st != RSH_API_SUCCESS)
+			return st;
+		s_cache.swap(found);
+		s_valid = true;
+	}
+
+	list = s_cache;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshDeviceEnumerator::Enumerate(RSH_BUFFER_DEVICE_BASE_INFO& list, U16 pid)
+{
+	std::vector<Device> devices;
+	U32 st = Enumerate(devices);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	size_t count = 0;
+	for(size_t i = 0; i < devices.size(); ++i)
+		if(pid == 0 || devices[i].info.pid == pid)
+			++count;
+
+	if(count == 0)
+	{
+		list.SetSize(0);
+		return RSH_API_SUCCESS;
+	}
+
+	if(list.PSize() < count)
+	{
+		st = list.Allocate(count);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	list.SetSize(0);
+	for(size_t i = 0; i < devices.size(); ++i)
+		if(pid == 0 || devices[i].info.pid == pid)
+			list.PushBack(devices[i].info);
+
+	return RSH_API_SUCCESS;
+}
+
+void RshDeviceEnumerator::Invalidate()
+{
+	RshMutexLocker locker(s_lock);
+	s_valid = false;
+}
+
+#if defined(RSH_LINUX)
+
+namespace {
+
+// PLX 9000 series drivers used by RSH PCI boards
+const char* const rshPlxDrivers[] = { "Plx9054", "Plx9050", "Plx8311", "Plx9056", "Plx9656", "Plx9030", "Plx9080" };
+const char* const rshSysPciDrivers = "/sys/bus/pci/drivers/";
+const char* const rshSysUsbDriver = "/sys/bus/usb/drivers/lausb/";
+// PCI_ID of PLX chips ("%04X:%04X") and PRODUCT of RSH USB devices ("%x/%x/%x") in uevents
+const char* const rshUeventPlxId = "10B5:";
+const char* const rshUeventUsbProduct = "534b/";
+
+bool ReadSysfsString(const std::string& path, std::string& value)
+{
+	FILE* f = fopen(path.c_str(), "r");
+	if(f == 0)
+		return false;
+
+	char buf[128];
+	bool ok = fgets(buf, sizeof(buf), f) != 0;
+	fclose(f);
+	if(!ok)
+		return false;
+
+	value = buf;
+	while(!value.empty() && (value[value.size() - 1] == '\n' || value[value.size() - 1] == ' '))
+		value.erase(value.size() - 1);
+	return true;
+}
+
+U16 ReadSysfsHex(const std::string& path)
+{
+	std::string value;
+	if(!ReadSysfsString(path, value))
+		return 0;
+	return static_cast<U16>(strtoul(value.c_str(), 0, 16));
+}
+
+U16 ReadSysfsDec(const std::string& path)
+{
+	std::string value;
+	if(!ReadSysfsString(path, value))
+		return 0;
+	return static_cast<U16>(strtoul(value.c_str(), 0, 10));
+}
+
+// driver directories contain device links plus bind/unbind/new_id files and module link
+void ListBoundDevices(const std::string& driverDir, std::vector<std::string>& names)
+{
+	DIR* dir = opendir(driverDir.c_str());
+	if(dir == 0)
+		return;
+
+	struct dirent* ent;
+	while((ent = readdir(dir)) != 0)
+		if(strchr(ent->d_name, ':') != 0)
+			names.push_back(ent->d_name);
+
+	closedir(dir);
+}
+
+std::string FindMiscNode(const std::string& interfaceDir)
+{
+	DIR* dir = opendir((interfaceDir + "/usbmisc").c_str());
+	if(dir == 0)
+		return std::string();
+
+	std::string node;
+	struct dirent* ent;
+	while((ent = readdir(dir)) != 0)
+		if(strncmp(ent->d_name, "lausb", 5) == 0)
+		{
+			node = std::string("/dev/") + ent->d_name;
+			break;
+		}
+
+	closedir(dir);
+	return node;
+}
+
+// uevent is "action@devpath" followed by KEY=VALUE strings, all zero terminated;
+// events of other PCI and USB devices (network, storage, hubs) do not invalidate cache
+bool IsRshUevent(const char* buf, size_t len)
+{
+	std::string subsystem, driver, pciId, product;
+	for(size_t pos = strlen(buf) + 1; pos < len; pos += strlen(buf + pos) + 1)
+	{
+		const char* item = buf + pos;
+		if(strncmp(item, "SUBSYSTEM=", 10) == 0)
+			subsystem = item + 10;
+		else if(strncmp(item, "DRIVER=", 7) == 0)
+			driver = item + 7;
+		else if(strncmp(item, "PCI_ID=", 7) == 0)
+			pciId = item + 7;
+		else if(strncmp(item, "PRODUCT=", 8) == 0)
+			product = item + 8;
+	}
+
+	if(subsystem == "pci")
+	{
+		for(size_t d = 0; d < sizeof(rshPlxDrivers) / sizeof(rshPlxDrivers[0]); ++d)
+			if(driver == rshPlxDrivers[d])
+				return true;
+		return strncasecmp(pciId.c_str(), rshUeventPlxId, strlen(rshUeventPlxId)) == 0;
+	}
+	if(subsystem == "usb")
+		return driver == "lausb" || strncasecmp(product.c_str(), rshUeventUsbProduct, strlen(rshUeventUsbProduct)) == 0;
+	return false;
+}
+
+bool BySlot(const RshDeviceEnumerator::Device& a, const RshDeviceEnumerator::Device& b)
+{
+	if(a.bus != b.bus)
+		return a.bus < b.bus;
+	return a.info.slot < b.info.slot;
+}
+
+}
+
+U32 RshDeviceEnumerator::Scan(std::vector<Device>& list)
+{
+	list.clear();
+
+	for(size_t d = 0; d < sizeof(rshPlxDrivers) / sizeof(rshPlxDrivers[0]); ++d)
+	{
+		std::vector<std::string> names;
+		ListBoundDevices(std::string(rshSysPciDrivers) + rshPlxDrivers[d], names);
+
+		for(size_t i = 0; i < names.size(); ++i)
+		{
+			std::string path = std::string(rshSysPciDrivers) + rshPlxDrivers[d] + "/" + names[i] + "/";
+
+			unsigned int domain = 0, bus = 0, slot = 0, func = 0;
+			if(sscanf(names[i].c_str(), "%x:%x:%x.%x", &domain, &bus, &slot, &func) != 4)
+				continue;
+
+			Device dev;
+			dev.bus = busPCI;
+			dev.driver = rshPlxDrivers[d];
+			dev.location = names[i];
+			dev.info.chip = ReadSysfsHex(path + "device");
+			dev.info.vid = ReadSysfsHex(path + "subsystem_vendor");
+			dev.info.pid = ReadSysfsHex(path + "subsystem_device");
+			dev.info.rev = ReadSysfsHex(path + "revision");
+			dev.info.slot = static_cast<U16>((bus << 8) | (slot << 3) | func);
+			list.push_back(dev);
+		}
+	}
+
+	std::vector<std::string> interfaces;
+	ListBoundDevices(rshSysUsbDriver, interfaces);
+
+	for(size_t i = 0; i < interfaces.size(); ++i)
+	{
+		std::string ifDir = std::string(rshSysUsbDriver) + interfaces[i];
+		std::string devDir = ifDir + "/../";
+
+		Device dev;
+		dev.bus = busUSB;
+		dev.driver = "lausb";
+		dev.location = FindMiscNode(ifDir);
+		dev.info.vid = ReadSysfsHex(devDir + "idVendor");
+		dev.info.pid = ReadSysfsHex(devDir + "idProduct");
+		dev.info.rev = ReadSysfsHex(devDir + "bcdDevice");
+		dev.info.slot = static_cast<U16>((ReadSysfsDec(devDir + "busnum") << 8) | ReadSysfsDec(devDir + "devnum"));
+
+		if(ReadSysfsString(devDir + "serial", dev.serial))
+		{
+			char* end = 0;
+			unsigned long sn = strtoul(dev.serial.c_str(), &end, 10);
+			if(end != dev.serial.c_str() && *end == '\0')
+				dev.info.serialNumber = static_cast<U32>(sn);
+		}
+
+		list.push_back(dev);
+	}
+
+	std::stable_sort(list.begin(), list.end(), BySlot);
+
+	// base is 1 based index among devices of the same model
+	for(size_t i = 0; i < list.size(); ++i)
+	{
+		U16 base = 1;
+		for(size_t j = 0; j < i; ++j)
+			if(list[j].info.pid == list[i].info.pid && list[j].info.vid == list[i].info.vid)
+				++base;
+		list[i].info.base = base;
+	}
+
+	return RSH_API_SUCCESS;
+}
+
+bool RshDeviceEnumerator::HotPlugOccurred()
+{
+	if(s_uevent < 0)
+	{
+		s_uevent = socket(AF_NETLINK, SOCK_DGRAM, NETLINK_KOBJECT_UEVENT);
+		if(s_uevent < 0)
+			return true; // no notifications - never trust the cache
+
+		struct sockaddr_nl addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.nl_family = AF_NETLINK;
+		addr.nl_groups = 1; // kernel uevents
+
+		if(bind(s_uevent, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0 ||
+		   fcntl(s_uevent, F_SETFL, fcntl(s_uevent, F_GETFL) | O_NONBLOCK) < 0)
+		{
+			close(s_uevent);
+			s_uevent = -1;
+			return true;
+		}
+		// socket is opened before first scan
+		return true;
+	}
+
+	bool changed = false;
+	char buf[2048];
+	for(;;)
+	{
+		ssize_t len = recv(s_uevent, buf, sizeof(buf) - 1, 0);
+		if(len < 0)
+		{
+			// ENOBUFS - events were lost, rescan to be sure
+			if(errno == ENOBUFS)
+				changed = true;
+			else if(errno != EINTR)
+				break;
+			continue;
+		}
+		buf[len] = '\0';
+		if(IsRshUevent(buf, static_cast<size_t>(len)))
+			changed = true;
+	}
+	return changed;
+}
+
+#else
+
+U32 RshDeviceEnumerator::Scan(std::vector<Device>& list)
+{
+	list.clear();
+	return RSH_API_FUNCTION_NOTSUPPORTED;
+}
+
+bool RshDeviceEnumerator::HotPlugOccurred()
+{
+	return true;
+}
+
+#endif
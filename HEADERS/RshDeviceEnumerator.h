@@ -0,0 +1,157 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDeviceEnumerator.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDeviceEnumerator class.
+ *
+ * One pass enumeration of all RSH devices with cached result.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDeviceEnumerator.
+ *
+ * Поиск всех устройств RSH за один проход с кэшированием результата.
+ *
+ */
+
+#ifndef RSH_DEVICE_ENUMERATOR_H
+#define RSH_DEVICE_ENUMERATOR_H
+
+#include "RshDefChk.h"
+#include "RshDeviceBaseInfo.h"
+#include "RshThread.h"
+
+#include <vector>
+#include <string>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Enumerate all RSH devices in one pass
+ *
+ * Devices served by PLX 9000 series drivers and by lausb driver
+ * are found by reading sysfs driver binding lists, so no device
+ * node is opened and no per index ioctl is issued.\n
+ * Result is cached process wide. Cache is invalidated by kernel
+ * hot-plug (uevent) notifications about devices of PLX drivers, PLX
+ * chips, lausb driver and RSH USB vendor, so repeated calls cost one
+ * non-blocking socket read until RSH device is plugged or unplugged.
+ *
+ * \remarks
+ * Only Linux is supported now, on other systems
+ * ::RSH_API_FUNCTION_NOTSUPPORTED is returned. Use
+ * ::RSH_GET_DEVICE_BASE_LIST_EXT there.
+ *
+ * \~russian
+ * \brief
+ * Поиск всех устройств RSH за один проход
+ *
+ * Устройства, обслуживаемые драйверами PLX 9000 и драйвером lausb,
+ * определяются по спискам привязки драйверов в sysfs, поэтому
+ * файлы устройств не открываются и не выполняется запрос ioctl
+ * для каждого индекса.\n
+ * Результат кэшируется для всего процесса. Кэш сбрасывается по
+ * уведомлениям ядра о подключении/отключении (uevent) устройств драйверов
+ * PLX, микросхем PLX, драйвера lausb и производителя USB RSH, поэтому
+ * повторные вызовы стоят одного неблокирующего чтения из сокета, пока не
+ * будет подключено или отключено устройство RSH.
+ *
+ * \remarks
+ * Сейчас поддерживается только Linux, в других системах
+ * возвращается ::RSH_API_FUNCTION_NOTSUPPORTED. Используйте
+ * ::RSH_GET_DEVICE_BASE_LIST_EXT.
+ *
+ */
+class RshDeviceEnumerator
+{
+public:
+
+	//! Bus device is connected to
+	enum BusType
+	{
+		busPCI = 0,
+		busUSB = 1
+	};
+
+	//! Enumerated device
+	struct Device
+	{
+		//! Base info. \b base is 1 based index among devices with the same \b pid.
+		RshDeviceBaseInfo info;
+		//! Bus type
+		BusType bus;
+		//! Kernel driver name (e.g. "Plx9054" or "lausb")
+		std::string driver;
+		//! PCI address ("0000:03:00.0") or USB device node ("/dev/lausb0")
+		std::string location;
+		//! Serial number string as reported by device (USB only)
+		std::string serial;
+	};
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Get list of all RSH devices
+	 *
+	 * \param[out] list Found devices, PCI devices first.
+	 * \param[in] rescan Ignore cache and read sysfs again.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or error code.
+	 *
+	 * \~russian
+	 * \brief
+	 * Получение списка всех устройств RSH
+	 *
+	 * \param[out] list Найденные устройства, сначала PCI.
+	 * \param[in] rescan Не использовать кэш, заново прочитать sysfs.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или код ошибки.
+	 *
+	 */
+	static U32 Enumerate(std::vector<Device>& list, bool rescan = false);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Get base info list in ::RSH_GET_DEVICE_BASE_LIST_EXT format
+	 *
+	 * \param[out] list Found devices.
+	 * \param[in] pid Return only devices with this product id, 0 - all devices.
+	 *
+	 * \~russian
+	 * \brief
+	 * Получение списка в формате ::RSH_GET_DEVICE_BASE_LIST_EXT
+	 *
+	 * \param[out] list Найденные устройства.
+	 * \param[in] pid Вернуть только устройства с данным кодом продукта, 0 - все устройства.
+	 *
+	 */
+	static U32 Enumerate(RSH_BUFFER_DEVICE_BASE_INFO& list, U16 pid = 0);
+
+	//! Drop cached list, next Enumerate() call will rescan
+	static void Invalidate();
+
+private:
+
+	RshDeviceEnumerator();
+
+	static U32 Scan(std::vector<Device>& list);
+	static bool HotPlugOccurred();
+
+	static RshMutex s_lock;
+	static std::vector<Device> s_cache;
+	static bool s_valid;
+	static int s_uevent;
+};
+
+#endif //RSH_DEVICE_ENUMERATOR_H
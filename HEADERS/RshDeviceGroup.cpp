@@ -0,0 +1,332 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDeviceGroup.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDeviceGroup class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDeviceGroup.
+ *
+ */
+
+#include "RshDeviceGroup.h"
+#include "RshConsts.h"
+
+// limit of blocks read to align one frame, protects from endless loop if device does not return data
+#define RSH_DEVICE_GROUP_MAX_SKIP 1024
+
+// no master in group
+#define RSH_DEVICE_GROUP_NO_MASTER 0xFFFFFFFF
+
+RshDeviceGroup::RshDeviceGroup() :
+	m_master(RSH_DEVICE_GROUP_NO_MASTER),
+	m_started(false),
+	m_frames(0),
+	m_realignments(0),
+	m_skew(0),
+	m_maxSkew(0)
+{ }
+
+RshDeviceGroup::~RshDeviceGroup()
+{
+	Stop();
+}
+
+U32 RshDeviceGroup::Add(IRshDevice* device, U32 role)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(m_started || (role == Master && m_master != RSH_DEVICE_GROUP_NO_MASTER))
+		return RSH_API_PARAMETER_INVALID;
+
+	Member member;
+	member.device = device;
+	member.role = (role == Master) ? Master : Slave;
+	if(role == Master)
+		m_master = static_cast<U32>(m_members.size());
+	m_members.push_back(member);
+	return RSH_API_SUCCESS;
+}
+
+void RshDeviceGroup::Clear()
+{
+	Stop();
+	m_members.clear();
+	m_master = RSH_DEVICE_GROUP_NO_MASTER;
+}
+
+U32 RshDeviceGroup::Devices() const
+{
+	return static_cast<U32>(m_members.size());
+}
+
+IRshDevice* RshDeviceGroup::Device(U32 index) const
+{
+	return (index < m_members.size()) ? m_members[index].device : 0;
+}
+
+U32 RshDeviceGroup::MasterIndex() const
+{
+	return (m_master == RSH_DEVICE_GROUP_NO_MASTER) ? Devices() : m_master;
+}
+
+U32 RshDeviceGroup::Init(U32 index, RshInitADC* init, U32 mode)
+{
+	if(index >= m_members.size())
+		return RSH_API_PARAMETER_OUTOFRANGE;
+	if(init == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	IRshDevice* device = m_members[index].device;
+	if(m_members[index].role == Slave)
+	{
+		RSH_U32 caps = RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH;
+		if(device->Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) != RSH_API_SUCCESS)
+			return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+		init->startType = RshInitADC::Master;
+	}
+	return device->Init(init, mode);
+}
+
+U32 RshDeviceGroup::Start()
+{
+	if(m_master == RSH_DEVICE_GROUP_NO_MASTER)
+		return RSH_API_PARAMETER_NOTINITIALIZED;
+	if(m_started)
+		Stop();
+
+	m_frames = 0;
+	m_realignments = 0;
+	m_skew = 0;
+	m_maxSkew = 0;
+	for(size_t i = 0; i < m_members.size(); ++i)
+	{
+		Member& member = m_members[i];
+		member.started = false;
+		member.block = RshBlockInfo();
+		member.baseSequence = 0;
+		member.firstTimestamp = 0;
+		member.lost = 0;
+		member.skipped = 0;
+	}
+
+	// slaves wait for master signal, so they must be armed before master starts
+	for(size_t i = 0; i <= m_members.size(); ++i)
+	{
+		const bool last = (i == m_members.size());
+		if(!last && i == m_master)
+			continue;
+
+		Member& member = m_members[last ? m_master : i];
+		U32 st = member.device->Start();
+		if(st != RSH_API_SUCCESS)
+		{
+			m_started = true;
+			Stop();
+			return st;
+		}
+		member.started = true;
+
+		// sequence of last block before start, so blocks lost before first frame are seen,
+		// devices without block info keep zero and are not aligned
+		RshBlockInfo info;
+		if(member.device->Get(RSH_GET_BUFFER_BLOCK_INFO, &info) == RSH_API_SUCCESS)
+			member.baseSequence = info.sequence;
+	}
+
+	m_started = true;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshDeviceGroup::Stop()
+{
+	if(!m_started)
+		return RSH_API_SUCCESS;
+
+	U32 result = RSH_API_SUCCESS;
+	for(size_t i = 0; i <= m_members.size(); ++i)
+	{
+		// master first, so slaves do not get start signal while stopping
+		const size_t index = (i == 0) ? m_master : i - 1;
+		if(i != 0 && index == m_master)
+			continue;
+
+		Member& member = m_members[index];
+		if(!member.started)
+			continue;
+
+		U32 st = member.device->Stop();
+		if(st != RSH_API_SUCCESS && result == RSH_API_SUCCESS)
+			result = st;
+		member.started = false;
+	}
+
+	m_started = false;
+	return result;
+}
+
+bool RshDeviceGroup::IsStarted() const
+{
+	return m_started;
+}
+
+U32 RshDeviceGroup::GetFrame(const std::vector<RshBaseType*>& buffers, U32 timeout)
+{
+	if(!m_started)
+		return RSH_API_DEVICE_WASNOTSTARTED;
+	if(buffers.size() != m_members.size())
+		return RSH_API_PARAMETER_INVALID;
+	for(size_t i = 0; i < buffers.size(); ++i)
+		if(buffers[i] == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+
+	for(size_t i = 0; i < m_members.size(); ++i)
+	{
+		U32 st = Read(m_members[i], buffers[i], timeout);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	U32 st = Align(buffers, timeout);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	U64 earliest = 0;
+	U64 latest = 0;
+	for(size_t i = 0; i < m_members.size(); ++i)
+	{
+		const U64 timestamp = m_members[i].block.timestamp;
+		if(timestamp == 0)
+			continue;
+		if(earliest == 0 || timestamp < earliest)
+			earliest = timestamp;
+		if(timestamp > latest)
+			latest = timestamp;
+	}
+	m_skew = static_cast<S64>(latest - earliest);
+	if(m_skew > m_maxSkew)
+		m_maxSkew = m_skew;
+
+	++m_frames;
+	return RSH_API_SUCCESS;
+}
+
+U64 RshDeviceGroup::Frames() const
+{
+	return m_frames;
+}
+
+const RshBlockInfo& RshDeviceGroup::LastBlock(U32 index) const
+{
+	return m_members[index].block;
+}
+
+U64 RshDeviceGroup::LostBlocks(U32 index) const
+{
+	return m_members[index].lost;
+}
+
+U64 RshDeviceGroup::SkippedBlocks(U32 index) const
+{
+	return m_members[index].skipped;
+}
+
+U64 RshDeviceGroup::Realignments() const
+{
+	return m_realignments;
+}
+
+S64 RshDeviceGroup::Skew() const
+{
+	return m_skew;
+}
+
+S64 RshDeviceGroup::MaxSkew() const
+{
+	return m_maxSkew;
+}
+
+S64 RshDeviceGroup::Drift(U32 index) const
+{
+	if(m_master == RSH_DEVICE_GROUP_NO_MASTER)
+		return 0;
+
+	const Member& member = m_members[index];
+	const Member& master = m_members[m_master];
+	if(member.firstTimestamp == 0 || master.firstTimestamp == 0)
+		return 0;
+
+	const S64 elapsed = static_cast<S64>(member.block.timestamp - member.firstTimestamp);
+	const S64 masterElapsed = static_cast<S64>(master.block.timestamp - master.firstTimestamp);
+	return elapsed - masterElapsed;
+}
+
+U32 RshDeviceGroup::Read(Member& member, RshBaseType* buffer, U32 timeout)
+{
+	RSH_U32 wait = timeout;
+	U32 st = member.device->Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	st = member.device->GetData(buffer);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	// zero sequence and time mean that driver does not provide them
+	RshBlockInfo info;
+	if(member.device->Get(RSH_GET_BUFFER_BLOCK_INFO, &info) != RSH_API_SUCCESS)
+		info = RshBlockInfo();
+
+	const U64 previous = (member.block.sequence != 0) ? member.block.sequence : member.baseSequence;
+	if(info.sequence != 0 && info.sequence > previous + 1)
+		member.lost += info.sequence - previous - 1;
+	if(member.firstTimestamp == 0)
+		member.firstTimestamp = info.timestamp;
+
+	member.block = info;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshDeviceGroup::Align(const std::vector<RshBaseType*>& buffers, U32 timeout)
+{
+	for(U32 round = 0; round < RSH_DEVICE_GROUP_MAX_SKIP; ++round)
+	{
+		// device which lost most blocks is ahead of others
+		U64 target = 0;
+		for(size_t i = 0; i < m_members.size(); ++i)
+		{
+			const Member& member = m_members[i];
+			if(member.block.sequence != 0 && member.block.sequence - member.baseSequence > target)
+				target = member.block.sequence - member.baseSequence;
+		}
+
+		bool aligned = true;
+		for(size_t i = 0; i < m_members.size(); ++i)
+		{
+			Member& member = m_members[i];
+			if(member.block.sequence == 0 || member.block.sequence - member.baseSequence >= target)
+				continue;
+
+			aligned = false;
+			++member.skipped;
+			U32 st = Read(member, buffers[i], timeout);
+			if(st != RSH_API_SUCCESS)
+				return st;
+		}
+
+		if(aligned)
+		{
+			if(round != 0)
+				++m_realignments;
+			return RSH_API_SUCCESS;
+		}
+	}
+
+	return RSH_API_DEVICE_CANTGETDATA;
+}
@@ -0,0 +1,294 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDeviceGroup.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDeviceGroup class.
+ *
+ * Synchronous data acquisition from several devices.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDeviceGroup.
+ *
+ * Синхронный сбор данных с нескольких устройств.
+ *
+ */
+
+#ifndef RSH_DEVICE_GROUP_H
+#define RSH_DEVICE_GROUP_H
+
+#include "RshDefChk.h"
+#include "RshBlockInfo.h"
+#include "RshInitADC.h"
+#include "IRshDevice.h"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Group of devices started from one master
+ *
+ * Devices connected with master-slave link (see
+ * ::RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH) are added to group, one of them
+ * as master. Init() sets RshInitADC::Master start type for slaves, Start()
+ * arms all slaves first and starts master last, so all devices begin
+ * acquisition on the same master signal.\n
+ * GetFrame() gets one block from every device. Blocks are checked using
+ * driver sequence numbers (::RSH_GET_BUFFER_BLOCK_INFO): lost blocks are
+ * counted, and if one device lost a block, blocks of other devices are
+ * skipped until sequence numbers counted from start match again, so frame
+ * always contains blocks acquired at the same time. Start of count is
+ * sequence number reported by device right after IRshDevice::Start(),
+ * so blocks lost before first frame are found too. Completion timestamps
+ * give skew between devices in frame and drift of each device relative
+ * to master.
+ *
+ * \remarks
+ * Blocks of devices which do not support ::RSH_GET_BUFFER_BLOCK_INFO
+ * (for now only RshSimulator and RshReplayDevice do) or return zero
+ * sequence numbers are taken as is: they are not checked for losses and
+ * not aligned, and group relies on common start signal only. Device
+ * objects are not owned by group.
+ *
+ * \~russian
+ * \brief
+ * Группа устройств, запускаемых от одного ведущего
+ *
+ * Устройства, соединенные линией ведущий-ведомый (см.
+ * ::RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH), добавляются в группу, одно из
+ * них - как ведущее. Init() устанавливает ведомым тип запуска
+ * RshInitADC::Master, Start() сначала переводит в ожидание все ведомые
+ * устройства, а затем запускает ведущее, поэтому все устройства начинают
+ * сбор по одному сигналу ведущего.\n
+ * GetFrame() получает по одному блоку с каждого устройства. Блоки
+ * проверяются по порядковым номерам драйвера (::RSH_GET_BUFFER_BLOCK_INFO):
+ * потерянные блоки подсчитываются, и если одно из устройств потеряло блок,
+ * блоки остальных устройств пропускаются, пока номера, отсчитанные от
+ * запуска, снова не совпадут, поэтому кадр всегда содержит блоки,
+ * собранные одновременно. Отсчет ведется от порядкового номера,
+ * возвращаемого устройством сразу после IRshDevice::Start(), поэтому
+ * обнаруживаются и блоки, потерянные до первого кадра. По времени завершения передачи вычисляется
+ * расхождение устройств в кадре и уход каждого устройства относительно ведущего.
+ *
+ * \remarks
+ * Блоки устройств, не поддерживающих ::RSH_GET_BUFFER_BLOCK_INFO (пока
+ * его поддерживают только RshSimulator и RshReplayDevice) или
+ * возвращающих нулевые порядковые номера, используются как есть: они не
+ * проверяются на потери и не выравниваются, и группа полагается только
+ * на общий сигнал запуска. Группа не владеет объектами устройств.
+ *
+ */
+class RshDeviceGroup
+{
+public:
+
+	//! Device role in group
+	enum Role
+	{
+		//! Device waits for start signal from master
+		Slave = 0x0,
+		//! Device generates start signal, only one in group
+		Master = 0x1
+	};
+
+	RshDeviceGroup();
+	~RshDeviceGroup();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Add connected device
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS or
+	 * ::RSH_API_PARAMETER_INVALID if group already has master
+	 * or is started.
+	 *
+	 * \~russian
+	 * \brief
+	 * Добавление подключенного устройства
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS или
+	 * ::RSH_API_PARAMETER_INVALID, если в группе уже есть
+	 * ведущее устройство или группа запущена.
+	 *
+	 */
+	U32 Add(IRshDevice* device, U32 role = Slave);
+
+	//! Stop and remove all devices
+	void Clear();
+
+	//! Number of devices, index of device is order of Add() calls
+	U32 Devices() const;
+
+	//! Device by index
+	IRshDevice* Device(U32 index) const;
+
+	//! Index of master device, Devices() if there is no master
+	U32 MasterIndex() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Initialize device of group
+	 *
+	 * For slave devices RshInitADC::startType is set to
+	 * RshInitADC::Master, other fields are used as is.
+	 *
+	 * \return
+	 * Result of IRshDevice::Init() or
+	 * ::RSH_API_DEVICE_FUNCTION_NOTSUPPORTED if slave
+	 * device has no ::RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH.
+	 *
+	 * \~russian
+	 * \brief
+	 * Инициализация устройства группы
+	 *
+	 * Для ведомых устройств поле RshInitADC::startType
+	 * устанавливается в RshInitADC::Master, остальные поля
+	 * используются без изменений.
+	 *
+	 * \return
+	 * Результат IRshDevice::Init() или
+	 * ::RSH_API_DEVICE_FUNCTION_NOTSUPPORTED, если ведомое
+	 * устройство не поддерживает ::RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH.
+	 *
+	 */
+	U32 Init(U32 index, RshInitADC* init, U32 mode = RSH_INIT_MODE_INIT);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Start group
+	 *
+	 * Slaves are started in order of adding, master is started last.
+	 * If any device fails to start, devices already started are stopped.
+	 * Frame counters are reset.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_NOTINITIALIZED
+	 * if group has no master or error of IRshDevice::Start().
+	 *
+	 * \~russian
+	 * \brief
+	 * Запуск группы
+	 *
+	 * Ведомые устройства запускаются в порядке добавления, ведущее -
+	 * последним. Если какое-либо устройство не запустилось, уже
+	 * запущенные устройства останавливаются. Счетчики кадров сбрасываются.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_NOTINITIALIZED,
+	 * если в группе нет ведущего устройства, или ошибка IRshDevice::Start().
+	 *
+	 */
+	U32 Start();
+
+	//! Stop master first, then slaves. Returns first error
+	U32 Stop();
+
+	//! True between Start() and Stop()
+	bool IsStarted() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Get time aligned frame
+	 *
+	 * Waits for data of each device and gets it with IRshDevice::GetData().
+	 *
+	 * \param[in,out] buffers One buffer per device, in order of adding.
+	 * \param[in] timeout Wait time for each device, ms.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID if number of
+	 * buffers is wrong, ::RSH_API_DEVICE_WASNOTSTARTED,
+	 * ::RSH_API_EVENT_WAITTIMEOUT or other device error.
+	 *
+	 * \~russian
+	 * \brief
+	 * Получение выровненного по времени кадра
+	 *
+	 * Ожидает готовности данных каждого устройства и получает их
+	 * методом IRshDevice::GetData().
+	 *
+	 * \param[in,out] buffers По одному буферу на устройство, в порядке добавления.
+	 * \param[in] timeout Время ожидания каждого устройства, мс.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID при неверном
+	 * числе буферов, ::RSH_API_DEVICE_WASNOTSTARTED,
+	 * ::RSH_API_EVENT_WAITTIMEOUT или другая ошибка устройства.
+	 *
+	 */
+	U32 GetFrame(const std::vector<RshBaseType*>& buffers, U32 timeout = 1000);
+
+	//! Frames returned since Start()
+	U64 Frames() const;
+
+	//! Block info of device in last frame
+	const RshBlockInfo& LastBlock(U32 index) const;
+
+	//! Blocks lost by driver of device since Start() (gaps in sequence numbers)
+	U64 LostBlocks(U32 index) const;
+
+	//! Blocks of device skipped to align frames since Start()
+	U64 SkippedBlocks(U32 index) const;
+
+	//! Frames which needed alignment since Start()
+	U64 Realignments() const;
+
+	//! Difference between latest and earliest block completion in last frame, ns
+	S64 Skew() const;
+
+	//! Maximum Skew() since Start(), ns
+	S64 MaxSkew() const;
+
+	//! Time since first frame measured by device minus the same time of master, ns
+	S64 Drift(U32 index) const;
+
+private:
+
+	RshDeviceGroup(const RshDeviceGroup&);
+	RshDeviceGroup& operator=(const RshDeviceGroup&);
+
+	struct Member
+	{
+		Member() : device(0), role(Slave), started(false), baseSequence(0), firstTimestamp(0), lost(0), skipped(0) {}
+
+		IRshDevice* device;
+		U32 role;
+		bool started;
+		RshBlockInfo block;
+		//! Sequence number reported right after Start(), blocks are counted from it
+		U64 baseSequence;
+		U64 firstTimestamp;
+		U64 lost;
+		U64 skipped;
+	};
+
+	U32 Read(Member& member, RshBaseType* buffer, U32 timeout);
+	U32 Align(const std::vector<RshBaseType*>& buffers, U32 timeout);
+
+	std::vector<Member> m_members;
+	U32 m_master;
+	bool m_started;
+	U64 m_frames;
+	U64 m_realignments;
+	S64 m_skew;
+	S64 m_maxSkew;
+};
+
+#endif //RSH_DEVICE_GROUP_H
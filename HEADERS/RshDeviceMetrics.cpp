@@ -0,0 +1,102 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDeviceMetrics.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDeviceMetrics class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDeviceMetrics.
+ *
+ */
+
+#include "RshDeviceMetrics.h"
+
+RshDeviceMetrics::RshDeviceMetrics() :
+	RshBaseType(rshDeviceMetrics, sizeof (RshDeviceMetrics)),
+	blocks(0),
+	bytes(0),
+	overruns(0),
+	droppedBlocks(0),
+	errors(0),
+	waitTimeouts(0),
+	elapsed(0),
+	byteRate(0.0),
+	latencyMean(0.0),
+	latencyP50(0),
+	latencyP99(0),
+	latencyMax(0),
+	getDataMean(0.0),
+	getDataP50(0),
+	getDataP99(0),
+	getDataMax(0)
+{ }
+
+RshDeviceMetrics::RshDeviceMetrics(const RshDeviceMetrics& obj) :
+	RshBaseType(rshDeviceMetrics, sizeof (RshDeviceMetrics))
+{
+	operator=(obj);
+}
+
+RshDeviceMetrics& RshDeviceMetrics::operator=(const RshDeviceMetrics& obj)
+{
+	if(this == &obj)
+		return *this;
+
+	this->blocks = obj.blocks;
+	this->bytes = obj.bytes;
+	this->overruns = obj.overruns;
+	this->droppedBlocks = obj.droppedBlocks;
+	this->errors = obj.errors;
+	this->waitTimeouts = obj.waitTimeouts;
+	this->elapsed = obj.elapsed;
+	this->byteRate = obj.byteRate;
+	this->latencyMean = obj.latencyMean;
+	this->latencyP50 = obj.latencyP50;
+	this->latencyP99 = obj.latencyP99;
+	this->latencyMax = obj.latencyMax;
+	this->getDataMean = obj.getDataMean;
+	this->getDataP50 = obj.getDataP50;
+	this->getDataP99 = obj.getDataP99;
+	this->getDataMax = obj.getDataMax;
+	return *this;
+}
+
+bool RshDeviceMetrics::operator==(const RshDeviceMetrics& obj) const
+{
+	return blocks == obj.blocks &&
+		bytes == obj.bytes &&
+		overruns == obj.overruns &&
+		droppedBlocks == obj.droppedBlocks &&
+		errors == obj.errors &&
+		waitTimeouts == obj.waitTimeouts &&
+		elapsed == obj.elapsed &&
+		byteRate == obj.byteRate &&
+		latencyMean == obj.latencyMean &&
+		latencyP50 == obj.latencyP50 &&
+		latencyP99 == obj.latencyP99 &&
+		latencyMax == obj.latencyMax &&
+		getDataMean == obj.getDataMean &&
+		getDataP50 == obj.getDataP50 &&
+		getDataP99 == obj.getDataP99 &&
+		getDataMax == obj.getDataMax;
+}
+
+bool RshDeviceMetrics::operator!=(const RshDeviceMetrics& obj) const
+{
+	return !( operator==(obj) );
+}
+
+std::ostream& operator<< (std::ostream &out, const RshDeviceMetrics& obj)
+{
+	return out << "[blocks=" << obj.blocks << "; bytes=" << obj.bytes << "; rate=" << obj.byteRate << "B/s"
+		<< "; overruns=" << obj.overruns << "; dropped=" << obj.droppedBlocks
+		<< "; errors=" << obj.errors << "; timeouts=" << obj.waitTimeouts
+		<< "; latency=" << obj.latencyP50 << "/" << obj.latencyP99 << "/" << obj.latencyMax << "ns"
+		<< "; getData=" << obj.getDataP50 << "/" << obj.getDataP99 << "/" << obj.getDataMax << "ns]";
+}
@@ -0,0 +1,109 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDeviceMetrics.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshDeviceMetrics class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshDeviceMetrics.
+ *
+ */
+
+#ifndef RSH_DEVICE_METRICS_H
+#define RSH_DEVICE_METRICS_H
+
+#include "RshBaseType.h"
+
+#include <ostream>
+
+#pragma pack(push, 8)
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Acquisition metrics of device.
+ *
+ * Snapshot of counters collected by RshMonitoredDevice since its
+ * creation or RshMonitoredDevice::Reset(). Latency is time from return
+ * of ::RSH_GET_WAIT_BUFFER_READY_EVENT to call of IRshDevice::GetData(),
+ * that is how long application was busy before taking ready block.
+ * Lost blocks are found by gaps in sequence numbers of
+ * ::RSH_GET_BUFFER_BLOCK_INFO, so they are counted only for devices
+ * with ::RSH_CAPS_DEVICE_BLOCK_TIMESTAMP.
+ *
+ * \see
+ * RSH_GET_DEVICE_METRICS | RshMonitoredDevice
+ *
+ * \~russian
+ * \brief
+ * Метрики сбора данных устройства.
+ *
+ * Мгновенные значения счетчиков, собранных RshMonitoredDevice с момента
+ * его создания или вызова RshMonitoredDevice::Reset(). Задержка - время
+ * от возврата из ::RSH_GET_WAIT_BUFFER_READY_EVENT до вызова
+ * IRshDevice::GetData(),
+ * то есть сколько приложение было занято, прежде чем забрать готовый блок.
+ * Потерянные блоки определяются по пропускам порядковых номеров
+ * ::RSH_GET_BUFFER_BLOCK_INFO, поэтому считаются только для устройств
+ * с ::RSH_CAPS_DEVICE_BLOCK_TIMESTAMP.
+ *
+ * \see
+ * RSH_GET_DEVICE_METRICS | RshMonitoredDevice
+ *
+ */
+struct RshDeviceMetrics : public RshBaseType {
+
+	//! Blocks returned by GetData()
+	U64 blocks;
+	//! Bytes written to user buffers by GetData()
+	U64 bytes;
+	//! Number of gaps in block sequence numbers (buffer overruns)
+	U64 overruns;
+	//! Number of blocks lost in these gaps
+	U64 droppedBlocks;
+	//! Failed GetData() calls
+	U64 errors;
+	//! Waits for ready buffer which timed out
+	U64 waitTimeouts;
+	//! Time since start of collection, ns
+	U64 elapsed;
+	//! bytes / elapsed, bytes per second
+	double byteRate;
+
+	//! Mean wait to GetData latency, ns
+	double latencyMean;
+	//! Median wait to GetData latency, ns
+	U64 latencyP50;
+	//! 99th percentile of wait to GetData latency, ns
+	U64 latencyP99;
+	//! Maximum wait to GetData latency, ns
+	U64 latencyMax;
+
+	//! Mean GetData() duration, ns
+	double getDataMean;
+	//! Median GetData() duration, ns
+	U64 getDataP50;
+	//! 99th percentile of GetData() duration, ns
+	U64 getDataP99;
+	//! Maximum GetData() duration, ns
+	U64 getDataMax;
+
+	RshDeviceMetrics();
+	RshDeviceMetrics(const RshDeviceMetrics& obj);
+	RshDeviceMetrics& operator=(const RshDeviceMetrics& obj);
+	bool operator==(const RshDeviceMetrics& obj) const;
+	bool operator!=(const RshDeviceMetrics& obj) const;
+
+	friend std::ostream& operator<< (std::ostream &out, const RshDeviceMetrics& obj);
+};
+
+#pragma pack(pop)
+
+#endif //RSH_DEVICE_METRICS_H
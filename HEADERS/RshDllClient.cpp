@@ -22,6 +22,7 @@
 #define RSHDLLCLIENT_CPP
 
 #include "RshDllClient.h"
+#include "RshTrace.h"
 
 #if defined(RSH_MSWINDOWS)
 
@@ -217,6 +218,7 @@ U32 RshDllClient::GetDPALibraryInterface(IN OUT RshDllInterfaceKey& key)
 
 U32 RshDllClient::GetDeviceInterface(IN OUT RshDllInterfaceKey& key)
 {
+	RSH_TRACE_SCOPE("client", "GetDeviceInterface");
 	return GetInterface(key, std::string(RSH_KEY_PATH_DRV), std::string("IRshDevice"));
 }
 
@@ -334,6 +336,7 @@ U32 RshDllClient::GetLibraryInterface(IN OUT RshDllInterfaceKey& key,IN const st
 
 U32 RshDllClient::GetDeviceInterface(IN OUT RshDllInterfaceKey& key)
 {
+	RSH_TRACE_SCOPE("client", "GetDeviceInterface");
     return GetInterface(key._Name, "IRshDevice", path_RSHBoardLibs,
 			key._Interface, key._Factory, key._Parameter);
 }
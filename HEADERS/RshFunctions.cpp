@@ -24,6 +24,7 @@
 
 #include "RshFunctions.h"
 #include "RshMacro.h"
+#include "RshRandom.h"
 #include <limits>
 
 U64 RshMix() // tries to get unique number
@@ -187,141 +188,9 @@ U32 RshCopyStringToBuffer(const char* str, RshBufferType<U8, rshBufferTypeU8>& u
 template<typename T, RshDataTypes dataCode>
 U32 RshFillBufferWithRandomNumbers(RshBufferType<T, dataCode>& userBuffer, U32 seed)
 {
-	return RSH_API_PARAMETER_NOTSUPPORTED;
-}
-
-//specializations for numeric buffer types
-template<>
-U32 RshFillBufferWithRandomNumbers<U8, rshBufferTypeU8>(RshBufferType<U8, rshBufferTypeU8>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-	
-	const int max = std::numeric_limits<U8>::max();
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] = rand() % max;
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
-}
-
-template<>
-U32 RshFillBufferWithRandomNumbers<S8, rshBufferTypeS8>(RshBufferType<S8, rshBufferTypeS8>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-
-	const int min = std::numeric_limits<S8>::min();
-	const int max = std::numeric_limits<S8>::max();
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] = min + rand() % (max - min);
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
-}
-
-template<>
-U32 RshFillBufferWithRandomNumbers<U16, rshBufferTypeU16>(RshBufferType<U16, rshBufferTypeU16>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] = rand();
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
-}
-
-template<>
-U32 RshFillBufferWithRandomNumbers<S16, rshBufferTypeS16>(RshBufferType<S16, rshBufferTypeS16>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] =-RAND_MAX/2 + rand();
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
-}
-
-template<>
-U32 RshFillBufferWithRandomNumbers<U32, rshBufferTypeU32>(RshBufferType<U32, rshBufferTypeU32>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] = rand();
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
-}
-
-template<>
-U32 RshFillBufferWithRandomNumbers<S32, rshBufferTypeS32>(RshBufferType<S32, rshBufferTypeS32>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] = -RAND_MAX/2 + rand();
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
-}
-
-template<>
-U32 RshFillBufferWithRandomNumbers<double, rshBufferTypeDouble>(RshBufferType<double, rshBufferTypeDouble>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] = -RAND_MAX/2 + rand();
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
-}
-
-template<>
-U32 RshFillBufferWithRandomNumbers<float, rshBufferTypeFloat>(RshBufferType<float, rshBufferTypeFloat>& userBuffer, U32 seed)
-{
-	if (seed ==0)
-		std::srand((unsigned int) RshMix());
-	else
-		std::srand(seed);
-	
-	for (size_t i = 0; i < userBuffer.PSize(); ++i)
-		userBuffer.ptr[i] = static_cast<float>(-RAND_MAX/2 + rand());
-
-	userBuffer.SetSize(userBuffer.PSize());
-
-	return RSH_API_SUCCESS;	
+	// local generator: reentrant and does not change application's std::rand() state
+	RshRandom generator(seed);
+	return generator.FillUniform(userBuffer);
 }
 
 
@@ -464,30 +464,39 @@ U32 RshCopyStringToBuffer(const char* str, RshBufferType<T, dataCode>& userBuffe
 	* Fill buffer with random numbers.
 	*
 	* \param[in] seed
-	* Seed for std::srand() function.
+	* Seed for random number generator.
 	* If no seed specified (or zero seed passed)
 	* random seed generated by ::RshMix() function
 	* will be used.
 	*
 	* Buffer will be filled with random numbers,
-	* generated by std::rand() function.
+	* generated by RshRandom::FillUniform(): integer buffers
+	* get values from the whole range of element type,
+	* floating point buffers get values in [-1, 1).
+	* Function does not change std::rand() state and can be
+	* called from several threads at once.
 	* RshBufferType::Size() field will be equal
 	* to RshBufferType::PSize() after this method call.
 	*
 	* \see
-	* ::RshMix()
+	* ::RshMix() | RshRandom
 	*
 	* \~russian
 	* \brief
 	* Заполнение буфера случайными числами.
 	*
 	* \param[in] seed
-	* Зерно для функции  std::srand().
+	* Зерно генератора случайных чисел.
 	* По умолчанию (seed = 0) будет использовано
 	* значение, полученное с помощью функции ::RshMix().
 	*
 	* Буфер будет заполнен случайными числами, сгенеренными
-	* функцией std::rand(). После выполнения этого метода,
+	* методом RshRandom::FillUniform(): целочисленные буферы
+	* заполняются значениями из всего диапазона типа, буферы
+	* с плавающей точкой - значениями из [-1, 1).
+	* Функция не изменяет состояние std::rand() и может
+	* вызываться из нескольких потоков одновременно.
+	* После выполнения этого метода,
 	* поле RshBufferType::Size() станет равным RshBufferType::PSize().
 	*
 	*/	
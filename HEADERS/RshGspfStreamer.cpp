@@ -0,0 +1,227 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshGspfStreamer.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshGspfStreamer class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshGspfStreamer.
+ *
+ */
+
+#include "RshGspfStreamer.h"
+#include "RshConsts.h"
+
+// worker waits for interrupt in slices of this length to react on Stop()
+#define RSH_GSPF_STREAMER_WAIT_MS 100
+
+RshGspfStreamer::RshGspfStreamer(U32 queueCapacity) :
+	m_device(0),
+	m_gapless(false),
+	m_stop(false),
+	m_lastError(RSH_API_SUCCESS),
+	m_underruns(0),
+	m_blocks(0),
+	m_underrunSamples(0),
+	m_half(0),
+	m_queue(queueCapacity)
+{ }
+
+RshGspfStreamer::~RshGspfStreamer()
+{
+	Stop();
+}
+
+U32 RshGspfStreamer::Push(const RSH_BUFFER_S16& block)
+{
+	U32 count = static_cast<U32>(block.Size());
+	if(count == 0)
+		return RSH_API_SUCCESS;
+	if(m_queue.Free() < count)
+		return RSH_API_BUFFER_INSUFFICIENTSIZE;
+
+	m_queue.PushBlock(block.ptr, count);
+	return RSH_API_SUCCESS;
+}
+
+U32 RshGspfStreamer::Start(IRshDevice* device, RshInitGSPF& init, U32 halfSize)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(halfSize == 0)
+		return RSH_API_BUFFER_ZEROSIZE;
+	if(m_thread.IsRunning())
+		return RSH_API_THREAD_CANTCREATE;
+
+	m_device = device;
+	m_stop = false;
+	m_lastError = RSH_API_SUCCESS;
+	m_underruns = 0;
+	m_blocks = 0;
+	m_underrunSamples = 0;
+
+	RSH_U32 caps = RSH_CAPS_DEVICE_STREAMING_PLAYBACK;
+	m_gapless = (m_device->Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) == RSH_API_SUCCESS);
+
+	if(m_gapless)
+		init.SetPlayModeLoop();
+	else
+		init.SetPlayModeOnce();
+
+	U32 st = m_device->Init(&init);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	st = m_half.Allocate(halfSize);
+	if(st != RSH_API_SUCCESS)
+		return st;
+	m_half.SetSize(halfSize);
+
+	if(m_gapless)
+	{
+		// both halves are uploaded before start
+		RSH_BUFFER_S16 first(2 * halfSize);
+		Fill(first.ptr, halfSize);
+		Fill(first.ptr + halfSize, halfSize);
+		first.SetSize(2 * halfSize);
+		st = m_device->GetData(&first);
+		m_blocks = 2;
+	}
+	else
+	{
+		Fill(m_half.ptr, halfSize);
+		st = m_device->GetData(&m_half);
+		m_blocks = 1;
+	}
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	st = m_device->Start();
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	st = m_thread.Start(&RshGspfStreamer::Routine, this);
+	if(st != RSH_API_SUCCESS)
+		m_device->Stop();
+	return st;
+}
+
+U32 RshGspfStreamer::Stop()
+{
+	if(!m_thread.IsRunning())
+		return RSH_API_SUCCESS;
+
+	{
+		// worker does not start device after this block
+		RshMutexLocker locker(m_lock);
+		m_stop = true;
+		// also wakes up worker waiting for interrupt
+		m_device->Stop();
+	}
+	return m_thread.Join();
+}
+
+bool RshGspfStreamer::IsGapless() const
+{
+	return m_gapless;
+}
+
+U32 RshGspfStreamer::Queued() const
+{
+	return m_queue.Count();
+}
+
+U32 RshGspfStreamer::Free() const
+{
+	return m_queue.Free();
+}
+
+U64 RshGspfStreamer::BlocksUploaded() const
+{
+	return m_blocks;
+}
+
+U32 RshGspfStreamer::Underruns() const
+{
+	return m_underruns;
+}
+
+U64 RshGspfStreamer::UnderrunSamples() const
+{
+	return m_underrunSamples;
+}
+
+U32 RshGspfStreamer::LastError() const
+{
+	return m_lastError;
+}
+
+void RshGspfStreamer::Routine(void* param)
+{
+	static_cast<RshGspfStreamer*>(param)->Run();
+}
+
+void RshGspfStreamer::Run()
+{
+	const U32 halfSize = static_cast<U32>(m_half.Size());
+
+	while(!m_stop)
+	{
+		// prepare next half while current one is playing
+		Fill(m_half.ptr, halfSize);
+
+		U32 st;
+		do
+		{
+			RSH_U32 timeout = RSH_GSPF_STREAMER_WAIT_MS;
+			st = m_device->Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &timeout);
+		} while(st == RSH_API_EVENT_WAITTIMEOUT && !m_stop);
+
+		if(m_stop)
+			break;
+		if(st != RSH_API_SUCCESS)
+		{
+			m_lastError = st;
+			break;
+		}
+
+		if(m_gapless)
+		{
+			st = m_device->GetData(&m_half, RSH_DATA_MODE_GSPF_STREAM_BLOCK);
+		}
+		else
+		{
+			RshMutexLocker locker(m_lock);
+			if(m_stop)
+				break;
+			st = m_device->GetData(&m_half);
+			if(st == RSH_API_SUCCESS)
+				st = m_device->Start();
+		}
+
+		if(st != RSH_API_SUCCESS)
+		{
+			m_lastError = st;
+			break;
+		}
+		++m_blocks;
+	}
+}
+
+void RshGspfStreamer::Fill(S16* dst, U32 count)
+{
+	U32 taken = m_queue.PopBlock(dst, count);
+	if(taken < count)
+	{
+		for(U32 i = taken; i < count; ++i)
+			dst[i] = 0;
+		__rshatomicadd32(&m_underruns, 1);
+		m_underrunSamples += count - taken;
+	}
+}
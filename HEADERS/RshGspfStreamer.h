@@ -0,0 +1,195 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshGspfStreamer.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshGspfStreamer class.
+ *
+ * Continuous playback of data stream on GSPF generators.
+ *
+ * \~russian
+ * \brief
+ * Класс RshGspfStreamer.
+ *
+ * Непрерывное проигрывание потока данных на генераторах ГСПФ.
+ *
+ */
+
+#ifndef RSH_GSPF_STREAMER_H
+#define RSH_GSPF_STREAMER_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshInitGSPF.h"
+#include "RshRingBuffer.h"
+#include "RshThread.h"
+#include "IRshDevice.h"
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Streaming playback for GSPF generators
+ *
+ * Application pushes blocks of DAC codes (see RshWaveformGenerator)
+ * into lock-free queue while device plays. Device is initialized in
+ * RshInitGSPF::PlayOnce mode with buffer of one half: worker thread
+ * prepares next half from the queue while current one is played, and
+ * on each ::RSH_GET_WAIT_BUFFER_READY_EVENT uploads it and starts device
+ * again, so signal of any length is played with short pause between
+ * halves (time of upload and start).\n
+ * If queue does not contain enough samples when half must be uploaded,
+ * missing samples are filled with zero code and counted as underrun.\n
+ * After Stop() returns, device is stopped and is not started again
+ * by worker thread.
+ *
+ * \remarks
+ * Device abstraction library with ::RSH_CAPS_DEVICE_STREAMING_PLAYBACK
+ * capability is driven in RshInitGSPF::PlayLoop mode instead: both
+ * halves are uploaded before start and each next half is written with
+ * ::RSH_DATA_MODE_GSPF_STREAM_BLOCK while the other one is played, so
+ * there is no pause (see IsGapless()). Current board libraries do not
+ * have this capability.
+ *
+ * \~russian
+ * \brief
+ * Потоковое проигрывание для генераторов ГСПФ
+ *
+ * Приложение помещает блоки кодов ЦАП (см. RshWaveformGenerator)
+ * в очередь без блокировок, пока устройство проигрывает сигнал.
+ * Устройство инициализируется в режиме RshInitGSPF::PlayOnce с буфером
+ * из одной половины: рабочий поток готовит следующую половину из очереди,
+ * пока проигрывается текущая, и по каждому событию
+ * ::RSH_GET_WAIT_BUFFER_READY_EVENT передает ее и снова запускает
+ * устройство, поэтому сигнал любой длительности проигрывается с короткой
+ * паузой между половинами (время передачи и запуска).\n
+ * Если в очереди недостаточно отсчетов, недостающие отсчеты
+ * заполняются нулевым кодом и учитываются как опустошение очереди.\n
+ * После возврата из Stop() устройство остановлено и больше не
+ * запускается рабочим потоком.
+ *
+ * \remarks
+ * Библиотека абстракции с возможностью ::RSH_CAPS_DEVICE_STREAMING_PLAYBACK
+ * используется в режиме RshInitGSPF::PlayLoop: обе половины передаются
+ * до запуска, а каждая следующая записывается с флагом
+ * ::RSH_DATA_MODE_GSPF_STREAM_BLOCK, пока проигрывается другая, поэтому
+ * пауз нет (см. IsGapless()). Существующие библиотеки устройств этой
+ * возможностью не обладают.
+ *
+ */
+class RshGspfStreamer
+{
+public:
+
+	//! \b queueCapacity - queue size in samples, rounded up to power of two
+	explicit RshGspfStreamer(U32 queueCapacity = 4 * 1024 * 1024);
+	~RshGspfStreamer();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Add samples to playback queue
+	 *
+	 * Block is added entirely or not added at all.
+	 * Can be called from any one producer thread.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_BUFFER_INSUFFICIENTSIZE
+	 * if there is no space in queue now.
+	 *
+	 * \~russian
+	 * \brief
+	 * Добавление отсчетов в очередь проигрывания
+	 *
+	 * Блок добавляется целиком или не добавляется совсем.
+	 * Может вызываться из одного потока-источника данных.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_BUFFER_INSUFFICIENTSIZE,
+	 * если в очереди сейчас нет места.
+	 *
+	 */
+	U32 Push(const RSH_BUFFER_S16& block);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Initialize device and start playback
+	 *
+	 * Play mode in \b init is set by streamer, other fields are used
+	 * as is. First two halves are taken from queue, so push some
+	 * data before start to avoid initial underrun.
+	 *
+	 * \param[in] device Connected GSPF device.
+	 * \param[in,out] init Generation parameters.
+	 * \param[in] halfSize Size of one half of playback buffer, samples.
+	 *
+	 * \~russian
+	 * \brief
+	 * Инициализация устройства и запуск проигрывания
+	 *
+	 * Режим проигрывания в \b init устанавливается автоматически, остальные
+	 * поля используются без изменений. Первые две половины берутся
+	 * из очереди, поэтому до запуска нужно поместить в нее данные.
+	 *
+	 * \param[in] device Подключенное устройство ГСПФ.
+	 * \param[in,out] init Параметры генерации.
+	 * \param[in] halfSize Размер половины буфера проигрывания в отсчетах.
+	 *
+	 */
+	U32 Start(IRshDevice* device, RshInitGSPF& init, U32 halfSize);
+
+	//! Stop device and wait for worker thread to exit
+	U32 Stop();
+
+	//! True if device supports ::RSH_CAPS_DEVICE_STREAMING_PLAYBACK
+	bool IsGapless() const;
+
+	//! Samples waiting in queue
+	U32 Queued() const;
+
+	//! Free space in queue, samples
+	U32 Free() const;
+
+	//! Number of halves uploaded to device
+	U64 BlocksUploaded() const;
+
+	//! Number of halves which were not completely filled from queue
+	U32 Underruns() const;
+
+	//! Total number of zero samples inserted because of underruns
+	U64 UnderrunSamples() const;
+
+	//! Last error returned by device in worker thread
+	U32 LastError() const;
+
+private:
+
+	RshGspfStreamer(const RshGspfStreamer&);
+	RshGspfStreamer& operator=(const RshGspfStreamer&);
+
+	static void Routine(void* param);
+	void Run();
+	void Fill(S16* dst, U32 count);
+
+	IRshDevice* m_device;
+	bool m_gapless;
+	volatile bool m_stop;
+	//! Makes check of m_stop and start of device atomic against Stop()
+	RshMutex m_lock;
+	volatile U32 m_lastError;
+	volatile U32 m_underruns;
+	U64 m_blocks;
+	U64 m_underrunSamples;
+	RSH_BUFFER_S16 m_half;
+	RshRingBuffer<S16> m_queue;
+	RshThread m_thread;
+};
+
+#endif //RSH_GSPF_STREAMER_H
@@ -0,0 +1,160 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshHistogram.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshHistogram class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshHistogram.
+ *
+ */
+
+#include "RshHistogram.h"
+
+// 2^5 buckets per power of two
+#define RSH_HISTOGRAM_SUB_BITS 5
+#define RSH_HISTOGRAM_SUB_COUNT (1U << RSH_HISTOGRAM_SUB_BITS)
+
+// minimum is kept as this value when histogram is empty
+#define RSH_HISTOGRAM_NO_MIN 0xFFFFFFFFFFFFFFFFULL
+
+RshHistogram::RshHistogram()
+{
+	Reset();
+}
+
+void RshHistogram::Record(U64 value)
+{
+	__rshatomicadd64(&m_buckets[BucketIndex(value)], 1);
+	__rshatomicadd64(&m_sum, value);
+
+	U64 current = m_min;
+	while(value < current)
+	{
+		const U64 previous = __rshatomiccas64(&m_min, current, value);
+		if(previous == current)
+			break;
+		current = previous;
+	}
+
+	current = m_max;
+	while(value > current)
+	{
+		const U64 previous = __rshatomiccas64(&m_max, current, value);
+		if(previous == current)
+			break;
+		current = previous;
+	}
+
+	// count is incremented last, so reader never sees more values than bucket counts
+	__rshatomicadd64(&m_count, 1);
+}
+
+void RshHistogram::Reset()
+{
+	for(U32 i = 0; i < BucketCount; ++i)
+		m_buckets[i] = 0;
+	m_count = 0;
+	m_sum = 0;
+	m_min = RSH_HISTOGRAM_NO_MIN;
+	m_max = 0;
+	__rshmembarrier();
+}
+
+U64 RshHistogram::Count() const
+{
+	return __rshatomicload64(&m_count);
+}
+
+U64 RshHistogram::Sum() const
+{
+	return __rshatomicload64(&m_sum);
+}
+
+U64 RshHistogram::Min() const
+{
+	const U64 value = __rshatomicload64(&m_min);
+	return (value == RSH_HISTOGRAM_NO_MIN) ? 0 : value;
+}
+
+U64 RshHistogram::Max() const
+{
+	return __rshatomicload64(&m_max);
+}
+
+double RshHistogram::Mean() const
+{
+	const U64 count = Count();
+	return (count == 0) ? 0.0 : static_cast<double>(Sum()) / count;
+}
+
+U64 RshHistogram::Percentile(double fraction) const
+{
+	const U64 count = Count();
+	if(count == 0)
+		return 0;
+
+	if(fraction < 0.0)
+		fraction = 0.0;
+	if(fraction > 1.0)
+		fraction = 1.0;
+
+	// rank of value, 1 based
+	U64 rank = static_cast<U64>(fraction * count + 0.5);
+	if(rank == 0)
+		rank = 1;
+
+	const U64 max = Max();
+	U64 seen = 0;
+	for(U32 i = 0; i < BucketCount; ++i)
+	{
+		seen += __rshatomicload64(&m_buckets[i]);
+		if(seen >= rank)
+		{
+			const U64 bound = BucketUpperBound(i);
+			return (bound < max) ? bound : max;
+		}
+	}
+	return max;
+}
+
+U64 RshHistogram::Bucket(U32 index) const
+{
+	return (index < BucketCount) ? __rshatomicload64(&m_buckets[index]) : 0;
+}
+
+U64 RshHistogram::BucketUpperBound(U32 index)
+{
+	if(index < RSH_HISTOGRAM_SUB_COUNT)
+		return index;
+	if(index >= BucketCount)
+		index = BucketCount - 1;
+
+	// index = (msb - SUB_BITS + 1) * SUB_COUNT + (value >> shift) - SUB_COUNT
+	const U32 shift = index / RSH_HISTOGRAM_SUB_COUNT - 1;
+	const U64 sub = index % RSH_HISTOGRAM_SUB_COUNT + RSH_HISTOGRAM_SUB_COUNT;
+	return ((sub + 1) << shift) - 1;
+}
+
+U32 RshHistogram::BucketIndex(U64 value)
+{
+	if(value < RSH_HISTOGRAM_SUB_COUNT)
+		return static_cast<U32>(value);
+
+	// position of most significant bit
+	U32 msb = 0;
+	for(U32 step = 32; step != 0; step >>= 1)
+	{
+		if(value >> (msb + step))
+			msb += step;
+	}
+
+	const U32 shift = msb - RSH_HISTOGRAM_SUB_BITS;
+	return (shift + 1) * RSH_HISTOGRAM_SUB_COUNT + static_cast<U32>(value >> shift) - RSH_HISTOGRAM_SUB_COUNT;
+}
@@ -0,0 +1,141 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshHistogram.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshHistogram class.
+ *
+ * Lock-free histogram of durations.
+ *
+ * \~russian
+ * \brief
+ * Класс RshHistogram.
+ *
+ * Гистограмма длительностей без блокировок.
+ *
+ */
+
+#ifndef RSH_HISTOGRAM_H
+#define RSH_HISTOGRAM_H
+
+#include "RshDefChk.h"
+#include "RshTypes.h"
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Lock-free histogram with constant relative precision
+ *
+ * Values from 0 to 2^64-1 are counted in buckets whose width is
+ * 1/32 of value magnitude (like HDR histogram with 2 significant
+ * digits), so percentiles are within 3% of true value for any range,
+ * from nanoseconds to hours. Record() takes constant time and uses only
+ * atomic additions, so it can be called from acquisition thread while
+ * other threads read percentiles.
+ *
+ * \remarks
+ * Percentiles are computed from bucket counts which are read one by
+ * one, so result taken during recording may be off by values recorded
+ * at that moment.
+ *
+ * \~russian
+ * \brief
+ * Гистограмма без блокировок с постоянной относительной точностью
+ *
+ * Значения от 0 до 2^64-1 подсчитываются в интервалах шириной 1/32
+ * от порядка значения (как HDR гистограмма с 2 значащими цифрами),
+ * поэтому процентили отличаются от точного значения не более чем на 3%
+ * в любом диапазоне, от наносекунд до часов. Record() выполняется за
+ * постоянное время и использует только атомарное сложение, поэтому его
+ * можно вызывать из потока сбора данных, пока другие потоки читают
+ * процентили.
+ *
+ * \remarks
+ * Процентили вычисляются по счетчикам интервалов, которые читаются по
+ * одному, поэтому результат, полученный во время записи, может не
+ * учитывать значения, записываемые в этот момент.
+ *
+ */
+class RshHistogram
+{
+public:
+
+	enum
+	{
+		//! Number of buckets
+		BucketCount = 1920
+	};
+
+	RshHistogram();
+
+	//! Count one value
+	void Record(U64 value);
+
+	//! Clear all counters
+	void Reset();
+
+	//! Number of recorded values
+	U64 Count() const;
+
+	//! Sum of recorded values
+	U64 Sum() const;
+
+	//! Smallest recorded value, 0 if empty
+	U64 Min() const;
+
+	//! Largest recorded value, 0 if empty
+	U64 Max() const;
+
+	//! Average of recorded values, 0 if empty
+	double Mean() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Value at given fraction of recorded values
+	 *
+	 * \param[in] fraction 0.5 for median, 0.99 for 99th percentile.
+	 *
+	 * \return
+	 * Upper bound of bucket, limited by Max(). 0 if empty.
+	 *
+	 * \~russian
+	 * \brief
+	 * Значение, не превышаемое заданной долей записанных значений
+	 *
+	 * \param[in] fraction 0.5 для медианы, 0.99 для 99-го процентиля.
+	 *
+	 * \return
+	 * Верхняя граница интервала, ограниченная Max(). 0 если пусто.
+	 *
+	 */
+	U64 Percentile(double fraction) const;
+
+	//! Count of values in bucket
+	U64 Bucket(U32 index) const;
+
+	//! Largest value counted in bucket
+	static U64 BucketUpperBound(U32 index);
+
+	//! Bucket of value
+	static U32 BucketIndex(U64 value);
+
+private:
+
+	RshHistogram(const RshHistogram&);
+	RshHistogram& operator=(const RshHistogram&);
+
+	volatile U64 m_buckets[BucketCount];
+	volatile U64 m_count;
+	volatile U64 m_sum;
+	volatile U64 m_min;
+	volatile U64 m_max;
+};
+
+#endif //RSH_HISTOGRAM_H
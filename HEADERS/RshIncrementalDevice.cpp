@@ -0,0 +1,234 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshIncrementalDevice.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshIncrementalDevice class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshIncrementalDevice.
+ *
+ */
+
+#include "RshIncrementalDevice.h"
+#include "RshConsts.h"
+#include "RshScalarType.h"
+#include "RshInitSerializer.h"
+#include "RshInitDMA.h"
+#include "RshInitMemory.h"
+#include "RshInitGSPF.h"
+#include "RshInitVoltmeter.h"
+#include "RshInitPort.h"
+#include "RshInitDAC.h"
+#include "RshInitTimer.h"
+#include "RshTrace.h"
+
+// empty structure of given type, 0 for types not supported by RshInitSerializer
+static RshBaseType* RshIncrementalDeviceCreate(U32 type)
+{
+	switch(type)
+	{
+	case rshInitADC: return new RshInitADC();
+	case rshInitDMA: return new RshInitDMA();
+	case rshInitMemory: return new RshInitMemory();
+	case rshInitGSPF: return new RshInitGSPF();
+	case rshInitVoltmeter: return new RshInitVoltmeter();
+	case rshInitPort: return new RshInitPort();
+	case rshInitDAC: return new RshInitDAC();
+	case rshInitTimer: return new RshInitTimer();
+	default: return 0;
+	}
+}
+
+RshIncrementalDevice::RshIncrementalDevice(IRshDevice* device) :
+	m_device(device),
+	m_active(0),
+	m_restarted(false),
+	m_native(-1),
+	m_persistent(false),
+	m_started(false)
+{ }
+
+RshIncrementalDevice::~RshIncrementalDevice()
+{
+	delete m_active;
+}
+
+U32 RshIncrementalDevice::Attach(IRshDevice* device)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	m_device = device;
+	m_native = -1;
+	m_started = false;
+	delete m_active;
+	m_active = 0;
+	return RSH_API_SUCCESS;
+}
+
+IRshDevice* RshIncrementalDevice::Device() const
+{
+	return m_device;
+}
+
+U32 __RSHCALLCONV RshIncrementalDevice::Connect(IN RshBaseType* key, IN U32 mode)
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	// other device may be behind the same interface after connection
+	m_native = -1;
+	m_started = false;
+	delete m_active;
+	m_active = 0;
+	return m_device->Connect(key, mode);
+}
+
+U32 __RSHCALLCONV RshIncrementalDevice::Init(IN OUT RshBaseType* structure, IN U32 mode)
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	if(mode != RSH_INIT_MODE_UPDATE || Native())
+	{
+		m_changes.clear();
+		m_restarted = false;
+		const U32 st = m_device->Init(structure, mode);
+		if(st == RSH_API_SUCCESS && mode != RSH_INIT_MODE_CHECK && structure != 0)
+			Remember(*structure);
+		return st;
+	}
+
+	RSH_TRACE_SCOPE("device", "InitUpdate");
+	if(structure == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	m_changes.clear();
+	m_restarted = false;
+
+	// device corrects parameters, so corrected ones are compared
+	U32 st = m_device->Init(structure, RSH_INIT_MODE_CHECK);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	// equal images mean equal structures, names of changes are found only if they differ
+	if(m_active != 0 && m_active->_type == structure->_type &&
+		RshInitSerializer::Write(*structure, m_next) == RSH_API_SUCCESS && m_next == m_image)
+		return RSH_API_SUCCESS;
+
+	if(m_active == 0 || RshInitSerializer::Compare(*m_active, *structure, m_changes) != RSH_API_SUCCESS)
+	{
+		m_changes.clear();
+		m_changes.push_back("type");
+	}
+	if(m_changes.empty())
+		return RSH_API_SUCCESS;
+
+	const bool restart = m_started && m_persistent;
+	if(restart)
+	{
+		st = m_device->Stop();
+		if(st != RSH_API_SUCCESS)
+			return st;
+		m_started = false;
+	}
+
+	st = m_device->Init(structure, RSH_INIT_MODE_INIT);
+	if(st != RSH_API_SUCCESS)
+		return st;
+	Remember(*structure);
+
+	if(restart)
+	{
+		st = Start();
+		m_restarted = (st == RSH_API_SUCCESS);
+	}
+	return st;
+}
+
+U32 __RSHCALLCONV RshIncrementalDevice::Start()
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	const U32 st = m_device->Start();
+	if(st == RSH_API_SUCCESS)
+		m_started = true;
+	return st;
+}
+
+U32 __RSHCALLCONV RshIncrementalDevice::Stop()
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	m_started = false;
+	return m_device->Stop();
+}
+
+U32 __RSHCALLCONV RshIncrementalDevice::GetData(IN OUT RshBaseType* buffer, IN U32 flags)
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	return m_device->GetData(buffer, flags);
+}
+
+U32 __RSHCALLCONV RshIncrementalDevice::Get(IN U32 mode, IN OUT RshBaseType* adr)
+{
+	if(mode == RSH_GET_DEVICE_IS_CAPABLE && adr != 0 && adr->_type == rshU32 &&
+		static_cast<RSH_U32*>(adr)->data == RSH_CAPS_DEVICE_INIT_UPDATE)
+		return RSH_API_SUCCESS;
+
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	return m_device->Get(mode, adr);
+}
+
+const std::vector<std::string>& RshIncrementalDevice::Changes() const
+{
+	return m_changes;
+}
+
+bool RshIncrementalDevice::Restarted() const
+{
+	return m_restarted;
+}
+
+bool RshIncrementalDevice::Native()
+{
+	if(m_native < 0)
+	{
+		RSH_U32 caps(RSH_CAPS_DEVICE_INIT_UPDATE);
+		m_native = (m_device->Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) == RSH_API_SUCCESS) ? 1 : 0;
+	}
+	return m_native != 0;
+}
+
+void RshIncrementalDevice::Remember(const RshBaseType& structure)
+{
+	m_persistent = (structure._type == rshInitDMA &&
+		static_cast<const RshInitDMA&>(structure).dmaMode == RshInitDMA::Persistent);
+
+	if(m_active != 0 && m_active->_type != structure._type)
+	{
+		delete m_active;
+		m_active = 0;
+	}
+	if(m_active == 0)
+		m_active = RshIncrementalDeviceCreate(structure._type);
+	if(m_active == 0)
+		return;
+
+	// image and channel table of copy are reused, so copying does not allocate
+	if(RshInitSerializer::Write(structure, m_image) != RSH_API_SUCCESS ||
+		RshInitSerializer::Read(m_image, *m_active) != RSH_API_SUCCESS)
+	{
+		delete m_active;
+		m_active = 0;
+	}
+}
@@ -0,0 +1,150 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshIncrementalDevice.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshIncrementalDevice class.
+ *
+ * Incremental reconfiguration of any device.
+ *
+ * \~russian
+ * \brief
+ * Класс RshIncrementalDevice.
+ *
+ * Инкрементальная перенастройка любого устройства.
+ *
+ */
+
+#ifndef RSH_INCREMENTAL_DEVICE_H
+#define RSH_INCREMENTAL_DEVICE_H
+
+#include "RshDefChk.h"
+#include "RshBaseType.h"
+#include "IRshDevice.h"
+
+#include <string>
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Device wrapper adding ::RSH_INIT_MODE_UPDATE
+ *
+ * Implements IRshDevice and passes all calls to device interface, so
+ * it is used in place of that interface without changes in application
+ * code. Devices with ::RSH_CAPS_DEVICE_INIT_UPDATE get update calls as
+ * is. For other devices wrapper keeps copy of structure of last
+ * successful initialization and on update:
+ * - checks new structure with ::RSH_INIT_MODE_CHECK, so values corrected
+ * by device are compared;
+ * - returns immediately if nothing changed;
+ * - otherwise stops device if it was started in persistent mode,
+ * initializes it and starts again.
+ *
+ * So sweep of parameters costs one check per step when value is the
+ * same, and one initialization instead of application side stop and
+ * start sequence when it is not.
+ *
+ * \remarks
+ * Changes() lists fields changed by last update.
+ * Object does not own device interface, it is released by RshDllClient.
+ *
+ * \~russian
+ * \brief
+ * Обертка устройства, добавляющая ::RSH_INIT_MODE_UPDATE
+ *
+ * Реализует IRshDevice и передает все вызовы интерфейсу устройства,
+ * поэтому используется вместо этого интерфейса без изменения кода
+ * приложения. Устройствам с ::RSH_CAPS_DEVICE_INIT_UPDATE вызовы
+ * обновления передаются как есть. Для других устройств обертка хранит
+ * копию структуры последней успешной инициализации и при обновлении:
+ * - проверяет новую структуру с ::RSH_INIT_MODE_CHECK, чтобы сравнивались
+ * значения, исправленные устройством;
+ * - сразу возвращает управление, если ничего не изменилось;
+ * - иначе останавливает устройство, если оно было запущено в
+ * непрерывном режиме, инициализирует его и запускает снова.
+ *
+ * Поэтому перебор параметров стоит одну проверку на шаг, если значение
+ * не изменилось, и одну инициализацию вместо последовательности
+ * остановки и запуска в приложении, если изменилось.
+ *
+ * \remarks
+ * Changes() перечисляет поля, измененные последним обновлением.
+ * Объект не владеет интерфейсом устройства, его освобождает RshDllClient.
+ *
+ */
+class RshIncrementalDevice : public IRshDevice
+{
+public:
+
+	explicit RshIncrementalDevice(IRshDevice* device = 0);
+	virtual ~RshIncrementalDevice();
+
+	//! Set device which calls are passed to
+	U32 Attach(IRshDevice* device);
+
+	//! Device which calls are passed to
+	IRshDevice* Device() const;
+
+	U32 __RSHCALLCONV Connect(IN RshBaseType* key, IN U32 mode = RSH_CONNECT_MODE_BASE);
+	U32 __RSHCALLCONV Init(IN OUT RshBaseType* structure, IN U32 mode = RSH_INIT_MODE_INIT);
+	U32 __RSHCALLCONV Start();
+	U32 __RSHCALLCONV Stop();
+	U32 __RSHCALLCONV GetData(IN OUT RshBaseType* buffer, IN U32 flags = RSH_DATA_MODE_NO_FLAGS);
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType* adr = NULL);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Fields changed by last update
+	 *
+	 * Names as returned by RshInitSerializer::Compare(): empty if
+	 * nothing changed, "type" if there was no previous initialization
+	 * with structure of the same type, empty for devices which apply
+	 * updates themselves.
+	 *
+	 * \~russian
+	 * \brief
+	 * Поля, измененные последним обновлением
+	 *
+	 * Названия в формате RshInitSerializer::Compare(): пусто, если ничего
+	 * не изменилось, "type", если не было предыдущей инициализации
+	 * структурой того же типа, пусто для устройств, которые сами
+	 * применяют обновления.
+	 *
+	 */
+	const std::vector<std::string>& Changes() const;
+
+	//! True if last update stopped and started acquisition again
+	bool Restarted() const;
+
+private:
+
+	RshIncrementalDevice(const RshIncrementalDevice&);
+	RshIncrementalDevice& operator=(const RshIncrementalDevice&);
+
+	bool Native();
+	void Remember(const RshBaseType& structure);
+
+	IRshDevice* m_device;
+
+	//! Copy of structure of last initialization, 0 if none
+	RshBaseType* m_active;
+	std::vector<U8> m_image;
+	std::vector<U8> m_next;
+	std::vector<std::string> m_changes;
+	bool m_restarted;
+
+	//! Device support of RSH_INIT_MODE_UPDATE: -1 unknown, 0 no, 1 yes
+	int m_native;
+	bool m_persistent;
+	bool m_started;
+};
+
+#endif //RSH_INCREMENTAL_DEVICE_H
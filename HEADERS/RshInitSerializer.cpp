@@ -0,0 +1,1052 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshInitSerializer.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshInitSerializer class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshInitSerializer.
+ *
+ */
+
+#include "RshInitSerializer.h"
+#include "RshConsts.h"
+#include "RshChannel.h"
+#include "RshSynchroChannel.h"
+#include "RshInitDMA.h"
+#include "RshInitMemory.h"
+#include "RshInitGSPF.h"
+#include "RshInitVoltmeter.h"
+#include "RshInitPort.h"
+#include "RshInitDAC.h"
+#include "RshInitTimer.h"
+#include "RshBufferType.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+
+// "RSHI" in little endian
+#define RSH_INIT_SERIALIZER_MAGIC 0x49485352UL
+
+// nesting limit of JSON parser
+#define RSH_INIT_SERIALIZER_MAX_DEPTH 32
+
+/*
+ * Fields of each structure, used by all readers and writers.
+ * Order of fields is binary format: new fields are added only
+ * at end of list, existing ones are never removed or reordered.
+ */
+
+template<class V>
+static void RshInitFields(V& v, RshChannel& s)
+{
+	v.Field("gain", s.gain);
+	v.Field("control", s.control);
+	v.Field("adjustment", s.adjustment);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshSynchroChannel& s)
+{
+	v.Field("gain", s.gain);
+	v.Field("control", s.control);
+}
+
+template<class V>
+static void RshInitFields(V& v, RSH_BUFFER_CHANNEL& s)
+{
+	v.Table("channels", s);
+}
+
+template<class V>
+static void RshInitADCFields(V& v, RshInitADC& s)
+{
+	v.Field("startType", s.startType);
+	v.Field("bufferSize", s.bufferSize);
+	v.Field("frequency", s.frequency);
+	v.Table("channels", s.channels);
+	v.Field("threshold", s.threshold);
+	v.Field("controlSynchro", s.controlSynchro);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitADC& s)
+{
+	RshInitADCFields(v, s);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitDMA& s)
+{
+	RshInitADCFields(v, s);
+	v.Field("dmaMode", s.dmaMode);
+	v.Field("control", s.control);
+	v.Field("frequencyFrame", s.frequencyFrame);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitMemory& s)
+{
+	RshInitADCFields(v, s);
+	v.Struct("channelSynchro", s.channelSynchro);
+	v.Field("control", s.control);
+	v.Field("preHistory", s.preHistory);
+	v.Field("startDelay", s.startDelay);
+	v.Field("hysteresis", s.hysteresis);
+	v.Field("packetNumber", s.packetNumber);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitGSPF& s)
+{
+	v.Field("startType", s.startType);
+	v.Field("frequency", s.frequency);
+	v.Field("attenuator", s.attenuator);
+	v.Field("control", s.control);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitVoltmeter& s)
+{
+	v.Field("startType", s.startType);
+	v.Field("bufferSize", s.bufferSize);
+	v.Field("filter", s.filter);
+	v.Field("control", s.control);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitPort& s)
+{
+	v.Field("operationType", s.operationType);
+	v.Field("portAddress", s.portAddress);
+	v.Field("portValue", s.portValue);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitDAC& s)
+{
+	v.Field("id", s.id);
+	v.Field("voltage", s.voltage);
+}
+
+template<class V>
+static void RshInitFields(V& v, RshInitTimer& s)
+{
+	v.Field("timer0Mode", s.timer0Mode);
+	v.Field("timer1Mode", s.timer1Mode);
+	v.Field("timer2Mode", s.timer2Mode);
+	v.Field("timer0Count", s.timer0Count);
+	v.Field("timer1Count", s.timer1Count);
+	v.Field("timer2Count", s.timer2Count);
+}
+
+// fields of structure of any supported type
+template<class V>
+static U32 RshInitVisit(V& v, RshBaseType& obj)
+{
+	switch(obj._type)
+	{
+	case rshInitADC:
+		v.Object(static_cast<RshInitADC&>(obj));
+		break;
+	case rshInitDMA:
+		v.Object(static_cast<RshInitDMA&>(obj));
+		break;
+	case rshInitMemory:
+		v.Object(static_cast<RshInitMemory&>(obj));
+		break;
+	case rshInitGSPF:
+		v.Object(static_cast<RshInitGSPF&>(obj));
+		break;
+	case rshInitVoltmeter:
+		v.Object(static_cast<RshInitVoltmeter&>(obj));
+		break;
+	case rshInitPort:
+		v.Object(static_cast<RshInitPort&>(obj));
+		break;
+	case rshInitDAC:
+		v.Object(static_cast<RshInitDAC&>(obj));
+		break;
+	case rshInitTimer:
+		v.Object(static_cast<RshInitTimer&>(obj));
+		break;
+	case rshChannel:
+		v.Object(static_cast<RshChannel&>(obj));
+		break;
+	case rshSynchroChannel:
+		v.Object(static_cast<RshSynchroChannel&>(obj));
+		break;
+	case rshBufferTypeChannel:
+		v.Object(static_cast<RSH_BUFFER_CHANNEL&>(obj));
+		break;
+	default:
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	}
+	return RSH_API_SUCCESS;
+}
+
+/*
+ * Binary form: header (magic, U16 version, U16 reserved, U32 type),
+ * then structure. Structure is U32 size of its fields in bytes and
+ * fields: U32 as 4 bytes, double as 8 bytes, nested structure as
+ * structure, table as U32 count and count structures.
+ */
+
+class RshInitBinaryWriter
+{
+public:
+
+	explicit RshInitBinaryWriter(std::vector<U8>& data) : m_data(data) {}
+
+	void U32Value(U32 value)
+	{
+		m_data.push_back(static_cast<U8>(value));
+		m_data.push_back(static_cast<U8>(value >> 8));
+		m_data.push_back(static_cast<U8>(value >> 16));
+		m_data.push_back(static_cast<U8>(value >> 24));
+	}
+
+	void Field(const char*, U32& value)
+	{
+		U32Value(value);
+	}
+
+	void Field(const char*, double& value)
+	{
+		U64 bits;
+		memcpy(&bits, &value, sizeof(bits));
+		U32Value(static_cast<U32>(bits));
+		U32Value(static_cast<U32>(bits >> 32));
+	}
+
+	template<typename T>
+	void Object(T& s)
+	{
+		const size_t at = m_data.size();
+		U32Value(0);
+		RshInitFields(*this, s);
+
+		const U32 size = static_cast<U32>(m_data.size() - at - 4);
+		for(int i = 0; i < 4; ++i)
+			m_data[at + i] = static_cast<U8>(size >> (8 * i));
+	}
+
+	template<typename T>
+	void Struct(const char*, T& s)
+	{
+		Object(s);
+	}
+
+	template<typename T, RshDataTypes dataCode>
+	void Table(const char*, RshBufferType<T, dataCode>& table)
+	{
+		U32Value(static_cast<U32>(table.Size()));
+		for(size_t i = 0; i < table.Size(); ++i)
+			Object(table[i]);
+	}
+
+private:
+
+	std::vector<U8>& m_data;
+};
+
+class RshInitBinaryReader
+{
+public:
+
+	RshInitBinaryReader(const U8* data, size_t size) :
+		m_position(data),
+		m_end(data + size),
+		m_status(RSH_API_SUCCESS)
+	{}
+
+	U32 Status() const { return m_status; }
+
+	size_t Remaining() const { return static_cast<size_t>(m_end - m_position); }
+
+	bool U32Value(U32& value)
+	{
+		if(m_end - m_position < 4)
+			return false;
+		value = static_cast<U32>(m_position[0]) | (static_cast<U32>(m_position[1]) << 8) |
+			(static_cast<U32>(m_position[2]) << 16) | (static_cast<U32>(m_position[3]) << 24);
+		m_position += 4;
+		return true;
+	}
+
+	// field which is not in data keeps its value
+	void Field(const char*, U32& value)
+	{
+		U32Value(value);
+	}
+
+	void Field(const char*, double& value)
+	{
+		if(m_end - m_position < 8)
+			return;
+		U32 low = 0, high = 0;
+		U32Value(low);
+		U32Value(high);
+		const U64 bits = static_cast<U64>(low) | (static_cast<U64>(high) << 32);
+		memcpy(&value, &bits, sizeof(value));
+	}
+
+	template<typename T>
+	void Object(T& s)
+	{
+		U32 size = 0;
+		if(!U32Value(size))
+			return;
+		if(size > static_cast<size_t>(m_end - m_position))
+		{
+			m_status = RSH_API_PARAMETER_INVALID;
+			m_position = m_end;
+			return;
+		}
+
+		// fields added by newer version are skipped
+		const U8* end = m_end;
+		m_end = m_position + size;
+		RshInitFields(*this, s);
+		m_position = m_end;
+		m_end = end;
+	}
+
+	template<typename T>
+	void Struct(const char*, T& s)
+	{
+		Object(s);
+	}
+
+	template<typename T, RshDataTypes dataCode>
+	void Table(const char*, RshBufferType<T, dataCode>& table)
+	{
+		U32 count = 0;
+		if(!U32Value(count))
+			return;
+		// each element has at least its size
+		if(count > static_cast<size_t>(m_end - m_position) / 4)
+		{
+			m_status = RSH_API_PARAMETER_INVALID;
+			m_position = m_end;
+			return;
+		}
+
+		if(table.PSize() < count)
+		{
+			U32 st = table.Allocate(count);
+			if(st != RSH_API_SUCCESS)
+			{
+				m_status = st;
+				m_position = m_end;
+				return;
+			}
+		}
+		table.SetSize(count);
+		for(size_t i = 0; i < count; ++i)
+		{
+			table[i] = T();
+			Object(table[i]);
+		}
+	}
+
+private:
+
+	const U8* m_position;
+	const U8* m_end;
+	U32 m_status;
+};
+
+class RshInitJsonWriter
+{
+public:
+
+	explicit RshInitJsonWriter(std::ostream& out) : m_out(out), m_depth(0), m_first(true) {}
+
+	void Field(const char* name, U32& value)
+	{
+		Name(name);
+		m_out << value;
+	}
+
+	void Field(const char* name, double& value)
+	{
+		Name(name);
+		// JSON has no infinity and NaN, reader keeps its value for null
+		if(__rshisfinite(value))
+			m_out << value;
+		else
+			m_out << "null";
+	}
+
+	template<typename T>
+	void Object(T& s)
+	{
+		m_out << "{";
+		++m_depth;
+		m_first = true;
+		RshInitFields(*this, s);
+		--m_depth;
+		Break();
+		m_out << "}";
+		m_first = false;
+	}
+
+	// top level object starts with type and version
+	template<typename T>
+	void Root(T& s, const char* type)
+	{
+		m_out << "{";
+		++m_depth;
+		m_first = true;
+		Name("type");
+		m_out << "\"" << type << "\"";
+		Name("version");
+		m_out << RSH_INIT_SERIALIZER_VERSION;
+		RshInitFields(*this, s);
+		--m_depth;
+		Break();
+		m_out << "}\n";
+	}
+
+	template<typename T>
+	void Struct(const char* name, T& s)
+	{
+		Name(name);
+		Object(s);
+	}
+
+	template<typename T, RshDataTypes dataCode>
+	void Table(const char* name, RshBufferType<T, dataCode>& table)
+	{
+		Name(name);
+		m_out << "[";
+		++m_depth;
+		for(size_t i = 0; i < table.Size(); ++i)
+		{
+			if(i != 0)
+				m_out << ",";
+			Break();
+			Object(table[i]);
+		}
+		--m_depth;
+		if(table.Size() != 0)
+			Break();
+		m_out << "]";
+		m_first = false;
+	}
+
+private:
+
+	void Break()
+	{
+		m_out << "\n";
+		for(int i = 0; i < m_depth; ++i)
+			m_out << "\t";
+	}
+
+	void Name(const char* name)
+	{
+		if(!m_first)
+			m_out << ",";
+		Break();
+		m_out << "\"" << name << "\": ";
+		m_first = false;
+	}
+
+	std::ostream& m_out;
+	int m_depth;
+	bool m_first;
+};
+
+// JSON value, children are indices in node list
+struct RshJsonNode
+{
+	enum Kind { Null, Boolean, Number, String, Array, Object };
+
+	RshJsonNode() : kind(Null), number(0.0) {}
+
+	Kind kind;
+	double number;
+	std::string text;
+	std::vector<std::string> keys;
+	std::vector<size_t> children;
+};
+
+class RshJsonParser
+{
+public:
+
+	RshJsonParser(const char* text, std::vector<RshJsonNode>& nodes) : m_text(text), m_nodes(nodes) {}
+
+	// whole text must be one value
+	bool Parse()
+	{
+		if(!Value(0))
+			return false;
+		Space();
+		return *m_text == 0;
+	}
+
+private:
+
+	void Space()
+	{
+		while(*m_text == ' ' || *m_text == '\t' || *m_text == '\n' || *m_text == '\r')
+			++m_text;
+	}
+
+	bool Literal(const char* word)
+	{
+		const size_t length = strlen(word);
+		if(strncmp(m_text, word, length) != 0)
+			return false;
+		m_text += length;
+		return true;
+	}
+
+	static void Utf8(std::string& out, U32 code)
+	{
+		if(code < 0x80)
+		{
+			out += static_cast<char>(code);
+		}
+		else if(code < 0x800)
+		{
+			out += static_cast<char>(0xC0 | (code >> 6));
+			out += static_cast<char>(0x80 | (code & 0x3F));
+		}
+		else
+		{
+			out += static_cast<char>(0xE0 | (code >> 12));
+			out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			out += static_cast<char>(0x80 | (code & 0x3F));
+		}
+	}
+
+	bool Text(std::string& out)
+	{
+		if(*m_text != '"')
+			return false;
+		++m_text;
+		for(;;)
+		{
+			const char c = *m_text++;
+			if(c == '"')
+				return true;
+			if(c == 0 || static_cast<unsigned char>(c) < 0x20)
+				return false;
+			if(c != '\\')
+			{
+				out += c;
+				continue;
+			}
+
+			const char e = *m_text++;
+			switch(e)
+			{
+			case '"': out += '"'; break;
+			case '\\': out += '\\'; break;
+			case '/': out += '/'; break;
+			case 'b': out += '\b'; break;
+			case 'f': out += '\f'; break;
+			case 'n': out += '\n'; break;
+			case 'r': out += '\r'; break;
+			case 't': out += '\t'; break;
+			case 'u':
+				{
+					U32 code = 0;
+					for(int i = 0; i < 4; ++i)
+					{
+						const char h = *m_text++;
+						code <<= 4;
+						if(h >= '0' && h <= '9')
+							code |= h - '0';
+						else if(h >= 'a' && h <= 'f')
+							code |= h - 'a' + 10;
+						else if(h >= 'A' && h <= 'F')
+							code |= h - 'A' + 10;
+						else
+							return false;
+					}
+					Utf8(out, code);
+				}
+				break;
+			default:
+				return false;
+			}
+		}
+	}
+
+	bool Value(int depth)
+	{
+		if(depth > RSH_INIT_SERIALIZER_MAX_DEPTH)
+			return false;
+
+		Space();
+		const size_t index = m_nodes.size();
+		m_nodes.push_back(RshJsonNode());
+
+		const char c = *m_text;
+		if(c == '{')
+		{
+			m_nodes[index].kind = RshJsonNode::Object;
+			++m_text;
+			Space();
+			if(*m_text == '}')
+			{
+				++m_text;
+				return true;
+			}
+			for(;;)
+			{
+				std::string key;
+				Space();
+				if(!Text(key))
+					return false;
+				Space();
+				if(*m_text++ != ':')
+					return false;
+				const size_t child = m_nodes.size();
+				if(!Value(depth + 1))
+					return false;
+				m_nodes[index].keys.push_back(key);
+				m_nodes[index].children.push_back(child);
+				Space();
+				if(*m_text == ',')
+				{
+					++m_text;
+					continue;
+				}
+				return *m_text++ == '}';
+			}
+		}
+		if(c == '[')
+		{
+			m_nodes[index].kind = RshJsonNode::Array;
+			++m_text;
+			Space();
+			if(*m_text == ']')
+			{
+				++m_text;
+				return true;
+			}
+			for(;;)
+			{
+				const size_t child = m_nodes.size();
+				if(!Value(depth + 1))
+					return false;
+				m_nodes[index].children.push_back(child);
+				Space();
+				if(*m_text == ',')
+				{
+					++m_text;
+					continue;
+				}
+				return *m_text++ == ']';
+			}
+		}
+		if(c == '"')
+		{
+			m_nodes[index].kind = RshJsonNode::String;
+			std::string text;
+			if(!Text(text))
+				return false;
+			m_nodes[index].text = text;
+			return true;
+		}
+		if(c == '-' || (c >= '0' && c <= '9'))
+		{
+			char* end = 0;
+			const double number = strtod(m_text, &end);
+			if(end == m_text || !__rshisfinite(number))
+				return false;
+			m_nodes[index].kind = RshJsonNode::Number;
+			m_nodes[index].number = number;
+			m_text = end;
+			return true;
+		}
+		if(Literal("true"))
+		{
+			m_nodes[index].kind = RshJsonNode::Boolean;
+			m_nodes[index].number = 1.0;
+			return true;
+		}
+		if(Literal("false"))
+		{
+			m_nodes[index].kind = RshJsonNode::Boolean;
+			return true;
+		}
+		return Literal("null");
+	}
+
+	const char* m_text;
+	std::vector<RshJsonNode>& m_nodes;
+};
+
+class RshInitJsonReader
+{
+public:
+
+	explicit RshInitJsonReader(const std::vector<RshJsonNode>& nodes) :
+		m_nodes(nodes),
+		m_object(0),
+		m_status(RSH_API_SUCCESS)
+	{}
+
+	U32 Status() const { return m_status; }
+
+	void Field(const char* name, U32& value)
+	{
+		const RshJsonNode* node = Find(name);
+		if(node == 0 || node->kind == RshJsonNode::Null)
+			return;
+		if(node->kind != RshJsonNode::Number || node->number < 0.0 ||
+			node->number > 4294967295.0 || node->number != floor(node->number))
+		{
+			m_status = RSH_API_PARAMETER_INVALID;
+			return;
+		}
+		value = static_cast<U32>(node->number);
+	}
+
+	void Field(const char* name, double& value)
+	{
+		const RshJsonNode* node = Find(name);
+		if(node == 0 || node->kind == RshJsonNode::Null)
+			return;
+		if(node->kind != RshJsonNode::Number)
+		{
+			m_status = RSH_API_PARAMETER_INVALID;
+			return;
+		}
+		value = node->number;
+	}
+
+	template<typename T>
+	void Object(T& s)
+	{
+		RshInitFields(*this, s);
+	}
+
+	template<typename T>
+	void Struct(const char* name, T& s)
+	{
+		const RshJsonNode* node = Find(name);
+		if(node == 0 || node->kind == RshJsonNode::Null)
+			return;
+		if(node->kind != RshJsonNode::Object)
+		{
+			m_status = RSH_API_PARAMETER_INVALID;
+			return;
+		}
+		Nested(node, s);
+	}
+
+	template<typename T, RshDataTypes dataCode>
+	void Table(const char* name, RshBufferType<T, dataCode>& table)
+	{
+		const RshJsonNode* node = Find(name);
+		if(node == 0 || node->kind == RshJsonNode::Null)
+			return;
+		if(node->kind != RshJsonNode::Array)
+		{
+			m_status = RSH_API_PARAMETER_INVALID;
+			return;
+		}
+
+		const size_t count = node->children.size();
+		if(table.PSize() < count)
+		{
+			U32 st = table.Allocate(count);
+			if(st != RSH_API_SUCCESS)
+			{
+				m_status = st;
+				return;
+			}
+		}
+		table.SetSize(count);
+		for(size_t i = 0; i < count; ++i)
+		{
+			const RshJsonNode* element = &m_nodes[node->children[i]];
+			if(element->kind != RshJsonNode::Object)
+			{
+				m_status = RSH_API_PARAMETER_INVALID;
+				return;
+			}
+			table[i] = T();
+			Nested(element, table[i]);
+		}
+	}
+
+	// member of current object, 0 if there is no such member
+	const RshJsonNode* Find(const char* name) const
+	{
+		const RshJsonNode& object = m_nodes[m_object];
+		for(size_t i = 0; i < object.keys.size(); ++i)
+			if(object.keys[i] == name)
+				return &m_nodes[object.children[i]];
+		return 0;
+	}
+
+private:
+
+	template<typename T>
+	void Nested(const RshJsonNode* node, T& s)
+	{
+		const size_t object = m_object;
+		m_object = static_cast<size_t>(node - &m_nodes[0]);
+		RshInitFields(*this, s);
+		m_object = object;
+	}
+
+	const std::vector<RshJsonNode>& m_nodes;
+	size_t m_object;
+	U32 m_status;
+};
+
+// writes top level JSON object
+class RshInitJsonRoot
+{
+public:
+
+	RshInitJsonRoot(RshInitJsonWriter& writer, const char* type) : m_writer(writer), m_type(type) {}
+
+	template<typename T>
+	void Object(T& s)
+	{
+		m_writer.Root(s, m_type);
+	}
+
+private:
+
+	RshInitJsonWriter& m_writer;
+	const char* m_type;
+};
+
+// field with full name and value bits
+struct RshInitFlatField
+{
+	std::string name;
+	U64 bits;
+};
+
+class RshInitFlattener
+{
+public:
+
+	explicit RshInitFlattener(std::vector<RshInitFlatField>& fields) : m_fields(fields) {}
+
+	void Field(const char* name, U32& value)
+	{
+		Add(name, value);
+	}
+
+	void Field(const char* name, double& value)
+	{
+		U64 bits;
+		memcpy(&bits, &value, sizeof(bits));
+		Add(name, bits);
+	}
+
+	template<typename T>
+	void Object(T& s)
+	{
+		RshInitFields(*this, s);
+	}
+
+	template<typename T>
+	void Struct(const char* name, T& s)
+	{
+		const size_t length = m_prefix.size();
+		m_prefix += name;
+		m_prefix += '.';
+		RshInitFields(*this, s);
+		m_prefix.resize(length);
+	}
+
+	template<typename T, RshDataTypes dataCode>
+	void Table(const char* name, RshBufferType<T, dataCode>& table)
+	{
+		const size_t length = m_prefix.size();
+		for(size_t i = 0; i < table.Size(); ++i)
+		{
+			char index[32];
+			sprintf(index, "[%u].", static_cast<unsigned int>(i));
+			m_prefix += name;
+			m_prefix += index;
+			RshInitFields(*this, table[i]);
+			m_prefix.resize(length);
+		}
+	}
+
+private:
+
+	void Add(const char* name, U64 bits)
+	{
+		m_fields.push_back(RshInitFlatField());
+		m_fields.back().name = m_prefix + name;
+		m_fields.back().bits = bits;
+	}
+
+	std::vector<RshInitFlatField>& m_fields;
+	std::string m_prefix;
+};
+
+bool RshInitSerializer::IsSupported(U32 type)
+{
+	switch(type)
+	{
+	case rshInitADC:
+	case rshInitDMA:
+	case rshInitMemory:
+	case rshInitGSPF:
+	case rshInitVoltmeter:
+	case rshInitPort:
+	case rshInitDAC:
+	case rshInitTimer:
+	case rshChannel:
+	case rshSynchroChannel:
+	case rshBufferTypeChannel:
+		return true;
+	default:
+		return false;
+	}
+}
+
+U32 RshInitSerializer::Write(const RshBaseType& obj, std::vector<U8>& data)
+{
+	if(!IsSupported(obj._type))
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	data.clear();
+	RshInitBinaryWriter writer(data);
+	writer.U32Value(RSH_INIT_SERIALIZER_MAGIC);
+	writer.U32Value(RSH_INIT_SERIALIZER_VERSION);
+	writer.U32Value(obj._type);
+	// writer does not change structure
+	return RshInitVisit(writer, const_cast<RshBaseType&>(obj));
+}
+
+U32 RshInitSerializer::Read(const U8* data, size_t size, RshBaseType& obj)
+{
+	if(data == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(!IsSupported(obj._type))
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	RshInitBinaryReader reader(data, size);
+	U32 magic = 0, version = 0, type = 0;
+	if(!reader.U32Value(magic) || !reader.U32Value(version) || !reader.U32Value(type) ||
+		magic != RSH_INIT_SERIALIZER_MAGIC || (version & 0xFFFF) == 0)
+		return RSH_API_PARAMETER_INVALID;
+	if(type != obj._type)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	// only fields inside structure may be missing, not its size
+	if(reader.Remaining() < 4)
+		return RSH_API_PARAMETER_INVALID;
+
+	U32 st = RshInitVisit(reader, obj);
+	return (st != RSH_API_SUCCESS) ? st : reader.Status();
+}
+
+U32 RshInitSerializer::Read(const std::vector<U8>& data, RshBaseType& obj)
+{
+	if(data.empty())
+		return RSH_API_PARAMETER_INVALID;
+	return Read(&data[0], data.size(), obj);
+}
+
+U32 RshInitSerializer::WriteJson(const RshBaseType& obj, std::ostream& out)
+{
+	if(!IsSupported(obj._type))
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	// doubles are written with enough digits to be read back exactly
+	const std::streamsize precision = out.precision(17);
+	const std::ios_base::fmtflags flags = out.flags();
+	out.unsetf(std::ios_base::floatfield);
+	out << std::dec;
+
+	RshInitJsonWriter writer(out);
+	RshInitJsonRoot root(writer, obj.GetTypeName());
+	U32 st = RshInitVisit(root, const_cast<RshBaseType&>(obj));
+
+	out.precision(precision);
+	out.flags(flags);
+	if(st != RSH_API_SUCCESS)
+		return st;
+	return out.good() ? RSH_API_SUCCESS : RSH_API_FILE_CANTWRITE;
+}
+
+U32 RshInitSerializer::ReadJson(const char* text, RshBaseType& obj)
+{
+	if(text == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(!IsSupported(obj._type))
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	std::vector<RshJsonNode> nodes;
+	RshJsonParser parser(text, nodes);
+	if(!parser.Parse() || nodes[0].kind != RshJsonNode::Object)
+		return RSH_API_PARAMETER_INVALID;
+
+	RshInitJsonReader reader(nodes);
+	const RshJsonNode* type = reader.Find("type");
+	if(type != 0 && (type->kind != RshJsonNode::String || type->text != obj.GetTypeName()))
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	const RshJsonNode* version = reader.Find("version");
+	if(version != 0 && (version->kind != RshJsonNode::Number || version->number < 1.0))
+		return RSH_API_PARAMETER_INVALID;
+
+	U32 st = RshInitVisit(reader, obj);
+	return (st != RSH_API_SUCCESS) ? st : reader.Status();
+}
+
+U32 RshInitSerializer::Compare(const RshBaseType& active, const RshBaseType& next, std::vector<std::string>& changed)
+{
+	changed.clear();
+	if(!IsSupported(active._type) || !IsSupported(next._type))
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	if(active._type != next._type)
+	{
+		changed.push_back("type");
+		return RSH_API_SUCCESS;
+	}
+
+	std::vector<RshInitFlatField> before, after;
+	RshInitFlattener flattenBefore(before), flattenAfter(after);
+	RshInitVisit(flattenBefore, const_cast<RshBaseType&>(active));
+	RshInitVisit(flattenAfter, const_cast<RshBaseType&>(next));
+
+	// lists differ only in length of tables, so names are matched by map
+	std::map<std::string, U64> values;
+	for(size_t i = 0; i < before.size(); ++i)
+		values[before[i].name] = before[i].bits;
+	for(size_t i = 0; i < after.size(); ++i)
+	{
+		std::map<std::string, U64>::iterator it = values.find(after[i].name);
+		if(it == values.end())
+		{
+			changed.push_back(after[i].name);
+			continue;
+		}
+		if(it->second != after[i].bits)
+			changed.push_back(after[i].name);
+		values.erase(it);
+	}
+	for(size_t i = 0; i < before.size(); ++i)
+		if(values.find(before[i].name) != values.end())
+			changed.push_back(before[i].name);
+	return RSH_API_SUCCESS;
+}
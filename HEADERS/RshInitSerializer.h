@@ -0,0 +1,239 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshInitSerializer.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshInitSerializer class.
+ *
+ * Binary and JSON form of initialization structures.
+ *
+ * \~russian
+ * \brief
+ * Класс RshInitSerializer.
+ *
+ * Двоичное и JSON представление структур инициализации.
+ *
+ */
+
+#ifndef RSH_INIT_SERIALIZER_H
+#define RSH_INIT_SERIALIZER_H
+
+#include "RshDefChk.h"
+#include "RshBaseType.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+//! Version written by RshInitSerializer
+#define RSH_INIT_SERIALIZER_VERSION 1
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Serialization of initialization structures
+ *
+ * Saves and restores RshInitADC, RshInitDMA, RshInitMemory,
+ * RshInitGSPF, RshInitVoltmeter, RshInitPort, RshInitDAC, RshInitTimer,
+ * RshChannel, RshSynchroChannel and RSH_BUFFER_CHANNEL, including
+ * channel tables.\n
+ * Binary form is compact and is read without parsing, so validated
+ * configuration can be cached and applied to existing structure in
+ * microseconds; memory of channel table is reused when it is large
+ * enough. JSON form is for configuration files and tools.\n
+ * Both forms carry type and version. New fields are only added after
+ * existing ones, so data written by any version is read by any other:
+ * fields missing in data keep values of structure, unknown fields are
+ * skipped.
+ *
+ * \remarks
+ * Binary numbers are little endian, double is IEEE 754.
+ * When read fails, structure may be partly changed.
+ *
+ * \~russian
+ * \brief
+ * Сериализация структур инициализации
+ *
+ * Сохраняет и восстанавливает RshInitADC, RshInitDMA, RshInitMemory,
+ * RshInitGSPF, RshInitVoltmeter, RshInitPort, RshInitDAC, RshInitTimer,
+ * RshChannel, RshSynchroChannel и RSH_BUFFER_CHANNEL, включая таблицы
+ * каналов.\n
+ * Двоичная форма компактна и читается без разбора текста, поэтому
+ * проверенную конфигурацию можно хранить в кэше и применять к
+ * существующей структуре за микросекунды; память таблицы каналов
+ * используется повторно, если ее достаточно. Форма JSON предназначена
+ * для файлов конфигурации и утилит.\n
+ * Обе формы содержат тип и версию. Новые поля добавляются только после
+ * существующих, поэтому данные, записанные любой версией, читаются любой
+ * другой: отсутствующие в данных поля сохраняют значения структуры,
+ * неизвестные поля пропускаются.
+ *
+ * \remarks
+ * Числа в двоичной форме записаны в порядке little endian, double в
+ * формате IEEE 754. Если чтение не удалось, структура может быть
+ * изменена частично.
+ *
+ */
+class RshInitSerializer
+{
+public:
+
+	//! True if structure of this type can be serialized
+	static bool IsSupported(U32 type);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Write structure in binary form
+	 *
+	 * \param[in] obj Structure.
+	 * \param[out] data Binary form, previous content is replaced.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED.
+	 *
+	 * \~russian
+	 * \brief
+	 * Запись структуры в двоичной форме
+	 *
+	 * \param[in] obj Структура.
+	 * \param[out] data Двоичная форма, прежнее содержимое заменяется.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED.
+	 *
+	 */
+	static U32 Write(const RshBaseType& obj, std::vector<U8>& data);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Read structure from binary form
+	 *
+	 * \param[in] data Binary form.
+	 * \param[in] size Size of data, bytes.
+	 * \param[in,out] obj Structure of type stored in data.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED if type differs or
+	 * ::RSH_API_PARAMETER_INVALID if data is damaged.
+	 *
+	 * \~russian
+	 * \brief
+	 * Чтение структуры из двоичной формы
+	 *
+	 * \param[in] data Двоичная форма.
+	 * \param[in] size Размер данных, байт.
+	 * \param[in,out] obj Структура того типа, что записан в данных.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED, если тип отличается, или
+	 * ::RSH_API_PARAMETER_INVALID, если данные повреждены.
+	 *
+	 */
+	static U32 Read(const U8* data, size_t size, RshBaseType& obj);
+
+	//! Read structure from binary form, see Read(const U8*, size_t, RshBaseType&)
+	static U32 Read(const std::vector<U8>& data, RshBaseType& obj);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Write structure as JSON object
+	 *
+	 * Object has members "type" (name of structure type), "version"
+	 * and one member per field; channel tables are arrays of objects.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED or
+	 * ::RSH_API_FILE_CANTWRITE.
+	 *
+	 * \~russian
+	 * \brief
+	 * Запись структуры в виде объекта JSON
+	 *
+	 * Объект содержит члены "type" (название типа структуры), "version"
+	 * и по одному члену на каждое поле; таблицы каналов - массивы
+	 * объектов.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED или
+	 * ::RSH_API_FILE_CANTWRITE.
+	 *
+	 */
+	static U32 WriteJson(const RshBaseType& obj, std::ostream& out);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Read structure from JSON object
+	 *
+	 * Member "type", if present, must match type of structure.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED or
+	 * ::RSH_API_PARAMETER_INVALID for syntax error or wrong value.
+	 *
+	 * \~russian
+	 * \brief
+	 * Чтение структуры из объекта JSON
+	 *
+	 * Член "type", если он есть, должен совпадать с типом структуры.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED или
+	 * ::RSH_API_PARAMETER_INVALID при синтаксической ошибке или неверном
+	 * значении.
+	 *
+	 */
+	static U32 ReadJson(const char* text, RshBaseType& obj);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Compare two structures field by field
+	 *
+	 * \param[in] active Structure applied before.
+	 * \param[in] next New structure.
+	 * \param[out] changed Names of fields which differ, as
+	 * "frequency", "channels[1].gain" or "channelSynchro.control"
+	 * (table element present in one structure only gives all its
+	 * fields). Single name "type" if types of structures differ.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED.
+	 *
+	 * \~russian
+	 * \brief
+	 * Сравнение двух структур по полям
+	 *
+	 * \param[in] active Структура, примененная ранее.
+	 * \param[in] next Новая структура.
+	 * \param[out] changed Названия различающихся полей, например
+	 * "frequency", "channels[1].gain" или "channelSynchro.control"
+	 * (для элемента таблицы, который есть только в одной структуре,
+	 * выдаются все его поля). Одно название "type", если типы структур
+	 * различаются.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED.
+	 *
+	 */
+	static U32 Compare(const RshBaseType& active, const RshBaseType& next, std::vector<std::string>& changed);
+};
+
+#endif //RSH_INIT_SERIALIZER_H
@@ -0,0 +1,93 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshLinkStatistics.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshLinkStatistics class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshLinkStatistics.
+ *
+ */
+
+#include "RshLinkStatistics.h"
+
+RshLinkStatistics::RshLinkStatistics() :
+	RshBaseType(rshLinkStatistics, sizeof (RshLinkStatistics)),
+	linkWidth(0),
+	linkSpeed(0),
+	ingressPayloadBytes(0),
+	ingressPayloadByteRate(0.0),
+	ingressLinkUtilization(0.0),
+	ingressPayloadAvgPerTlp(0.0),
+	egressPayloadBytes(0),
+	egressPayloadByteRate(0.0),
+	egressLinkUtilization(0.0),
+	egressPayloadAvgPerTlp(0.0),
+	dmaBytes(0),
+	dmaBlocks(0),
+	bufferOverruns(0)
+{ }
+
+RshLinkStatistics::RshLinkStatistics(const RshLinkStatistics& obj) :
+	RshBaseType(rshLinkStatistics, sizeof (RshLinkStatistics))
+{
+	operator=(obj);
+}
+
+RshLinkStatistics& RshLinkStatistics::operator=(const RshLinkStatistics& obj)
+{
+	if(this == &obj)
+		return *this;
+
+	this->linkWidth = obj.linkWidth;
+	this->linkSpeed = obj.linkSpeed;
+	this->ingressPayloadBytes = obj.ingressPayloadBytes;
+	this->ingressPayloadByteRate = obj.ingressPayloadByteRate;
+	this->ingressLinkUtilization = obj.ingressLinkUtilization;
+	this->ingressPayloadAvgPerTlp = obj.ingressPayloadAvgPerTlp;
+	this->egressPayloadBytes = obj.egressPayloadBytes;
+	this->egressPayloadByteRate = obj.egressPayloadByteRate;
+	this->egressLinkUtilization = obj.egressLinkUtilization;
+	this->egressPayloadAvgPerTlp = obj.egressPayloadAvgPerTlp;
+	this->dmaBytes = obj.dmaBytes;
+	this->dmaBlocks = obj.dmaBlocks;
+	this->bufferOverruns = obj.bufferOverruns;
+	return *this;
+}
+
+bool RshLinkStatistics::operator==(const RshLinkStatistics& obj) const
+{
+	return linkWidth == obj.linkWidth &&
+		linkSpeed == obj.linkSpeed &&
+		ingressPayloadBytes == obj.ingressPayloadBytes &&
+		ingressPayloadByteRate == obj.ingressPayloadByteRate &&
+		ingressLinkUtilization == obj.ingressLinkUtilization &&
+		ingressPayloadAvgPerTlp == obj.ingressPayloadAvgPerTlp &&
+		egressPayloadBytes == obj.egressPayloadBytes &&
+		egressPayloadByteRate == obj.egressPayloadByteRate &&
+		egressLinkUtilization == obj.egressLinkUtilization &&
+		egressPayloadAvgPerTlp == obj.egressPayloadAvgPerTlp &&
+		dmaBytes == obj.dmaBytes &&
+		dmaBlocks == obj.dmaBlocks &&
+		bufferOverruns == obj.bufferOverruns;
+}
+
+bool RshLinkStatistics::operator!=(const RshLinkStatistics& obj) const
+{
+	return !( operator==(obj) );
+}
+
+std::ostream& operator<< (std::ostream &out, const RshLinkStatistics& obj)
+{
+	return out << "[link=x" << +obj.linkWidth << " gen" << +obj.linkSpeed
+		<< "; ingress=" << obj.ingressPayloadByteRate << "B/s " << obj.ingressLinkUtilization << "%"
+		<< "; egress=" << obj.egressPayloadByteRate << "B/s " << obj.egressLinkUtilization << "%"
+		<< "; dmaBytes=" << obj.dmaBytes << "; dmaBlocks=" << obj.dmaBlocks
+		<< "; overruns=" << obj.bufferOverruns << "]";
+}
@@ -0,0 +1,101 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshLinkStatistics.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshLinkStatistics class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshLinkStatistics.
+ *
+ */
+
+#ifndef RSH_LINK_STATISTICS_H
+#define RSH_LINK_STATISTICS_H
+
+#include "RshBaseType.h"
+
+#include <ostream>
+
+#pragma pack(push, 8)
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Bus link and DMA statistics.
+ *
+ * Snapshot of device bus counters. Ingress/egress fields
+ * are filled from PLX performance counters (only for devices
+ * connected via PLX PCI Express switch or bridge that
+ * supports performance monitoring), DMA fields are
+ * maintained by device driver for all bus types.\n
+ * Byte and block counters are cumulative since device connect.
+ *
+ * \see
+ * RSH_GET_DEVICE_LINK_STATISTICS | RshLinkStatisticsSampler
+ *
+ * \~russian
+ * \brief
+ * Статистика шины и DMA.
+ *
+ * Мгновенные значения счетчиков шины устройства. Поля ingress/egress
+ * заполняются по данным счетчиков производительности PLX (только для
+ * устройств, подключенных через коммутатор или мост PLX PCI Express
+ * с поддержкой мониторинга производительности), поля DMA
+ * поддерживаются драйвером устройства для всех типов шин.\n
+ * Счетчики байт и блоков накапливаются с момента подключения к устройству.
+ *
+ * \see
+ * RSH_GET_DEVICE_LINK_STATISTICS | RshLinkStatisticsSampler
+ *
+ */
+struct RshLinkStatistics : public RshBaseType {
+
+	//! Negotiated link width (number of lanes), 0 if unknown
+	U8 linkWidth;
+	//! Negotiated link speed (1 - 2.5GT/s, 2 - 5GT/s, 3 - 8GT/s), 0 if unknown
+	U8 linkSpeed;
+
+	//! Total ingress payload bytes
+	U64 ingressPayloadBytes;
+	//! Ingress payload rate, bytes per second
+	double ingressPayloadByteRate;
+	//! Ingress link utilization, percent
+	double ingressLinkUtilization;
+	//! Average ingress payload per TLP, bytes
+	double ingressPayloadAvgPerTlp;
+
+	//! Total egress payload bytes
+	U64 egressPayloadBytes;
+	//! Egress payload rate, bytes per second
+	double egressPayloadByteRate;
+	//! Egress link utilization, percent
+	double egressLinkUtilization;
+	//! Average egress payload per TLP, bytes
+	double egressPayloadAvgPerTlp;
+
+	//! Total bytes transferred by DMA
+	U64 dmaBytes;
+	//! Total completed DMA blocks
+	U64 dmaBlocks;
+	//! Number of buffer overruns detected by driver
+	U64 bufferOverruns;
+
+	RshLinkStatistics();
+	RshLinkStatistics(const RshLinkStatistics& obj);
+	RshLinkStatistics& operator=(const RshLinkStatistics& obj);
+	bool operator==(const RshLinkStatistics& obj) const;
+	bool operator!=(const RshLinkStatistics& obj) const;
+
+	friend std::ostream& operator<< (std::ostream &out, const RshLinkStatistics& obj);
+};
+
+#pragma pack(pop)
+
+#endif //RSH_LINK_STATISTICS_H
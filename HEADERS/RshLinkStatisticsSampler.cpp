@@ -0,0 +1,159 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshLinkStatisticsSampler.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshLinkStatisticsSampler class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshLinkStatisticsSampler.
+ *
+ */
+
+#include "RshLinkStatisticsSampler.h"
+#include "RshConsts.h"
+#include "RshTime.h"
+
+RshLinkStatisticsSampler::RshLinkStatisticsSampler(U32 ringCapacity) :
+	m_device(0),
+	m_periodMs(1000),
+	m_stop(false),
+	m_lastError(RSH_API_SUCCESS),
+	m_index(0),
+	m_startTime(0.0),
+	m_prevTime(0.0),
+	m_ring(ringCapacity)
+{ }
+
+RshLinkStatisticsSampler::~RshLinkStatisticsSampler()
+{
+	Stop();
+}
+
+U32 RshLinkStatisticsSampler::Start(IRshDevice* device, U32 periodMs)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(periodMs == 0)
+		return RSH_API_PARAMETER_INVALID;
+	if(m_thread.IsRunning())
+		return RSH_API_THREAD_CANTCREATE;
+
+	m_device = device;
+	m_periodMs = periodMs;
+	m_stop = false;
+	m_index = 0;
+	m_startTime = Seconds();
+	m_prevTime = m_startTime;
+
+	// fail fast if neither device library nor PLX counters give link statistics
+	m_plx.Close();
+	m_prev = RshLinkStatistics();
+	U32 st = m_device->Get(RSH_GET_DEVICE_LINK_STATISTICS, &m_prev);
+	if(st != RSH_API_SUCCESS && m_plx.Open(m_device) == RSH_API_SUCCESS)
+		st = m_plx.Read(m_prev, 0);
+	m_lastError = st;
+	if(st != RSH_API_SUCCESS)
+	{
+		m_plx.Close();
+		return st;
+	}
+
+	return m_thread.Start(&RshLinkStatisticsSampler::Routine, this);
+}
+
+U32 RshLinkStatisticsSampler::Stop()
+{
+	m_stop = true;
+	const U32 st = m_thread.Join();
+	m_plx.Close();
+	return st;
+}
+
+bool RshLinkStatisticsSampler::Pop(RshLinkStatisticsSample& sample)
+{
+	return m_ring.Pop(sample);
+}
+
+U32 RshLinkStatisticsSampler::Count() const
+{
+	return m_ring.Count();
+}
+
+U32 RshLinkStatisticsSampler::Dropped() const
+{
+	return m_ring.Dropped();
+}
+
+U32 RshLinkStatisticsSampler::LastError() const
+{
+	return m_lastError;
+}
+
+bool RshLinkStatisticsSampler::IsPlx() const
+{
+	return m_plx.IsOpen();
+}
+
+void RshLinkStatisticsSampler::Routine(void* param)
+{
+	static_cast<RshLinkStatisticsSampler*>(param)->Run();
+}
+
+void RshLinkStatisticsSampler::Run()
+{
+	// sleep in short slices to react on Stop() quickly
+	const U32 slice = 10;
+	double next = m_startTime;
+
+	while(!m_stop)
+	{
+		next += m_periodMs / 1000.0;
+		for(;;)
+		{
+			if(m_stop)
+				return;
+			double left = next - Seconds();
+			if(left <= 0.0)
+				break;
+			U32 ms = static_cast<U32>(left * 1000.0);
+			__rshmssleep(ms < slice ? (ms == 0 ? 1 : ms) : slice);
+		}
+
+		m_lastError = Sample(Seconds());
+	}
+}
+
+U32 RshLinkStatisticsSampler::Sample(double now)
+{
+	RshLinkStatisticsSample sample;
+	double dt = now - m_prevTime;
+	U32 st = m_plx.IsOpen() ?
+		m_plx.Read(sample.stats, static_cast<U32>(dt * 1000.0 + 0.5)) :
+		m_device->Get(RSH_GET_DEVICE_LINK_STATISTICS, &sample.stats);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	sample.index = m_index++;
+	sample.elapsed = now - m_startTime;
+	if(dt > 0.0 && sample.stats.dmaBytes >= m_prev.dmaBytes)
+		sample.dmaByteRate = (sample.stats.dmaBytes - m_prev.dmaBytes) / dt;
+	if(sample.stats.bufferOverruns >= m_prev.bufferOverruns)
+		sample.overrunsDelta = sample.stats.bufferOverruns - m_prev.bufferOverruns;
+
+	m_prev = sample.stats;
+	m_prevTime = now;
+
+	m_ring.Push(sample);
+	return RSH_API_SUCCESS;
+}
+
+double RshLinkStatisticsSampler::Seconds()
+{
+	return RshTimestamp::Now().Seconds();
+}
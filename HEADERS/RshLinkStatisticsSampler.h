@@ -0,0 +1,183 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshLinkStatisticsSampler.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshLinkStatisticsSampler class.
+ *
+ * Periodic polling of ::RSH_GET_DEVICE_LINK_STATISTICS or PLX
+ * performance counters.
+ *
+ * \~russian
+ * \brief
+ * Класс RshLinkStatisticsSampler.
+ *
+ * Периодический опрос ::RSH_GET_DEVICE_LINK_STATISTICS или счетчиков
+ * производительности PLX.
+ *
+ */
+
+#ifndef RSH_LINK_STATISTICS_SAMPLER_H
+#define RSH_LINK_STATISTICS_SAMPLER_H
+
+#include "RshDefChk.h"
+#include "RshLinkStatistics.h"
+#include "RshPlxPerformance.h"
+#include "RshRingBuffer.h"
+#include "RshThread.h"
+#include "IRshDevice.h"
+
+/*!
+ *
+ * \~english
+ * \brief
+ * One link statistics sample
+ *
+ * \~russian
+ * \brief
+ * Один отсчет статистики шины
+ *
+ */
+struct RshLinkStatisticsSample
+{
+	//! Sequential sample number, starting from 0
+	U32 index;
+	//! Time since sampler start, seconds
+	double elapsed;
+	//! Raw counters returned by device
+	RshLinkStatistics stats;
+	//! DMA throughput since previous sample, bytes per second
+	double dmaByteRate;
+	//! Buffer overruns since previous sample
+	U64 overrunsDelta;
+
+	RshLinkStatisticsSample() : index(0), elapsed(0.0), dmaByteRate(0.0), overrunsDelta(0) {}
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Background link statistics sampler
+ *
+ * Polls device with ::RSH_GET_DEVICE_LINK_STATISTICS from
+ * separate thread and stores samples in lock-free ring, so
+ * acquisition thread is never blocked by telemetry consumer.
+ * If consumer does not call Pop() fast enough, oldest samples
+ * are kept and new ones are counted in Dropped().\n
+ * Board libraries do not implement ::RSH_GET_DEVICE_LINK_STATISTICS,
+ * for them PLX performance counters of device are read with
+ * RshPlxPerformance, which fills link fields of samples only.
+ *
+ * \remarks
+ * IRshDevice::Get() of device abstraction library must be
+ * thread safe for this code, as it is for all RSH libraries.
+ *
+ * \~russian
+ * \brief
+ * Фоновый опрос статистики шины
+ *
+ * Опрашивает устройство с помощью ::RSH_GET_DEVICE_LINK_STATISTICS
+ * в отдельном потоке и сохраняет отсчеты в кольцевой буфер без
+ * блокировок, поэтому поток сбора данных никогда не блокируется
+ * потребителем телеметрии. Если потребитель не успевает вызывать Pop(),
+ * новые отсчеты отбрасываются и учитываются в Dropped().\n
+ * Библиотеки устройств не реализуют ::RSH_GET_DEVICE_LINK_STATISTICS,
+ * для них счетчики производительности PLX устройства читаются с помощью
+ * RshPlxPerformance, который заполняет только поля шины в отсчетах.
+ *
+ * \remarks
+ * Метод IRshDevice::Get() библиотеки абстракции должен быть
+ * потокобезопасным (как во всех библиотеках RSH).
+ *
+ */
+class RshLinkStatisticsSampler
+{
+public:
+
+	explicit RshLinkStatisticsSampler(U32 ringCapacity = 256);
+	~RshLinkStatisticsSampler();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Start sampling
+	 *
+	 * Statistics are requested once synchronously, so unsupported
+	 * devices are reported immediately, then sampling thread is started.
+	 * If device does not support ::RSH_GET_DEVICE_LINK_STATISTICS, PLX
+	 * performance counters are used; when they are not available
+	 * either, error of device is returned.
+	 *
+	 * \param[in] device Connected device.
+	 * \param[in] periodMs Sampling period in milliseconds.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or error code.
+	 *
+	 * \~russian
+	 * \brief
+	 * Запуск опроса
+	 *
+	 * Статистика запрашивается один раз синхронно, чтобы сразу сообщить
+	 * об отсутствии поддержки, после чего запускается поток опроса.
+	 * Если устройство не поддерживает ::RSH_GET_DEVICE_LINK_STATISTICS,
+	 * используются счетчики производительности PLX; если недоступны и они,
+	 * возвращается ошибка устройства.
+	 *
+	 * \param[in] device Подключенное устройство.
+	 * \param[in] periodMs Период опроса в миллисекундах.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или код ошибки.
+	 *
+	 */
+	U32 Start(IRshDevice* device, U32 periodMs = 1000);
+
+	//! Stop sampling thread and wait for it to exit
+	U32 Stop();
+
+	//! Take oldest sample, returns false if there are no samples
+	bool Pop(RshLinkStatisticsSample& sample);
+
+	//! Number of samples waiting in ring
+	U32 Count() const;
+
+	//! Number of samples dropped because ring was full
+	U32 Dropped() const;
+
+	//! Last error returned by device while sampling
+	U32 LastError() const;
+
+	//! True if samples are read from PLX performance counters
+	bool IsPlx() const;
+
+private:
+
+	RshLinkStatisticsSampler(const RshLinkStatisticsSampler&);
+	RshLinkStatisticsSampler& operator=(const RshLinkStatisticsSampler&);
+
+	static void Routine(void* param);
+	void Run();
+	U32 Sample(double elapsed);
+	static double Seconds();
+
+	IRshDevice* m_device;
+	U32 m_periodMs;
+	volatile bool m_stop;
+	volatile U32 m_lastError;
+	U32 m_index;
+	double m_startTime;
+	double m_prevTime;
+	RshLinkStatistics m_prev;
+	RshPlxPerformance m_plx;
+	RshRingBuffer<RshLinkStatisticsSample> m_ring;
+	RshThread m_thread;
+};
+
+#endif //RSH_LINK_STATISTICS_SAMPLER_H
@@ -0,0 +1,130 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshMappedFile.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshMappedFile class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshMappedFile.
+ *
+ */
+
+#include "RshMappedFile.h"
+#include "RshConsts.h"
+
+#if defined(RSH_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+RshMappedFile::RshMappedFile() :
+	m_data(0),
+	m_size(0)
+#if defined(RSH_MSWINDOWS)
+	, m_file(INVALID_HANDLE_VALUE),
+	m_mapping(0)
+#endif
+{ }
+
+RshMappedFile::~RshMappedFile()
+{
+	Close();
+}
+
+U32 RshMappedFile::Open(const char* fileName)
+{
+	Close();
+
+	if(fileName == 0 || *fileName == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+
+#if defined(RSH_MSWINDOWS)
+	m_file = ::CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if(m_file == INVALID_HANDLE_VALUE)
+		return RSH_API_FILE_CANTOPEN;
+
+	LARGE_INTEGER size;
+	if(!::GetFileSizeEx(m_file, &size) || size.QuadPart == 0 ||
+		static_cast<U64>(size.QuadPart) > static_cast<U64>(static_cast<size_t>(-1)))
+	{
+		Close();
+		return RSH_API_FILE_CANTREAD;
+	}
+
+	m_mapping = ::CreateFileMapping(m_file, 0, PAGE_READONLY, 0, 0, 0);
+	const void* data = (m_mapping != 0) ? ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : 0;
+	if(data == 0)
+	{
+		Close();
+		return RSH_API_FILE_CANTREAD;
+	}
+	m_data = static_cast<const U8*>(data);
+	m_size = static_cast<size_t>(size.QuadPart);
+#elif defined(RSH_LINUX)
+	const int file = open(fileName, O_RDONLY);
+	if(file < 0)
+		return RSH_API_FILE_CANTOPEN;
+
+	struct stat status;
+	if(fstat(file, &status) != 0 || status.st_size <= 0 ||
+		static_cast<U64>(status.st_size) > static_cast<U64>(static_cast<size_t>(-1)))
+	{
+		close(file);
+		return RSH_API_FILE_CANTREAD;
+	}
+
+	const size_t size = static_cast<size_t>(status.st_size);
+	void* data = mmap(0, size, PROT_READ, MAP_SHARED, file, 0);
+	// mapping stays valid after descriptor is closed
+	close(file);
+	if(data == MAP_FAILED)
+		return RSH_API_FILE_CANTREAD;
+
+	// file is usually read from start to end
+	madvise(data, size, MADV_SEQUENTIAL);
+	m_data = static_cast<const U8*>(data);
+	m_size = size;
+#endif
+	return RSH_API_SUCCESS;
+}
+
+void RshMappedFile::Close()
+{
+#if defined(RSH_MSWINDOWS)
+	if(m_data != 0)
+		::UnmapViewOfFile(m_data);
+	if(m_mapping != 0)
+		::CloseHandle(m_mapping);
+	if(m_file != INVALID_HANDLE_VALUE)
+		::CloseHandle(m_file);
+	m_mapping = 0;
+	m_file = INVALID_HANDLE_VALUE;
+#elif defined(RSH_LINUX)
+	if(m_data != 0)
+		munmap(const_cast<U8*>(m_data), m_size);
+#endif
+	m_data = 0;
+	m_size = 0;
+}
+
+bool RshMappedFile::IsOpen() const
+{
+	return m_data != 0;
+}
+
+const U8* RshMappedFile::Data() const
+{
+	return m_data;
+}
+
+size_t RshMappedFile::Size() const
+{
+	return m_size;
+}
@@ -0,0 +1,102 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshMappedFile.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshMappedFile class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshMappedFile.
+ *
+ */
+
+#ifndef RSH_MAPPED_FILE_H
+#define RSH_MAPPED_FILE_H
+
+#include "RshDefChk.h"
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Read only memory mapped file
+ *
+ * Whole file is mapped to address space, so its content is read
+ * by operating system on first access to each page and is shared
+ * with file cache, without copying to user buffers.
+ *
+ * \~russian
+ * \brief
+ * Отображаемый в память файл только для чтения
+ *
+ * Файл целиком отображается в адресное пространство, поэтому его
+ * содержимое читается операционной системой при первом обращении к
+ * каждой странице и разделяется с файловым кэшем, без копирования в
+ * буферы пользователя.
+ *
+ */
+class RshMappedFile
+{
+public:
+
+	RshMappedFile();
+	~RshMappedFile();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Map file
+	 *
+	 * Previously mapped file is closed.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_FILE_NAMENOTDEFINED,
+	 * ::RSH_API_FILE_CANTOPEN or ::RSH_API_FILE_CANTREAD
+	 * (file is empty or can not be mapped).
+	 *
+	 * \~russian
+	 * \brief
+	 * Отображение файла
+	 *
+	 * Ранее отображенный файл закрывается.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_FILE_NAMENOTDEFINED,
+	 * ::RSH_API_FILE_CANTOPEN или ::RSH_API_FILE_CANTREAD
+	 * (файл пуст или не может быть отображен).
+	 *
+	 */
+	U32 Open(const char* fileName);
+
+	//! Unmap file
+	void Close();
+
+	//! True if file is mapped
+	bool IsOpen() const;
+
+	//! First byte of file, 0 if not mapped
+	const U8* Data() const;
+
+	//! File size in bytes
+	size_t Size() const;
+
+private:
+
+	RshMappedFile(const RshMappedFile&);
+	RshMappedFile& operator=(const RshMappedFile&);
+
+	const U8* m_data;
+	size_t m_size;
+#if defined(RSH_MSWINDOWS)
+	HANDLE m_file;
+	HANDLE m_mapping;
+#endif
+};
+
+#endif //RSH_MAPPED_FILE_H
@@ -0,0 +1,391 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshMonitoredDevice.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshMonitoredDevice class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshMonitoredDevice.
+ *
+ */
+
+#include "RshMonitoredDevice.h"
+#include "RshConsts.h"
+#include "RshBlockInfo.h"
+#include "RshScalarType.h"
+#include "RshBufferType.h"
+#include "RshTime.h"
+#include "RshTrace.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+
+// quantiles of latency summaries in Prometheus export
+static const double rshMonitoredDeviceQuantiles[] = { 0.5, 0.9, 0.99, 0.999, 1.0 };
+
+// size of data in buffer returned by GetData(), 0 for unknown types
+static U64 RshMonitoredDeviceByteSize(const RshBaseType* buffer)
+{
+	switch(buffer->_type)
+	{
+	case rshBufferTypeU8: return static_cast<const RSH_BUFFER_U8*>(buffer)->ByteSize();
+	case rshBufferTypeS8: return static_cast<const RSH_BUFFER_S8*>(buffer)->ByteSize();
+	case rshBufferTypeU16: return static_cast<const RSH_BUFFER_U16*>(buffer)->ByteSize();
+	case rshBufferTypeS16: return static_cast<const RSH_BUFFER_S16*>(buffer)->ByteSize();
+	case rshBufferTypeU32: return static_cast<const RSH_BUFFER_U32*>(buffer)->ByteSize();
+	case rshBufferTypeS32: return static_cast<const RSH_BUFFER_S32*>(buffer)->ByteSize();
+	case rshBufferTypeU64: return static_cast<const RSH_BUFFER_U64*>(buffer)->ByteSize();
+	case rshBufferTypeS64: return static_cast<const RSH_BUFFER_S64*>(buffer)->ByteSize();
+	case rshBufferTypeFloat: return static_cast<const RSH_BUFFER_FLOAT*>(buffer)->ByteSize();
+	case rshBufferTypeDouble: return static_cast<const RSH_BUFFER_DOUBLE*>(buffer)->ByteSize();
+	default: return 0;
+	}
+}
+
+// label value with \, " and line feed escaped
+static std::string RshMonitoredDeviceEscape(const std::string& text)
+{
+	std::string result;
+	for(size_t i = 0; i < text.size(); ++i)
+	{
+		if(text[i] == '\\' || text[i] == '"')
+			result += '\\';
+		if(text[i] == '\n')
+			result += "\\n";
+		else
+			result += text[i];
+	}
+	return result;
+}
+
+static void RshMonitoredDeviceCounter(std::ostream& out, const char* name, const char* help, const std::string& label, U64 value)
+{
+	out << "# HELP " << name << " " << help << "\n"
+		<< "# TYPE " << name << " counter\n"
+		<< name << "{device=\"" << label << "\"} " << value << "\n";
+}
+
+static void RshMonitoredDeviceSummary(std::ostream& out, const char* name, const char* help, const std::string& label, const RshHistogram& histogram)
+{
+	out << "# HELP " << name << " " << help << "\n"
+		<< "# TYPE " << name << " summary\n";
+	for(size_t i = 0; i < sizeof(rshMonitoredDeviceQuantiles) / sizeof(rshMonitoredDeviceQuantiles[0]); ++i)
+	{
+		out << name << "{device=\"" << label << "\",quantile=\"" << rshMonitoredDeviceQuantiles[i] << "\"} "
+			<< histogram.Percentile(rshMonitoredDeviceQuantiles[i]) * 1e-9 << "\n";
+	}
+	out << name << "_sum{device=\"" << label << "\"} " << histogram.Sum() * 1e-9 << "\n"
+		<< name << "_count{device=\"" << label << "\"} " << histogram.Count() << "\n";
+}
+
+RshMonitoredDevice::RshMonitoredDevice(IRshDevice* device, const char* label) :
+	m_device(device),
+	m_label(label ? label : ""),
+	m_blocks(0),
+	m_bytes(0),
+	m_overruns(0),
+	m_dropped(0),
+	m_errors(0),
+	m_waitTimeouts(0),
+	m_startTime(RshTimestamp::Now().NanoSeconds()),
+	m_blockInfo(false),
+	m_readyTime(0),
+	m_lastSequence(0),
+	m_exportPeriod(10000),
+	m_exportStop(false),
+	m_exportError(RSH_API_SUCCESS)
+{ }
+
+RshMonitoredDevice::~RshMonitoredDevice()
+{
+	StopExport();
+}
+
+U32 RshMonitoredDevice::Attach(IRshDevice* device)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	m_device = device;
+	return RSH_API_SUCCESS;
+}
+
+IRshDevice* RshMonitoredDevice::Device() const
+{
+	return m_device;
+}
+
+U32 __RSHCALLCONV RshMonitoredDevice::Connect(IN RshBaseType* key, IN U32 mode)
+{
+	RSH_TRACE_SCOPE("device", "Connect");
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	return m_device->Connect(key, mode);
+}
+
+U32 __RSHCALLCONV RshMonitoredDevice::Init(IN OUT RshBaseType* structure, IN U32 mode)
+{
+	RSH_TRACE_SCOPE("device", "Init");
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	return m_device->Init(structure, mode);
+}
+
+U32 __RSHCALLCONV RshMonitoredDevice::Start()
+{
+	RSH_TRACE_SCOPE("device", "Start");
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	// sequence numbers may start again after Start()
+	m_readyTime = 0;
+	m_lastSequence = 0;
+	RSH_U32 caps(RSH_CAPS_DEVICE_BLOCK_TIMESTAMP);
+	m_blockInfo = (m_device->Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) == RSH_API_SUCCESS);
+
+	return m_device->Start();
+}
+
+U32 __RSHCALLCONV RshMonitoredDevice::Stop()
+{
+	RSH_TRACE_SCOPE("device", "Stop");
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	return m_device->Stop();
+}
+
+U32 __RSHCALLCONV RshMonitoredDevice::GetData(IN OUT RshBaseType* buffer, IN U32 flags)
+{
+	RSH_TRACE_SCOPE("device", "GetData");
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	const U64 t0 = RshTimestamp::Now().NanoSeconds();
+	const U32 st = m_device->GetData(buffer, flags);
+	const U64 t1 = RshTimestamp::Now().NanoSeconds();
+
+	if(st != RSH_API_SUCCESS)
+	{
+		__rshatomicadd64(&m_errors, 1);
+		return st;
+	}
+
+	m_getDataTime.Record(t1 - t0);
+	if(m_readyTime != 0)
+	{
+		m_latency.Record(t0 - m_readyTime);
+		m_readyTime = 0;
+	}
+
+	__rshatomicadd64(&m_blocks, 1);
+	if(buffer != 0)
+		__rshatomicadd64(&m_bytes, RshMonitoredDeviceByteSize(buffer));
+
+	if(m_blockInfo)
+	{
+		RshBlockInfo info;
+		if(m_device->Get(RSH_GET_BUFFER_BLOCK_INFO, &info) == RSH_API_SUCCESS && info.sequence != 0)
+		{
+			if(m_lastSequence != 0 && info.sequence > m_lastSequence + 1)
+			{
+				__rshatomicadd64(&m_overruns, 1);
+				__rshatomicadd64(&m_dropped, info.sequence - m_lastSequence - 1);
+			}
+			m_lastSequence = info.sequence;
+		}
+	}
+
+	return st;
+}
+
+U32 __RSHCALLCONV RshMonitoredDevice::Get(IN U32 mode, IN OUT RshBaseType* adr)
+{
+	if(mode == RSH_GET_DEVICE_METRICS)
+	{
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshDeviceMetrics)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		Metrics(*static_cast<RshDeviceMetrics*>(adr));
+		return RSH_API_SUCCESS;
+	}
+
+	if(mode == RSH_GET_DEVICE_IS_CAPABLE && adr != 0 && adr->_type == rshU32 &&
+		static_cast<RSH_U32*>(adr)->data == RSH_CAPS_DEVICE_METRICS)
+		return RSH_API_SUCCESS;
+
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	if(mode == RSH_GET_WAIT_BUFFER_READY_EVENT)
+	{
+		RSH_TRACE_SCOPE("device", "WaitBufferReady");
+		const U32 st = m_device->Get(mode, adr);
+		if(st == RSH_API_SUCCESS)
+			m_readyTime = RshTimestamp::Now().NanoSeconds();
+		else if(st == RSH_API_EVENT_WAITTIMEOUT)
+			__rshatomicadd64(&m_waitTimeouts, 1);
+		return st;
+	}
+	return m_device->Get(mode, adr);
+}
+
+void RshMonitoredDevice::Metrics(RshDeviceMetrics& metrics) const
+{
+	metrics.blocks = __rshatomicload64(&m_blocks);
+	metrics.bytes = __rshatomicload64(&m_bytes);
+	metrics.overruns = __rshatomicload64(&m_overruns);
+	metrics.droppedBlocks = __rshatomicload64(&m_dropped);
+	metrics.errors = __rshatomicload64(&m_errors);
+	metrics.waitTimeouts = __rshatomicload64(&m_waitTimeouts);
+
+	const U64 now = RshTimestamp::Now().NanoSeconds();
+	const U64 start = __rshatomicload64(&m_startTime);
+	metrics.elapsed = (now > start) ? now - start : 0;
+	metrics.byteRate = (metrics.elapsed != 0) ? metrics.bytes * 1e9 / metrics.elapsed : 0.0;
+
+	metrics.latencyMean = m_latency.Mean();
+	metrics.latencyP50 = m_latency.Percentile(0.5);
+	metrics.latencyP99 = m_latency.Percentile(0.99);
+	metrics.latencyMax = m_latency.Max();
+
+	metrics.getDataMean = m_getDataTime.Mean();
+	metrics.getDataP50 = m_getDataTime.Percentile(0.5);
+	metrics.getDataP99 = m_getDataTime.Percentile(0.99);
+	metrics.getDataMax = m_getDataTime.Max();
+}
+
+void RshMonitoredDevice::Reset()
+{
+	m_blocks = 0;
+	m_bytes = 0;
+	m_overruns = 0;
+	m_dropped = 0;
+	m_errors = 0;
+	m_waitTimeouts = 0;
+	m_latency.Reset();
+	m_getDataTime.Reset();
+	m_startTime = RshTimestamp::Now().NanoSeconds();
+	__rshmembarrier();
+}
+
+const RshHistogram& RshMonitoredDevice::Latency() const
+{
+	return m_latency;
+}
+
+const RshHistogram& RshMonitoredDevice::GetDataTime() const
+{
+	return m_getDataTime;
+}
+
+U32 RshMonitoredDevice::WritePrometheus(std::ostream& out) const
+{
+	RshDeviceMetrics metrics;
+	Metrics(metrics);
+	const std::string label = RshMonitoredDeviceEscape(m_label);
+
+	out << std::setprecision(9);
+	RshMonitoredDeviceCounter(out, "rsh_device_blocks_total", "Blocks returned by GetData.", label, metrics.blocks);
+	RshMonitoredDeviceCounter(out, "rsh_device_bytes_total", "Bytes returned by GetData.", label, metrics.bytes);
+	RshMonitoredDeviceCounter(out, "rsh_device_overruns_total", "Gaps in block sequence numbers.", label, metrics.overruns);
+	RshMonitoredDeviceCounter(out, "rsh_device_dropped_blocks_total", "Blocks lost in sequence gaps.", label, metrics.droppedBlocks);
+	RshMonitoredDeviceCounter(out, "rsh_device_errors_total", "Failed GetData calls.", label, metrics.errors);
+	RshMonitoredDeviceCounter(out, "rsh_device_wait_timeouts_total", "Timed out waits for ready buffer.", label, metrics.waitTimeouts);
+	out << "# HELP rsh_device_byte_rate Bytes per second since start of monitoring.\n"
+		<< "# TYPE rsh_device_byte_rate gauge\n"
+		<< "rsh_device_byte_rate{device=\"" << label << "\"} " << metrics.byteRate << "\n";
+	RshMonitoredDeviceSummary(out, "rsh_device_latency_seconds", "Time from buffer ready to GetData call.", label, m_latency);
+	RshMonitoredDeviceSummary(out, "rsh_device_getdata_seconds", "Duration of GetData call.", label, m_getDataTime);
+
+	return out.good() ? RSH_API_SUCCESS : RSH_API_FILE_CANTWRITE;
+}
+
+U32 RshMonitoredDevice::StartExport(const char* fileName, U32 periodMs)
+{
+	if(fileName == 0 || *fileName == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+	if(periodMs == 0)
+		return RSH_API_PARAMETER_INVALID;
+	if(m_exportThread.IsRunning())
+		return RSH_API_THREAD_CANTCREATE;
+
+	m_exportFile = fileName;
+	m_exportPeriod = periodMs;
+	m_exportStop = false;
+
+	// fail fast if file can not be written
+	const U32 st = WriteFile();
+	m_exportError = st;
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	return m_exportThread.Start(&RshMonitoredDevice::Routine, this);
+}
+
+U32 RshMonitoredDevice::StopExport()
+{
+	m_exportStop = true;
+	return m_exportThread.Join();
+}
+
+U32 RshMonitoredDevice::LastExportError() const
+{
+	return m_exportError;
+}
+
+void RshMonitoredDevice::Routine(void* param)
+{
+	static_cast<RshMonitoredDevice*>(param)->Export();
+}
+
+void RshMonitoredDevice::Export()
+{
+	// sleep in short slices to react on StopExport() quickly
+	const U32 slice = 10;
+	U32 waited = 0;
+
+	while(!m_exportStop)
+	{
+		__rshmssleep(slice);
+		waited += slice;
+		if(waited < m_exportPeriod)
+			continue;
+		waited = 0;
+		m_exportError = WriteFile();
+	}
+}
+
+U32 RshMonitoredDevice::WriteFile() const
+{
+	const std::string temporary = m_exportFile + ".tmp";
+	{
+		std::ofstream file(temporary.c_str(), std::ios::out | std::ios::trunc);
+		if(!file.is_open())
+			return RSH_API_FILE_CANTCREATE;
+		const U32 st = WritePrometheus(file);
+		file.close();
+		if(st != RSH_API_SUCCESS || file.fail())
+		{
+			remove(temporary.c_str());
+			return RSH_API_FILE_CANTWRITE;
+		}
+	}
+
+#if defined(RSH_MSWINDOWS)
+	// rename does not replace existing file
+	remove(m_exportFile.c_str());
+#endif
+	if(rename(temporary.c_str(), m_exportFile.c_str()) != 0)
+	{
+		remove(temporary.c_str());
+		return RSH_API_FILE_CANTWRITE;
+	}
+	return RSH_API_SUCCESS;
+}
@@ -0,0 +1,224 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshMonitoredDevice.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshMonitoredDevice class.
+ *
+ * Acquisition metrics of any device.
+ *
+ * \~russian
+ * \brief
+ * Класс RshMonitoredDevice.
+ *
+ * Метрики сбора данных любого устройства.
+ *
+ */
+
+#ifndef RSH_MONITORED_DEVICE_H
+#define RSH_MONITORED_DEVICE_H
+
+#include "RshDefChk.h"
+#include "RshDeviceMetrics.h"
+#include "RshHistogram.h"
+#include "RshThread.h"
+#include "IRshDevice.h"
+
+#include <ostream>
+#include <string>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Device wrapper collecting acquisition metrics
+ *
+ * Implements IRshDevice and passes all calls to device interface
+ * obtained from RshDllClient, so it is used in place of that interface
+ * without changes in application code. On the way it counts blocks and
+ * bytes returned by GetData(), failed calls, timeouts of
+ * ::RSH_GET_WAIT_BUFFER_READY_EVENT, gaps in ::RSH_GET_BUFFER_BLOCK_INFO
+ * sequence numbers, and records histograms of wait to GetData latency
+ * and GetData() duration.\n
+ * Counters are updated with atomic operations only, so metrics can be
+ * read with Metrics(), Get(::RSH_GET_DEVICE_METRICS) or WritePrometheus()
+ * from any thread without slowing down acquisition thread. Export to
+ * file in Prometheus text format (for node_exporter textfile collector)
+ * is done periodically by background thread, see StartExport().
+ *
+ * \remarks
+ * Counters are cumulative since object creation or Reset(), not since
+ * device start, as monitoring systems expect from counters.
+ * Object does not own device interface, it is released by RshDllClient.
+ *
+ * \~russian
+ * \brief
+ * Обертка устройства, собирающая метрики сбора данных
+ *
+ * Реализует IRshDevice и передает все вызовы интерфейсу устройства,
+ * полученному от RshDllClient, поэтому используется вместо этого
+ * интерфейса без изменения кода приложения. При этом подсчитываются
+ * блоки и байты, полученные GetData(), ошибки вызовов, истечения времени
+ * ожидания ::RSH_GET_WAIT_BUFFER_READY_EVENT, пропуски порядковых номеров
+ * ::RSH_GET_BUFFER_BLOCK_INFO, и строятся гистограммы задержки от
+ * ожидания до GetData и длительности GetData().\n
+ * Счетчики обновляются только атомарными операциями, поэтому метрики
+ * можно читать методами Metrics(), Get(::RSH_GET_DEVICE_METRICS) или
+ * WritePrometheus() из любого потока, не замедляя поток сбора данных.
+ * Периодическая запись в файл в текстовом формате Prometheus (для
+ * textfile collector в node_exporter) выполняется фоновым потоком,
+ * см. StartExport().
+ *
+ * \remarks
+ * Счетчики накапливаются с момента создания объекта или вызова Reset(),
+ * а не с момента запуска устройства, как ожидают системы мониторинга.
+ * Объект не владеет интерфейсом устройства, его освобождает RshDllClient.
+ *
+ */
+class RshMonitoredDevice : public IRshDevice
+{
+public:
+
+	explicit RshMonitoredDevice(IRshDevice* device = 0, const char* label = "device");
+	virtual ~RshMonitoredDevice();
+
+	//! Set device which calls are passed to
+	U32 Attach(IRshDevice* device);
+
+	//! Device which calls are passed to
+	IRshDevice* Device() const;
+
+	U32 __RSHCALLCONV Connect(IN RshBaseType* key, IN U32 mode = RSH_CONNECT_MODE_BASE);
+	U32 __RSHCALLCONV Init(IN OUT RshBaseType* structure, IN U32 mode = RSH_INIT_MODE_INIT);
+	U32 __RSHCALLCONV Start();
+	U32 __RSHCALLCONV Stop();
+	U32 __RSHCALLCONV GetData(IN OUT RshBaseType* buffer, IN U32 flags = RSH_DATA_MODE_NO_FLAGS);
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType* adr = NULL);
+
+	//! Snapshot of counters and percentiles
+	void Metrics(RshDeviceMetrics& metrics) const;
+
+	//! Clear counters and histograms
+	void Reset();
+
+	//! Histogram of wait to GetData latency, ns
+	const RshHistogram& Latency() const;
+
+	//! Histogram of GetData() duration, ns
+	const RshHistogram& GetDataTime() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Write metrics in Prometheus text format
+	 *
+	 * Counters are named rsh_device_*_total, latency and GetData
+	 * duration are written as summaries in seconds, all with label
+	 * device set in constructor.
+	 *
+	 * \param[out] out Output stream.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_FILE_CANTWRITE.
+	 *
+	 * \~russian
+	 * \brief
+	 * Запись метрик в текстовом формате Prometheus
+	 *
+	 * Счетчики называются rsh_device_*_total, задержка и длительность
+	 * GetData записываются как summary в секундах, все с меткой device,
+	 * заданной в конструкторе.
+	 *
+	 * \param[out] out Поток вывода.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_FILE_CANTWRITE.
+	 *
+	 */
+	U32 WritePrometheus(std::ostream& out) const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Start periodic export to file
+	 *
+	 * File is written once synchronously, so wrong path is reported
+	 * immediately, then background thread rewrites it every period.
+	 * Data is written to temporary file which then replaces \b fileName,
+	 * so readers never see partially written file.
+	 *
+	 * \param[in] fileName Output file, for example
+	 * "/var/lib/node_exporter/textfile_collector/rsh.prom".
+	 * \param[in] periodMs Export period in milliseconds.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or error code.
+	 *
+	 * \~russian
+	 * \brief
+	 * Запуск периодической записи в файл
+	 *
+	 * Файл записывается один раз синхронно, чтобы сразу сообщить о
+	 * неверном пути, затем фоновый поток перезаписывает его каждый период.
+	 * Данные записываются во временный файл, который затем заменяет
+	 * \b fileName, поэтому читатели не видят частично записанный файл.
+	 *
+	 * \param[in] fileName Файл, например
+	 * "/var/lib/node_exporter/textfile_collector/rsh.prom".
+	 * \param[in] periodMs Период записи в миллисекундах.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или код ошибки.
+	 *
+	 */
+	U32 StartExport(const char* fileName, U32 periodMs = 10000);
+
+	//! Stop export thread and wait for it to exit
+	U32 StopExport();
+
+	//! Last error of export thread
+	U32 LastExportError() const;
+
+private:
+
+	RshMonitoredDevice(const RshMonitoredDevice&);
+	RshMonitoredDevice& operator=(const RshMonitoredDevice&);
+
+	static void Routine(void* param);
+	void Export();
+	U32 WriteFile() const;
+
+	IRshDevice* m_device;
+	std::string m_label;
+
+	// counters, updated atomically
+	volatile U64 m_blocks;
+	volatile U64 m_bytes;
+	volatile U64 m_overruns;
+	volatile U64 m_dropped;
+	volatile U64 m_errors;
+	volatile U64 m_waitTimeouts;
+	volatile U64 m_startTime;
+	RshHistogram m_latency;
+	RshHistogram m_getDataTime;
+
+	// state of acquisition thread
+	bool m_blockInfo;
+	U64 m_readyTime;
+	U64 m_lastSequence;
+
+	// export
+	std::string m_exportFile;
+	U32 m_exportPeriod;
+	volatile bool m_exportStop;
+	volatile U32 m_exportError;
+	RshThread m_exportThread;
+};
+
+#endif //RSH_MONITORED_DEVICE_H
@@ -0,0 +1,278 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshPlxPerformance.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshPlxPerformance class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshPlxPerformance.
+ *
+ */
+
+#include "RshPlxPerformance.h"
+#include "RshConsts.h"
+#include "RshDeviceBaseInfo.h"
+#include "RshThread.h"
+
+#include <cstring>
+
+// PLX API status of success (ApiSuccess in PlxStat.h)
+#define RSH_PLX_API_SUCCESS 0x200
+// PLX_PERF_CMD_START in PlxTypes.h
+#define RSH_PLX_PERF_CMD_START 0
+#define RSH_PLX_PERF_CMD_STOP 1
+// PCI_FIELD_IGNORE in Plx.h
+#define RSH_PLX_FIELD_IGNORE 0xFF
+
+// PLX_DEVICE_KEY of PlxTypes.h
+struct RshPlxDeviceKey
+{
+	U32 IsValidTag;
+	U8 domain;
+	U8 bus;
+	U8 slot;
+	U8 function;
+	U16 VendorId;
+	U16 DeviceId;
+	U16 SubVendorId;
+	U16 SubDeviceId;
+	U8 Revision;
+	U16 PlxChip;
+	U8 PlxRevision;
+	U8 PlxFamily;
+	U8 ApiIndex;
+	U16 DeviceNumber;
+	U8 ApiMode;
+	U8 PlxPort;
+	U8 NTPortType;
+	U8 NTPortNum;
+	U8 DeviceMode;
+	U32 ApiInternal[2];
+};
+
+// PLX_PERF_PROP of PlxTypes.h: port properties and 14 current and 14 previous counters
+struct RshPlxPerfProp
+{
+	U32 IsValidTag;
+	U8 PortNumber;
+	U8 LinkWidth;
+	U8 LinkSpeed;
+	U8 Station;
+	U8 StationPort;
+	U32 counters[28];
+};
+
+// PLX_PERF_STATS of PlxTypes.h
+struct RshPlxPerfStats
+{
+	S64 IngressTotalBytes;
+	long double IngressTotalByteRate;
+	S64 IngressCplAvgPerReadReq;
+	S64 IngressCplAvgBytesPerTlp;
+	S64 IngressPayloadReadBytes;
+	S64 IngressPayloadReadBytesAvg;
+	S64 IngressPayloadWriteBytes;
+	S64 IngressPayloadWriteBytesAvg;
+	S64 IngressPayloadTotalBytes;
+	double IngressPayloadAvgPerTlp;
+	long double IngressPayloadByteRate;
+	long double IngressLinkUtilization;
+
+	S64 EgressTotalBytes;
+	long double EgressTotalByteRate;
+	S64 EgressCplAvgPerReadReq;
+	S64 EgressCplAvgBytesPerTlp;
+	S64 EgressPayloadReadBytes;
+	S64 EgressPayloadReadBytesAvg;
+	S64 EgressPayloadWriteBytes;
+	S64 EgressPayloadWriteBytesAvg;
+	S64 EgressPayloadTotalBytes;
+	double EgressPayloadAvgPerTlp;
+	long double EgressPayloadByteRate;
+	long double EgressLinkUtilization;
+};
+
+struct RshPlxPerformance::Port
+{
+	// PLX_DEVICE_OBJECT is used by PLX API only, so storage of enough size is passed
+	U64 device[128];
+	RshPlxPerfProp properties;
+};
+
+typedef int (*RshPlxDeviceOpen)(RshPlxDeviceKey* key, void* device);
+typedef int (*RshPlxDeviceClose)(void* device);
+typedef int (*RshPlxPerformanceInitializeProperties)(void* device, RshPlxPerfProp* properties);
+typedef int (*RshPlxPerformanceMonitorControl)(void* device, int command);
+typedef int (*RshPlxPerformanceResetCounters)(void* device, RshPlxPerfProp* properties, U8 count);
+typedef int (*RshPlxPerformanceGetCounters)(void* device, RshPlxPerfProp* properties, U8 count);
+typedef int (*RshPlxPerformanceCalcStatistics)(RshPlxPerfProp* properties, RshPlxPerfStats* stats, U32 elapsedMs);
+
+// PLX API is loaded once and stays loaded until process exits
+static RshMutex rshPlxMutex;
+static bool rshPlxTried = false;
+static RshPlxDeviceOpen rshPlxDeviceOpen = 0;
+static RshPlxDeviceClose rshPlxDeviceClose = 0;
+static RshPlxPerformanceInitializeProperties rshPlxPerformanceInitializeProperties = 0;
+static RshPlxPerformanceMonitorControl rshPlxPerformanceMonitorControl = 0;
+static RshPlxPerformanceResetCounters rshPlxPerformanceResetCounters = 0;
+static RshPlxPerformanceGetCounters rshPlxPerformanceGetCounters = 0;
+static RshPlxPerformanceCalcStatistics rshPlxPerformanceCalcStatistics = 0;
+
+static bool RshPlxLoad()
+{
+	RshMutexLocker locker(rshPlxMutex);
+	if(!rshPlxTried)
+	{
+		rshPlxTried = true;
+#if defined(RSH_MSWINDOWS)
+		HMODULE library = ::LoadLibraryA("PlxApi.dll");
+		if(library != 0)
+		{
+			rshPlxDeviceOpen = (RshPlxDeviceOpen)::GetProcAddress(library, "PlxPci_DeviceOpen");
+			rshPlxDeviceClose = (RshPlxDeviceClose)::GetProcAddress(library, "PlxPci_DeviceClose");
+			rshPlxPerformanceInitializeProperties = (RshPlxPerformanceInitializeProperties)::GetProcAddress(library, "PlxPci_PerformanceInitializeProperties");
+			rshPlxPerformanceMonitorControl = (RshPlxPerformanceMonitorControl)::GetProcAddress(library, "PlxPci_PerformanceMonitorControl");
+			rshPlxPerformanceResetCounters = (RshPlxPerformanceResetCounters)::GetProcAddress(library, "PlxPci_PerformanceResetCounters");
+			rshPlxPerformanceGetCounters = (RshPlxPerformanceGetCounters)::GetProcAddress(library, "PlxPci_PerformanceGetCounters");
+			rshPlxPerformanceCalcStatistics = (RshPlxPerformanceCalcStatistics)::GetProcAddress(library, "PlxPci_PerformanceCalcStatistics");
+		}
+#elif defined(RSH_LINUX)
+		// PLX API is linked into each of PLX support libraries, any of them serves all PLX drivers
+		const char* names[] = { "libPLX8311.so", "libPLX9054.so", "libPLX9050.so" };
+		void* library = 0;
+		for(size_t i = 0; i < sizeof(names) / sizeof(names[0]) && library == 0; ++i)
+			library = dlopen((std::string(RSH_DLL_LIBRARIES_DIRECTORY) + names[i]).c_str(), RTLD_NOW | RTLD_LOCAL);
+		if(library != 0)
+		{
+			rshPlxDeviceOpen = (RshPlxDeviceOpen)dlsym(library, "PlxPci_DeviceOpen");
+			rshPlxDeviceClose = (RshPlxDeviceClose)dlsym(library, "PlxPci_DeviceClose");
+			rshPlxPerformanceInitializeProperties = (RshPlxPerformanceInitializeProperties)dlsym(library, "PlxPci_PerformanceInitializeProperties");
+			rshPlxPerformanceMonitorControl = (RshPlxPerformanceMonitorControl)dlsym(library, "PlxPci_PerformanceMonitorControl");
+			rshPlxPerformanceResetCounters = (RshPlxPerformanceResetCounters)dlsym(library, "PlxPci_PerformanceResetCounters");
+			rshPlxPerformanceGetCounters = (RshPlxPerformanceGetCounters)dlsym(library, "PlxPci_PerformanceGetCounters");
+			rshPlxPerformanceCalcStatistics = (RshPlxPerformanceCalcStatistics)dlsym(library, "PlxPci_PerformanceCalcStatistics");
+		}
+#endif
+	}
+	return rshPlxDeviceOpen != 0 && rshPlxDeviceClose != 0 && rshPlxPerformanceInitializeProperties != 0 &&
+		rshPlxPerformanceMonitorControl != 0 && rshPlxPerformanceResetCounters != 0 &&
+		rshPlxPerformanceGetCounters != 0 && rshPlxPerformanceCalcStatistics != 0;
+}
+
+RshPlxPerformance::RshPlxPerformance() :
+	m_port(0),
+	m_ingressBytes(0),
+	m_egressBytes(0)
+{ }
+
+RshPlxPerformance::~RshPlxPerformance()
+{
+	Close();
+}
+
+U32 RshPlxPerformance::Open(IRshDevice* device)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	Close();
+	if(!RshPlxLoad())
+		return RSH_API_DLL_WASNOTLOADED;
+
+	// PCI location of connected device is taken from device list, by serial number if there are several
+	RSH_BUFFER_DEVICE_BASE_INFO list;
+	U32 st = device->Get(RSH_GET_DEVICE_BASE_LIST_EXT, &list);
+	if(st != RSH_API_SUCCESS)
+		return st;
+	RSH_U32 serial;
+	const bool haveSerial = (device->Get(RSH_GET_DEVICE_SERIAL_NUMBER, &serial) == RSH_API_SUCCESS);
+	const RshDeviceBaseInfo* info = 0;
+	for(size_t i = 0; i < list.Size(); ++i)
+	{
+		if(list.Size() == 1 || (haveSerial && list[i].serialNumber == serial.data))
+		{
+			info = &list[i];
+			break;
+		}
+	}
+	if(info == 0)
+		return RSH_API_DEVICE_NOTFOUND;
+
+	RshPlxDeviceKey key;
+	memset(&key, RSH_PLX_FIELD_IGNORE, sizeof(key));
+	key.VendorId = info->vid;
+	key.DeviceId = info->pid;
+	key.slot = static_cast<U8>(info->slot);
+
+	Port* port = new Port();
+	if(rshPlxDeviceOpen(&key, port->device) != RSH_PLX_API_SUCCESS)
+	{
+		delete port;
+		return RSH_API_DEVICE_NOTFOUND;
+	}
+	if(rshPlxPerformanceInitializeProperties(port->device, &port->properties) != RSH_PLX_API_SUCCESS ||
+		rshPlxPerformanceMonitorControl(port->device, RSH_PLX_PERF_CMD_START) != RSH_PLX_API_SUCCESS ||
+		rshPlxPerformanceResetCounters(port->device, &port->properties, 1) != RSH_PLX_API_SUCCESS)
+	{
+		rshPlxDeviceClose(port->device);
+		delete port;
+		return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+	}
+
+	m_port = port;
+	m_ingressBytes = 0;
+	m_egressBytes = 0;
+	return RSH_API_SUCCESS;
+}
+
+void RshPlxPerformance::Close()
+{
+	if(m_port == 0)
+		return;
+	rshPlxPerformanceMonitorControl(m_port->device, RSH_PLX_PERF_CMD_STOP);
+	rshPlxDeviceClose(m_port->device);
+	delete m_port;
+	m_port = 0;
+}
+
+bool RshPlxPerformance::IsOpen() const
+{
+	return m_port != 0;
+}
+
+U32 RshPlxPerformance::Read(RshLinkStatistics& stats, U32 elapsedMs)
+{
+	if(m_port == 0)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+
+	if(rshPlxPerformanceGetCounters(m_port->device, &m_port->properties, 1) != RSH_PLX_API_SUCCESS)
+		return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+
+	RshPlxPerfStats perf;
+	memset(&perf, 0, sizeof(perf));
+	// statistics are calculated from difference of current and previous counters kept by driver
+	if(elapsedMs == 0 || rshPlxPerformanceCalcStatistics(&m_port->properties, &perf, elapsedMs) != RSH_PLX_API_SUCCESS)
+		memset(&perf, 0, sizeof(perf));
+
+	if(perf.IngressPayloadTotalBytes > 0)
+		m_ingressBytes += static_cast<U64>(perf.IngressPayloadTotalBytes);
+	if(perf.EgressPayloadTotalBytes > 0)
+		m_egressBytes += static_cast<U64>(perf.EgressPayloadTotalBytes);
+
+	stats.linkWidth = m_port->properties.LinkWidth;
+	stats.linkSpeed = m_port->properties.LinkSpeed;
+	stats.ingressPayloadBytes = m_ingressBytes;
+	stats.ingressPayloadByteRate = static_cast<double>(perf.IngressPayloadByteRate);
+	stats.ingressLinkUtilization = static_cast<double>(perf.IngressLinkUtilization);
+	stats.ingressPayloadAvgPerTlp = perf.IngressPayloadAvgPerTlp;
+	stats.egressPayloadBytes = m_egressBytes;
+	stats.egressPayloadByteRate = static_cast<double>(perf.EgressPayloadByteRate);
+	stats.egressLinkUtilization = static_cast<double>(perf.EgressLinkUtilization);
+	stats.egressPayloadAvgPerTlp = perf.EgressPayloadAvgPerTlp;
+	return RSH_API_SUCCESS;
+}
@@ -0,0 +1,137 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshPlxPerformance.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshPlxPerformance class.
+ *
+ * PCI Express link statistics from PLX performance counters.
+ *
+ * \~russian
+ * \brief
+ * Класс RshPlxPerformance.
+ *
+ * Статистика шины PCI Express по счетчикам производительности PLX.
+ *
+ */
+
+#ifndef RSH_PLX_PERFORMANCE_H
+#define RSH_PLX_PERFORMANCE_H
+
+#include "RshDefChk.h"
+#include "RshLinkStatistics.h"
+#include "IRshDevice.h"
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Reader of PLX performance counters of device
+ *
+ * Loads PLX API from library directory of SDK at run time, finds PLX
+ * device with VID, PID and slot of connected device
+ * (::RSH_GET_DEVICE_BASE_LIST_EXT) and reads its counters with
+ * PlxPci_PerformanceGetCounters() and PlxPci_PerformanceCalcStatistics().
+ * Used by RshLinkStatisticsSampler for devices whose library does not
+ * support ::RSH_GET_DEVICE_LINK_STATISTICS.
+ *
+ * \remarks
+ * Counters exist only in PLX PCI Express chips with performance
+ * monitoring, served by PLX driver with performance support; for
+ * PCI bridges (9050, 9054) Open() returns error. DMA fields of
+ * RshLinkStatistics are not filled.
+ *
+ * \~russian
+ * \brief
+ * Чтение счетчиков производительности PLX устройства
+ *
+ * Загружает PLX API из каталога библиотек SDK во время выполнения,
+ * находит устройство PLX с VID, PID и слотом подключенного устройства
+ * (::RSH_GET_DEVICE_BASE_LIST_EXT) и читает его счетчики с помощью
+ * PlxPci_PerformanceGetCounters() и PlxPci_PerformanceCalcStatistics().
+ * Используется классом RshLinkStatisticsSampler для устройств, библиотека
+ * которых не поддерживает ::RSH_GET_DEVICE_LINK_STATISTICS.
+ *
+ * \remarks
+ * Счетчики есть только в микросхемах PLX PCI Express с мониторингом
+ * производительности, обслуживаемых драйвером PLX с его поддержкой; для
+ * мостов PCI (9050, 9054) Open() возвращает ошибку. Поля DMA
+ * RshLinkStatistics не заполняются.
+ *
+ */
+class RshPlxPerformance
+{
+public:
+
+	RshPlxPerformance();
+	~RshPlxPerformance();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Open PLX device of connected device and start monitoring
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_DLL_WASNOTLOADED if PLX API is not found,
+	 * ::RSH_API_DEVICE_NOTFOUND or
+	 * ::RSH_API_DEVICE_FUNCTION_NOTSUPPORTED.
+	 *
+	 * \~russian
+	 * \brief
+	 * Открытие устройства PLX подключенного устройства и запуск мониторинга
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS,
+	 * ::RSH_API_DLL_WASNOTLOADED, если PLX API не найден,
+	 * ::RSH_API_DEVICE_NOTFOUND или
+	 * ::RSH_API_DEVICE_FUNCTION_NOTSUPPORTED.
+	 *
+	 */
+	U32 Open(IRshDevice* device);
+
+	//! Stop monitoring and close PLX device
+	void Close();
+
+	//! True between successful Open() and Close()
+	bool IsOpen() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Read counters and fill link fields of statistics
+	 *
+	 * \param[out] stats Link width and speed, ingress and egress fields.
+	 * Byte totals are accumulated since Open().
+	 * \param[in] elapsedMs Time since previous Read() or Open(), ms.
+	 *
+	 * \~russian
+	 * \brief
+	 * Чтение счетчиков и заполнение полей шины в статистике
+	 *
+	 * \param[out] stats Ширина и скорость канала, поля ingress и egress.
+	 * Суммы байт накапливаются с момента Open().
+	 * \param[in] elapsedMs Время с предыдущего вызова Read() или Open(), мс.
+	 *
+	 */
+	U32 Read(RshLinkStatistics& stats, U32 elapsedMs);
+
+private:
+
+	RshPlxPerformance(const RshPlxPerformance&);
+	RshPlxPerformance& operator=(const RshPlxPerformance&);
+
+	//! PLX structures, defined in RshPlxPerformance.cpp
+	struct Port;
+	Port* m_port;
+	U64 m_ingressBytes;
+	U64 m_egressBytes;
+};
+
+#endif //RSH_PLX_PERFORMANCE_H
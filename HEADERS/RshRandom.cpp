@@ -0,0 +1,274 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshRandom.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshRandom class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshRandom.
+ *
+ */
+
+#include "RshRandom.h"
+#include "RshFunctions.h"
+#include "RshConsts.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#define RSH_RANDOM_ROTL(x, k) (((x) << (k)) | ((x) >> (64 - (k))))
+// 2^-53, converts upper 53 bits of random value to double in [0, 1)
+#define RSH_RANDOM_DOUBLE_UNIT (1.0 / 9007199254740992.0)
+#define RSH_RANDOM_TWO_PI 6.283185307179586476925286766559
+
+RshRandom::RshRandom(U64 seed)
+{
+	Seed(seed);
+}
+
+void RshRandom::Seed(U64 seed)
+{
+	if(seed == 0)
+		seed = RshMix();
+
+	// state is expanded from seed with splitmix64, as recommended by xoshiro authors
+	U64 x = seed;
+	for(int w = 0; w < 4; ++w)
+		for(int l = 0; l < lanes; ++l)
+		{
+			x += 0x9E3779B97F4A7C15ULL;
+			U64 z = x;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			m_state[w][l] = z ^ (z >> 31);
+		}
+
+	m_cached = 0;
+	m_hasGaussian = false;
+	m_gaussian = 0.0;
+}
+
+U64 RshRandom::Next()
+{
+	if(m_cached == 0)
+	{
+		Generate(m_cache, lanes);
+		m_cached = lanes;
+	}
+	return m_cache[--m_cached];
+}
+
+double RshRandom::Uniform()
+{
+	return (Next() >> 11) * RSH_RANDOM_DOUBLE_UNIT;
+}
+
+double RshRandom::Gaussian()
+{
+	if(m_hasGaussian)
+	{
+		m_hasGaussian = false;
+		return m_gaussian;
+	}
+
+	U64 raw[2] = { Next(), Next() };
+	double pair[2];
+	ToGaussian(raw, pair, 2);
+	m_gaussian = pair[1];
+	m_hasGaussian = true;
+	return pair[0];
+}
+
+void RshRandom::Fill(U64* values, size_t count)
+{
+	Generate(values, count);
+}
+
+void RshRandom::FillBytes(void* data, size_t size)
+{
+	U8* bytes = static_cast<U8*>(data);
+	size_t words = size / sizeof(U64);
+	U64 raw[blockSize];
+
+	// go through aligned local block, data may be not aligned for U64
+	for(size_t done = 0; done < words; done += blockSize)
+	{
+		size_t n = (words - done < static_cast<size_t>(blockSize)) ? words - done : static_cast<size_t>(blockSize);
+		Generate(raw, n);
+		memcpy(bytes + done * sizeof(U64), raw, n * sizeof(U64));
+	}
+
+	size_t tail = size - words * sizeof(U64);
+	if(tail != 0)
+	{
+		U64 last = Next();
+		memcpy(bytes + words * sizeof(U64), &last, tail);
+	}
+}
+
+void RshRandom::Generate(U64* values, size_t count)
+{
+	const size_t full = count - count % lanes;
+
+	// one step of xoshiro256** for each lane
+	for(size_t i = 0; i < full; i += lanes)
+	{
+		for(int l = 0; l < lanes; ++l)
+		{
+			const U64 s1 = m_state[1][l];
+			const U64 mul = s1 * 5;
+			values[i + l] = RSH_RANDOM_ROTL(mul, 7) * 9;
+
+			const U64 t = s1 << 17;
+			m_state[2][l] ^= m_state[0][l];
+			m_state[3][l] ^= s1;
+			m_state[1][l] = s1 ^ m_state[2][l];
+			m_state[0][l] ^= m_state[3][l];
+			m_state[2][l] ^= t;
+			m_state[3][l] = RSH_RANDOM_ROTL(m_state[3][l], 45);
+		}
+	}
+
+	for(size_t i = full; i < count; ++i)
+		values[i] = Next();
+}
+
+void RshRandom::ToUniform(const U64* src, double* dst, size_t count)
+{
+	for(size_t i = 0; i < count; ++i)
+		dst[i] = (src[i] >> 11) * RSH_RANDOM_DOUBLE_UNIT;
+}
+
+void RshRandom::ToGaussian(const U64* src, double* dst, size_t count)
+{
+	// Box-Muller transform, each pair of uniform values gives pair of normal ones; count is even
+	for(size_t i = 0; i + 1 < count; i += 2)
+	{
+		const double u0 = 1.0 - (src[i] >> 11) * RSH_RANDOM_DOUBLE_UNIT; // (0, 1], log is finite
+		const double u1 = (src[i + 1] >> 11) * RSH_RANDOM_DOUBLE_UNIT;
+		const double r = sqrt(-2.0 * log(u0));
+		dst[i] = r * cos(RSH_RANDOM_TWO_PI * u1);
+		dst[i + 1] = r * sin(RSH_RANDOM_TWO_PI * u1);
+	}
+}
+
+template<typename T>
+void RshRandom::Store(const double* src, T* dst, size_t count)
+{
+	if(RshRandomTraits<T>::integer)
+	{
+		// round to nearest and saturate to element type range
+		const T minValue = std::numeric_limits<T>::min();
+		const T maxValue = std::numeric_limits<T>::max();
+		const double lo = static_cast<double>(minValue);
+		const double hi = static_cast<double>(maxValue);
+		for(size_t i = 0; i < count; ++i)
+		{
+			const double v = floor(src[i] + 0.5);
+			dst[i] = (v <= lo) ? minValue : ((v >= hi) ? maxValue : static_cast<T>(v));
+		}
+	}
+	else
+	{
+		for(size_t i = 0; i < count; ++i)
+			dst[i] = static_cast<T>(src[i]);
+	}
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshRandom::FillUniform(RshBufferType<T, dataCode>& buffer)
+{
+	if(!RshRandomTraits<T>::supported)
+		return RSH_API_PARAMETER_NOTSUPPORTED;
+
+	if(RshRandomTraits<T>::integer)
+	{
+		// every bit pattern is valid value, so whole range is covered uniformly
+		FillBytes(buffer.ptr, buffer.PSize() * sizeof(T));
+		buffer.SetSize(buffer.PSize());
+		return RSH_API_SUCCESS;
+	}
+
+	return FillUniform(buffer, -1.0, 1.0);
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshRandom::FillUniform(RshBufferType<T, dataCode>& buffer, double min, double max)
+{
+	if(max < min)
+		return RSH_API_PARAMETER_INVALID;
+
+	U32 st = UniformImpl(buffer.ptr, buffer.PSize(), min, max, Supported<RshRandomTraits<T>::supported>());
+	if(st == RSH_API_SUCCESS)
+		buffer.SetSize(buffer.PSize());
+	return st;
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshRandom::FillGaussian(RshBufferType<T, dataCode>& buffer, double mean, double sigma)
+{
+	if(sigma < 0.0)
+		return RSH_API_PARAMETER_INVALID;
+
+	U32 st = GaussianImpl(buffer.ptr, buffer.PSize(), mean, sigma, Supported<RshRandomTraits<T>::supported>());
+	if(st == RSH_API_SUCCESS)
+		buffer.SetSize(buffer.PSize());
+	return st;
+}
+
+template<typename T>
+U32 RshRandom::UniformImpl(T* data, size_t size, double min, double max, Supported<1>)
+{
+	// integer values: floor of [min, max + 1) gives every integer in [min, max] with same probability
+	const bool integer = RshRandomTraits<T>::integer != 0;
+	const double base = integer ? ceil(min) : min;
+	const double width = integer ? floor(max) - base + 1.0 : max - min;
+	U64 raw[blockSize];
+	double values[blockSize];
+
+	for(size_t done = 0; done < size; done += blockSize)
+	{
+		size_t n = (size - done < static_cast<size_t>(blockSize)) ? size - done : static_cast<size_t>(blockSize);
+		Generate(raw, n);
+		ToUniform(raw, values, n);
+		if(integer)
+		{
+			for(size_t i = 0; i < n; ++i)
+				values[i] = floor(base + width * values[i]);
+		}
+		else
+		{
+			for(size_t i = 0; i < n; ++i)
+				values[i] = base + width * values[i];
+		}
+		Store(values, data + done, n);
+	}
+	return RSH_API_SUCCESS;
+}
+
+template<typename T>
+U32 RshRandom::GaussianImpl(T* data, size_t size, double mean, double sigma, Supported<1>)
+{
+	U64 raw[blockSize];
+	double values[blockSize];
+
+	for(size_t done = 0; done < size; done += blockSize)
+	{
+		size_t n = (size - done < static_cast<size_t>(blockSize)) ? size - done : static_cast<size_t>(blockSize);
+		// values are produced in pairs, blockSize is even
+		size_t pairs = (n + 1) & ~static_cast<size_t>(1);
+		Generate(raw, pairs);
+		ToGaussian(raw, values, pairs);
+		for(size_t i = 0; i < n; ++i)
+			values[i] = mean + sigma * values[i];
+		Store(values, data + done, n);
+	}
+	return RSH_API_SUCCESS;
+}
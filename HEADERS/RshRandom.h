@@ -0,0 +1,162 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshRandom.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshRandom class.
+ *
+ * Fast pseudo random number generator with bulk buffer fill.
+ *
+ * \~russian
+ * \brief
+ * Класс RshRandom.
+ *
+ * Быстрый генератор псевдослучайных чисел с заполнением буферов.
+ *
+ */
+
+#ifndef RSH_RANDOM_H
+#define RSH_RANDOM_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshConsts.h"
+
+//! Buffer element types supported by RshRandom fill methods
+template<typename T> struct RshRandomTraits { enum { supported = 0, integer = 0 }; };
+template<> struct RshRandomTraits<U8>     { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<S8>     { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<U16>    { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<S16>    { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<U32>    { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<S32>    { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<U64>    { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<S64>    { enum { supported = 1, integer = 1 }; };
+template<> struct RshRandomTraits<float>  { enum { supported = 1, integer = 0 }; };
+template<> struct RshRandomTraits<double> { enum { supported = 1, integer = 0 }; };
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Pseudo random number generator
+ *
+ * xoshiro256** algorithm, period 2^256 - 1. Generator runs four
+ * independent streams (lanes), consecutive values are taken from
+ * them in turn.\n
+ * Generator keeps all state in the object: it does not touch
+ * std::rand() state and different objects can be used from
+ * different threads without locking. One object must not be
+ * used from several threads at once.
+ *
+ * \~russian
+ * \brief
+ * Генератор псевдослучайных чисел
+ *
+ * Алгоритм xoshiro256**, период 2^256 - 1. Генератор ведет четыре
+ * независимых потока (дорожки), последовательные значения берутся
+ * из них по очереди.\n
+ * Всё состояние хранится в объекте: состояние std::rand() не
+ * изменяется, а разные объекты можно использовать из разных
+ * потоков без блокировок. Один объект нельзя использовать
+ * из нескольких потоков одновременно.
+ *
+ */
+class RshRandom
+{
+public:
+
+	//! \b seed = 0 - random seed obtained with ::RshMix()
+	explicit RshRandom(U64 seed = 0);
+
+	//! Restart sequence, \b seed = 0 - random seed obtained with ::RshMix()
+	void Seed(U64 seed);
+
+	//! Next 64 bit value
+	U64 Next();
+
+	//! Uniform value in [0, 1)
+	double Uniform();
+
+	//! Normal value with zero mean and unit variance
+	double Gaussian();
+
+	//! Fill array with 64 bit values
+	void Fill(U64* values, size_t count);
+
+	//! Fill memory with random bytes
+	void FillBytes(void* data, size_t size);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Fill buffer with uniformly distributed values
+	 *
+	 * Integer buffers get values from the whole range of element type,
+	 * floating point buffers get values in [-1, 1).
+	 * RshBufferType::Size() is set to RshBufferType::PSize().
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_PARAMETER_NOTSUPPORTED
+	 * for non numeric buffers.
+	 *
+	 * \~russian
+	 * \brief
+	 * Заполнение буфера равномерно распределенными значениями
+	 *
+	 * Целочисленные буферы заполняются значениями из всего диапазона типа,
+	 * буферы с плавающей точкой - значениями из [-1, 1).
+	 * RshBufferType::Size() устанавливается равным RshBufferType::PSize().
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_PARAMETER_NOTSUPPORTED
+	 * для нечисловых буферов.
+	 *
+	 */
+	template<typename T, RshDataTypes dataCode>
+	U32 FillUniform(RshBufferType<T, dataCode>& buffer);
+
+	//! Uniform values in [min, max] for integer buffers, [min, max) for floating point ones
+	template<typename T, RshDataTypes dataCode>
+	U32 FillUniform(RshBufferType<T, dataCode>& buffer, double min, double max);
+
+	//! Normally distributed values, integer buffers get rounded and saturated values
+	template<typename T, RshDataTypes dataCode>
+	U32 FillGaussian(RshBufferType<T, dataCode>& buffer, double mean, double sigma);
+
+private:
+
+	enum { lanes = 4, blockSize = 256 };
+
+	// selects implementation for supported and not supported element types
+	template<int value> struct Supported {};
+
+	template<typename T>
+	U32 UniformImpl(T* data, size_t size, double min, double max, Supported<1>);
+	template<typename T>
+	U32 UniformImpl(T*, size_t, double, double, Supported<0>) { return RSH_API_PARAMETER_NOTSUPPORTED; }
+	template<typename T>
+	U32 GaussianImpl(T* data, size_t size, double mean, double sigma, Supported<1>);
+	template<typename T>
+	U32 GaussianImpl(T*, size_t, double, double, Supported<0>) { return RSH_API_PARAMETER_NOTSUPPORTED; }
+
+	void Generate(U64* values, size_t count);
+	static void ToUniform(const U64* src, double* dst, size_t count);
+	static void ToGaussian(const U64* src, double* dst, size_t count);
+	template<typename T>
+	static void Store(const double* src, T* dst, size_t count);
+
+	// state word w of lane l is m_state[w][l]
+	U64 m_state[4][lanes];
+	U64 m_cache[lanes];
+	U32 m_cached;
+	double m_gaussian;
+	bool m_hasGaussian;
+};
+
+#endif //RSH_RANDOM_H
@@ -0,0 +1,288 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshRecordingDevice.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshRecordingDevice class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshRecordingDevice.
+ *
+ */
+
+#include "RshRecordingDevice.h"
+#include "RshConsts.h"
+#include "RshBlockInfo.h"
+#include "RshScalarType.h"
+#include "RshBufferType.h"
+#include "RshTime.h"
+#include "RshTrace.h"
+
+#include <cstring>
+
+RshRecordingDevice::RshRecordingDevice(IRshDevice* device) :
+	m_device(device),
+	m_error(RSH_API_SUCCESS),
+	m_blocks(0),
+	m_initialized(false),
+	m_blockInfo(false),
+	m_origin(0),
+	m_readyTime(0)
+{
+	memset(&m_init, 0, sizeof(m_init));
+}
+
+RshRecordingDevice::~RshRecordingDevice()
+{
+	Close();
+}
+
+U32 RshRecordingDevice::Attach(IRshDevice* device)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	m_device = device;
+	return RSH_API_SUCCESS;
+}
+
+IRshDevice* RshRecordingDevice::Device() const
+{
+	return m_device;
+}
+
+U32 __RSHCALLCONV RshRecordingDevice::Connect(IN RshBaseType* key, IN U32 mode)
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	return m_device->Connect(key, mode);
+}
+
+U32 __RSHCALLCONV RshRecordingDevice::Init(IN OUT RshBaseType* structure, IN U32 mode)
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	const U32 st = m_device->Init(structure, mode);
+	if(st != RSH_API_SUCCESS || mode == RSH_INIT_MODE_CHECK || structure == 0 || structure->_type != rshInitDMA)
+		return st;
+
+	// device corrects parameters, so they are taken after the call
+	const RshInitDMA& init = *static_cast<const RshInitDMA*>(structure);
+	m_init.type = rshInitDMA;
+	m_init.startType = init.startType;
+	m_init.bufferSize = init.bufferSize;
+	m_init.dmaMode = init.dmaMode;
+	m_init.control = init.control;
+	m_init.controlSynchro = init.controlSynchro;
+	m_init.channels = static_cast<U32>(init.channels.Size());
+	m_init.frequency = init.frequency;
+	m_init.frequencyFrame = init.frequencyFrame;
+	m_init.threshold = init.threshold;
+	m_channels.resize(init.channels.Size());
+	for(size_t c = 0; c < m_channels.size(); ++c)
+	{
+		m_channels[c].gain = init.channels[c].gain;
+		m_channels[c].control = init.channels[c].control;
+		m_channels[c].adjustment = init.channels[c].adjustment;
+	}
+	m_initialized = true;
+
+	if(IsOpen())
+		Write(RshRecordingKindInit, &m_init, sizeof(m_init),
+			m_channels.empty() ? 0 : &m_channels[0], m_channels.size() * sizeof(RshRecordingChannel));
+	return st;
+}
+
+U32 __RSHCALLCONV RshRecordingDevice::Start()
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	m_readyTime = 0;
+	RSH_U32 caps(RSH_CAPS_DEVICE_BLOCK_TIMESTAMP);
+	m_blockInfo = (m_device->Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) == RSH_API_SUCCESS);
+
+	const U64 now = RshTimestamp::Now().NanoSeconds();
+	const U32 st = m_device->Start();
+	if(st == RSH_API_SUCCESS && IsOpen())
+	{
+		RshRecordingStart start;
+		start.time = now - m_origin;
+		Write(RshRecordingKindStart, &start, sizeof(start), 0, 0);
+	}
+	return st;
+}
+
+U32 __RSHCALLCONV RshRecordingDevice::Stop()
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	return m_device->Stop();
+}
+
+U32 __RSHCALLCONV RshRecordingDevice::GetData(IN OUT RshBaseType* buffer, IN U32 flags)
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	const U64 t0 = RshTimestamp::Now().NanoSeconds();
+	const U32 st = m_device->GetData(buffer, flags);
+	const U64 t1 = RshTimestamp::Now().NanoSeconds();
+
+	const U64 ready = (m_readyTime != 0) ? m_readyTime : t0;
+	m_readyTime = 0;
+	if(st != RSH_API_SUCCESS || buffer == 0 || !IsOpen())
+		return st;
+
+	const U64 time = (ready > m_origin) ? ready - m_origin : 0;
+
+	switch(buffer->_type)
+	{
+	case rshBufferTypeS8:
+		Record<S8, rshBufferTypeS8>(buffer, time, t1 - t0);
+		break;
+	case rshBufferTypeS16:
+		Record<S16, rshBufferTypeS16>(buffer, time, t1 - t0);
+		break;
+	case rshBufferTypeS32:
+		Record<S32, rshBufferTypeS32>(buffer, time, t1 - t0);
+		break;
+	case rshBufferTypeFloat:
+		Record<float, rshBufferTypeFloat>(buffer, time, t1 - t0);
+		break;
+	case rshBufferTypeDouble:
+		Record<double, rshBufferTypeDouble>(buffer, time, t1 - t0);
+		break;
+	default:
+		break;
+	}
+	return st;
+}
+
+U32 __RSHCALLCONV RshRecordingDevice::Get(IN U32 mode, IN OUT RshBaseType* adr)
+{
+	if(m_device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	const U32 st = m_device->Get(mode, adr);
+	if(mode == RSH_GET_WAIT_BUFFER_READY_EVENT && st == RSH_API_SUCCESS)
+		m_readyTime = RshTimestamp::Now().NanoSeconds();
+	return st;
+}
+
+U32 RshRecordingDevice::Open(const char* fileName)
+{
+	Close();
+
+	if(fileName == 0 || *fileName == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+
+	m_file.clear();
+	m_file.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+	if(!m_file.is_open())
+		return RSH_API_FILE_CANTCREATE;
+
+	RshRecordingFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, RSH_RECORDING_MAGIC, sizeof(header.magic));
+	header.version = RSH_RECORDING_VERSION;
+	header.headerSize = sizeof(header);
+	m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	m_error = RSH_API_SUCCESS;
+	m_blocks = 0;
+	m_origin = RshTimestamp::Now().NanoSeconds();
+	if(m_initialized)
+		Write(RshRecordingKindInit, &m_init, sizeof(m_init),
+			m_channels.empty() ? 0 : &m_channels[0], m_channels.size() * sizeof(RshRecordingChannel));
+
+	if(!m_file.good())
+	{
+		m_file.close();
+		return RSH_API_FILE_CANTWRITE;
+	}
+	return RSH_API_SUCCESS;
+}
+
+U32 RshRecordingDevice::Close()
+{
+	if(!m_file.is_open())
+		return m_error;
+
+	m_file.close();
+	if(m_file.fail() && m_error == RSH_API_SUCCESS)
+		m_error = RSH_API_FILE_CANTCLOSE;
+	return m_error;
+}
+
+bool RshRecordingDevice::IsOpen() const
+{
+	return m_file.is_open();
+}
+
+U64 RshRecordingDevice::Blocks() const
+{
+	return m_blocks;
+}
+
+U32 RshRecordingDevice::LastError() const
+{
+	return m_error;
+}
+
+template<typename T, RshDataTypes dataCode>
+void RshRecordingDevice::Record(const RshBaseType* buffer, U64 ready, U64 getDataTime)
+{
+	const RshBufferType<T, dataCode>& input = *static_cast<const RshBufferType<T, dataCode>*>(buffer);
+
+	RshRecordingBlock block;
+	memset(&block, 0, sizeof(block));
+	block.ready = ready;
+	block.getDataTime = getDataTime;
+	block.dataType = dataCode;
+	block.elementSize = sizeof(T);
+	block.elements = input.Size();
+
+	if(m_blockInfo)
+	{
+		RshBlockInfo info;
+		if(m_device->Get(RSH_GET_BUFFER_BLOCK_INFO, &info) == RSH_API_SUCCESS)
+		{
+			block.sequence = info.sequence;
+			block.timestamp = info.timestamp;
+		}
+	}
+
+	Write(RshRecordingKindBlock, &block, sizeof(block), input.ptr, input.Size() * sizeof(T));
+	if(m_error == RSH_API_SUCCESS)
+		++m_blocks;
+}
+
+void RshRecordingDevice::Write(U32 kind, const void* header, size_t headerSize, const void* data, size_t dataSize)
+{
+	RSH_TRACE_SCOPE("file", "RecordingWrite");
+
+	static const char padding[8] = { 0 };
+
+	RshRecordingRecord record;
+	record.kind = kind;
+	record.reserved = 0;
+	record.size = headerSize + dataSize;
+
+	m_file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+	m_file.write(static_cast<const char*>(header), headerSize);
+	if(dataSize != 0)
+		m_file.write(static_cast<const char*>(data), dataSize);
+	m_file.write(padding, static_cast<std::streamsize>((8 - record.size % 8) % 8));
+
+	if(!m_file.good())
+	{
+		m_error = RSH_API_FILE_CANTWRITE;
+		m_file.close();
+	}
+}
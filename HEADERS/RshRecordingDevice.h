@@ -0,0 +1,272 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshRecordingDevice.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshRecordingDevice class and recording file format.
+ *
+ * \~russian
+ * \brief
+ * Класс RshRecordingDevice и формат файла записи.
+ *
+ */
+
+#ifndef RSH_RECORDING_DEVICE_H
+#define RSH_RECORDING_DEVICE_H
+
+#include "RshDefChk.h"
+#include "RshInitDMA.h"
+#include "IRshDevice.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+//! "RSHREC" signature of recording file
+#define RSH_RECORDING_MAGIC "RSHREC\0"
+//! Version of recording file format
+#define RSH_RECORDING_VERSION 1
+
+//! Record kinds of recording file
+enum RshRecordingKind
+{
+	//! Parameters of IRshDevice::Init(), RshRecordingInit and RshRecordingChannel array
+	RshRecordingKindInit = 0x1,
+	//! Call of IRshDevice::Start(), RshRecordingStart
+	RshRecordingKindStart = 0x2,
+	//! Block returned by IRshDevice::GetData(), RshRecordingBlock and samples
+	RshRecordingKindBlock = 0x3
+};
+
+#pragma pack(push, 8)
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Header of recording file
+ *
+ * Recording file starts with this header, followed by records.
+ * Each record is RshRecordingRecord header and payload of given size,
+ * padded with zeros to multiple of 8 bytes, so all fields are aligned
+ * when file is mapped to memory. Numbers are in byte order of recording
+ * machine.
+ *
+ * \~russian
+ * \brief
+ * Заголовок файла записи
+ *
+ * Файл записи начинается с этого заголовка, за которым следуют записи.
+ * Каждая запись - заголовок RshRecordingRecord и данные указанного
+ * размера, дополненные нулями до кратного 8 байтам, поэтому все поля
+ * выровнены при отображении файла в память. Числа записаны в порядке
+ * байт машины, на которой велась запись.
+ *
+ */
+struct RshRecordingFileHeader
+{
+	//! RSH_RECORDING_MAGIC
+	char magic[8];
+	//! RSH_RECORDING_VERSION
+	U32 version;
+	//! sizeof(RshRecordingFileHeader)
+	U32 headerSize;
+};
+
+//! Header of record
+struct RshRecordingRecord
+{
+	//! Value of RshRecordingKind
+	U32 kind;
+	U32 reserved;
+	//! Payload size without padding, bytes
+	U64 size;
+};
+
+//! Parameters of RshInitDMA, followed by \b channels RshRecordingChannel
+struct RshRecordingInit
+{
+	U32 type;
+	U32 startType;
+	U32 bufferSize;
+	U32 dmaMode;
+	U32 control;
+	U32 controlSynchro;
+	U32 channels;
+	U32 reserved;
+	double frequency;
+	double frequencyFrame;
+	double threshold;
+};
+
+//! Parameters of RshChannel
+struct RshRecordingChannel
+{
+	U32 gain;
+	U32 control;
+	double adjustment;
+};
+
+//! Start of acquisition
+struct RshRecordingStart
+{
+	//! Time of Start() call since RshRecordingDevice::Open(), ns
+	U64 time;
+};
+
+//! Block of data, followed by \b elements samples of \b elementSize bytes
+struct RshRecordingBlock
+{
+	//! Time when block was ready (return of ::RSH_GET_WAIT_BUFFER_READY_EVENT or call of GetData()) since RshRecordingDevice::Open(), ns
+	U64 ready;
+	//! Duration of GetData() call, ns
+	U64 getDataTime;
+	//! RshBlockInfo::sequence, 0 if not available
+	U64 sequence;
+	//! RshBlockInfo::timestamp, 0 if not available
+	U64 timestamp;
+	//! RshDataTypes code of buffer
+	U32 dataType;
+	U32 elementSize;
+	U64 elements;
+};
+
+#pragma pack(pop)
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Device wrapper recording acquired data stream to file
+ *
+ * Implements IRshDevice and passes all calls to device interface,
+ * like RshMonitoredDevice does. While file is open, RshInitDMA
+ * parameters of successful Init() calls, times of Start() calls and
+ * every block returned by GetData() are written to it, together with
+ * time when block was ready, GetData() duration and block sequence
+ * number. Recording is replayed by RshReplayDevice at original or
+ * accelerated speed, so data processing can be profiled and load tested
+ * reproducibly without hardware.\n
+ * Data is written by buffered stream in thread calling GetData(), so
+ * disk must keep up with device data rate.
+ *
+ * \remarks
+ * Supported buffer types are RSH_BUFFER_S8, RSH_BUFFER_S16,
+ * RSH_BUFFER_S32, RSH_BUFFER_FLOAT and RSH_BUFFER_DOUBLE. Blocks of
+ * other types and Init() with other structures are passed to device,
+ * but not recorded.\n
+ * Write error stops recording, device calls are not affected;
+ * see LastError().
+ *
+ * \~russian
+ * \brief
+ * Обертка устройства, записывающая поток данных в файл
+ *
+ * Реализует IRshDevice и передает все вызовы интерфейсу устройства,
+ * как и RshMonitoredDevice. Пока файл открыт, в него записываются
+ * параметры RshInitDMA успешных вызовов Init(), время вызовов Start()
+ * и каждый блок, полученный GetData(), вместе со временем готовности
+ * блока, длительностью GetData() и порядковым номером блока. Запись
+ * воспроизводится RshReplayDevice с исходной или увеличенной скоростью,
+ * поэтому производительность обработки данных можно измерять и
+ * проверять под нагрузкой воспроизводимо и без оборудования.\n
+ * Данные записываются буферизованным потоком в потоке, вызывающем
+ * GetData(), поэтому диск должен успевать за скоростью устройства.
+ *
+ * \remarks
+ * Поддерживаются буферы RSH_BUFFER_S8, RSH_BUFFER_S16, RSH_BUFFER_S32,
+ * RSH_BUFFER_FLOAT и RSH_BUFFER_DOUBLE. Блоки других типов и Init() с
+ * другими структурами передаются устройству, но не записываются.\n
+ * Ошибка записи останавливает запись, на вызовы устройства она не
+ * влияет; см. LastError().
+ *
+ */
+class RshRecordingDevice : public IRshDevice
+{
+public:
+
+	explicit RshRecordingDevice(IRshDevice* device = 0);
+	virtual ~RshRecordingDevice();
+
+	//! Set device which calls are passed to
+	U32 Attach(IRshDevice* device);
+
+	//! Device which calls are passed to
+	IRshDevice* Device() const;
+
+	U32 __RSHCALLCONV Connect(IN RshBaseType* key, IN U32 mode = RSH_CONNECT_MODE_BASE);
+	U32 __RSHCALLCONV Init(IN OUT RshBaseType* structure, IN U32 mode = RSH_INIT_MODE_INIT);
+	U32 __RSHCALLCONV Start();
+	U32 __RSHCALLCONV Stop();
+	U32 __RSHCALLCONV GetData(IN OUT RshBaseType* buffer, IN U32 flags = RSH_DATA_MODE_NO_FLAGS);
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType* adr = NULL);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Start recording to file
+	 *
+	 * Previous recording is closed. If device was already initialized,
+	 * parameters of last Init() are written first.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_FILE_NAMENOTDEFINED,
+	 * ::RSH_API_FILE_CANTCREATE or ::RSH_API_FILE_CANTWRITE.
+	 *
+	 * \~russian
+	 * \brief
+	 * Начало записи в файл
+	 *
+	 * Предыдущая запись закрывается. Если устройство уже было
+	 * инициализировано, сначала записываются параметры последнего Init().
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_FILE_NAMENOTDEFINED,
+	 * ::RSH_API_FILE_CANTCREATE или ::RSH_API_FILE_CANTWRITE.
+	 *
+	 */
+	U32 Open(const char* fileName);
+
+	//! Flush and close file
+	U32 Close();
+
+	//! True if recording
+	bool IsOpen() const;
+
+	//! Blocks recorded since Open()
+	U64 Blocks() const;
+
+	//! Error which stopped recording, ::RSH_API_SUCCESS if none
+	U32 LastError() const;
+
+private:
+
+	RshRecordingDevice(const RshRecordingDevice&);
+	RshRecordingDevice& operator=(const RshRecordingDevice&);
+
+	template<typename T, RshDataTypes dataCode>
+	void Record(const RshBaseType* buffer, U64 ready, U64 getDataTime);
+	void Write(U32 kind, const void* header, size_t headerSize, const void* data, size_t dataSize);
+
+	IRshDevice* m_device;
+	std::ofstream m_file;
+	U32 m_error;
+	U64 m_blocks;
+
+	// parameters of last Init()
+	RshRecordingInit m_init;
+	std::vector<RshRecordingChannel> m_channels;
+	bool m_initialized;
+
+	// times are recorded since Open()
+	bool m_blockInfo;
+	U64 m_origin;
+	U64 m_readyTime;
+};
+
+#endif //RSH_RECORDING_DEVICE_H
@@ -0,0 +1,492 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshReplayDevice.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshReplayDevice class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshReplayDevice.
+ *
+ */
+
+#include "RshReplayDevice.h"
+#include "RshConsts.h"
+#include "RshDeviceKey.h"
+#include "RshScalarType.h"
+#include "RshBufferType.h"
+#include "RshTime.h"
+#include "RshTrace.h"
+
+#include <cstring>
+
+// longest sleep while waiting for block, so Stop() from other thread is not delayed, ns
+#define RSH_REPLAY_MAX_PAUSE 10000000ULL
+
+static const char* const rshReplayName = "Replay";
+
+RshReplayDevice::RshReplayDevice() :
+	m_init(0),
+	m_channels(0),
+	m_speed(1.0),
+	m_loop(false),
+	m_getDataTiming(false),
+	m_initialized(false),
+	m_running(false),
+	m_startTime(0),
+	m_segment(0),
+	m_next(0),
+	m_timeOffset(0),
+	m_sequenceOffset(0)
+{
+	m_playing.start = 0;
+	m_playing.first = 0;
+	m_playing.end = 0;
+}
+
+RshReplayDevice::~RshReplayDevice()
+{
+	Stop();
+}
+
+U32 __RSHCALLCONV RshReplayDevice::Connect(IN RshBaseType* key, IN U32 mode)
+{
+	if(key == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(key->_type != rshDeviceKey)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	if(mode != RSH_CONNECT_MODE_BASE)
+		return RSH_API_PARAMETER_CONNECTMODENOTSUPPORTED;
+
+	const RshDeviceKey* deviceKey = static_cast<const RshDeviceKey*>(key);
+	if(deviceKey->storedTypeId != rshS8P || deviceKey->value_S8P == 0)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	return Open(reinterpret_cast<const char*>(deviceKey->value_S8P));
+}
+
+U32 __RSHCALLCONV RshReplayDevice::Init(IN OUT RshBaseType* structure, IN U32 mode)
+{
+	if(!m_file.IsOpen())
+		return RSH_API_DEVICE_NOTINITIALIZED;
+	if(structure == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(structure->_type != rshInitDMA)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	// like real device corrects parameters, recorded ones are returned
+	if(m_init != 0)
+	{
+		RshInitDMA& init = *static_cast<RshInitDMA*>(structure);
+		init.startType = m_init->startType;
+		init.bufferSize = m_init->bufferSize;
+		init.dmaMode = m_init->dmaMode;
+		init.control = m_init->control;
+		init.controlSynchro = m_init->controlSynchro;
+		init.frequency = m_init->frequency;
+		init.frequencyFrame = m_init->frequencyFrame;
+		init.threshold = m_init->threshold;
+		if(init.channels.PSize() < m_init->channels)
+		{
+			U32 st = init.channels.Allocate(m_init->channels);
+			if(st != RSH_API_SUCCESS)
+				return st;
+		}
+		init.channels.SetSize(m_init->channels);
+		for(size_t c = 0; c < m_init->channels; ++c)
+		{
+			init.channels[c].gain = m_channels[c].gain;
+			init.channels[c].control = m_channels[c].control;
+			init.channels[c].adjustment = m_channels[c].adjustment;
+		}
+	}
+
+	if(mode == RSH_INIT_MODE_CHECK)
+		return RSH_API_SUCCESS;
+
+	Stop();
+	m_initialized = true;
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshReplayDevice::Start()
+{
+	if(!m_initialized)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+
+	Stop();
+
+	// recording without blocks starts, but has no data
+	if(m_segment >= m_segments.size())
+		m_segment = 0;
+	if(m_segment < m_segments.size())
+	{
+		m_playing = m_segments[m_segment++];
+	}
+	else
+	{
+		m_playing.start = 0;
+		m_playing.first = m_playing.end = 0;
+	}
+
+	m_next = m_playing.first;
+	m_timeOffset = 0;
+	m_sequenceOffset = 0;
+	m_lastBlock = RshBlockInfo();
+	if(m_playing.first < m_playing.end && m_blocks[m_playing.first]->sequence != 0)
+		m_lastBlock.sequence = m_blocks[m_playing.first]->sequence - 1;
+	m_stopEvent.Reset();
+	m_startTime = RshTimestamp::Now().NanoSeconds();
+	m_running = true;
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshReplayDevice::Stop()
+{
+	if(!m_running)
+		return RSH_API_SUCCESS;
+
+	m_running = false;
+	m_stopEvent.Set();
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshReplayDevice::GetData(IN OUT RshBaseType* buffer, IN U32 flags)
+{
+	(void)flags;
+
+	if(buffer == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(!m_initialized)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+	if(!m_running || (m_next >= m_playing.end && !Rewind()))
+		return RSH_API_DEVICE_CANTGETDATA;
+
+	const RshRecordingBlock& block = *m_blocks[m_next];
+	const U64 due = Due(block);
+	const U64 t0 = RshTimestamp::Now().NanoSeconds();
+	if(t0 < due)
+		return RSH_API_DEVICE_CANTGETDATA;
+	if(buffer->_type != block.dataType)
+		return RSH_API_BUFFER_WRONGDATATYPE;
+
+	U32 st;
+	switch(buffer->_type)
+	{
+	case rshBufferTypeS8:
+		st = Copy<S8, rshBufferTypeS8>(buffer, block);
+		break;
+	case rshBufferTypeS16:
+		st = Copy<S16, rshBufferTypeS16>(buffer, block);
+		break;
+	case rshBufferTypeS32:
+		st = Copy<S32, rshBufferTypeS32>(buffer, block);
+		break;
+	case rshBufferTypeFloat:
+		st = Copy<float, rshBufferTypeFloat>(buffer, block);
+		break;
+	case rshBufferTypeDouble:
+		st = Copy<double, rshBufferTypeDouble>(buffer, block);
+		break;
+	default:
+		st = RSH_API_BUFFER_WRONGDATATYPE;
+		break;
+	}
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	if(m_getDataTiming && m_speed > 0.0)
+	{
+		const U64 end = t0 + static_cast<U64>(block.getDataTime / m_speed);
+		for(U64 now = RshTimestamp::Now().NanoSeconds(); now < end && m_running; now = RshTimestamp::Now().NanoSeconds())
+			Pause(end - now);
+	}
+
+	// blocks without recorded number are numbered from start
+	const U64 sequence = (block.sequence != 0) ? block.sequence : m_next - m_playing.first + 1;
+	m_lastBlock.sequence = sequence + m_sequenceOffset;
+	m_lastBlock.timestamp = (due != 0) ? due : t0;
+	m_lastBlock.size = static_cast<U32>(block.elements * block.elementSize);
+	++m_next;
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshReplayDevice::Get(IN U32 mode, IN OUT RshBaseType* adr)
+{
+	switch(mode)
+	{
+	case RSH_GET_WAIT_BUFFER_READY_EVENT:
+		{
+			if(adr == 0)
+				return RSH_API_PARAMETER_ZEROADDRESS;
+			if(adr->_type != rshU32)
+				return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+			const U32 timeout = static_cast<RSH_U32*>(adr)->data;
+			const U64 start = RshTimestamp::Now().NanoSeconds();
+			for(;;)
+			{
+				if(!m_running)
+					return RSH_API_DEVICE_WASNOTSTARTED;
+				if(m_next >= m_playing.end && !Rewind())
+				{
+					m_running = false;
+					return RSH_API_DEVICE_WASNOTSTARTED;
+				}
+
+				const U64 due = Due(*m_blocks[m_next]);
+				const U64 now = RshTimestamp::Now().NanoSeconds();
+				if(now >= due)
+					return RSH_API_SUCCESS;
+
+				U64 wait = due - now;
+				if(timeout != RSH_INFINITE_WAIT_TIME)
+				{
+					const U64 limit = static_cast<U64>(timeout) * 1000000ULL;
+					if(now - start >= limit)
+						return RSH_API_EVENT_WAITTIMEOUT;
+					if(wait > limit - (now - start))
+						wait = limit - (now - start);
+				}
+				Pause(wait);
+			}
+		}
+
+	case RSH_GET_BUFFER_BLOCK_INFO:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshBlockInfo)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		*static_cast<RshBlockInfo*>(adr) = m_lastBlock;
+		return RSH_API_SUCCESS;
+
+	case RSH_GET_DEVICE_IS_CAPABLE:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshU32)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		switch(static_cast<RSH_U32*>(adr)->data)
+		{
+		case RSH_CAPS_SOFT_GATHERING_IS_AVAILABLE:
+		case RSH_CAPS_SOFT_PGATHERING_IS_AVAILABLE:
+		case RSH_CAPS_SOFT_INIT_DMA:
+		case RSH_CAPS_DEVICE_BLOCK_TIMESTAMP:
+			return RSH_API_SUCCESS;
+		default:
+			return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+		}
+
+	case RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshU32)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		if(m_init == 0)
+			return RSH_API_DEVICE_NOTINITIALIZED;
+		{
+			U32 used = 0;
+			for(U32 c = 0; c < m_init->channels; ++c)
+				if(m_channels[c].control & RshChannel::Used)
+					++used;
+			static_cast<RSH_U32*>(adr)->data = used;
+		}
+		return RSH_API_SUCCESS;
+
+	case RSH_GET_DEVICE_NAME_VERBOSE:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshS8P)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		static_cast<RSH_S8P*>(adr)->data = reinterpret_cast<S8*>(const_cast<char*>(rshReplayName));
+		return RSH_API_SUCCESS;
+
+	default:
+		return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+	}
+}
+
+U32 RshReplayDevice::Open(const char* fileName)
+{
+	Stop();
+	m_initialized = false;
+	m_init = 0;
+	m_channels = 0;
+	m_blocks.clear();
+	m_segments.clear();
+	m_segment = 0;
+	m_lastBlock = RshBlockInfo();
+
+	U32 st = m_file.Open(fileName);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	const U8* data = m_file.Data();
+	const size_t size = m_file.Size();
+	const RshRecordingFileHeader* header = reinterpret_cast<const RshRecordingFileHeader*>(data);
+	if(size < sizeof(RshRecordingFileHeader) ||
+		memcmp(header->magic, RSH_RECORDING_MAGIC, sizeof(header->magic)) != 0 ||
+		header->version != RSH_RECORDING_VERSION ||
+		header->headerSize < sizeof(RshRecordingFileHeader) || header->headerSize % 8 != 0 ||
+		header->headerSize > size)
+	{
+		m_file.Close();
+		return RSH_API_FILE_CANTREAD;
+	}
+
+	// record cut by interrupted recording and records after it are ignored
+	size_t position = header->headerSize;
+	while(size - position >= sizeof(RshRecordingRecord))
+	{
+		const RshRecordingRecord& record = *reinterpret_cast<const RshRecordingRecord*>(data + position);
+		position += sizeof(RshRecordingRecord);
+		if(record.size > size - position)
+			break;
+		const U8* payload = data + position;
+		const size_t payloadSize = static_cast<size_t>(record.size);
+
+		if(record.kind == RshRecordingKindInit && payloadSize >= sizeof(RshRecordingInit))
+		{
+			const RshRecordingInit* init = reinterpret_cast<const RshRecordingInit*>(payload);
+			if(init->channels <= (payloadSize - sizeof(RshRecordingInit)) / sizeof(RshRecordingChannel))
+			{
+				m_init = init;
+				m_channels = reinterpret_cast<const RshRecordingChannel*>(init + 1);
+			}
+		}
+		else if(record.kind == RshRecordingKindStart && payloadSize >= sizeof(RshRecordingStart))
+		{
+			Segment segment;
+			segment.start = reinterpret_cast<const RshRecordingStart*>(payload)->time;
+			segment.first = segment.end = m_blocks.size();
+			m_segments.push_back(segment);
+		}
+		else if(record.kind == RshRecordingKindBlock && payloadSize >= sizeof(RshRecordingBlock))
+		{
+			const RshRecordingBlock* block = reinterpret_cast<const RshRecordingBlock*>(payload);
+			if(block->elementSize != 0 &&
+				block->elements <= (payloadSize - sizeof(RshRecordingBlock)) / block->elementSize)
+			{
+				// recording opened after Start() begins with blocks
+				if(m_segments.empty())
+				{
+					Segment segment;
+					segment.start = 0;
+					segment.first = segment.end = 0;
+					m_segments.push_back(segment);
+				}
+				m_blocks.push_back(block);
+				m_segments.back().end = m_blocks.size();
+			}
+		}
+
+		const size_t padded = payloadSize + (8 - payloadSize % 8) % 8;
+		if(padded > size - position)
+			break;
+		position += padded;
+	}
+
+	return RSH_API_SUCCESS;
+}
+
+U32 RshReplayDevice::SetSpeed(double speed)
+{
+	if(!(speed >= 0.0) || !__rshisfinite(speed))
+		return RSH_API_PARAMETER_INVALID;
+	m_speed = speed;
+	return RSH_API_SUCCESS;
+}
+
+void RshReplayDevice::SetLoop(bool loop)
+{
+	m_loop = loop;
+}
+
+void RshReplayDevice::SetGetDataTiming(bool enable)
+{
+	m_getDataTiming = enable;
+}
+
+U64 RshReplayDevice::Blocks() const
+{
+	return m_blocks.size();
+}
+
+U64 RshReplayDevice::Starts() const
+{
+	return m_segments.size();
+}
+
+U64 RshReplayDevice::Due(const RshRecordingBlock& block) const
+{
+	if(m_speed == 0.0)
+		return 0;
+	const U64 time = ((block.ready > m_playing.start) ? block.ready - m_playing.start : 0) + m_timeOffset;
+	return m_startTime + static_cast<U64>(time / m_speed);
+}
+
+bool RshReplayDevice::Rewind()
+{
+	// only recording with one start is continuous stream
+	if(!m_loop || m_segments.size() != 1 || m_playing.first == m_playing.end)
+		return false;
+
+	// next pass follows last block after average block period
+	const RshRecordingBlock& first = *m_blocks[m_playing.first];
+	const RshRecordingBlock& last = *m_blocks[m_playing.end - 1];
+	const size_t count = m_playing.end - m_playing.first;
+	const U64 firstTime = (first.ready > m_playing.start) ? first.ready - m_playing.start : 0;
+	const U64 lastTime = (last.ready > m_playing.start) ? last.ready - m_playing.start : 0;
+	const U64 period = (count > 1) ? ((lastTime > firstTime) ? (lastTime - firstTime) / (count - 1) : 0) : firstTime;
+
+	// numbers of next pass continue from last block, recording may start not from 1
+	const U64 firstSequence = (first.sequence != 0) ? first.sequence : 1;
+	m_timeOffset += lastTime + period;
+	m_sequenceOffset = m_lastBlock.sequence - (firstSequence - 1);
+	m_next = m_playing.first;
+	return true;
+}
+
+void RshReplayDevice::Pause(U64 nanoSeconds)
+{
+	if(nanoSeconds > RSH_REPLAY_MAX_PAUSE)
+		nanoSeconds = RSH_REPLAY_MAX_PAUSE;
+
+	// event wakes on Stop(), shorter pauses are slept
+	if(nanoSeconds >= 1000000ULL)
+	{
+		m_stopEvent.Wait(static_cast<U32>(nanoSeconds / 1000000ULL));
+		return;
+	}
+#if defined(RSH_MSWINDOWS)
+	::Sleep(0);
+#elif defined(RSH_LINUX)
+	usleep(static_cast<useconds_t>(nanoSeconds / 1000ULL));
+#endif
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshReplayDevice::Copy(RshBaseType* buffer, const RshRecordingBlock& block)
+{
+	RSH_TRACE_SCOPE("replay", "Copy");
+
+	if(block.elementSize != sizeof(T))
+		return RSH_API_BUFFER_WRONGDATATYPE;
+
+	RshBufferType<T, dataCode>& output = *static_cast<RshBufferType<T, dataCode>*>(buffer);
+	const size_t size = static_cast<size_t>(block.elements);
+	if(output.PSize() < size)
+	{
+		U32 st = output.Allocate(size);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	if(size != 0)
+		memcpy(output.ptr, &block + 1, size * sizeof(T));
+	output.SetSize(size);
+	return RSH_API_SUCCESS;
+}
@@ -0,0 +1,222 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshReplayDevice.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshReplayDevice class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshReplayDevice.
+ *
+ */
+
+#ifndef RSH_REPLAY_DEVICE_H
+#define RSH_REPLAY_DEVICE_H
+
+#include "RshDefChk.h"
+#include "RshBlockInfo.h"
+#include "RshMappedFile.h"
+#include "RshRecordingDevice.h"
+#include "RshThread.h"
+#include "IRshDevice.h"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Device replaying stream recorded by RshRecordingDevice
+ *
+ * Implements IRshDevice, so application code and data processing run
+ * on recorded stream exactly as on device it was recorded from.
+ * Recording file is mapped to memory, so GetData() copies samples
+ * directly from file cache.\n
+ * Connect() takes RshDeviceKey with file name. Init() accepts
+ * RshInitDMA and fills it with recorded parameters. Each Start() replays
+ * blocks acquired after next recorded Start() call (after last one
+ * recording begins again), so single block mode is reproduced as well
+ * as persistent one. Block becomes ready at
+ * its recorded time since start divided by speed (see SetSpeed()),
+ * which is seen by ::RSH_GET_WAIT_BUFFER_READY_EVENT.
+ * ::RSH_GET_BUFFER_BLOCK_INFO returns recorded sequence number, so gaps
+ * in original stream are reproduced, and time when block became ready
+ * in replay. Right after Start() it returns sequence number preceding
+ * first block, as device which has not passed any block yet. When blocks of this start are over, waiting returns
+ * ::RSH_API_DEVICE_WASNOTSTARTED, as device which stopped.
+ *
+ * \remarks
+ * Buffer passed to GetData() must be of recorded type.
+ * Replay does not depend on application speed: late application gets
+ * blocks later, but never loses them, so results are reproducible.
+ *
+ * \~russian
+ * \brief
+ * Устройство, воспроизводящее поток, записанный RshRecordingDevice
+ *
+ * Реализует IRshDevice, поэтому код приложения и обработка данных
+ * работают с записанным потоком так же, как с устройством, с которого
+ * он был записан. Файл записи отображается в память, поэтому GetData()
+ * копирует отсчеты непосредственно из файлового кэша.\n
+ * Connect() принимает RshDeviceKey с именем файла. Init() принимает
+ * RshInitDMA и заполняет ее записанными параметрами. Каждый Start()
+ * воспроизводит блоки, полученные после очередного записанного вызова
+ * Start() (после последнего запись начинается снова), поэтому
+ * воспроизводится как непрерывный, так и однократный режим. Блок становится готов в записанное время от запуска, деленное
+ * на скорость (см. SetSpeed()), что видно по
+ * ::RSH_GET_WAIT_BUFFER_READY_EVENT. ::RSH_GET_BUFFER_BLOCK_INFO
+ * возвращает записанный порядковый номер, поэтому пропуски исходного
+ * потока воспроизводятся, и время готовности блока при воспроизведении.
+ * Сразу после Start() возвращается номер, предшествующий первому блоку,
+ * как у устройства, еще не передавшего ни одного блока. Когда блоки этого запуска закончились, ожидание возвращает
+ * ::RSH_API_DEVICE_WASNOTSTARTED, как у остановленного устройства.
+ *
+ * \remarks
+ * Буфер, передаваемый в GetData(), должен быть записанного типа.
+ * Воспроизведение не зависит от скорости приложения: медленное
+ * приложение получает блоки позже, но не теряет их, поэтому результаты
+ * воспроизводимы.
+ *
+ */
+class RshReplayDevice : public IRshDevice
+{
+public:
+
+	RshReplayDevice();
+	virtual ~RshReplayDevice();
+
+	U32 __RSHCALLCONV Connect(IN RshBaseType* key, IN U32 mode = RSH_CONNECT_MODE_BASE);
+	U32 __RSHCALLCONV Init(IN OUT RshBaseType* structure, IN U32 mode = RSH_INIT_MODE_INIT);
+	U32 __RSHCALLCONV Start();
+	U32 __RSHCALLCONV Stop();
+	U32 __RSHCALLCONV GetData(IN OUT RshBaseType* buffer, IN U32 flags = RSH_DATA_MODE_NO_FLAGS);
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType* adr = NULL);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Open recording file
+	 *
+	 * Same as Connect() with file name.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, error of RshMappedFile::Open() or
+	 * ::RSH_API_FILE_CANTREAD if file is not valid recording.
+	 *
+	 * \~russian
+	 * \brief
+	 * Открытие файла записи
+	 *
+	 * То же, что Connect() с именем файла.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ошибка RshMappedFile::Open() или
+	 * ::RSH_API_FILE_CANTREAD, если файл не является записью.
+	 *
+	 */
+	U32 Open(const char* fileName);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Set replay speed
+	 *
+	 * \param[in] speed Ratio to original speed, for example 10 replays
+	 * ten times faster than recorded. 0 makes each block ready
+	 * immediately, for maximum throughput.
+	 *
+	 * \~russian
+	 * \brief
+	 * Установка скорости воспроизведения
+	 *
+	 * \param[in] speed Отношение к исходной скорости, например 10
+	 * воспроизводит в десять раз быстрее записи. При 0 каждый блок
+	 * готов сразу, для максимальной пропускной способности.
+	 *
+	 */
+	U32 SetSpeed(double speed);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Replay stream endlessly
+	 *
+	 * If recording has one start, its blocks are replayed again and
+	 * again after one Start(), with sequence numbers continuing, for
+	 * long load tests. Recordings with several starts are not affected.
+	 *
+	 * \~russian
+	 * \brief
+	 * Бесконечное воспроизведение потока
+	 *
+	 * Если в записи один запуск, его блоки после одного Start()
+	 * воспроизводятся снова и снова с продолжением порядковых номеров,
+	 * для длительных испытаний под нагрузкой. На записи с несколькими
+	 * запусками не влияет.
+	 *
+	 */
+	void SetLoop(bool loop);
+
+	//! Make GetData() last as long as during recording (divided by speed)
+	void SetGetDataTiming(bool enable);
+
+	//! Number of recorded blocks
+	U64 Blocks() const;
+
+	//! Number of recorded starts
+	U64 Starts() const;
+
+private:
+
+	RshReplayDevice(const RshReplayDevice&);
+	RshReplayDevice& operator=(const RshReplayDevice&);
+
+	struct Segment
+	{
+		//! Recorded time of Start(), ns
+		U64 start;
+		//! Range of blocks in m_blocks
+		size_t first;
+		size_t end;
+	};
+
+	U64 Due(const RshRecordingBlock& block) const;
+	bool Rewind();
+	void Pause(U64 nanoSeconds);
+
+	template<typename T, RshDataTypes dataCode>
+	U32 Copy(RshBaseType* buffer, const RshRecordingBlock& block);
+
+	RshMappedFile m_file;
+	const RshRecordingInit* m_init;
+	const RshRecordingChannel* m_channels;
+	std::vector<const RshRecordingBlock*> m_blocks;
+	std::vector<Segment> m_segments;
+
+	// options
+	double m_speed;
+	bool m_loop;
+	bool m_getDataTiming;
+
+	// replay
+	bool m_initialized;
+	volatile bool m_running;
+	RshEvent m_stopEvent;
+	U64 m_startTime;
+	size_t m_segment;
+	Segment m_playing;
+	size_t m_next;
+	U64 m_timeOffset;
+	U64 m_sequenceOffset;
+	RshBlockInfo m_lastBlock;
+};
+
+#endif //RSH_REPLAY_DEVICE_H
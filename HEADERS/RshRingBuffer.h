@@ -0,0 +1,161 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshRingBuffer.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshRingBuffer template class.
+ *
+ * Lock-free single producer / single consumer ring.
+ *
+ * \~russian
+ * \brief
+ * Шаблонный класс RshRingBuffer.
+ *
+ * Кольцевой буфер без блокировок для одного писателя и одного читателя.
+ *
+ */
+
+#ifndef RSH_RING_BUFFER_H
+#define RSH_RING_BUFFER_H
+
+#include "RshDefChk.h"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Lock-free single producer / single consumer ring
+ *
+ * One thread may call Push() while another thread calls Pop()
+ * without any additional locking. Capacity is rounded up
+ * to the nearest power of two. When ring is full,
+ * Push() drops new element and increments Dropped() counter,
+ * so producer never blocks.
+ *
+ * \~russian
+ * \brief
+ * Кольцевой буфер без блокировок (один писатель, один читатель)
+ *
+ * Один поток может вызывать Push(), а другой - Pop()
+ * без дополнительной синхронизации. Емкость округляется
+ * вверх до степени двойки. Если буфер заполнен, Push()
+ * отбрасывает новый элемент и увеличивает счетчик Dropped(),
+ * таким образом писатель никогда не блокируется.
+ *
+ */
+template<typename T>
+class RshRingBuffer
+{
+public:
+
+	explicit RshRingBuffer(U32 capacity = 64) :
+		m_head(0),
+		m_tail(0),
+		m_dropped(0)
+	{
+		U32 size = 2;
+		while(size < capacity && size < 0x80000000)
+			size <<= 1;
+		m_data.resize(size);
+		m_mask = size - 1;
+	}
+
+	//! Add element (producer side). Returns false if ring is full.
+	bool Push(const T& value)
+	{
+		U32 head = m_head;
+		if(head - m_tail > m_mask)
+		{
+			__rshatomicadd32(&m_dropped, 1);
+			return false;
+		}
+		m_data[head & m_mask] = value;
+		__rshmembarrier();
+		m_head = head + 1;
+		return true;
+	}
+
+	//! Take oldest element (consumer side). Returns false if ring is empty.
+	bool Pop(T& value)
+	{
+		U32 tail = m_tail;
+		if(tail == m_head)
+			return false;
+		__rshmembarrier();
+		value = m_data[tail & m_mask];
+		__rshmembarrier();
+		m_tail = tail + 1;
+		return true;
+	}
+
+	//! Add up to \b count elements (producer side). Returns number of elements added.
+	U32 PushBlock(const T* values, U32 count)
+	{
+		U32 head = m_head;
+		U32 space = m_mask + 1 - (head - m_tail);
+		if(count > space)
+			count = space;
+		for(U32 i = 0; i < count; ++i)
+			m_data[(head + i) & m_mask] = values[i];
+		__rshmembarrier();
+		m_head = head + count;
+		return count;
+	}
+
+	//! Take up to \b count oldest elements (consumer side). Returns number of elements taken.
+	U32 PopBlock(T* values, U32 count)
+	{
+		U32 tail = m_tail;
+		U32 ready = m_head - tail;
+		if(count > ready)
+			count = ready;
+		__rshmembarrier();
+		for(U32 i = 0; i < count; ++i)
+			values[i] = m_data[(tail + i) & m_mask];
+		__rshmembarrier();
+		m_tail = tail + count;
+		return count;
+	}
+
+	//! Number of elements ready to be popped
+	U32 Count() const
+	{
+		return m_head - m_tail;
+	}
+
+	//! Number of elements that can be pushed
+	U32 Free() const
+	{
+		return m_mask + 1 - (m_head - m_tail);
+	}
+
+	U32 Capacity() const
+	{
+		return m_mask + 1;
+	}
+
+	//! Number of elements dropped because ring was full
+	U32 Dropped() const
+	{
+		return m_dropped;
+	}
+
+private:
+
+	RshRingBuffer(const RshRingBuffer&);
+	RshRingBuffer& operator=(const RshRingBuffer&);
+
+	std::vector<T> m_data;
+	U32 m_mask;
+	volatile U32 m_head;
+	volatile U32 m_tail;
+	volatile U32 m_dropped;
+};
+
+#endif //RSH_RING_BUFFER_H
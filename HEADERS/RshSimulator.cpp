@@ -0,0 +1,778 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshSimulator.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshSimulator class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshSimulator.
+ *
+ */
+
+#include "RshSimulator.h"
+#include "RshConsts.h"
+#include "RshDeviceKey.h"
+#include "RshInitDMA.h"
+#include "RshInitMemory.h"
+#include "RshScalarType.h"
+#include "RshBufferType.h"
+#include "RshTime.h"
+#include "RshTrace.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#define RSH_SIMULATOR_PI 3.1415926535897932384626433832795
+
+// sine table of 2^12 points, index is taken from upper bits of 64 bit phase
+#define RSH_SIMULATOR_TABLE_BITS 12
+
+// 2^64 as double, to convert fraction of period to phase
+#define RSH_SIMULATOR_PHASE_SCALE 18446744073709551616.0
+
+// longest sleep of generator thread, so Stop() is not delayed by slow sample rate, ns
+#define RSH_SIMULATOR_MAX_PAUSE 10000000ULL
+
+// wait for free buffer in non real time mode, ms
+#define RSH_SIMULATOR_SPACE_WAIT 10
+
+static const char* const rshSimulatorName = "Simulator";
+static const char* const rshSimulatorVersion = "1.0.0.0";
+#if defined(RSH_MSWINDOWS)
+static const char* const rshSimulatorLibrary = "SIMULATOR.dll";
+#else
+static const char* const rshSimulatorLibrary = "libSIMULATOR.so";
+#endif
+
+// whole string must be a number
+static bool RshSimulatorToNumber(const std::string& text, double& value)
+{
+	if(text.empty())
+		return false;
+	char* end = 0;
+	value = strtod(text.c_str(), &end);
+	return end != 0 && *end == 0 && __rshisfinite(value);
+}
+
+static std::string RshSimulatorTrim(const std::string& text)
+{
+	const size_t first = text.find_first_not_of(" \t");
+	if(first == std::string::npos)
+		return std::string();
+	return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+}
+
+RshSimulator::RshSimulator() :
+	m_bits(16),
+	m_deviceChannels(8),
+	m_signal(Sine),
+	m_tone(1000.0),
+	m_amplitude(0.5),
+	m_noise(0.0),
+	m_range(1.0),
+	m_bufferCount(8),
+	m_realTime(true),
+	m_jitter(0),
+	m_dropRate(0.0),
+	m_seed(1),
+	m_maxFrequency(1.0e+9),
+	m_connected(false),
+	m_serial(0),
+	m_initialized(false),
+	m_persistent(false),
+	m_frequency(0.0),
+	m_bufferSize(0),
+	m_update(false),
+	m_updateFrequency(0.0),
+	m_running(false),
+	m_stopRequest(false),
+	m_head(0),
+	m_tail(0),
+	m_sequence(0),
+	m_blocks(0),
+	m_overflows(0),
+	m_dropped(0)
+{
+	m_sine.resize(1 << RSH_SIMULATOR_TABLE_BITS);
+	for(size_t i = 0; i < m_sine.size(); ++i)
+		m_sine[i] = sin(2.0 * RSH_SIMULATOR_PI * i / m_sine.size());
+}
+
+RshSimulator::~RshSimulator()
+{
+	Stop();
+}
+
+U32 __RSHCALLCONV RshSimulator::Connect(IN RshBaseType* key, IN U32 mode)
+{
+	if(key == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(key->_type != rshDeviceKey)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	if(mode != RSH_CONNECT_MODE_BASE)
+		return RSH_API_PARAMETER_CONNECTMODENOTSUPPORTED;
+
+	Stop();
+	m_connected = false;
+	m_initialized = false;
+
+	const RshDeviceKey* deviceKey = static_cast<const RshDeviceKey*>(key);
+	U32 st = RSH_API_SUCCESS;
+	if(deviceKey->storedTypeId == rshU32)
+	{
+		if(deviceKey->value_U32 == 0)
+			return RSH_API_DEVICE_NOTFOUND;
+		m_serial = deviceKey->value_U32;
+		const char* options = getenv("RSH_SIMULATOR");
+		if(options != 0)
+			st = Configure(options);
+	}
+	else if(deviceKey->storedTypeId == rshS8P && deviceKey->value_S8P != 0)
+	{
+		m_serial = 1;
+		st = Configure(reinterpret_cast<const char*>(deviceKey->value_S8P));
+	}
+	else
+	{
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	}
+
+	if(st != RSH_API_SUCCESS)
+		return st;
+	m_connected = true;
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshSimulator::Init(IN OUT RshBaseType* structure, IN U32 mode)
+{
+	if(!m_connected)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+	if(structure == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	bool persistent = false;
+	if(structure->_type == rshInitDMA)
+		persistent = (static_cast<RshInitDMA*>(structure)->dmaMode == RshInitDMA::Persistent);
+	else if(structure->_type != rshInitMemory)
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+	RshInitADC* init = static_cast<RshInitADC*>(structure);
+	if(init->startType != RshInitADC::Program)
+		return RSH_API_PARAMETER_STARTTYPEINVALID;
+	if(init->bufferSize == 0)
+		return RSH_API_PARAMETER_OUTOFRANGE;
+
+	// like real devices, sample rate is corrected to available range
+	if(!(init->frequency >= 1.0))
+		init->frequency = 1.0;
+	if(init->frequency > m_maxFrequency)
+		init->frequency = m_maxFrequency;
+
+	std::vector<U32> gains;
+	for(size_t c = 0; c < init->channels.Size(); ++c)
+	{
+		if(!init->channels[c].IsUsed())
+			continue;
+		if(c >= m_deviceChannels)
+			return RSH_API_PARAMETER_WRONGCHANNELNUMBER;
+		gains.push_back(init->channels[c].gain == 0 ? 1 : init->channels[c].gain);
+	}
+	if(gains.empty())
+		return RSH_API_PARAMETER_CHANNELWASNOTSELECTED;
+
+	if(mode == RSH_INIT_MODE_CHECK)
+		return RSH_API_SUCCESS;
+
+	if(mode == RSH_INIT_MODE_UPDATE && m_thread.IsRunning())
+	{
+		// rate and gains do not change buffers, so generator takes them
+		// at block boundary, as hardware does with its registers
+		if(persistent == m_persistent && init->bufferSize == m_bufferSize && gains.size() == m_channels.size())
+		{
+			RshMutexLocker lock(m_mutex);
+			m_updateFrequency = init->frequency;
+			m_updateGains = gains;
+			m_update = true;
+			return RSH_API_SUCCESS;
+		}
+
+		const U32 st = Init(structure, RSH_INIT_MODE_INIT);
+		return (st != RSH_API_SUCCESS) ? st : Start();
+	}
+
+	Stop();
+
+	m_update = false;
+	m_persistent = persistent;
+	m_bufferSize = init->bufferSize;
+
+	const double fullScale = static_cast<double>(1ULL << (m_bits - 1));
+	m_channels.assign(gains.size(), Channel());
+	for(size_t c = 0; c < m_channels.size(); ++c)
+		m_channels[c].amplitude = m_amplitude * fullScale;
+	SetRate(init->frequency, gains);
+
+	m_slots.resize(m_bufferCount);
+	for(size_t i = 0; i < m_slots.size(); ++i)
+		m_slots[i].codes.assign(static_cast<size_t>(m_bufferSize) * m_channels.size(), 0);
+
+	m_initialized = true;
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshSimulator::Start()
+{
+	if(!m_initialized)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+
+	Stop();
+
+	// channel N is shifted by N / channels of period, so channels differ
+	for(size_t c = 0; c < m_channels.size(); ++c)
+	{
+		m_channels[c].phase = static_cast<U64>(static_cast<double>(c) / m_channels.size() * RSH_SIMULATOR_PHASE_SCALE);
+		m_channels[c].counter = static_cast<S64>(c);
+	}
+
+	m_random.Seed(m_seed);
+	m_head = 0;
+	m_tail = 0;
+	m_sequence = 0;
+	m_blocks = 0;
+	m_overflows = 0;
+	m_dropped = 0;
+	m_lastBlock = RshBlockInfo();
+	m_ready.Reset();
+	m_space.Reset();
+	m_stopRequest = false;
+	m_running = true;
+
+	if(m_thread.Start(&RshSimulator::Routine, this) != RSH_API_SUCCESS)
+	{
+		m_running = false;
+		return RSH_API_DEVICE_CANTSTART;
+	}
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshSimulator::Stop()
+{
+	if(!m_thread.IsRunning())
+		return RSH_API_SUCCESS;
+
+	m_stopRequest = true;
+	m_space.Set();
+	m_thread.Join();
+	{
+		RshMutexLocker lock(m_mutex);
+		m_running = false;
+	}
+
+	// waiting thread returns with error
+	m_ready.Set();
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshSimulator::GetData(IN OUT RshBaseType* buffer, IN U32 flags)
+{
+	(void)flags;
+
+	if(buffer == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(!m_initialized)
+		return RSH_API_DEVICE_NOTINITIALIZED;
+
+	size_t index = 0;
+	{
+		RshMutexLocker lock(m_mutex);
+		if(m_head == m_tail)
+			return RSH_API_DEVICE_CANTGETDATA;
+		index = static_cast<size_t>(m_tail % m_slots.size());
+	}
+
+	// generator does not write to slot until it is released below
+	const Slot& slot = m_slots[index];
+	U32 st;
+	switch(buffer->_type)
+	{
+	case rshBufferTypeS8:
+		st = Copy<S8, rshBufferTypeS8>(buffer, slot);
+		break;
+	case rshBufferTypeS16:
+		st = Copy<S16, rshBufferTypeS16>(buffer, slot);
+		break;
+	case rshBufferTypeS32:
+		st = Copy<S32, rshBufferTypeS32>(buffer, slot);
+		break;
+	case rshBufferTypeFloat:
+		st = Copy<float, rshBufferTypeFloat>(buffer, slot);
+		break;
+	case rshBufferTypeDouble:
+		st = Copy<double, rshBufferTypeDouble>(buffer, slot);
+		break;
+	default:
+		st = RSH_API_BUFFER_WRONGDATATYPE;
+		break;
+	}
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	{
+		RshMutexLocker lock(m_mutex);
+		m_lastBlock = slot.info;
+		++m_tail;
+	}
+	m_space.Set();
+	return RSH_API_SUCCESS;
+}
+
+U32 __RSHCALLCONV RshSimulator::Get(IN U32 mode, IN OUT RshBaseType* adr)
+{
+	switch(mode)
+	{
+	case RSH_GET_WAIT_BUFFER_READY_EVENT:
+		{
+			if(adr == 0)
+				return RSH_API_PARAMETER_ZEROADDRESS;
+			if(adr->_type != rshU32)
+				return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+
+			const U32 timeout = static_cast<RSH_U32*>(adr)->data;
+			const RshTimestamp start = RshTimestamp::Now();
+			for(;;)
+			{
+				{
+					RshMutexLocker lock(m_mutex);
+					if(m_head != m_tail)
+						return RSH_API_SUCCESS;
+					if(!m_running)
+						return RSH_API_DEVICE_WASNOTSTARTED;
+				}
+
+				U32 wait = timeout;
+				if(timeout != RSH_INFINITE_WAIT_TIME)
+				{
+					const U64 elapsed = static_cast<U64>(RshTimestamp::Now() - start) / 1000000ULL;
+					if(elapsed >= timeout)
+						return RSH_API_EVENT_WAITTIMEOUT;
+					wait = static_cast<U32>(timeout - elapsed);
+				}
+				m_ready.Wait(wait);
+			}
+		}
+
+	case RSH_GET_BUFFER_BLOCK_INFO:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshBlockInfo)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		{
+			RshMutexLocker lock(m_mutex);
+			*static_cast<RshBlockInfo*>(adr) = m_lastBlock;
+		}
+		return RSH_API_SUCCESS;
+
+	case RSH_GET_DEVICE_IS_CAPABLE:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshU32)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		switch(static_cast<RSH_U32*>(adr)->data)
+		{
+		case RSH_CAPS_SOFT_GATHERING_IS_AVAILABLE:
+		case RSH_CAPS_SOFT_PGATHERING_IS_AVAILABLE:
+		case RSH_CAPS_SOFT_INIT_MEMORY:
+		case RSH_CAPS_SOFT_INIT_DMA:
+		case RSH_CAPS_DEVICE_BLOCK_TIMESTAMP:
+		case RSH_CAPS_DEVICE_INIT_UPDATE:
+			return RSH_API_SUCCESS;
+		default:
+			return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+		}
+
+	case RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER:
+	case RSH_GET_DEVICE_DATA_BITS:
+	case RSH_GET_DEVICE_SERIAL_NUMBER:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshU32)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		if(mode == RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER)
+			static_cast<RSH_U32*>(adr)->data = static_cast<U32>(m_channels.size());
+		else if(mode == RSH_GET_DEVICE_DATA_BITS)
+			static_cast<RSH_U32*>(adr)->data = m_bits;
+		else
+			static_cast<RSH_U32*>(adr)->data = m_serial;
+		return RSH_API_SUCCESS;
+
+	case RSH_GET_DEVICE_INPUT_RANGE_VOLTS:
+	case RSH_GET_DEVICE_MIN_FREQUENCY:
+	case RSH_GET_DEVICE_MAX_FREQUENCY:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshDouble)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		if(mode == RSH_GET_DEVICE_INPUT_RANGE_VOLTS)
+			static_cast<RSH_DOUBLE*>(adr)->data = m_range;
+		else if(mode == RSH_GET_DEVICE_MIN_FREQUENCY)
+			static_cast<RSH_DOUBLE*>(adr)->data = 1.0;
+		else
+			static_cast<RSH_DOUBLE*>(adr)->data = m_maxFrequency;
+		return RSH_API_SUCCESS;
+
+	case RSH_GET_DEVICE_NAME_VERBOSE:
+	case RSH_GET_LIBRARY_FILENAME:
+	case RSH_GET_LIBRARY_VERSION_STR:
+		if(adr == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(adr->_type != rshS8P)
+			return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+		{
+			const char* text = (mode == RSH_GET_DEVICE_NAME_VERBOSE) ? rshSimulatorName :
+				((mode == RSH_GET_LIBRARY_FILENAME) ? rshSimulatorLibrary : rshSimulatorVersion);
+			static_cast<RSH_S8P*>(adr)->data = reinterpret_cast<S8*>(const_cast<char*>(text));
+		}
+		return RSH_API_SUCCESS;
+
+	default:
+		return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+	}
+}
+
+U32 RshSimulator::Configure(const char* options)
+{
+	if(options == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(m_thread.IsRunning())
+		return RSH_API_DEVICE_ALREADYCAPTURED;
+
+	const std::string text(options);
+	size_t position = 0;
+	while(position <= text.size())
+	{
+		size_t end = text.find(';', position);
+		if(end == std::string::npos)
+			end = text.size();
+
+		const std::string item = RshSimulatorTrim(text.substr(position, end - position));
+		position = end + 1;
+		if(item.empty())
+			continue;
+
+		const size_t equal = item.find('=');
+		if(equal == std::string::npos)
+			return RSH_API_PARAMETER_INVALID;
+		U32 st = SetOption(RshSimulatorTrim(item.substr(0, equal)), RshSimulatorTrim(item.substr(equal + 1)));
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	// new options take effect on next Init()
+	m_initialized = false;
+	return RSH_API_SUCCESS;
+}
+
+U64 RshSimulator::Blocks() const
+{
+	RshMutexLocker lock(const_cast<RshMutex&>(m_mutex));
+	return m_blocks;
+}
+
+U64 RshSimulator::Overflows() const
+{
+	RshMutexLocker lock(const_cast<RshMutex&>(m_mutex));
+	return m_overflows;
+}
+
+U64 RshSimulator::Dropped() const
+{
+	RshMutexLocker lock(const_cast<RshMutex&>(m_mutex));
+	return m_dropped;
+}
+
+U32 RshSimulator::SetOption(const std::string& name, const std::string& value)
+{
+	if(name == "signal")
+	{
+		if(value == "sine")
+			m_signal = Sine;
+		else if(value == "square")
+			m_signal = Square;
+		else if(value == "saw")
+			m_signal = Sawtooth;
+		else if(value == "noise")
+			m_signal = Noise;
+		else if(value == "counter")
+			m_signal = Counter;
+		else if(value == "zero")
+			m_signal = Zero;
+		else
+			return RSH_API_PARAMETER_INVALID;
+		return RSH_API_SUCCESS;
+	}
+
+	double number = 0.0;
+	if(!RshSimulatorToNumber(value, number))
+		return RSH_API_PARAMETER_INVALID;
+
+	if(name == "bits" && number >= 8 && number <= 32 && number == floor(number))
+		m_bits = static_cast<U32>(number);
+	else if(name == "channels" && number >= 1 && number <= 1024 && number == floor(number))
+		m_deviceChannels = static_cast<U32>(number);
+	else if(name == "tone" && number >= 0.0)
+		m_tone = number;
+	else if(name == "amplitude" && number >= 0.0 && number <= 1.0)
+		m_amplitude = number;
+	else if(name == "noise" && number >= 0.0 && number <= 1.0)
+		m_noise = number;
+	else if(name == "range" && number > 0.0)
+		m_range = number;
+	else if(name == "buffers" && number >= 2 && number <= 4096 && number == floor(number))
+		m_bufferCount = static_cast<U32>(number);
+	else if(name == "realtime" && (number == 0.0 || number == 1.0))
+		m_realTime = (number != 0.0);
+	else if(name == "jitter" && number >= 0.0 && number <= 1.0e+6)
+		m_jitter = static_cast<U32>(number);
+	else if(name == "drop" && number >= 0.0 && number <= 1.0)
+		m_dropRate = number;
+	else if(name == "seed" && number >= 0.0)
+		m_seed = static_cast<U64>(number);
+	else if(name == "maxfrequency" && number >= 1.0)
+		m_maxFrequency = number;
+	else
+		return RSH_API_PARAMETER_INVALID;
+	return RSH_API_SUCCESS;
+}
+
+void RshSimulator::Routine(void* param)
+{
+	RSH_TRACE_THREAD_NAME("RshSimulator");
+	static_cast<RshSimulator*>(param)->Produce();
+}
+
+void RshSimulator::Produce()
+{
+	U64 period = static_cast<U64>(1.0e+9 * m_bufferSize / m_frequency + 0.5);
+	U64 due = RshTimestamp::Now().NanoSeconds() + period;
+	U64 delay = (m_jitter != 0) ? static_cast<U64>(m_random.Uniform() * m_jitter * 1000.0) : 0;
+
+	while(!m_stopRequest)
+	{
+		if(m_realTime)
+		{
+			// several blocks are completed at once if thread was late
+			const U64 now = RshTimestamp::Now().NanoSeconds();
+			if(now < due + delay)
+			{
+				Pause(due + delay - now);
+				continue;
+			}
+		}
+		else
+		{
+			bool full;
+			{
+				RshMutexLocker lock(m_mutex);
+				full = (m_head - m_tail >= m_slots.size());
+			}
+			if(full)
+			{
+				m_space.Wait(RSH_SIMULATOR_SPACE_WAIT);
+				continue;
+			}
+		}
+
+		const bool drop = (m_dropRate > 0.0 && m_random.Uniform() < m_dropRate);
+		bool full;
+		U64 sequence;
+		{
+			RshMutexLocker lock(m_mutex);
+			full = (m_head - m_tail >= m_slots.size());
+			sequence = ++m_sequence;
+			if(m_update)
+			{
+				SetRate(m_updateFrequency, m_updateGains);
+				period = static_cast<U64>(1.0e+9 * m_bufferSize / m_frequency + 0.5);
+				m_update = false;
+			}
+		}
+
+		if(drop || full)
+		{
+			RSH_TRACE_INSTANT("simulator", drop ? "Drop" : "Overflow", sequence);
+			Skip();
+			RshMutexLocker lock(m_mutex);
+			++m_blocks;
+			if(drop)
+				++m_dropped;
+			else
+				++m_overflows;
+		}
+		else
+		{
+			// slot at head is not visible to GetData() until head is moved
+			Slot& slot = m_slots[static_cast<size_t>(m_head % m_slots.size())];
+			Generate(&slot.codes[0]);
+			slot.info.sequence = sequence;
+			slot.info.timestamp = RshTimestamp::Now().NanoSeconds();
+			slot.info.size = static_cast<U32>(slot.codes.size() * ((m_bits + 7) / 8));
+			slot.voltsPerCode.resize(m_channels.size());
+			for(size_t c = 0; c < m_channels.size(); ++c)
+				slot.voltsPerCode[c] = m_channels[c].voltsPerCode;
+			{
+				RshMutexLocker lock(m_mutex);
+				++m_head;
+				++m_blocks;
+			}
+			m_ready.Set();
+		}
+
+		if(!m_persistent)
+			break;
+
+		due += period;
+		delay = (m_jitter != 0) ? static_cast<U64>(m_random.Uniform() * m_jitter * 1000.0) : 0;
+	}
+
+	{
+		RshMutexLocker lock(m_mutex);
+		m_running = false;
+	}
+	m_ready.Set();
+}
+
+void RshSimulator::Generate(S32* codes)
+{
+	RSH_TRACE_SCOPE("simulator", "Generate");
+	const size_t channels = m_channels.size();
+	const size_t count = m_bufferSize;
+	const S64 maxCode = static_cast<S64>((1ULL << (m_bits - 1)) - 1);
+	const S64 minCode = -maxCode - 1;
+	const U64 mask = (1ULL << m_bits) - 1;
+	const U32 tableShift = 64 - RSH_SIMULATOR_TABLE_BITS;
+	const double noise = m_noise * (static_cast<double>(maxCode) + 1.0);
+	const double* table = &m_sine[0];
+
+	for(size_t c = 0; c < channels; ++c)
+	{
+		Channel& channel = m_channels[c];
+		S32* dst = codes + c;
+		const double amplitude = channel.amplitude;
+		U64 phase = channel.phase;
+		const U64 step = channel.step;
+
+		for(size_t i = 0; i < count; ++i)
+		{
+			double v;
+			switch(m_signal)
+			{
+			case Sine:
+				v = amplitude * table[phase >> tableShift];
+				break;
+			case Square:
+				v = (phase < 0x8000000000000000ULL) ? amplitude : -amplitude;
+				break;
+			case Sawtooth:
+				v = amplitude * (static_cast<double>(phase) / RSH_SIMULATOR_PHASE_SCALE * 2.0 - 1.0);
+				break;
+			case Counter:
+				// wrap to ADC code range
+				v = static_cast<double>(static_cast<S64>(static_cast<U64>(channel.counter++ - minCode) & mask) + minCode);
+				break;
+			default:
+				v = 0.0;
+				break;
+			}
+			phase += step;
+
+			if(noise != 0.0)
+				v += noise * m_random.Gaussian();
+			const double rounded = floor(v + 0.5);
+			const S64 code = (rounded > maxCode) ? maxCode : ((rounded < minCode) ? minCode : static_cast<S64>(rounded));
+			dst[i * channels] = static_cast<S32>(code);
+		}
+		channel.phase = phase;
+	}
+}
+
+void RshSimulator::Skip()
+{
+	// signal continues after lost block, as it would on real input
+	for(size_t c = 0; c < m_channels.size(); ++c)
+	{
+		m_channels[c].phase += m_channels[c].step * m_bufferSize;
+		m_channels[c].counter += m_bufferSize;
+	}
+}
+
+void RshSimulator::SetRate(double frequency, const std::vector<U32>& gains)
+{
+	const double fullScale = static_cast<double>(1ULL << (m_bits - 1));
+	const double cycles = fmod(m_tone / frequency, 1.0);
+	m_frequency = frequency;
+	for(size_t c = 0; c < m_channels.size(); ++c)
+	{
+		m_channels[c].step = static_cast<U64>(cycles * RSH_SIMULATOR_PHASE_SCALE);
+		m_channels[c].voltsPerCode = m_range / gains[c] / fullScale;
+	}
+}
+
+void RshSimulator::Pause(U64 nanoSeconds)
+{
+	if(nanoSeconds > RSH_SIMULATOR_MAX_PAUSE)
+		nanoSeconds = RSH_SIMULATOR_MAX_PAUSE;
+#if defined(RSH_MSWINDOWS)
+	::Sleep(static_cast<DWORD>(nanoSeconds / 1000000ULL));
+#elif defined(RSH_LINUX)
+	usleep(static_cast<useconds_t>(nanoSeconds / 1000ULL));
+#endif
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshSimulator::Copy(RshBaseType* buffer, const Slot& slot)
+{
+	RshBufferType<T, dataCode>& output = *static_cast<RshBufferType<T, dataCode>*>(buffer);
+	const size_t channels = m_channels.size();
+	const size_t size = static_cast<size_t>(m_bufferSize) * channels;
+	if(output.PSize() < size)
+	{
+		U32 st = output.Allocate(size);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	const S32* codes = &slot.codes[0];
+	T* dst = output.ptr;
+	if(std::numeric_limits<T>::is_integer)
+	{
+		// codes are aligned to most significant bit of buffer type
+		const int shift = static_cast<int>(sizeof(T) * 8) - static_cast<int>(m_bits);
+		if(shift >= 0)
+		{
+			const S64 scale = 1LL << shift;
+			for(size_t i = 0; i < size; ++i)
+				dst[i] = static_cast<T>(static_cast<S64>(codes[i]) * scale);
+		}
+		else
+		{
+			for(size_t i = 0; i < size; ++i)
+				dst[i] = static_cast<T>(codes[i] >> -shift);
+		}
+	}
+	else
+	{
+		for(size_t i = 0; i < size; i += channels)
+			for(size_t c = 0; c < channels; ++c)
+				dst[i + c] = static_cast<T>(codes[i + c] * slot.voltsPerCode[c]);
+	}
+
+	output.SetSize(size);
+	return RSH_API_SUCCESS;
+}
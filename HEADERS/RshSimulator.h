@@ -0,0 +1,288 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshSimulator.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshSimulator class.
+ *
+ * Simulated ADC device without hardware.
+ *
+ * \~russian
+ * \brief
+ * Класс RshSimulator.
+ *
+ * Имитатор АЦП, не требующий оборудования.
+ *
+ */
+
+#ifndef RSH_SIMULATOR_H
+#define RSH_SIMULATOR_H
+
+#include "RshDefChk.h"
+#include "RshBlockInfo.h"
+#include "RshInitADC.h"
+#include "RshRandom.h"
+#include "RshThread.h"
+#include "IRshDevice.h"
+
+#include <string>
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Simulated ADC device
+ *
+ * Implements IRshDevice like device abstraction libraries do, so
+ * application code, data processing and storage can be tested and
+ * benchmarked without hardware. Object can be used directly, or loaded
+ * from board library "SIMULATOR" with RshDllClient::GetDeviceInterface()
+ * (see simulator/RshSimulatorBoard.cpp).\n
+ * Device accepts RshInitDMA (single block or persistent mode) and
+ * RshInitMemory structures with program start. Background thread
+ * generates blocks of RshInitADC::bufferSize samples per channel at
+ * the rate given by RshInitADC::frequency and puts them in ring of
+ * internal buffers, like DMA of real device does. If application does
+ * not take blocks in time and ring is full, new blocks are lost, which
+ * is seen as gap in sequence numbers (::RSH_GET_BUFFER_BLOCK_INFO).
+ * In non real time mode blocks are generated as fast as application
+ * takes them, which gives maximum throughput of host side code.\n
+ * With ::RSH_INIT_MODE_UPDATE sample rate and gains are changed during
+ * acquisition starting from next block; change of other parameters
+ * restarts acquisition.\n
+ * Signal, resolution, input range, number of channels, completion
+ * jitter and random block losses are set with Configure() or with
+ * string key in Connect(), for example
+ * RshDeviceKey("bits=14;signal=sine;tone=1000;noise=0.01;jitter=200").
+ *
+ * \remarks
+ * Integer buffers receive codes aligned to most significant bit of
+ * buffer type, floating point buffers receive volts.
+ * Options (values are case sensitive):
+ * - bits - ADC resolution, 8..32 (16);
+ * - channels - number of device channels, 1..1024 (8);
+ * - signal - sine, square, saw, noise, counter or zero (sine);
+ * - tone - signal frequency, Hz (1000);
+ * - amplitude - signal amplitude relative to full scale, 0..1 (0.5);
+ * - noise - gaussian noise rms relative to full scale, 0..1 (0);
+ * - range - input range at gain 1, V (1);
+ * - buffers - number of internal buffers, 2..4096 (8);
+ * - realtime - 1 to keep sample rate, 0 to run as fast as possible (1);
+ * - jitter - maximum random delay of block completion, us (0);
+ * - drop - probability of block loss, 0..1 (0);
+ * - seed - seed of noise and loss generator (1);
+ * - maxfrequency - maximum sample rate, Hz (1e9).
+ *
+ * Environment variable RSH_SIMULATOR is applied in the same format
+ * when device is connected by number.
+ *
+ * \~russian
+ * \brief
+ * Имитатор АЦП
+ *
+ * Реализует интерфейс IRshDevice так же, как библиотеки абстракции
+ * устройств, поэтому код приложения, обработку и сохранение данных
+ * можно проверять и измерять их производительность без оборудования.
+ * Объект можно использовать напрямую или загружать из библиотеки
+ * устройства "SIMULATOR" методом RshDllClient::GetDeviceInterface()
+ * (см. simulator/RshSimulatorBoard.cpp).\n
+ * Устройство принимает структуры RshInitDMA (однократный и непрерывный
+ * режим) и RshInitMemory с программным запуском. Фоновый поток создает
+ * блоки по RshInitADC::bufferSize отсчетов на канал с частотой
+ * RshInitADC::frequency и помещает их в кольцо внутренних буферов, как
+ * это делает ПДП реального устройства. Если приложение не забирает блоки
+ * вовремя и кольцо заполнено, новые блоки теряются, что видно по пропуску
+ * порядковых номеров (::RSH_GET_BUFFER_BLOCK_INFO). В режиме без
+ * соблюдения реального времени блоки создаются с той скоростью, с
+ * которой их забирает приложение, что дает максимальную пропускную
+ * способность кода на стороне компьютера.\n
+ * При ::RSH_INIT_MODE_UPDATE частота дискретизации и коэффициенты
+ * усиления меняются во время сбора начиная со следующего блока;
+ * изменение других параметров перезапускает сбор.\n
+ * Сигнал, разрядность, входной диапазон, число каналов, разброс времени
+ * завершения и случайные потери блоков задаются методом Configure() или
+ * строковым ключом в Connect(), например
+ * RshDeviceKey("bits=14;signal=sine;tone=1000;noise=0.01;jitter=200").
+ *
+ * \remarks
+ * В целочисленные буферы записываются коды, выровненные по старшему
+ * разряду типа буфера, в буферы чисел с плавающей точкой - вольты.
+ * Параметры (значения чувствительны к регистру):
+ * - bits - разрядность АЦП, 8..32 (16);
+ * - channels - число каналов устройства, 1..1024 (8);
+ * - signal - sine, square, saw, noise, counter или zero (sine);
+ * - tone - частота сигнала, Гц (1000);
+ * - amplitude - амплитуда сигнала относительно полной шкалы, 0..1 (0.5);
+ * - noise - СКО гауссова шума относительно полной шкалы, 0..1 (0);
+ * - range - входной диапазон при коэффициенте усиления 1, В (1);
+ * - buffers - число внутренних буферов, 2..4096 (8);
+ * - realtime - 1 для соблюдения частоты дискретизации, 0 для работы с
+ * максимальной скоростью (1);
+ * - jitter - максимальная случайная задержка завершения блока, мкс (0);
+ * - drop - вероятность потери блока, 0..1 (0);
+ * - seed - начальное значение генератора шума и потерь (1);
+ * - maxfrequency - максимальная частота дискретизации, Гц (1e9).
+ *
+ * Переменная окружения RSH_SIMULATOR в том же формате применяется
+ * при подключении к устройству по номеру.
+ *
+ */
+class RshSimulator : public IRshDevice
+{
+public:
+
+	//! Generated signal
+	enum Signal
+	{
+		//! Sine wave
+		Sine = 0x0,
+		//! Square wave with 50% duty cycle
+		Square = 0x1,
+		//! Sawtooth from minus to plus amplitude
+		Sawtooth = 0x2,
+		//! Gaussian noise only (see "noise" option)
+		Noise = 0x3,
+		//! Code increments by one each sample, channel N starts from N. Gaps show lost data
+		Counter = 0x4,
+		//! Zero code
+		Zero = 0x5
+	};
+
+	RshSimulator();
+	virtual ~RshSimulator();
+
+	U32 __RSHCALLCONV Connect(IN RshBaseType* key, IN U32 mode = RSH_CONNECT_MODE_BASE);
+	U32 __RSHCALLCONV Init(IN OUT RshBaseType* structure, IN U32 mode = RSH_INIT_MODE_INIT);
+	U32 __RSHCALLCONV Start();
+	U32 __RSHCALLCONV Stop();
+	U32 __RSHCALLCONV GetData(IN OUT RshBaseType* buffer, IN U32 flags = RSH_DATA_MODE_NO_FLAGS);
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType* adr = NULL);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Set options
+	 *
+	 * \param[in] options List of "name=value" separated by ';',
+	 * see class description. Options not in list keep their values.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID for unknown
+	 * option or wrong value (options before it are applied) or
+	 * ::RSH_API_DEVICE_ALREADYCAPTURED if acquisition is running.
+	 *
+	 * \~russian
+	 * \brief
+	 * Установка параметров
+	 *
+	 * \param[in] options Список "имя=значение" через ';',
+	 * см. описание класса. Параметры, которых нет в списке,
+	 * сохраняют свои значения.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID для неизвестного
+	 * параметра или неверного значения (предшествующие параметры
+	 * применяются) или ::RSH_API_DEVICE_ALREADYCAPTURED, если идет сбор.
+	 *
+	 */
+	U32 Configure(const char* options);
+
+	//! Blocks generated since Start(), including lost ones
+	U64 Blocks() const;
+
+	//! Blocks lost since Start() because ring of internal buffers was full
+	U64 Overflows() const;
+
+	//! Blocks lost since Start() by "drop" option
+	U64 Dropped() const;
+
+private:
+
+	RshSimulator(const RshSimulator&);
+	RshSimulator& operator=(const RshSimulator&);
+
+	struct Channel
+	{
+		Channel() : phase(0), step(0), counter(0), amplitude(0.0), voltsPerCode(0.0) {}
+
+		U64 phase;
+		U64 step;
+		S64 counter;
+		double amplitude;
+		double voltsPerCode;
+	};
+
+	struct Slot
+	{
+		std::vector<S32> codes;
+		RshBlockInfo info;
+		//! Scale of channels when block was generated
+		std::vector<double> voltsPerCode;
+	};
+
+	static void Routine(void* param);
+	void Produce();
+	void Generate(S32* codes);
+	void Skip();
+	void SetRate(double frequency, const std::vector<U32>& gains);
+	void Pause(U64 nanoSeconds);
+	U32 SetOption(const std::string& name, const std::string& value);
+
+	template<typename T, RshDataTypes dataCode>
+	U32 Copy(RshBaseType* buffer, const Slot& slot);
+
+	// options
+	U32 m_bits;
+	U32 m_deviceChannels;
+	U32 m_signal;
+	double m_tone;
+	double m_amplitude;
+	double m_noise;
+	double m_range;
+	U32 m_bufferCount;
+	bool m_realTime;
+	U32 m_jitter;
+	double m_dropRate;
+	U64 m_seed;
+	double m_maxFrequency;
+
+	// parameters of last Init()
+	bool m_connected;
+	U32 m_serial;
+	bool m_initialized;
+	bool m_persistent;
+	double m_frequency;
+	U32 m_bufferSize;
+	std::vector<Channel> m_channels;
+
+	// RSH_INIT_MODE_UPDATE during acquisition, applied from next block
+	bool m_update;
+	double m_updateFrequency;
+	std::vector<U32> m_updateGains;
+
+	// acquisition
+	std::vector<Slot> m_slots;
+	std::vector<double> m_sine;
+	RshRandom m_random;
+	RshThread m_thread;
+	RshMutex m_mutex;
+	RshEvent m_ready;
+	RshEvent m_space;
+	volatile bool m_running;
+	volatile bool m_stopRequest;
+	U64 m_head;
+	U64 m_tail;
+	U64 m_sequence;
+	U64 m_blocks;
+	U64 m_overflows;
+	U64 m_dropped;
+	RshBlockInfo m_lastBlock;
+};
+
+#endif //RSH_SIMULATOR_H
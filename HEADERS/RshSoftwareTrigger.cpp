@@ -0,0 +1,400 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshSoftwareTrigger.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshSoftwareTrigger class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshSoftwareTrigger.
+ *
+ */
+
+#include "RshSoftwareTrigger.h"
+#include "RshConsts.h"
+
+#include <cstring>
+
+RshSoftwareTrigger::RshSoftwareTrigger(U32 channels) :
+	m_channelCount(1),
+	m_condition(Level),
+	m_channel(0),
+	m_sign(1.0),
+	m_level(0.0),
+	m_low(0.0),
+	m_high(0.0),
+	m_hysteresis(0.0),
+	m_minWidth(0),
+	m_maxWidth(0),
+	m_pre(0),
+	m_post(0),
+	m_maxEvents(0)
+{
+	SetChannels(channels);
+}
+
+U32 RshSoftwareTrigger::SetChannels(U32 channels)
+{
+	if(channels == 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_channelCount = channels;
+	if(m_channel >= channels)
+		m_channel = 0;
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshSoftwareTrigger::SetLevel(U32 channel, double level, U32 slope, double hysteresis)
+{
+	if(channel >= m_channelCount)
+		return RSH_API_PARAMETER_WRONGCHANNELNUMBER;
+	if(hysteresis < 0.0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_condition = Level;
+	m_channel = channel;
+	m_sign = (slope & RshInitADC::SlopeDecline) ? -1.0 : 1.0;
+	m_level = m_sign * level;
+	m_hysteresis = hysteresis;
+	Disarm();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshSoftwareTrigger::SetWindow(U32 channel, double low, double high)
+{
+	if(channel >= m_channelCount)
+		return RSH_API_PARAMETER_WRONGCHANNELNUMBER;
+	if(low > high)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_condition = Window;
+	m_channel = channel;
+	m_sign = 1.0;
+	m_low = low;
+	m_high = high;
+	Disarm();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshSoftwareTrigger::SetPulseWidth(U32 channel, double level, U32 minWidth, U32 maxWidth, U32 slope, double hysteresis)
+{
+	if(channel >= m_channelCount)
+		return RSH_API_PARAMETER_WRONGCHANNELNUMBER;
+	if(minWidth > maxWidth || hysteresis < 0.0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_condition = PulseWidth;
+	m_channel = channel;
+	m_sign = (slope & RshInitADC::SlopeDecline) ? -1.0 : 1.0;
+	m_level = m_sign * level;
+	m_hysteresis = hysteresis;
+	m_minWidth = minWidth;
+	m_maxWidth = maxWidth;
+	Disarm();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshSoftwareTrigger::SetRecord(U32 preSamples, U32 postSamples, U32 maxEvents)
+{
+	if(postSamples == 0 || maxEvents == 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_pre = preSamples;
+	m_post = postSamples;
+	m_maxEvents = maxEvents;
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+void RshSoftwareTrigger::Reset()
+{
+	Disarm();
+	m_busyUntil = 0;
+	m_position = 0;
+	m_triggers = 0;
+	m_dropped = 0;
+	m_capturing = false;
+	m_left = 0;
+	m_events.clear();
+	m_history.assign(static_cast<size_t>(m_pre) * m_channelCount, 0.0);
+	m_historyHead = 0;
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshSoftwareTrigger::Process(const RshBufferType<T, dataCode>& block, double scale)
+{
+	if(m_post == 0)
+		return RSH_API_PARAMETER_NOTINITIALIZED;
+	if(block.Size() % m_channelCount != 0)
+		return RSH_API_BUFFER_WRONGSIZE;
+
+	const size_t size = block.Size();
+	const size_t frames = size / m_channelCount;
+	if(m_data.size() < size)
+		m_data.resize(size);
+	if(m_scan.size() < frames)
+		m_scan.resize(frames);
+
+	double* data = &m_data[0];
+	const T* src = block.ptr;
+	for(size_t i = 0; i < size; ++i)
+		data[i] = static_cast<double>(src[i]) * scale;
+
+	double* scan = &m_scan[0];
+	const double* channel = data + m_channel;
+	const double sign = m_sign;
+	for(size_t i = 0; i < frames; ++i)
+		scan[i] = sign * channel[i * m_channelCount];
+
+	return Run(frames);
+}
+
+U32 RshSoftwareTrigger::Events() const
+{
+	return static_cast<U32>(m_events.size());
+}
+
+U32 RshSoftwareTrigger::GetEvent(RSH_BUFFER_DOUBLE& record, U64* position)
+{
+	if(m_events.empty())
+		return RSH_API_BUFFER_ISEMPTY;
+
+	const Event& ev = m_events.front();
+	const size_t size = ev.data.size();
+	if(record.PSize() < size)
+	{
+		U32 st = record.Allocate(size);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+	memcpy(record.ptr, &ev.data[0], size * sizeof(double));
+	record.SetSize(size);
+	if(position != 0)
+		*position = ev.position;
+
+	m_events.pop_front();
+	return RSH_API_SUCCESS;
+}
+
+U64 RshSoftwareTrigger::Triggers() const
+{
+	return m_triggers;
+}
+
+U64 RshSoftwareTrigger::DroppedEvents() const
+{
+	return m_dropped;
+}
+
+U64 RshSoftwareTrigger::Position() const
+{
+	return m_position;
+}
+
+void RshSoftwareTrigger::Disarm()
+{
+	m_armed = false;
+	m_inPulse = false;
+	m_width = 0;
+}
+
+U32 RshSoftwareTrigger::Run(size_t frames)
+{
+	m_hits.clear();
+	Scan(frames);
+
+	// record started in one of previous blocks
+	if(m_capturing)
+		Append(0, (m_left < frames) ? m_left : frames);
+
+	// records do not overlap, so each one starts after previous is finished
+	for(size_t h = 0; h < m_hits.size(); ++h)
+	{
+		const size_t index = m_hits[h];
+		StartRecord(index);
+		Append(index, (m_post < frames - index) ? m_post : frames - index);
+	}
+
+	UpdateHistory(frames);
+	m_position += frames;
+	return RSH_API_SUCCESS;
+}
+
+void RshSoftwareTrigger::Scan(size_t frames)
+{
+	const double* v = &m_scan[0];
+
+	for(size_t pos = 0; pos < frames; pos += scanPart)
+	{
+		const size_t n = (frames - pos < static_cast<size_t>(scanPart)) ? frames - pos : static_cast<size_t>(scanPart);
+		const size_t full = n - n % 4;
+
+		// minimum and maximum of part, four samples per pass
+		double mn[4] = { v[pos], v[pos], v[pos], v[pos] };
+		double mx[4] = { v[pos], v[pos], v[pos], v[pos] };
+		for(size_t i = 0; i < full; i += 4)
+			for(int l = 0; l < 4; ++l)
+			{
+				const double x = v[pos + i + l];
+				mn[l] = (x < mn[l]) ? x : mn[l];
+				mx[l] = (x > mx[l]) ? x : mx[l];
+			}
+		for(size_t i = full; i < n; ++i)
+		{
+			mn[0] = (v[pos + i] < mn[0]) ? v[pos + i] : mn[0];
+			mx[0] = (v[pos + i] > mx[0]) ? v[pos + i] : mx[0];
+		}
+		for(int l = 1; l < 4; ++l)
+		{
+			mn[0] = (mn[l] < mn[0]) ? mn[l] : mn[0];
+			mx[0] = (mx[l] > mx[0]) ? mx[l] : mx[0];
+		}
+
+		if(Quiet(mn[0], mx[0]))
+		{
+			if(m_inPulse)
+				m_width += n;
+			continue;
+		}
+
+		for(size_t i = pos; i < pos + n; ++i)
+			if(Step(v[i]))
+				Accept(i);
+	}
+}
+
+bool RshSoftwareTrigger::Quiet(double minValue, double maxValue) const
+{
+	// inside range: stays inside; outside: can not enter
+	if(m_condition == Window)
+		return m_armed ? (minValue >= m_low && maxValue <= m_high) : (maxValue < m_low || minValue > m_high);
+
+	// pulse does not end
+	if(m_condition == PulseWidth && m_inPulse)
+		return minValue >= m_level - m_hysteresis;
+
+	// level is not crossed and not armed, pulse start is the same crossing
+	return m_armed ? (maxValue < m_level) : (minValue >= m_level - m_hysteresis);
+}
+
+bool RshSoftwareTrigger::Step(double value)
+{
+	switch(m_condition)
+	{
+	case Window:
+	{
+		const bool inside = (value >= m_low && value <= m_high);
+		if(m_armed && !inside)
+		{
+			m_armed = false;
+			return true;
+		}
+		if(inside)
+			m_armed = true;
+		return false;
+	}
+	case PulseWidth:
+		if(m_inPulse)
+		{
+			if(value >= m_level - m_hysteresis)
+			{
+				++m_width;
+				return false;
+			}
+			m_inPulse = false;
+			m_armed = true;
+			return m_width >= m_minWidth && m_width <= m_maxWidth;
+		}
+		if(m_armed && value >= m_level)
+		{
+			m_inPulse = true;
+			m_armed = false;
+			m_width = 1;
+		}
+		else if(value < m_level - m_hysteresis)
+			m_armed = true;
+		return false;
+	default:
+		if(m_armed && value >= m_level)
+		{
+			m_armed = false;
+			return true;
+		}
+		if(value < m_level - m_hysteresis)
+			m_armed = true;
+		return false;
+	}
+}
+
+void RshSoftwareTrigger::Accept(size_t index)
+{
+	const U64 position = m_position + index;
+	if(position < m_pre || position < m_busyUntil)
+		return;
+
+	m_busyUntil = position + m_post;
+	++m_triggers;
+	m_hits.push_back(index);
+}
+
+void RshSoftwareTrigger::StartRecord(size_t index)
+{
+	const size_t channels = m_channelCount;
+	m_current.position = m_position + index;
+	m_current.data.resize((static_cast<size_t>(m_pre) + m_post) * channels);
+	double* dst = m_current.data.empty() ? 0 : &m_current.data[0];
+
+	// prehistory: oldest part from ring, newest part from current block
+	const size_t fromBlock = (index < m_pre) ? index : m_pre;
+	const size_t fromRing = m_pre - fromBlock;
+	for(size_t f = 0; f < fromRing; ++f)
+	{
+		const size_t frame = (m_historyHead + m_pre - fromRing + f) % m_pre;
+		memcpy(dst + f * channels, &m_history[frame * channels], channels * sizeof(double));
+	}
+	if(fromBlock != 0)
+		memcpy(dst + fromRing * channels, &m_data[(index - fromBlock) * channels], fromBlock * channels * sizeof(double));
+
+	m_capturing = true;
+	m_left = m_post;
+}
+
+void RshSoftwareTrigger::Append(size_t from, size_t count)
+{
+	const size_t channels = m_channelCount;
+	const size_t offset = static_cast<size_t>(m_pre) + m_post - m_left;
+	if(count != 0)
+		memcpy(&m_current.data[offset * channels], &m_data[from * channels], count * channels * sizeof(double));
+	m_left -= static_cast<U32>(count);
+
+	if(m_left != 0)
+		return;
+
+	m_capturing = false;
+	if(m_events.size() < m_maxEvents)
+		m_events.push_back(m_current);
+	else
+		++m_dropped;
+}
+
+void RshSoftwareTrigger::UpdateHistory(size_t frames)
+{
+	if(m_pre == 0 || frames == 0)
+		return;
+
+	const size_t channels = m_channelCount;
+	const size_t count = (frames < m_pre) ? frames : m_pre;
+	const double* src = &m_data[(frames - count) * channels];
+
+	for(size_t f = 0; f < count; ++f)
+	{
+		memcpy(&m_history[m_historyHead * channels], src + f * channels, channels * sizeof(double));
+		m_historyHead = (m_historyHead + 1) % m_pre;
+	}
+}
@@ -0,0 +1,303 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshSoftwareTrigger.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshSoftwareTrigger class.
+ *
+ * Software trigger with prehistory for continuous data stream.
+ *
+ * \~russian
+ * \brief
+ * Класс RshSoftwareTrigger.
+ *
+ * Программная синхронизация с предысторией для непрерывного потока данных.
+ *
+ */
+
+#ifndef RSH_SOFTWARE_TRIGGER_H
+#define RSH_SOFTWARE_TRIGGER_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshConsts.h"
+#include "RshInitADC.h"
+
+#include <deque>
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Software trigger for persistent data acquisition
+ *
+ * Hardware prehistory works only in memory (start-stop) mode. This class
+ * gives the same for continuous DMA stream: blocks returned by
+ * IRshDevice::GetData() are passed to Process(), condition is checked on
+ * one channel, and for every trigger event fixed length record of all
+ * channels is made, containing \b pre samples before trigger and \b post
+ * samples starting from trigger sample. Records are assembled across block
+ * boundaries, prehistory is kept in circular buffer, so only events are
+ * stored, not the whole stream.\n
+ * Trigger channel is scanned in parts: minimum and maximum of part are
+ * found first, and part is checked
+ * sample by sample only if condition can be met in it. So quiet signal
+ * is scanned at memory speed.
+ *
+ * \remarks
+ * While record is being filled with post trigger samples, new trigger
+ * events are ignored. Events in the first \b pre samples of stream
+ * are ignored too, because there is no prehistory for them.
+ *
+ * \~russian
+ * \brief
+ * Программная синхронизация для непрерывного сбора данных
+ *
+ * Аппаратная предыстория работает только в режиме сбора в память.
+ * Этот класс дает ту же возможность для непрерывного потока: блоки,
+ * полученные методом IRshDevice::GetData(), передаются в Process(),
+ * условие проверяется по одному каналу, и для каждого события
+ * формируется запись фиксированной длины по всем каналам, содержащая
+ * \b pre отсчетов до события и \b post отсчетов, начиная с отсчета
+ * события. Записи собираются через границы блоков, предыстория хранится
+ * в кольцевом буфере, поэтому сохраняются только события, а не весь поток.\n
+ * Канал синхронизации просматривается частями: сначала находятся минимум
+ * и максимум части, и часть
+ * проверяется поотсчетно, только если в ней может выполниться условие.
+ * Поэтому сигнал без событий просматривается со скоростью чтения памяти.
+ *
+ * \remarks
+ * Пока запись заполняется отсчетами после события, новые события
+ * пропускаются. События в первых \b pre отсчетах потока также пропускаются,
+ * так как для них нет предыстории.
+ *
+ */
+class RshSoftwareTrigger
+{
+public:
+
+	//! Trigger conditions
+	enum Condition
+	{
+		//! Signal crosses level
+		Level = 0x0,
+		//! Signal leaves range between low and high levels
+		Window = 0x1,
+		//! Pulse with width in given range ends
+		PulseWidth = 0x2
+	};
+
+	explicit RshSoftwareTrigger(U32 channels = 1);
+
+	//! Set number of interleaved channels
+	U32 SetChannels(U32 channels);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Trigger on level crossing
+	 *
+	 * \param[in] channel Trigger channel.
+	 * \param[in] level Threshold, volts (after scaling in Process()).
+	 * \param[in] slope RshInitADC::SlopeFront or RshInitADC::SlopeDecline.
+	 * \param[in] hysteresis Signal must go this far to other side of level
+	 * before next crossing is detected, protects from noise.
+	 *
+	 * \~russian
+	 * \brief
+	 * Синхронизация по переходу уровня
+	 *
+	 * \param[in] channel Канал синхронизации.
+	 * \param[in] level Порог, вольт (после масштабирования в Process()).
+	 * \param[in] slope RshInitADC::SlopeFront или RshInitADC::SlopeDecline.
+	 * \param[in] hysteresis Сигнал должен отойти на эту величину в другую сторону
+	 * от уровня до обнаружения следующего перехода, защищает от шума.
+	 *
+	 */
+	U32 SetLevel(U32 channel, double level, U32 slope = RshInitADC::SlopeFront, double hysteresis = 0.0);
+
+	//! Trigger when signal leaves [\b low, \b high] range after being inside it
+	U32 SetWindow(U32 channel, double low, double high);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Trigger on pulse width
+	 *
+	 * Pulse starts when signal crosses \b level with \b slope and ends
+	 * when it crosses back (with \b hysteresis). Trigger sample is the
+	 * first sample after pulse, so set prehistory longer than
+	 * \b maxWidth to have whole pulse in record.
+	 *
+	 * \param[in] minWidth Minimum pulse width, samples.
+	 * \param[in] maxWidth Maximum pulse width, samples.
+	 *
+	 * \~russian
+	 * \brief
+	 * Синхронизация по длительности импульса
+	 *
+	 * Импульс начинается при переходе уровня \b level по \b slope и
+	 * заканчивается при обратном переходе (с учетом \b hysteresis).
+	 * Отсчет события - первый отсчет после импульса, поэтому задайте
+	 * предысторию длиннее \b maxWidth, чтобы импульс целиком попал в запись.
+	 *
+	 * \param[in] minWidth Минимальная длительность импульса, отсчетов.
+	 * \param[in] maxWidth Максимальная длительность импульса, отсчетов.
+	 *
+	 */
+	U32 SetPulseWidth(U32 channel, double level, U32 minWidth, U32 maxWidth, U32 slope = RshInitADC::SlopeFront, double hysteresis = 0.0);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Set record length
+	 *
+	 * \param[in] preSamples Samples of each channel before trigger.
+	 * \param[in] postSamples Samples of each channel from trigger sample, not 0.
+	 * \param[in] maxEvents Records waiting for GetEvent(), next ones are dropped.
+	 *
+	 * \~russian
+	 * \brief
+	 * Установка длины записи
+	 *
+	 * \param[in] preSamples Отсчетов каждого канала до события.
+	 * \param[in] postSamples Отсчетов каждого канала, начиная с отсчета события, не 0.
+	 * \param[in] maxEvents Записей, ожидающих вызова GetEvent(), последующие отбрасываются.
+	 *
+	 */
+	U32 SetRecord(U32 preSamples, U32 postSamples, U32 maxEvents = 64);
+
+	//! Discard prehistory, trigger state and records
+	void Reset();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Process acquired block
+	 *
+	 * \param[in] block Interleaved samples of all channels,
+	 * RshBufferType::Size() must be multiple of number of channels.
+	 * \param[in] scale Samples are multiplied by this value
+	 * (for example, volts per code for integer buffers).
+	 *
+	 * \~russian
+	 * \brief
+	 * Обработка полученного блока
+	 *
+	 * \param[in] block Чередующиеся отсчеты всех каналов,
+	 * RshBufferType::Size() должен быть кратен числу каналов.
+	 * \param[in] scale Отсчеты умножаются на это значение
+	 * (например, вольт на код для целочисленных буферов).
+	 *
+	 */
+	template<typename T, RshDataTypes dataCode>
+	U32 Process(const RshBufferType<T, dataCode>& block, double scale = 1.0);
+
+	//! Number of records ready
+	U32 Events() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Take next record
+	 *
+	 * \param[out] record Interleaved samples of all channels,
+	 * trigger sample of channel c has index \b pre * channels + c.
+	 * \param[out] position Stream position of trigger sample (samples of one channel since Reset()).
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_BUFFER_ISEMPTY.
+	 *
+	 * \~russian
+	 * \brief
+	 * Получение следующей записи
+	 *
+	 * \param[out] record Чередующиеся отсчеты всех каналов,
+	 * отсчет события канала c имеет индекс \b pre * channels + c.
+	 * \param[out] position Позиция отсчета события в потоке (отсчетов одного канала после Reset()).
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_BUFFER_ISEMPTY.
+	 *
+	 */
+	U32 GetEvent(RSH_BUFFER_DOUBLE& record, U64* position = 0);
+
+	//! Trigger events accepted since Reset()
+	U64 Triggers() const;
+
+	//! Records dropped because \b maxEvents records were waiting
+	U64 DroppedEvents() const;
+
+	//! Samples of one channel processed since Reset()
+	U64 Position() const;
+
+private:
+
+	enum { scanPart = 256 };
+
+	struct Event
+	{
+		U64 position;
+		std::vector<double> data;
+	};
+
+	void Disarm();
+	U32 Run(size_t frames);
+	void Scan(size_t frames);
+	bool Quiet(double minValue, double maxValue) const;
+	bool Step(double value);
+	void Accept(size_t index);
+	void StartRecord(size_t index);
+	void Append(size_t from, size_t count);
+	void UpdateHistory(size_t frames);
+
+	// trigger settings, decline slope is handled as front of inverted signal
+	U32 m_channelCount;
+	U32 m_condition;
+	U32 m_channel;
+	double m_sign;
+	double m_level;
+	double m_low;
+	double m_high;
+	double m_hysteresis;
+	U32 m_minWidth;
+	U32 m_maxWidth;
+
+	// trigger state
+	bool m_armed;
+	bool m_inPulse;
+	U64 m_width;
+	U64 m_busyUntil;
+
+	// records
+	U32 m_pre;
+	U32 m_post;
+	U32 m_maxEvents;
+	U64 m_position;
+	U64 m_triggers;
+	U64 m_dropped;
+	bool m_capturing;
+	U32 m_left;
+	Event m_current;
+	std::deque<Event> m_events;
+
+	// prehistory ring of m_pre frames, m_historyHead is oldest frame
+	std::vector<double> m_history;
+	U32 m_historyHead;
+
+	std::vector<double> m_data;
+	std::vector<double> m_scan;
+	std::vector<size_t> m_hits;
+};
+
+#endif //RSH_SOFTWARE_TRIGGER_H
@@ -0,0 +1,428 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshSpectrumAnalyzer.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshFftPlan and RshSpectrumAnalyzer classes.
+ *
+ * \~russian
+ * \brief
+ * Классы RshFftPlan и RshSpectrumAnalyzer.
+ *
+ */
+
+#include "RshSpectrumAnalyzer.h"
+#include "RshConsts.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#define RSH_SPECTRUM_TWO_PI 6.283185307179586476925286766559
+
+RshFftPlan::RshFftPlan() :
+	m_size(0)
+{ }
+
+U32 RshFftPlan::Create(U32 size)
+{
+	if(size < 4 || (size & (size - 1)) != 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	const U32 half = size / 2;
+	U32 bits = 0;
+	while((1U << bits) < half)
+		++bits;
+
+	m_reverse.resize(half);
+	for(U32 i = 0; i < half; ++i)
+	{
+		U32 r = 0;
+		for(U32 b = 0; b < bits; ++b)
+			r |= ((i >> b) & 1) << (bits - 1 - b);
+		m_reverse[i] = r;
+	}
+
+	// stage with span h uses exp(-2*pi*i*j/(2h)), j < h
+	m_stageRe.resize(half > 1 ? half - 1 : 1);
+	m_stageIm.resize(half > 1 ? half - 1 : 1);
+	for(U32 span = 1; span < half; span *= 2)
+		for(U32 j = 0; j < span; ++j)
+		{
+			const double angle = -RSH_SPECTRUM_TWO_PI * j / (2.0 * span);
+			m_stageRe[span - 1 + j] = cos(angle);
+			m_stageIm[span - 1 + j] = sin(angle);
+		}
+
+	m_splitRe.resize(half + 1);
+	m_splitIm.resize(half + 1);
+	for(U32 k = 0; k <= half; ++k)
+	{
+		const double angle = -RSH_SPECTRUM_TWO_PI * k / size;
+		m_splitRe[k] = cos(angle);
+		m_splitIm[k] = sin(angle);
+	}
+
+	m_size = size;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshFftPlan::Size() const
+{
+	return m_size;
+}
+
+U32 RshFftPlan::Bins() const
+{
+	return m_size == 0 ? 0 : m_size / 2 + 1;
+}
+
+void RshFftPlan::Forward(const double* input, double* re, double* im, double* workRe, double* workIm) const
+{
+	const U32 half = m_size / 2;
+
+	// even samples are real and odd samples are imaginary parts of half size signal
+	for(U32 i = 0; i < half; ++i)
+	{
+		const U32 r = m_reverse[i];
+		workRe[i] = input[2 * r];
+		workIm[i] = input[2 * r + 1];
+	}
+
+	for(U32 span = 1; span < half; span *= 2)
+	{
+		const double* wRe = &m_stageRe[span - 1];
+		const double* wIm = &m_stageIm[span - 1];
+		for(U32 start = 0; start < half; start += 2 * span)
+		{
+			double* aRe = workRe + start;
+			double* aIm = workIm + start;
+			double* bRe = aRe + span;
+			double* bIm = aIm + span;
+			// butterflies of one group
+			for(U32 j = 0; j < span; ++j)
+			{
+				const double tRe = wRe[j] * bRe[j] - wIm[j] * bIm[j];
+				const double tIm = wRe[j] * bIm[j] + wIm[j] * bRe[j];
+				bRe[j] = aRe[j] - tRe;
+				bIm[j] = aIm[j] - tIm;
+				aRe[j] += tRe;
+				aIm[j] += tIm;
+			}
+		}
+	}
+
+	// split spectrum of packed signal into spectrum of real signal
+	re[0] = workRe[0] + workIm[0];
+	im[0] = 0.0;
+	re[half] = workRe[0] - workIm[0];
+	im[half] = 0.0;
+	for(U32 k = 1; k < half; ++k)
+	{
+		const double aRe = workRe[k];
+		const double aIm = workIm[k];
+		const double bRe = workRe[half - k];
+		const double bIm = -workIm[half - k];
+		const double evenRe = 0.5 * (aRe + bRe);
+		const double evenIm = 0.5 * (aIm + bIm);
+		const double oddRe = 0.5 * (aIm - bIm);
+		const double oddIm = -0.5 * (aRe - bRe);
+		re[k] = evenRe + m_splitRe[k] * oddRe - m_splitIm[k] * oddIm;
+		im[k] = evenIm + m_splitRe[k] * oddIm + m_splitIm[k] * oddRe;
+	}
+}
+
+RshSpectrumAnalyzer::RshSpectrumAnalyzer() :
+	m_channelCount(0),
+	m_hop(0),
+	m_averages(0),
+	m_frames(0),
+	m_sampleFrequency(0.0),
+	m_powerScale(0.0),
+	m_noiseBandwidth(0.0)
+{ }
+
+U32 RshSpectrumAnalyzer::Configure(U32 fftSize, U32 channels, double sampleFrequency, U32 window, double overlap, U32 averages, U32 threads)
+{
+	if(channels == 0 || sampleFrequency <= 0.0 || overlap < 0.0 || overlap >= 1.0)
+		return RSH_API_PARAMETER_INVALID;
+	if(window > FlatTop)
+		return RSH_API_PARAMETER_NOTSUPPORTED;
+
+	U32 st = m_plan.Create(fftSize);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	const U32 overlapped = static_cast<U32>(floor(overlap * fftSize + 0.5));
+	m_hop = (overlapped < fftSize) ? fftSize - overlapped : 1;
+	m_channelCount = channels;
+	m_sampleFrequency = sampleFrequency;
+	m_averages = averages;
+
+	// periodic windows, coefficients of cosine terms
+	static const double coefficients[][5] = {
+		{ 1.0, 0.0, 0.0, 0.0, 0.0 },
+		{ 0.5, 0.5, 0.0, 0.0, 0.0 },
+		{ 0.54, 0.46, 0.0, 0.0, 0.0 },
+		{ 0.42, 0.5, 0.08, 0.0, 0.0 },
+		{ 0.35875, 0.48829, 0.14128, 0.01168, 0.0 },
+		{ 0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368 }
+	};
+	const double* a = coefficients[window];
+
+	m_window.resize(fftSize);
+	double sum = 0.0;
+	double sumSquares = 0.0;
+	for(U32 i = 0; i < fftSize; ++i)
+	{
+		const double x = RSH_SPECTRUM_TWO_PI * i / fftSize;
+		const double w = a[0] - a[1] * cos(x) + a[2] * cos(2 * x) - a[3] * cos(3 * x) + a[4] * cos(4 * x);
+		m_window[i] = w;
+		sum += w;
+		sumSquares += w * w;
+	}
+	m_powerScale = 1.0 / (sum * sum);
+	m_noiseBandwidth = sampleFrequency * sumSquares / (sum * sum);
+
+	const U32 bins = m_plan.Bins();
+	m_channels.assign(channels, Channel());
+	for(U32 c = 0; c < channels; ++c)
+	{
+		m_channels[c].history.resize(fftSize);
+		m_channels[c].sum.resize(bins);
+		m_channels[c].result.resize(bins);
+	}
+
+	const U32 workers = (threads == 0) ? 1 : ((threads < channels) ? threads : channels);
+	m_workers.assign(workers, Worker());
+	for(U32 w = 0; w < workers; ++w)
+	{
+		m_workers[w].first = w;
+		m_workers[w].segment.resize(fftSize);
+		m_workers[w].re.resize(bins);
+		m_workers[w].im.resize(bins);
+		m_workers[w].workRe.resize(fftSize / 2);
+		m_workers[w].workIm.resize(fftSize / 2);
+	}
+
+	m_pool.SetThreads(workers);
+
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+void RshSpectrumAnalyzer::Reset()
+{
+	for(size_t c = 0; c < m_channels.size(); ++c)
+	{
+		Channel& channel = m_channels[c];
+		channel.fill = 0;
+		channel.count = 0;
+		channel.completed = 0;
+		std::fill(channel.sum.begin(), channel.sum.end(), 0.0);
+	}
+	m_frames = 0;
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshSpectrumAnalyzer::Process(const RshBufferType<T, dataCode>& block, double scale)
+{
+	if(m_plan.Size() == 0)
+		return RSH_API_PARAMETER_NOTINITIALIZED;
+	if(block.Size() % m_channelCount != 0)
+		return RSH_API_BUFFER_WRONGSIZE;
+
+	const size_t frames = block.Size() / m_channelCount;
+	if(frames == 0)
+		return RSH_API_SUCCESS;
+
+	// separate channels, so segment processing works on contiguous data
+	for(U32 c = 0; c < m_channelCount; ++c)
+	{
+		std::vector<double>& input = m_channels[c].input;
+		if(input.size() < frames)
+			input.resize(frames);
+		const T* src = block.ptr + c;
+		for(size_t i = 0; i < frames; ++i)
+			input[i] = static_cast<double>(src[i * m_channelCount]) * scale;
+	}
+	m_frames = static_cast<U32>(frames);
+
+	m_pool.Run(&RshSpectrumAnalyzer::Routine, this, static_cast<U32>(m_workers.size()));
+	return RSH_API_SUCCESS;
+}
+
+U32 RshSpectrumAnalyzer::GetSpectrum(U32 channel, RSH_BUFFER_DPA_POWER_SPECTRUM& spectrum) const
+{
+	if(channel >= m_channels.size())
+		return RSH_API_PARAMETER_INVALID;
+
+	const Channel& ch = m_channels[channel];
+	if((m_averages == 0 && ch.count == 0) || (m_averages != 0 && ch.completed == 0))
+		return RSH_API_BUFFER_ISEMPTY;
+
+	const U32 bins = m_plan.Bins();
+	if(spectrum.PSize() < bins)
+	{
+		U32 st = spectrum.Allocate(bins);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	if(m_averages == 0)
+		Scale(ch.sum, ch.count, spectrum.ptr);
+	else
+		memcpy(spectrum.ptr, &ch.result[0], bins * sizeof(double));
+	spectrum.SetSize(bins);
+	return RSH_API_SUCCESS;
+}
+
+U32 RshSpectrumAnalyzer::GetWindow(RSH_BUFFER_DPA_WINDOW& window) const
+{
+	const U32 size = m_plan.Size();
+	if(size == 0)
+		return RSH_API_PARAMETER_NOTINITIALIZED;
+
+	if(window.PSize() < size)
+	{
+		U32 st = window.Allocate(size);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+	memcpy(window.ptr, &m_window[0], size * sizeof(double));
+	window.SetSize(size);
+	return RSH_API_SUCCESS;
+}
+
+U32 RshSpectrumAnalyzer::Transform(const RSH_BUFFER_DOUBLE& input, RSH_BUFFER_DPA_FFT_COMPLEX& output)
+{
+	const U32 size = m_plan.Size();
+	if(size == 0)
+		return RSH_API_PARAMETER_NOTINITIALIZED;
+	if(input.Size() < size)
+		return RSH_API_BUFFER_INSUFFICIENTSIZE;
+
+	const U32 bins = m_plan.Bins();
+	if(output.PSize() < 2 * bins)
+	{
+		U32 st = output.Allocate(2 * bins);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	Worker& worker = m_workers[0];
+	for(U32 i = 0; i < size; ++i)
+		worker.segment[i] = input.ptr[i] * m_window[i];
+	m_plan.Forward(&worker.segment[0], &worker.re[0], &worker.im[0], &worker.workRe[0], &worker.workIm[0]);
+
+	for(U32 k = 0; k < bins; ++k)
+	{
+		output.ptr[2 * k] = worker.re[k];
+		output.ptr[2 * k + 1] = worker.im[k];
+	}
+	output.SetSize(2 * bins);
+	return RSH_API_SUCCESS;
+}
+
+U64 RshSpectrumAnalyzer::Averages(U32 channel) const
+{
+	if(channel >= m_channels.size())
+		return 0;
+	return (m_averages == 0) ? m_channels[channel].count : m_channels[channel].completed;
+}
+
+U32 RshSpectrumAnalyzer::Bins() const
+{
+	return m_plan.Bins();
+}
+
+double RshSpectrumAnalyzer::FrequencyResolution() const
+{
+	return (m_plan.Size() == 0) ? 0.0 : m_sampleFrequency / m_plan.Size();
+}
+
+double RshSpectrumAnalyzer::NoiseBandwidth() const
+{
+	return m_noiseBandwidth;
+}
+
+void RshSpectrumAnalyzer::Routine(void* param, U32 part)
+{
+	RshSpectrumAnalyzer* analyzer = static_cast<RshSpectrumAnalyzer*>(param);
+	analyzer->ProcessChannels(analyzer->m_workers[part]);
+}
+
+void RshSpectrumAnalyzer::ProcessChannels(Worker& worker)
+{
+	const U32 size = m_plan.Size();
+	const U32 step = static_cast<U32>(m_workers.size());
+
+	for(U32 c = worker.first; c < m_channelCount; c += step)
+	{
+		Channel& channel = m_channels[c];
+		const double* src = &channel.input[0];
+		U32 left = m_frames;
+
+		while(left != 0)
+		{
+			const U32 n = (size - channel.fill < left) ? size - channel.fill : left;
+			memcpy(&channel.history[channel.fill], src, n * sizeof(double));
+			channel.fill += n;
+			src += n;
+			left -= n;
+
+			if(channel.fill == size)
+			{
+				Segment(channel, worker);
+				// keep overlapped part for next segment
+				if(m_hop < size)
+					memmove(&channel.history[0], &channel.history[m_hop], (size - m_hop) * sizeof(double));
+				channel.fill = size - m_hop;
+			}
+		}
+	}
+}
+
+void RshSpectrumAnalyzer::Segment(Channel& channel, Worker& worker)
+{
+	const U32 size = m_plan.Size();
+	const U32 bins = m_plan.Bins();
+	double* segment = &worker.segment[0];
+	const double* history = &channel.history[0];
+	const double* window = &m_window[0];
+
+	for(U32 i = 0; i < size; ++i)
+		segment[i] = history[i] * window[i];
+
+	m_plan.Forward(segment, &worker.re[0], &worker.im[0], &worker.workRe[0], &worker.workIm[0]);
+
+	double* sum = &channel.sum[0];
+	const double* re = &worker.re[0];
+	const double* im = &worker.im[0];
+	for(U32 k = 0; k < bins; ++k)
+		sum[k] += re[k] * re[k] + im[k] * im[k];
+	++channel.count;
+
+	if(m_averages != 0 && channel.count == m_averages)
+	{
+		Scale(channel.sum, channel.count, &channel.result[0]);
+		std::fill(channel.sum.begin(), channel.sum.end(), 0.0);
+		channel.count = 0;
+		++channel.completed;
+	}
+}
+
+void RshSpectrumAnalyzer::Scale(const std::vector<double>& sum, double count, double* dst) const
+{
+	// one-sided spectrum: all bins except DC and Nyquist get power of negative frequencies
+	const size_t last = sum.size() - 1;
+	const double scale = m_powerScale / count;
+	for(size_t k = 0; k <= last; ++k)
+		dst[k] = 2.0 * scale * sum[k];
+	dst[0] = scale * sum[0];
+	dst[last] = scale * sum[last];
+}
@@ -0,0 +1,352 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshSpectrumAnalyzer.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshFftPlan and RshSpectrumAnalyzer classes.
+ *
+ * Streaming power spectrum estimation of acquired data.
+ *
+ * \~russian
+ * \brief
+ * Классы RshFftPlan и RshSpectrumAnalyzer.
+ *
+ * Потоковая оценка спектра мощности собираемых данных.
+ *
+ */
+
+#ifndef RSH_SPECTRUM_ANALYZER_H
+#define RSH_SPECTRUM_ANALYZER_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshConsts.h"
+#include "RshThread.h"
+
+#include <vector>
+
+//! One-sided power spectrum, squared RMS volts per frequency bin
+typedef RshBufferType<double, rshDPADataFFTPowerSpectrum> RSH_BUFFER_DPA_POWER_SPECTRUM;
+
+//! Complex spectrum, real and imaginary parts of each bin follow each other
+typedef RshBufferType<double, rshDPADataFFTComplex> RSH_BUFFER_DPA_FFT_COMPLEX;
+
+//! Window function coefficients
+typedef RshBufferType<double, rshDPADataWindowFunction> RSH_BUFFER_DPA_WINDOW;
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Real input FFT plan
+ *
+ * Bit reversal and twiddle tables are calculated once in Create(),
+ * so transform itself makes no trigonometric calls and no memory
+ * allocation. Real signal of N samples is transformed as complex
+ * signal of N/2 samples with following split, which is about two
+ * times faster than complex FFT of size N.\n
+ * Plan is not changed by Forward(), so one plan can be used from
+ * several threads at once, each with its own work arrays.
+ *
+ * \~russian
+ * \brief
+ * План БПФ действительного сигнала
+ *
+ * Таблицы перестановки и поворачивающих множителей вычисляются один
+ * раз в методе Create(), поэтому при преобразовании не вызываются
+ * тригонометрические функции и не выделяется память. Действительный
+ * сигнал из N отсчетов преобразуется как комплексный сигнал из N/2
+ * отсчетов с последующим разделением, что примерно в два раза быстрее
+ * комплексного БПФ размера N.\n
+ * Метод Forward() не изменяет план, поэтому один план можно
+ * использовать одновременно из нескольких потоков, каждый со своими
+ * рабочими массивами.
+ *
+ */
+class RshFftPlan
+{
+public:
+
+	RshFftPlan();
+
+	//! \b size - transform size, power of two, not less than 4
+	U32 Create(U32 size);
+
+	//! Transform size, 0 if plan was not created
+	U32 Size() const;
+
+	//! Number of output bins, Size() / 2 + 1
+	U32 Bins() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Forward transform
+	 *
+	 * \param[in] input Size() real samples.
+	 * \param[out] re Bins() real parts of spectrum.
+	 * \param[out] im Bins() imaginary parts of spectrum.
+	 * \param[out] workRe Work array of Size() / 2 elements.
+	 * \param[out] workIm Work array of Size() / 2 elements.
+	 *
+	 * \~russian
+	 * \brief
+	 * Прямое преобразование
+	 *
+	 * \param[in] input Size() действительных отсчетов.
+	 * \param[out] re Bins() действительных частей спектра.
+	 * \param[out] im Bins() мнимых частей спектра.
+	 * \param[out] workRe Рабочий массив из Size() / 2 элементов.
+	 * \param[out] workIm Рабочий массив из Size() / 2 элементов.
+	 *
+	 */
+	void Forward(const double* input, double* re, double* im, double* workRe, double* workIm) const;
+
+private:
+
+	U32 m_size;
+	std::vector<U32> m_reverse;
+	// twiddles of all butterfly stages, stage with span h starts at index h - 1
+	std::vector<double> m_stageRe;
+	std::vector<double> m_stageIm;
+	// exp(-2*pi*i*k/N) for split of half size transform
+	std::vector<double> m_splitRe;
+	std::vector<double> m_splitIm;
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Streaming multichannel power spectrum analyzer
+ *
+ * Blocks returned by IRshDevice::GetData() are passed to Process()
+ * as is, samples of channels are interleaved. Each channel is split
+ * into overlapping segments, every segment is multiplied by window
+ * function and transformed with RshFftPlan, squared magnitudes are
+ * averaged (Welch method). Segments continue from block to block,
+ * so result does not depend on block size.\n
+ * Spectrum is one-sided and scaled so sine wave with amplitude A
+ * gives peak A^2/2 (squared RMS). Divide it by NoiseBandwidth()
+ * to get power spectral density.\n
+ * Channels are processed in parallel when more than one thread
+ * is set in Configure().
+ *
+ * \remarks
+ * Object must be used from one thread: Process() and GetSpectrum()
+ * must not be called at the same time.
+ *
+ * \~russian
+ * \brief
+ * Потоковый многоканальный анализатор спектра мощности
+ *
+ * Блоки, полученные методом IRshDevice::GetData(), передаются в
+ * Process() без изменений, отсчеты каналов чередуются. Данные каждого
+ * канала разбиваются на перекрывающиеся сегменты, каждый сегмент
+ * умножается на оконную функцию и преобразуется с помощью RshFftPlan,
+ * квадраты модулей усредняются (метод Уэлча). Сегменты продолжаются
+ * из блока в блок, поэтому результат не зависит от размера блока.\n
+ * Спектр односторонний и масштабирован так, что синусоида с амплитудой A
+ * дает пик A^2/2 (квадрат СКЗ). Для получения спектральной плотности
+ * мощности разделите его на NoiseBandwidth().\n
+ * Каналы обрабатываются параллельно, если в Configure() задано больше
+ * одного потока.
+ *
+ * \remarks
+ * Объект должен использоваться из одного потока: Process() и GetSpectrum()
+ * нельзя вызывать одновременно.
+ *
+ */
+class RshSpectrumAnalyzer
+{
+public:
+
+	//! Window functions
+	enum WindowType
+	{
+		//! No window
+		Rectangular = 0x0,
+		//! Hann window
+		Hann = 0x1,
+		//! Hamming window
+		Hamming = 0x2,
+		//! Blackman window
+		Blackman = 0x3,
+		//! 4-term Blackman-Harris window
+		BlackmanHarris = 0x4,
+		//! Flat top window, most precise amplitude of tones
+		FlatTop = 0x5
+	};
+
+	RshSpectrumAnalyzer();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Set analysis parameters
+	 *
+	 * Previous results are discarded.
+	 *
+	 * \param[in] fftSize Segment length, power of two, not less than 4.
+	 * \param[in] channels Number of channels interleaved in data blocks.
+	 * \param[in] sampleFrequency Sample frequency of one channel, Hz.
+	 * \param[in] window One of RshSpectrumAnalyzer::WindowType values.
+	 * \param[in] overlap Part of segment overlapped with next one, 0 <= overlap < 1.
+	 * \param[in] averages Number of segments averaged for one result,
+	 * 0 - running average of all segments since Reset().
+	 * \param[in] threads Number of threads processing channels.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID or
+	 * ::RSH_API_PARAMETER_NOTSUPPORTED for unknown window.
+	 *
+	 * \~russian
+	 * \brief
+	 * Установка параметров анализа
+	 *
+	 * Предыдущие результаты сбрасываются.
+	 *
+	 * \param[in] fftSize Длина сегмента, степень двойки, не меньше 4.
+	 * \param[in] channels Число каналов, чередующихся в блоках данных.
+	 * \param[in] sampleFrequency Частота дискретизации одного канала, Гц.
+	 * \param[in] window Одно из значений RshSpectrumAnalyzer::WindowType.
+	 * \param[in] overlap Доля перекрытия сегмента со следующим, 0 <= overlap < 1.
+	 * \param[in] averages Число сегментов, усредняемых для одного результата,
+	 * 0 - скользящее среднее всех сегментов после Reset().
+	 * \param[in] threads Число потоков обработки каналов.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID или
+	 * ::RSH_API_PARAMETER_NOTSUPPORTED для неизвестного окна.
+	 *
+	 */
+	U32 Configure(U32 fftSize, U32 channels, double sampleFrequency, U32 window = Hann, double overlap = 0.5, U32 averages = 0, U32 threads = 1);
+
+	//! Discard accumulated data and results
+	void Reset();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Process acquired block
+	 *
+	 * \param[in] block Interleaved samples of all channels,
+	 * RshBufferType::Size() must be multiple of number of channels.
+	 * \param[in] scale Samples are multiplied by this value
+	 * (for example, volts per code for integer buffers).
+	 *
+	 * \~russian
+	 * \brief
+	 * Обработка полученного блока
+	 *
+	 * \param[in] block Чередующиеся отсчеты всех каналов,
+	 * RshBufferType::Size() должен быть кратен числу каналов.
+	 * \param[in] scale Отсчеты умножаются на это значение
+	 * (например, вольт на код для целочисленных буферов).
+	 *
+	 */
+	template<typename T, RshDataTypes dataCode>
+	U32 Process(const RshBufferType<T, dataCode>& block, double scale = 1.0);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Averaged power spectrum of channel
+	 *
+	 * Buffer is resized to Bins() elements, element k
+	 * corresponds to frequency k * FrequencyResolution().
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_BUFFER_ISEMPTY if
+	 * no result is ready yet.
+	 *
+	 * \~russian
+	 * \brief
+	 * Усредненный спектр мощности канала
+	 *
+	 * Размер буфера устанавливается равным Bins(), элемент k
+	 * соответствует частоте k * FrequencyResolution().
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_BUFFER_ISEMPTY,
+	 * если результат еще не готов.
+	 *
+	 */
+	U32 GetSpectrum(U32 channel, RSH_BUFFER_DPA_POWER_SPECTRUM& spectrum) const;
+
+	//! Window coefficients, buffer is resized to FFT size
+	U32 GetWindow(RSH_BUFFER_DPA_WINDOW& window) const;
+
+	//! Windowed FFT of first FFT size samples of \b input, without scaling. \b output gets Bins() complex values.
+	U32 Transform(const RSH_BUFFER_DOUBLE& input, RSH_BUFFER_DPA_FFT_COMPLEX& output);
+
+	//! Completed results of channel (\b averages > 0) or segments in running average (\b averages = 0)
+	U64 Averages(U32 channel) const;
+
+	//! Number of spectrum bins
+	U32 Bins() const;
+
+	//! Distance between bins, Hz
+	double FrequencyResolution() const;
+
+	//! Equivalent noise bandwidth of one bin, Hz
+	double NoiseBandwidth() const;
+
+private:
+
+	RshSpectrumAnalyzer(const RshSpectrumAnalyzer&);
+	RshSpectrumAnalyzer& operator=(const RshSpectrumAnalyzer&);
+
+	struct Channel
+	{
+		Channel() : fill(0), count(0), completed(0) {}
+
+		std::vector<double> input;
+		std::vector<double> history;
+		std::vector<double> sum;
+		std::vector<double> result;
+		U32 fill;
+		U32 count;
+		U64 completed;
+	};
+
+	struct Worker
+	{
+		Worker() : first(0) {}
+
+		U32 first;
+		std::vector<double> segment;
+		std::vector<double> re;
+		std::vector<double> im;
+		std::vector<double> workRe;
+		std::vector<double> workIm;
+	};
+
+	static void Routine(void* param, U32 part);
+	void ProcessChannels(Worker& worker);
+	void Segment(Channel& channel, Worker& worker);
+	void Scale(const std::vector<double>& sum, double count, double* dst) const;
+
+	RshFftPlan m_plan;
+	U32 m_channelCount;
+	U32 m_hop;
+	U32 m_averages;
+	U32 m_frames;
+	double m_sampleFrequency;
+	double m_powerScale;
+	double m_noiseBandwidth;
+	std::vector<double> m_window;
+	std::vector<Channel> m_channels;
+	std::vector<Worker> m_workers;
+	RshWorkerPool m_pool;
+};
+
+#endif //RSH_SPECTRUM_ANALYZER_H
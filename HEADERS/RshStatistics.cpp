@@ -0,0 +1,336 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshStatistics.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshStatistics and RshStreamStatistics classes.
+ *
+ * \~russian
+ * \brief
+ * Классы RshStatistics и RshStreamStatistics.
+ *
+ */
+
+#include "RshStatistics.h"
+#include "RshConsts.h"
+
+#include <cmath>
+
+// arrays are processed in parts of this size, so second pass reads data from cache
+#define RSH_STATISTICS_PART 1024
+
+RshStatistics::RshStatistics()
+{
+	Reset();
+}
+
+void RshStatistics::Reset()
+{
+	m_count = 0;
+	m_mean = 0.0;
+	m_m2 = 0.0;
+	m_min = 0.0;
+	m_max = 0.0;
+}
+
+void RshStatistics::Add(double value)
+{
+	if(m_count == 0)
+	{
+		m_min = value;
+		m_max = value;
+	}
+	else
+	{
+		m_min = (value < m_min) ? value : m_min;
+		m_max = (value > m_max) ? value : m_max;
+	}
+
+	++m_count;
+	const double delta = value - m_mean;
+	m_mean += delta / static_cast<double>(m_count);
+	m_m2 += delta * (value - m_mean);
+}
+
+void RshStatistics::Add(const double* values, size_t count)
+{
+	for(size_t done = 0; done < count; done += RSH_STATISTICS_PART)
+	{
+		const size_t n = (count - done < RSH_STATISTICS_PART) ? count - done : RSH_STATISTICS_PART;
+		const double* v = values + done;
+		const size_t full = n - n % 4;
+
+		// sum, minimum and maximum of part, four samples per pass
+		double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double mn[4] = { v[0], v[0], v[0], v[0] };
+		double mx[4] = { v[0], v[0], v[0], v[0] };
+		for(size_t i = 0; i < full; i += 4)
+			for(int l = 0; l < 4; ++l)
+			{
+				const double x = v[i + l];
+				sum[l] += x;
+				mn[l] = (x < mn[l]) ? x : mn[l];
+				mx[l] = (x > mx[l]) ? x : mx[l];
+			}
+		for(size_t i = full; i < n; ++i)
+		{
+			sum[0] += v[i];
+			mn[0] = (v[i] < mn[0]) ? v[i] : mn[0];
+			mx[0] = (v[i] > mx[0]) ? v[i] : mx[0];
+		}
+
+		RshStatistics part;
+		part.m_count = n;
+		part.m_mean = ((sum[0] + sum[1]) + (sum[2] + sum[3])) / static_cast<double>(n);
+		part.m_min = mn[0];
+		part.m_max = mx[0];
+		for(int l = 1; l < 4; ++l)
+		{
+			part.m_min = (mn[l] < part.m_min) ? mn[l] : part.m_min;
+			part.m_max = (mx[l] > part.m_max) ? mx[l] : part.m_max;
+		}
+
+		// deviations from exact mean of part, no cancellation as in sum of squares
+		double m2[4] = { 0.0, 0.0, 0.0, 0.0 };
+		const double mean = part.m_mean;
+		for(size_t i = 0; i < full; i += 4)
+			for(int l = 0; l < 4; ++l)
+			{
+				const double d = v[i + l] - mean;
+				m2[l] += d * d;
+			}
+		for(size_t i = full; i < n; ++i)
+		{
+			const double d = v[i] - mean;
+			m2[0] += d * d;
+		}
+		part.m_m2 = (m2[0] + m2[1]) + (m2[2] + m2[3]);
+
+		Merge(part);
+	}
+}
+
+void RshStatistics::Merge(const RshStatistics& obj)
+{
+	if(obj.m_count == 0)
+		return;
+	if(m_count == 0)
+	{
+		*this = obj;
+		return;
+	}
+
+	const double na = static_cast<double>(m_count);
+	const double nb = static_cast<double>(obj.m_count);
+	const double n = na + nb;
+	const double delta = obj.m_mean - m_mean;
+
+	m_mean += delta * (nb / n);
+	m_m2 += obj.m_m2 + delta * delta * (na * nb / n);
+	m_count += obj.m_count;
+	m_min = (obj.m_min < m_min) ? obj.m_min : m_min;
+	m_max = (obj.m_max > m_max) ? obj.m_max : m_max;
+}
+
+U64 RshStatistics::Count() const
+{
+	return m_count;
+}
+
+double RshStatistics::Min() const
+{
+	return m_min;
+}
+
+double RshStatistics::Max() const
+{
+	return m_max;
+}
+
+double RshStatistics::PeakToPeak() const
+{
+	return m_max - m_min;
+}
+
+double RshStatistics::Mean() const
+{
+	return m_mean;
+}
+
+double RshStatistics::Variance() const
+{
+	return (m_count == 0) ? 0.0 : m_m2 / static_cast<double>(m_count);
+}
+
+double RshStatistics::StdDev() const
+{
+	return sqrt(Variance());
+}
+
+double RshStatistics::Rms() const
+{
+	return sqrt(m_mean * m_mean + Variance());
+}
+
+// returned for channel out of range
+static const RshStatistics rshStatisticsEmpty;
+
+RshStreamStatistics::RshStreamStatistics(U32 channels) :
+	m_channelCount(1),
+	m_stepSize(0),
+	m_steps(0),
+	m_stepFill(0),
+	m_windowHead(0),
+	m_windowCount(0),
+	m_channels(1),
+	m_chunk(chunkSize)
+{
+	SetChannels(channels);
+}
+
+U32 RshStreamStatistics::SetChannels(U32 channels)
+{
+	if(channels == 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_channelCount = channels;
+	m_channels.assign(channels, Channel());
+	for(U32 c = 0; c < channels; ++c)
+		m_channels[c].window.resize(m_steps);
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+U32 RshStreamStatistics::SetWindow(U32 stepSize, U32 steps)
+{
+	if(stepSize != 0 && steps == 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	m_stepSize = stepSize;
+	m_steps = (stepSize == 0) ? 0 : steps;
+	for(U32 c = 0; c < m_channelCount; ++c)
+		m_channels[c].window.assign(m_steps, RshStatistics());
+	Reset();
+	return RSH_API_SUCCESS;
+}
+
+void RshStreamStatistics::Reset()
+{
+	for(U32 c = 0; c < m_channelCount; ++c)
+	{
+		Channel& channel = m_channels[c];
+		channel.total.Reset();
+		channel.block.Reset();
+		channel.step.Reset();
+		for(size_t s = 0; s < channel.window.size(); ++s)
+			channel.window[s].Reset();
+	}
+	m_stepFill = 0;
+	m_windowHead = 0;
+	m_windowCount = 0;
+}
+
+template<typename T, RshDataTypes dataCode>
+U32 RshStreamStatistics::Process(const RshBufferType<T, dataCode>& block, double scale)
+{
+	if(block.Size() % m_channelCount != 0)
+		return RSH_API_BUFFER_WRONGSIZE;
+
+	for(U32 c = 0; c < m_channelCount; ++c)
+		m_channels[c].block.Reset();
+
+	const size_t frames = block.Size() / m_channelCount;
+	double* chunk = &m_chunk[0];
+	size_t done = 0;
+
+	while(done < frames)
+	{
+		size_t n = (frames - done < static_cast<size_t>(chunkSize)) ? frames - done : static_cast<size_t>(chunkSize);
+		// part never crosses window step boundary
+		if(m_stepSize != 0 && n > m_stepSize - m_stepFill)
+			n = m_stepSize - m_stepFill;
+
+		for(U32 c = 0; c < m_channelCount; ++c)
+		{
+			const T* src = block.ptr + done * m_channelCount + c;
+			for(size_t i = 0; i < n; ++i)
+				chunk[i] = static_cast<double>(src[i * m_channelCount]) * scale;
+			Accumulate(m_channels[c], chunk, n);
+		}
+		done += n;
+
+		if(m_stepSize != 0)
+		{
+			m_stepFill += static_cast<U32>(n);
+			if(m_stepFill == m_stepSize)
+			{
+				for(U32 c = 0; c < m_channelCount; ++c)
+				{
+					m_channels[c].window[m_windowHead] = m_channels[c].step;
+					m_channels[c].step.Reset();
+				}
+				m_windowHead = (m_windowHead + 1) % m_steps;
+				if(m_windowCount < m_steps)
+					++m_windowCount;
+				m_stepFill = 0;
+			}
+		}
+	}
+
+	return RSH_API_SUCCESS;
+}
+
+U32 RshStreamStatistics::Merge(const RshStreamStatistics& obj)
+{
+	if(obj.m_channelCount != m_channelCount)
+		return RSH_API_PARAMETER_INVALID;
+
+	for(U32 c = 0; c < m_channelCount; ++c)
+		m_channels[c].total.Merge(obj.m_channels[c].total);
+	return RSH_API_SUCCESS;
+}
+
+U32 RshStreamStatistics::Channels() const
+{
+	return m_channelCount;
+}
+
+const RshStatistics& RshStreamStatistics::Total(U32 channel) const
+{
+	if(channel >= m_channelCount)
+		return rshStatisticsEmpty;
+	return m_channels[channel].total;
+}
+
+const RshStatistics& RshStreamStatistics::Block(U32 channel) const
+{
+	if(channel >= m_channelCount)
+		return rshStatisticsEmpty;
+	return m_channels[channel].block;
+}
+
+RshStatistics RshStreamStatistics::Window(U32 channel) const
+{
+	RshStatistics result;
+	if(channel >= m_channelCount)
+		return result;
+	const Channel& ch = m_channels[channel];
+	for(U32 s = 0; s < m_windowCount; ++s)
+		result.Merge(ch.window[s]);
+	return result;
+}
+
+void RshStreamStatistics::Accumulate(Channel& channel, const double* values, size_t count)
+{
+	RshStatistics part;
+	part.Add(values, count);
+
+	channel.total.Merge(part);
+	channel.block.Merge(part);
+	if(m_stepSize != 0)
+		channel.step.Merge(part);
+}
@@ -0,0 +1,242 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshStatistics.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshStatistics and RshStreamStatistics classes.
+ *
+ * Single pass statistics of acquired data.
+ *
+ * \~russian
+ * \brief
+ * Классы RshStatistics и RshStreamStatistics.
+ *
+ * Статистика собираемых данных за один проход.
+ *
+ */
+
+#ifndef RSH_STATISTICS_H
+#define RSH_STATISTICS_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshConsts.h"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Statistics accumulator
+ *
+ * Keeps number of values, minimum, maximum, mean and sum of squared
+ * deviations from mean, samples are not stored. Mean and deviation
+ * are updated with Welford method, arrays are processed in chunks
+ * and chunk results are combined with the same stable formula
+ * (Chan et al.), so there is no loss of precision when signal has
+ * large constant offset or when billions of values are accumulated.\n
+ * Accumulators filled in different threads are combined by Merge().
+ *
+ * \~russian
+ * \brief
+ * Накопитель статистики
+ *
+ * Хранит число значений, минимум, максимум, среднее и сумму квадратов
+ * отклонений от среднего, сами отсчеты не сохраняются. Среднее и
+ * отклонение обновляются методом Уэлфорда, массивы обрабатываются
+ * частями, результаты частей объединяются по той же устойчивой формуле
+ * (Chan et al.), поэтому точность не теряется при большом постоянном
+ * смещении сигнала и при накоплении миллиардов значений.\n
+ * Накопители, заполненные в разных потоках, объединяются методом Merge().
+ *
+ */
+class RshStatistics
+{
+public:
+
+	RshStatistics();
+
+	//! Discard all values
+	void Reset();
+
+	//! Add one value
+	void Add(double value);
+
+	//! Add array of values
+	void Add(const double* values, size_t count);
+
+	//! Add values accumulated by other object
+	void Merge(const RshStatistics& obj);
+
+	//! Number of values
+	U64 Count() const;
+
+	//! Minimum value, 0 if there are no values
+	double Min() const;
+
+	//! Maximum value, 0 if there are no values
+	double Max() const;
+
+	//! Max() - Min()
+	double PeakToPeak() const;
+
+	//! Mean value
+	double Mean() const;
+
+	//! Population variance (sum of squared deviations divided by Count())
+	double Variance() const;
+
+	//! Square root of Variance()
+	double StdDev() const;
+
+	//! Root mean square of values
+	double Rms() const;
+
+private:
+
+	U64 m_count;
+	double m_mean;
+	double m_m2;
+	double m_min;
+	double m_max;
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Statistics of multichannel data stream
+ *
+ * Blocks returned by IRshDevice::GetData() are passed to Process()
+ * as is, samples of channels are interleaved. For every channel
+ * following results are available at once:
+ * - Total() - all samples since Reset();
+ * - Block() - samples of last processed block;
+ * - Window() - last samples in sliding window (see SetWindow()).
+ *
+ * Sliding window is kept as statistics of its steps, so memory does
+ * not depend on window length.
+ *
+ * \~russian
+ * \brief
+ * Статистика многоканального потока данных
+ *
+ * Блоки, полученные методом IRshDevice::GetData(), передаются в
+ * Process() без изменений, отсчеты каналов чередуются. Для каждого
+ * канала одновременно доступны результаты:
+ * - Total() - все отсчеты после Reset();
+ * - Block() - отсчеты последнего обработанного блока;
+ * - Window() - последние отсчеты в скользящем окне (см. SetWindow()).
+ *
+ * Скользящее окно хранится как статистика его шагов, поэтому объем
+ * памяти не зависит от длины окна.
+ *
+ */
+class RshStreamStatistics
+{
+public:
+
+	explicit RshStreamStatistics(U32 channels = 1);
+
+	//! Set number of interleaved channels, accumulated data is discarded
+	U32 SetChannels(U32 channels);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Set sliding window
+	 *
+	 * Window contains \b steps * \b stepSize samples of each channel
+	 * and moves by \b stepSize samples. Window() returns statistics
+	 * of last \b steps completed steps. Accumulated data is discarded.
+	 *
+	 * \param[in] stepSize Samples of one channel in step, 0 - no window.
+	 * \param[in] steps Number of steps in window.
+	 *
+	 * \~russian
+	 * \brief
+	 * Установка скользящего окна
+	 *
+	 * Окно содержит \b steps * \b stepSize отсчетов каждого канала
+	 * и сдвигается на \b stepSize отсчетов. Window() возвращает статистику
+	 * последних \b steps завершенных шагов. Накопленные данные сбрасываются.
+	 *
+	 * \param[in] stepSize Отсчетов одного канала в шаге, 0 - окно не используется.
+	 * \param[in] steps Число шагов в окне.
+	 *
+	 */
+	U32 SetWindow(U32 stepSize, U32 steps);
+
+	//! Discard accumulated data
+	void Reset();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Process acquired block
+	 *
+	 * \param[in] block Interleaved samples of all channels,
+	 * RshBufferType::Size() must be multiple of number of channels.
+	 * \param[in] scale Samples are multiplied by this value
+	 * (for example, volts per code for integer buffers).
+	 *
+	 * \~russian
+	 * \brief
+	 * Обработка полученного блока
+	 *
+	 * \param[in] block Чередующиеся отсчеты всех каналов,
+	 * RshBufferType::Size() должен быть кратен числу каналов.
+	 * \param[in] scale Отсчеты умножаются на это значение
+	 * (например, вольт на код для целочисленных буферов).
+	 *
+	 */
+	template<typename T, RshDataTypes dataCode>
+	U32 Process(const RshBufferType<T, dataCode>& block, double scale = 1.0);
+
+	//! Add Total() of other object with same number of channels, for example filled in other thread
+	U32 Merge(const RshStreamStatistics& obj);
+
+	//! Number of channels
+	U32 Channels() const;
+
+	//! All samples of channel since Reset(), empty if channel is out of range
+	const RshStatistics& Total(U32 channel) const;
+
+	//! Samples of channel in last processed block, empty if channel is out of range
+	const RshStatistics& Block(U32 channel) const;
+
+	//! Samples of channel in sliding window, empty if channel is out of range
+	RshStatistics Window(U32 channel) const;
+
+private:
+
+	enum { chunkSize = 1024 };
+
+	struct Channel
+	{
+		RshStatistics total;
+		RshStatistics block;
+		RshStatistics step;
+		std::vector<RshStatistics> window;
+	};
+
+	void Accumulate(Channel& channel, const double* values, size_t count);
+
+	U32 m_channelCount;
+	U32 m_stepSize;
+	U32 m_steps;
+	U32 m_stepFill;
+	U32 m_windowHead;
+	U32 m_windowCount;
+	std::vector<Channel> m_channels;
+	std::vector<double> m_chunk;
+};
+
+#endif //RSH_STATISTICS_H
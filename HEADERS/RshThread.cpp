@@ -0,0 +1,314 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshThread.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshThread class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshThread.
+ *
+ */
+
+#include "RshThread.h"
+#include "RshConsts_StatusCodes.h"
+#include "RshConsts_Common.h"
+
+RshThread::RshThread() :
+	m_running(false)
+{
+	m_params.routine = 0;
+	m_params.param = 0;
+#if defined(RSH_MSWINDOWS)
+	m_handle = 0;
+#endif
+}
+
+RshThread::~RshThread()
+{
+	Join();
+}
+
+U32 RshThread::Start(RoutineType routine, void* param)
+{
+	if(routine == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(m_running)
+		return RSH_API_THREAD_CANTCREATE;
+
+	m_params.routine = routine;
+	m_params.param = param;
+
+#if defined(RSH_MSWINDOWS)
+	m_handle = (HANDLE)_beginthreadex(0, 0, &RshThread::ThreadProc, &m_params, 0, 0);
+	if(m_handle == 0)
+		return RSH_API_THREAD_CANTCREATE;
+#elif defined(RSH_LINUX)
+	if(pthread_create(&m_handle, 0, &RshThread::ThreadProc, &m_params) != 0)
+		return RSH_API_THREAD_CANTCREATE;
+#endif
+
+	m_running = true;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshThread::Join()
+{
+	if(!m_running)
+		return RSH_API_SUCCESS;
+
+#if defined(RSH_MSWINDOWS)
+	if(::WaitForSingleObject(m_handle, INFINITE) != WAIT_OBJECT_0)
+		return RSH_API_THREAD_CANTTERMINATE;
+	::CloseHandle(m_handle);
+	m_handle = 0;
+#elif defined(RSH_LINUX)
+	if(pthread_join(m_handle, 0) != 0)
+		return RSH_API_THREAD_CANTTERMINATE;
+#endif
+
+	m_running = false;
+	return RSH_API_SUCCESS;
+}
+
+bool RshThread::IsRunning() const
+{
+	return m_running;
+}
+
+#if defined(RSH_MSWINDOWS)
+unsigned __stdcall RshThread::ThreadProc(void* arg)
+{
+	StartParams* p = static_cast<StartParams*>(arg);
+	p->routine(p->param);
+	return 0;
+}
+#elif defined(RSH_LINUX)
+void* RshThread::ThreadProc(void* arg)
+{
+	StartParams* p = static_cast<StartParams*>(arg);
+	p->routine(p->param);
+	return 0;
+}
+#endif
+
+RshMutex::RshMutex()
+{
+#if defined(RSH_MSWINDOWS)
+	::InitializeCriticalSection(&m_cs);
+#elif defined(RSH_LINUX)
+	pthread_mutex_init(&m_mutex, 0);
+#endif
+}
+
+RshMutex::~RshMutex()
+{
+#if defined(RSH_MSWINDOWS)
+	::DeleteCriticalSection(&m_cs);
+#elif defined(RSH_LINUX)
+	pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+void RshMutex::Lock()
+{
+#if defined(RSH_MSWINDOWS)
+	::EnterCriticalSection(&m_cs);
+#elif defined(RSH_LINUX)
+	pthread_mutex_lock(&m_mutex);
+#endif
+}
+
+void RshMutex::Unlock()
+{
+#if defined(RSH_MSWINDOWS)
+	::LeaveCriticalSection(&m_cs);
+#elif defined(RSH_LINUX)
+	pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+RshEvent::RshEvent()
+{
+#if defined(RSH_MSWINDOWS)
+	m_handle = ::CreateEvent(0, FALSE, FALSE, 0);
+#elif defined(RSH_LINUX)
+	pthread_mutex_init(&m_mutex, 0);
+	// monotonic clock, so timeout does not depend on system time changes
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&m_cond, &attr);
+	pthread_condattr_destroy(&attr);
+	m_signaled = false;
+#endif
+}
+
+RshEvent::~RshEvent()
+{
+#if defined(RSH_MSWINDOWS)
+	if(m_handle != 0)
+		::CloseHandle(m_handle);
+#elif defined(RSH_LINUX)
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+void RshEvent::Set()
+{
+#if defined(RSH_MSWINDOWS)
+	::SetEvent(m_handle);
+#elif defined(RSH_LINUX)
+	pthread_mutex_lock(&m_mutex);
+	m_signaled = true;
+	pthread_cond_signal(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+void RshEvent::Reset()
+{
+#if defined(RSH_MSWINDOWS)
+	::ResetEvent(m_handle);
+#elif defined(RSH_LINUX)
+	pthread_mutex_lock(&m_mutex);
+	m_signaled = false;
+	pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+U32 RshEvent::Wait(U32 timeout)
+{
+#if defined(RSH_MSWINDOWS)
+	return (::WaitForSingleObject(m_handle, (timeout == RSH_INFINITE_WAIT_TIME) ? INFINITE : timeout) == WAIT_OBJECT_0) ?
+		RSH_API_SUCCESS : RSH_API_EVENT_WAITTIMEOUT;
+#elif defined(RSH_LINUX)
+	struct timespec deadline;
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeout / 1000;
+	deadline.tv_nsec += static_cast<long>(timeout % 1000) * 1000000L;
+	if(deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_nsec -= 1000000000L;
+		++deadline.tv_sec;
+	}
+
+	pthread_mutex_lock(&m_mutex);
+	while(!m_signaled)
+	{
+		const int r = (timeout == RSH_INFINITE_WAIT_TIME) ? pthread_cond_wait(&m_cond, &m_mutex) :
+			pthread_cond_timedwait(&m_cond, &m_mutex, &deadline);
+		if(r != 0 && r != EINTR)
+			break;
+	}
+	const bool signaled = m_signaled;
+	m_signaled = false;
+	pthread_mutex_unlock(&m_mutex);
+	return signaled ? RSH_API_SUCCESS : RSH_API_EVENT_WAITTIMEOUT;
+#endif
+}
+
+RshWorkerPool::RshWorkerPool() :
+	m_threads(1),
+	m_workers(0),
+	m_routine(0),
+	m_param(0),
+	m_parts(0),
+	m_quit(false)
+{
+}
+
+RshWorkerPool::~RshWorkerPool()
+{
+	Stop();
+}
+
+U32 RshWorkerPool::SetThreads(U32 threads)
+{
+	Stop();
+
+	m_threads = (threads == 0) ? 1 : threads;
+	if(m_threads == 1)
+		return RSH_API_SUCCESS;
+
+	// calling thread processes part 0
+	m_quit = false;
+	m_workers = new Worker[m_threads - 1];
+	for(U32 w = 0; w < m_threads - 1; ++w)
+	{
+		Worker& worker = m_workers[w];
+		worker.pool = this;
+		worker.part = w + 1;
+		worker.started = (worker.thread.Start(&RshWorkerPool::Routine, &worker) == RSH_API_SUCCESS);
+	}
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWorkerPool::Threads() const
+{
+	return m_threads;
+}
+
+void RshWorkerPool::Run(RoutineType routine, void* param, U32 parts)
+{
+	if(parts > m_threads)
+		parts = m_threads;
+	if(parts == 0)
+		return;
+
+	m_routine = routine;
+	m_param = param;
+	m_parts = parts;
+	for(U32 w = 0; w + 1 < parts; ++w)
+		if(m_workers[w].started)
+			m_workers[w].start.Set();
+
+	routine(param, 0);
+
+	for(U32 w = 0; w + 1 < parts; ++w)
+	{
+		if(m_workers[w].started)
+			m_workers[w].done.Wait(RSH_INFINITE_WAIT_TIME);
+		else
+			routine(param, m_workers[w].part);
+	}
+}
+
+void RshWorkerPool::Routine(void* param)
+{
+	Worker* worker = static_cast<Worker*>(param);
+	RshWorkerPool* pool = worker->pool;
+	for(;;)
+	{
+		worker->start.Wait(RSH_INFINITE_WAIT_TIME);
+		if(pool->m_quit)
+			break;
+		pool->m_routine(pool->m_param, worker->part);
+		worker->done.Set();
+	}
+}
+
+void RshWorkerPool::Stop()
+{
+	if(m_workers == 0)
+		return;
+
+	m_quit = true;
+	for(U32 w = 0; w < m_threads - 1; ++w)
+	{
+		if(m_workers[w].started)
+		{
+			m_workers[w].start.Set();
+			m_workers[w].thread.Join();
+		}
+	}
+	delete[] m_workers;
+	m_workers = 0;
+	m_threads = 1;
+}
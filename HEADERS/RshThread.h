@@ -0,0 +1,380 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshThread.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshThread class.
+ *
+ * Minimal portable worker thread, mutex and event wrappers and pool
+ * of worker threads.
+ *
+ * \~russian
+ * \brief
+ * Класс RshThread.
+ *
+ * Простые кроссплатформенные обертки для рабочего потока, мьютекса и события
+ * и пул рабочих потоков.
+ *
+ */
+
+#ifndef RSH_THREAD_H
+#define RSH_THREAD_H
+
+#include "RshDefChk.h"
+
+#if defined(RSH_LINUX)
+	#include <pthread.h>
+	#include <time.h>
+#endif
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Portable worker thread
+ *
+ * Starts user routine in separate thread and waits for
+ * its completion. Object can not be copied.
+ *
+ * \remarks
+ * On Linux application must be linked with pthread library (-lpthread).
+ *
+ * \~russian
+ * \brief
+ * Кроссплатформенный рабочий поток
+ *
+ * Запускает пользовательскую функцию в отдельном потоке
+ * и ожидает её завершения. Объект не может быть скопирован.
+ *
+ * \remarks
+ * В Linux приложение необходимо собирать с библиотекой pthread (-lpthread).
+ *
+ */
+class RshThread
+{
+public:
+
+	//! Thread routine type
+	typedef void (*RoutineType)(void* param);
+
+	RshThread();
+	~RshThread();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Start thread
+	 *
+	 * \param[in] routine Function to be executed in thread.
+	 * \param[in] param Parameter passed to routine.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_THREAD_CANTCREATE.
+	 *
+	 * \~russian
+	 * \brief
+	 * Запуск потока
+	 *
+	 * \param[in] routine Функция, выполняемая в потоке.
+	 * \param[in] param Параметр, передаваемый в функцию.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_THREAD_CANTCREATE.
+	 *
+	 */
+	U32 Start(RoutineType routine, void* param);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Wait for thread routine to return
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_THREAD_CANTTERMINATE.
+	 *
+	 * \~russian
+	 * \brief
+	 * Ожидание завершения функции потока
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_THREAD_CANTTERMINATE.
+	 *
+	 */
+	U32 Join();
+
+	bool IsRunning() const;
+
+private:
+
+	RshThread(const RshThread&);
+	RshThread& operator=(const RshThread&);
+
+	struct StartParams
+	{
+		RoutineType routine;
+		void* param;
+	};
+
+#if defined(RSH_MSWINDOWS)
+	static unsigned __stdcall ThreadProc(void* arg);
+	HANDLE m_handle;
+#elif defined(RSH_LINUX)
+	static void* ThreadProc(void* arg);
+	pthread_t m_handle;
+#endif
+
+	StartParams m_params;
+	bool m_running;
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Portable non-recursive mutex
+ *
+ * \~russian
+ * \brief
+ * Кроссплатформенный нерекурсивный мьютекс
+ *
+ */
+class RshMutex
+{
+public:
+
+	RshMutex();
+	~RshMutex();
+
+	void Lock();
+	void Unlock();
+
+private:
+
+	RshMutex(const RshMutex&);
+	RshMutex& operator=(const RshMutex&);
+
+#if defined(RSH_MSWINDOWS)
+	CRITICAL_SECTION m_cs;
+#elif defined(RSH_LINUX)
+	pthread_mutex_t m_mutex;
+#endif
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Locks mutex for the lifetime of the object
+ *
+ * \~russian
+ * \brief
+ * Захватывает мьютекс на время жизни объекта
+ *
+ */
+class RshMutexLocker
+{
+public:
+
+	explicit RshMutexLocker(RshMutex& mutex) : m_mutex(mutex) { m_mutex.Lock(); }
+	~RshMutexLocker() { m_mutex.Unlock(); }
+
+private:
+
+	RshMutexLocker(const RshMutexLocker&);
+	RshMutexLocker& operator=(const RshMutexLocker&);
+
+	RshMutex& m_mutex;
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Portable auto reset event
+ *
+ * Set() wakes one waiting thread, or next Wait() call if no thread
+ * is waiting. Event is reset when Wait() returns.
+ *
+ * \~russian
+ * \brief
+ * Кроссплатформенное событие с автоматическим сбросом
+ *
+ * Set() будит один ожидающий поток, или следующий вызов Wait(), если
+ * ожидающих потоков нет. Событие сбрасывается при выходе из Wait().
+ *
+ */
+class RshEvent
+{
+public:
+
+	RshEvent();
+	~RshEvent();
+
+	void Set();
+
+	//! Clear signal set before
+	void Reset();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Wait for signal
+	 *
+	 * \param[in] timeout Time to wait, ms, or ::RSH_INFINITE_WAIT_TIME.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_EVENT_WAITTIMEOUT.
+	 *
+	 * \~russian
+	 * \brief
+	 * Ожидание сигнала
+	 *
+	 * \param[in] timeout Время ожидания, мс, или ::RSH_INFINITE_WAIT_TIME.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_EVENT_WAITTIMEOUT.
+	 *
+	 */
+	U32 Wait(U32 timeout);
+
+private:
+
+	RshEvent(const RshEvent&);
+	RshEvent& operator=(const RshEvent&);
+
+#if defined(RSH_MSWINDOWS)
+	HANDLE m_handle;
+#elif defined(RSH_LINUX)
+	pthread_mutex_t m_mutex;
+	pthread_cond_t m_cond;
+	bool m_signaled;
+#endif
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Persistent worker threads for parallel processing of parts
+ *
+ * SetThreads() starts threads - 1 threads, which wait on events
+ * between calls of Run(), so processing of each block does not
+ * create threads. Run() processes first part in calling thread.
+ * Used by RshDecimator, RshSpectrumAnalyzer and RshCompressor.
+ *
+ * \remarks
+ * Run() must be called from one thread at a time.
+ *
+ * \~russian
+ * \brief
+ * Постоянные рабочие потоки для параллельной обработки частей
+ *
+ * SetThreads() запускает threads - 1 потоков, которые ожидают событий
+ * между вызовами Run(), поэтому обработка каждого блока не создает
+ * потоков. Run() обрабатывает первую часть в вызывающем потоке.
+ * Используется в RshDecimator, RshSpectrumAnalyzer и RshCompressor.
+ *
+ * \remarks
+ * Run() должен вызываться одновременно только из одного потока.
+ *
+ */
+class RshWorkerPool
+{
+public:
+
+	//! Routine processing part with index \b part
+	typedef void (*RoutineType)(void* param, U32 part);
+
+	RshWorkerPool();
+	~RshWorkerPool();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Set number of parts processed in parallel
+	 *
+	 * Threads of previous call are stopped. If thread can not be
+	 * created, its part is processed in calling thread.
+	 *
+	 * \param[in] threads Number of threads including calling one, 0 is 1.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS.
+	 *
+	 * \~russian
+	 * \brief
+	 * Установка числа частей, обрабатываемых параллельно
+	 *
+	 * Потоки предыдущего вызова останавливаются. Если поток не удается
+	 * создать, его часть обрабатывается в вызывающем потоке.
+	 *
+	 * \param[in] threads Число потоков, включая вызывающий, 0 - 1.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS.
+	 *
+	 */
+	U32 SetThreads(U32 threads);
+
+	//! Number of threads including calling one
+	U32 Threads() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Call routine for each part and wait for all of them
+	 *
+	 * \param[in] routine Function processing one part.
+	 * \param[in] param Parameter passed to routine.
+	 * \param[in] parts Number of parts, not more than Threads().
+	 *
+	 * \~russian
+	 * \brief
+	 * Вызов функции для каждой части и ожидание их завершения
+	 *
+	 * \param[in] routine Функция обработки одной части.
+	 * \param[in] param Параметр, передаваемый в функцию.
+	 * \param[in] parts Число частей, не больше Threads().
+	 *
+	 */
+	void Run(RoutineType routine, void* param, U32 parts);
+
+private:
+
+	RshWorkerPool(const RshWorkerPool&);
+	RshWorkerPool& operator=(const RshWorkerPool&);
+
+	struct Worker
+	{
+		Worker() : pool(0), part(0), started(false) {}
+
+		RshWorkerPool* pool;
+		U32 part;
+		bool started;
+		RshEvent start;
+		RshEvent done;
+		RshThread thread;
+	};
+
+	static void Routine(void* param);
+	void Stop();
+
+	U32 m_threads;
+	Worker* m_workers;
+	// task of current Run(), passed to workers through start event
+	RoutineType m_routine;
+	void* m_param;
+	U32 m_parts;
+	bool m_quit;
+};
+
+#endif //RSH_THREAD_H
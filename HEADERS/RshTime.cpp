@@ -17,9 +17,14 @@
 
 #include "RshTime.h"
 #include "RshFunctions.h"
+#include "RshThread.h"
 #include <iomanip>
 #include <sstream>
 
+#if defined(RSH_LINUX)
+	#include <time.h>
+#endif
+
  
 RshTime::RshTime():
  h(0),
@@ -143,14 +148,13 @@ RshTime RshTime::currentTime()
 
 #elif defined (RSH_LINUX)
 	struct timeval tv;
-	struct timezone tz;
-	struct tm *tm;
-	gettimeofday(&tv,&tz);
-	tm = localtime(&tv.tv_sec);
-
-	curTime.h = tm->tm_hour;
-    curTime.m = tm->tm_min;
-    curTime.s = tm->tm_sec;
+	struct tm tm;
+	gettimeofday(&tv, 0);
+	localtime_r(&tv.tv_sec, &tm);
+
+	curTime.h = tm.tm_hour;
+    curTime.m = tm.tm_min;
+    curTime.s = tm.tm_sec;
     curTime.ms = (U16)(tv.tv_usec / 1000);
 	curTime.us = (U16)(tv.tv_usec % 1000); 
 #endif
@@ -318,3 +322,179 @@ U64 RshTime::toMicroSeconds() const
 {
 	return m_hashedTimeInMicroSeconds;
 }
+
+// offset between system and monotonic clock, measured by RshTimestamp::Calibrate()
+static RshMutex rshTimestampMutex;
+static S64 rshTimestampOffset = 0;
+static bool rshTimestampCalibrated = false;
+
+RshTimestamp::RshTimestamp() :
+	m_ns(0)
+{ }
+
+RshTimestamp::RshTimestamp(U64 nanoSeconds) :
+	m_ns(nanoSeconds)
+{ }
+
+RshTimestamp RshTimestamp::Now()
+{
+#if defined(RSH_MSWINDOWS)
+	// frequency is fixed at system boot, so it is requested once
+	static LONGLONG frequency = 0;
+	if(frequency == 0)
+	{
+		LARGE_INTEGER freq;
+		::QueryPerformanceFrequency(&freq);
+		frequency = freq.QuadPart;
+	}
+
+	LARGE_INTEGER counter;
+	::QueryPerformanceCounter(&counter);
+	// split to avoid overflow of counter * 10^9
+	const U64 c = static_cast<U64>(counter.QuadPart);
+	const U64 f = static_cast<U64>(frequency);
+	return RshTimestamp((c / f) * 1000000000ULL + (c % f) * 1000000000ULL / f);
+#elif defined(RSH_LINUX)
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+	return RshTimestamp(static_cast<U64>(ts.tv_sec) * 1000000000ULL + static_cast<U64>(ts.tv_nsec));
+#endif
+}
+
+U64 RshTimestamp::NanoSeconds() const
+{
+	return m_ns;
+}
+
+double RshTimestamp::Seconds() const
+{
+	return m_ns / 1e9;
+}
+
+S64 RshTimestamp::operator-(const RshTimestamp& obj) const
+{
+	return static_cast<S64>(m_ns - obj.m_ns);
+}
+
+bool RshTimestamp::operator==(const RshTimestamp& obj) const
+{
+	return m_ns == obj.m_ns;
+}
+
+bool RshTimestamp::operator!=(const RshTimestamp& obj) const
+{
+	return m_ns != obj.m_ns;
+}
+
+bool RshTimestamp::operator<(const RshTimestamp& obj) const
+{
+	return m_ns < obj.m_ns;
+}
+
+bool RshTimestamp::operator>(const RshTimestamp& obj) const
+{
+	return m_ns > obj.m_ns;
+}
+
+bool RshTimestamp::operator<=(const RshTimestamp& obj) const
+{
+	return m_ns <= obj.m_ns;
+}
+
+bool RshTimestamp::operator>=(const RshTimestamp& obj) const
+{
+	return m_ns >= obj.m_ns;
+}
+
+U64 RshTimestamp::ToUnixNanoSeconds() const
+{
+	return static_cast<U64>(static_cast<S64>(m_ns) + WallOffset());
+}
+
+RshTime RshTimestamp::ToTime() const
+{
+	const U64 wall = ToUnixNanoSeconds();
+	const U16 milliseconds = static_cast<U16>((wall / 1000000) % 1000);
+	const U16 microseconds = static_cast<U16>((wall / 1000) % 1000);
+
+#if defined(RSH_MSWINDOWS)
+	// 100 ns intervals since 01.01.1601
+	ULARGE_INTEGER value;
+	value.QuadPart = wall / 100 + 116444736000000000ULL;
+
+	FILETIME ftTimeStamp, ltime;
+	SYSTEMTIME stime;
+	ftTimeStamp.dwLowDateTime = value.LowPart;
+	ftTimeStamp.dwHighDateTime = value.HighPart;
+	FileTimeToLocalFileTime(&ftTimeStamp, &ltime);
+	FileTimeToSystemTime(&ltime, &stime);
+
+	return RshTime(static_cast<U8>(stime.wHour), static_cast<U8>(stime.wMinute), static_cast<U8>(stime.wSecond), milliseconds, microseconds);
+#elif defined(RSH_LINUX)
+	time_t seconds = static_cast<time_t>(wall / 1000000000ULL);
+	struct tm tm;
+	localtime_r(&seconds, &tm);
+
+	return RshTime(static_cast<U8>(tm.tm_hour), static_cast<U8>(tm.tm_min), static_cast<U8>(tm.tm_sec), milliseconds, microseconds);
+#endif
+}
+
+void RshTimestamp::Calibrate()
+{
+	// system clock is read between two monotonic readings,
+	// the narrowest of several tries gives the most precise offset
+	U64 bestWidth = 0;
+	S64 offset = 0;
+	for(int i = 0; i < 8; ++i)
+	{
+		const U64 before = Now().m_ns;
+		const U64 wall = WallNanoSeconds();
+		const U64 after = Now().m_ns;
+		const U64 width = after - before;
+		if(i == 0 || width < bestWidth)
+		{
+			bestWidth = width;
+			offset = static_cast<S64>(wall) - static_cast<S64>(before + width / 2);
+		}
+	}
+
+	RshMutexLocker locker(rshTimestampMutex);
+	rshTimestampOffset = offset;
+	rshTimestampCalibrated = true;
+}
+
+U64 RshTimestamp::WallNanoSeconds()
+{
+#if defined(RSH_MSWINDOWS)
+	FILETIME ftTimeStamp;
+	GetSystemTimeAsFileTime(&ftTimeStamp);
+
+	ULARGE_INTEGER value;
+	value.LowPart = ftTimeStamp.dwLowDateTime;
+	value.HighPart = ftTimeStamp.dwHighDateTime;
+	return (value.QuadPart - 116444736000000000ULL) * 100;
+#elif defined(RSH_LINUX)
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return static_cast<U64>(ts.tv_sec) * 1000000000ULL + static_cast<U64>(ts.tv_nsec);
+#endif
+}
+
+S64 RshTimestamp::WallOffset()
+{
+	{
+		RshMutexLocker locker(rshTimestampMutex);
+		if(rshTimestampCalibrated)
+			return rshTimestampOffset;
+	}
+
+	Calibrate();
+
+	RshMutexLocker locker(rshTimestampMutex);
+	return rshTimestampOffset;
+}
+
+std::ostream& operator<< (std::ostream &out, const RshTimestamp& obj)
+{
+	return out << obj.m_ns << "ns";
+}
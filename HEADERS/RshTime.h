@@ -394,5 +394,102 @@ private:
 	mutable U64 m_hashedTimeInMicroSeconds;
 };
 
+/*!
+ *
+ * \~english
+ * \brief
+ * Monotonic timestamp with nanosecond resolution.
+ *
+ * Time is taken from CLOCK_MONOTONIC_RAW (Linux) or
+ * QueryPerformanceCounter() (Windows). This clock is not affected
+ * by system time changes and NTP adjustments, so difference of two
+ * timestamps is always correct interval. On Linux it is the same
+ * clock that drivers use for RshBlockInfo::timestamp, so
+ * block completion time can be compared with Now() directly.\n
+ * Capture is cheap (no system call on modern kernels, no locks),
+ * conversion to wall time is done only when needed, using offset
+ * between monotonic and system clock measured once per process.
+ *
+ * \~russian
+ * \brief
+ * Монотонная метка времени с наносекундным разрешением.
+ *
+ * Время берется из CLOCK_MONOTONIC_RAW (Linux) или
+ * QueryPerformanceCounter() (Windows). Эти часы не зависят
+ * от изменения системного времени и коррекции NTP, поэтому разность
+ * двух меток всегда дает правильный интервал. В Linux это те же часы,
+ * по которым драйверы заполняют RshBlockInfo::timestamp, поэтому время
+ * завершения передачи блока можно напрямую сравнивать с Now().\n
+ * Получение метки быстрое (без системного вызова на современных ядрах,
+ * без блокировок), преобразование в системное время выполняется только
+ * при необходимости, по смещению между монотонными и системными часами,
+ * которое измеряется один раз за время работы процесса.
+ *
+ */
+class RshTimestamp
+{
+	friend std::ostream& operator<< (std::ostream &out, const RshTimestamp& obj);
+
+public:
+
+	RshTimestamp();
+
+	//! \b nanoSeconds - monotonic clock value, for example RshBlockInfo::timestamp
+	explicit RshTimestamp(U64 nanoSeconds);
+
+	//! Current monotonic time
+	static RshTimestamp Now();
+
+	//! Monotonic clock value, ns
+	U64 NanoSeconds() const;
+
+	//! Monotonic clock value, seconds
+	double Seconds() const;
+
+	//! Interval between timestamps, ns (negative if \b obj is later)
+	S64 operator-(const RshTimestamp& obj) const;
+
+	bool operator==(const RshTimestamp& obj) const;
+	bool operator!=(const RshTimestamp& obj) const;
+	bool operator<(const RshTimestamp& obj) const;
+	bool operator>(const RshTimestamp& obj) const;
+	bool operator<=(const RshTimestamp& obj) const;
+	bool operator>=(const RshTimestamp& obj) const;
+
+	//! Wall time (UTC) in ns since 01.01.1970
+	U64 ToUnixNanoSeconds() const;
+
+	//! Local time of day
+	RshTime ToTime() const;
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Measure offset between monotonic and system clock
+	 *
+	 * Called automatically on first conversion to wall time.
+	 * Call it again if system time was changed while application
+	 * is running.
+	 *
+	 * \~russian
+	 * \brief
+	 * Измерение смещения между монотонными и системными часами
+	 *
+	 * Вызывается автоматически при первом преобразовании в системное время.
+	 * Вызовите метод повторно, если системное время было изменено
+	 * во время работы приложения.
+	 *
+	 */
+	static void Calibrate();
+
+private:
+
+	static U64 WallNanoSeconds();
+	static S64 WallOffset();
+
+	U64 m_ns;
+};
+
 #pragma pack(pop)
 #endif //RSH_TIME_H
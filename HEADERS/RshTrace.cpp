@@ -0,0 +1,348 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshTrace.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshTrace class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshTrace.
+ *
+ */
+
+#include "RshTrace.h"
+#include "RshConsts.h"
+#include "RshThread.h"
+#include "RshTime.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#define RSH_TRACE_DEFAULT_CAPACITY 16384
+
+// Chrome trace event phases
+#define RSH_TRACE_PHASE_COMPLETE 'X'
+#define RSH_TRACE_PHASE_INSTANT 'i'
+
+struct RshTraceEvent
+{
+	const char* category;
+	const char* name;
+	U64 begin;
+	U64 duration;
+	U64 arg;
+	char phase;
+};
+
+// events of one thread, written only by that thread
+struct RshTraceBuffer
+{
+	explicit RshTraceBuffer(U32 capacity) : events(capacity), written(0), tid(0) {}
+
+	std::vector<RshTraceEvent> events;
+	// number of events ever written, event i is in slot i % capacity
+	volatile U64 written;
+	U32 tid;
+	// guarded by registry mutex
+	std::string name;
+};
+
+#if defined(RSH_MSWINDOWS)
+static void WINAPI RshTraceThreadExit(void* value);
+#else
+static void RshTraceThreadExit(void* value);
+#endif
+
+struct RshTraceRegistry
+{
+	RshTraceRegistry() :
+		enabled(true),
+		capacity(RSH_TRACE_DEFAULT_CAPACITY),
+		start(RshTimestamp::Now().NanoSeconds()),
+		clearTime(0)
+	{
+#if defined(RSH_MSWINDOWS)
+		threadExit = FlsAlloc(&RshTraceThreadExit);
+#else
+		threadExitValid = (pthread_key_create(&threadExit, &RshTraceThreadExit) == 0);
+#endif
+	}
+
+	// buffers are not deleted, threads may still record at process exit
+	~RshTraceRegistry()
+	{
+#if defined(RSH_MSWINDOWS)
+		if(threadExit != FLS_OUT_OF_INDEXES)
+			FlsFree(threadExit);
+#else
+		if(threadExitValid)
+			pthread_key_delete(threadExit);
+#endif
+	}
+
+	RshMutex mutex;
+	std::vector<RshTraceBuffer*> buffers;
+	// buffers of finished threads, given to new threads
+	std::vector<RshTraceBuffer*> unused;
+#if defined(RSH_MSWINDOWS)
+	DWORD threadExit;
+#else
+	pthread_key_t threadExit;
+	bool threadExitValid;
+#endif
+	volatile bool enabled;
+	volatile U32 capacity;
+	U64 start;
+	volatile U64 clearTime;
+};
+
+static RshTraceRegistry rshTraceRegistry;
+
+static __rshthreadlocal RshTraceBuffer* rshTraceThreadBuffer = 0;
+
+// called by system when thread which recorded events ends
+#if defined(RSH_MSWINDOWS)
+static void WINAPI RshTraceThreadExit(void* value)
+#else
+static void RshTraceThreadExit(void* value)
+#endif
+{
+	if(value == 0)
+		return;
+	rshTraceThreadBuffer = 0;
+	RshMutexLocker lock(rshTraceRegistry.mutex);
+	rshTraceRegistry.unused.push_back(static_cast<RshTraceBuffer*>(value));
+}
+
+static RshTraceBuffer* RshTraceGetBuffer()
+{
+	if(rshTraceThreadBuffer == 0)
+	{
+		const U32 capacity = rshTraceRegistry.capacity;
+		RshMutexLocker lock(rshTraceRegistry.mutex);
+		RshTraceBuffer* buffer;
+		if(!rshTraceRegistry.unused.empty())
+		{
+			// new thread continues track of finished one, as with reused system thread id
+			buffer = rshTraceRegistry.unused.back();
+			rshTraceRegistry.unused.pop_back();
+			buffer->name.clear();
+			if(buffer->events.size() != capacity)
+			{
+				buffer->events.assign(capacity, RshTraceEvent());
+				buffer->written = 0;
+			}
+		}
+		else
+		{
+			buffer = new RshTraceBuffer(capacity);
+			rshTraceRegistry.buffers.push_back(buffer);
+			buffer->tid = static_cast<U32>(rshTraceRegistry.buffers.size());
+		}
+
+		// without exit notification buffer stays with thread forever
+#if defined(RSH_MSWINDOWS)
+		if(rshTraceRegistry.threadExit != FLS_OUT_OF_INDEXES)
+			FlsSetValue(rshTraceRegistry.threadExit, buffer);
+#else
+		if(rshTraceRegistry.threadExitValid)
+			pthread_setspecific(rshTraceRegistry.threadExit, buffer);
+#endif
+		rshTraceThreadBuffer = buffer;
+	}
+	return rshTraceThreadBuffer;
+}
+
+static void RshTraceRecord(char phase, const char* category, const char* name, U64 begin, U64 duration, U64 arg)
+{
+	if(!rshTraceRegistry.enabled)
+		return;
+
+	RshTraceBuffer* buffer = RshTraceGetBuffer();
+	const U64 index = __rshatomicload64(&buffer->written);
+	RshTraceEvent& event = buffer->events[static_cast<size_t>(index % buffer->events.size())];
+	event.category = category;
+	event.name = name;
+	event.begin = begin;
+	event.duration = duration;
+	event.arg = arg;
+	event.phase = phase;
+
+	// full barrier, event is complete before reader sees new count
+	__rshatomicadd64(&buffer->written, 1);
+}
+
+static void RshTraceWriteString(std::ostream& out, const char* text)
+{
+	out << '"';
+	for(const char* c = text; c != 0 && *c != 0; ++c)
+	{
+		if(*c == '"' || *c == '\\')
+			out << '\\' << *c;
+		else if(static_cast<unsigned char>(*c) < 0x20)
+			out << ' ';
+		else
+			out << *c;
+	}
+	out << '"';
+}
+
+// microseconds since registry start, as Chrome trace expects
+static void RshTraceWriteTime(std::ostream& out, U64 nanoSeconds)
+{
+	char text[32];
+	sprintf(text, "%llu.%03u", static_cast<unsigned long long>(nanoSeconds / 1000), static_cast<unsigned>(nanoSeconds % 1000));
+	out << text;
+}
+
+void RshTrace::Enable(bool enable)
+{
+	rshTraceRegistry.enabled = enable;
+}
+
+bool RshTrace::IsEnabled()
+{
+	return rshTraceRegistry.enabled;
+}
+
+void RshTrace::SetThreadCapacity(U32 events)
+{
+	rshTraceRegistry.capacity = (events == 0) ? 1 : events;
+}
+
+void RshTrace::SetThreadName(const char* name)
+{
+	RshTraceBuffer* buffer = RshTraceGetBuffer();
+	RshMutexLocker lock(rshTraceRegistry.mutex);
+	buffer->name = name ? name : "";
+}
+
+void RshTrace::Complete(const char* category, const char* name, U64 begin, U64 end, U64 arg)
+{
+	RshTraceRecord(RSH_TRACE_PHASE_COMPLETE, category, name, begin, (end > begin) ? end - begin : 0, arg);
+}
+
+void RshTrace::Instant(const char* category, const char* name, U64 arg)
+{
+	if(!rshTraceRegistry.enabled)
+		return;
+	RshTraceRecord(RSH_TRACE_PHASE_INSTANT, category, name, RshTimestamp::Now().NanoSeconds(), 0, arg);
+}
+
+void RshTrace::Clear()
+{
+	const U64 now = RshTimestamp::Now().NanoSeconds();
+	U64 current = __rshatomicload64(&rshTraceRegistry.clearTime);
+	for(;;)
+	{
+		const U64 previous = __rshatomiccas64(&rshTraceRegistry.clearTime, current, now);
+		if(previous == current)
+			break;
+		current = previous;
+	}
+}
+
+U32 RshTrace::WriteChromeJson(std::ostream& out)
+{
+	const U64 start = rshTraceRegistry.start;
+	const U64 clearTime = __rshatomicload64(&rshTraceRegistry.clearTime);
+	const U32 pid = static_cast<U32>(__rshgetpid());
+	std::vector<RshTraceEvent> events;
+	bool first = true;
+
+	out << "{\"traceEvents\":[\n";
+
+	// new threads wait while buffers are read, recording is not blocked
+	RshMutexLocker lock(rshTraceRegistry.mutex);
+	for(size_t b = 0; b < rshTraceRegistry.buffers.size(); ++b)
+	{
+		const RshTraceBuffer& buffer = *rshTraceRegistry.buffers[b];
+		const U64 capacity = buffer.events.size();
+
+		if(!buffer.name.empty())
+		{
+			out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+				<< ",\"tid\":" << buffer.tid << ",\"args\":{\"name\":";
+			RshTraceWriteString(out, buffer.name.c_str());
+			out << "}}";
+			first = false;
+		}
+
+		// copy events, then drop those overwritten by writer meanwhile,
+		// including slot which may be written right now
+		const U64 written = __rshatomicload64(&buffer.written);
+		const U64 from = (written > capacity) ? written - capacity : 0;
+		events.clear();
+		for(U64 i = from; i < written; ++i)
+			events.push_back(buffer.events[static_cast<size_t>(i % capacity)]);
+		__rshmembarrier();
+		const U64 after = __rshatomicload64(&buffer.written);
+		const U64 valid = (after + 1 > capacity) ? after + 1 - capacity : 0;
+
+		for(U64 i = (valid > from) ? valid : from; i < written; ++i)
+		{
+			const RshTraceEvent& event = events[static_cast<size_t>(i - from)];
+			if(event.begin < clearTime || event.begin < start)
+				continue;
+
+			out << (first ? "" : ",\n") << "{\"name\":";
+			RshTraceWriteString(out, event.name);
+			out << ",\"cat\":";
+			RshTraceWriteString(out, event.category);
+			out << ",\"ph\":\"" << event.phase << "\",\"ts\":";
+			RshTraceWriteTime(out, event.begin - start);
+			if(event.phase == RSH_TRACE_PHASE_COMPLETE)
+			{
+				out << ",\"dur\":";
+				RshTraceWriteTime(out, event.duration);
+			}
+			else
+			{
+				out << ",\"s\":\"t\"";
+			}
+			out << ",\"pid\":" << pid << ",\"tid\":" << buffer.tid
+				<< ",\"args\":{\"arg\":" << event.arg << "}}";
+			first = false;
+		}
+	}
+
+	out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+	return out.good() ? RSH_API_SUCCESS : RSH_API_FILE_CANTWRITE;
+}
+
+U32 RshTrace::WriteChromeJson(const char* fileName)
+{
+	if(fileName == 0 || *fileName == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+
+	std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+	if(!file.is_open())
+		return RSH_API_FILE_CANTCREATE;
+	const U32 st = WriteChromeJson(file);
+	file.close();
+	return (st == RSH_API_SUCCESS && !file.fail()) ? RSH_API_SUCCESS : RSH_API_FILE_CANTWRITE;
+}
+
+RshTraceScope::RshTraceScope(const char* category, const char* name) :
+	m_category(category),
+	m_name(name),
+	m_begin(RshTimestamp::Now().NanoSeconds()),
+	m_arg(0)
+{ }
+
+RshTraceScope::~RshTraceScope()
+{
+	RshTrace::Complete(m_category, m_name, m_begin, RshTimestamp::Now().NanoSeconds(), m_arg);
+}
+
+void RshTraceScope::SetArg(U64 arg)
+{
+	m_arg = arg;
+}
@@ -0,0 +1,189 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshTrace.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshTrace class and trace point macros.
+ *
+ * Timeline of SDK calls in Chrome trace format.
+ *
+ * \~russian
+ * \brief
+ * Класс RshTrace и макросы точек трассировки.
+ *
+ * Временная диаграмма вызовов SDK в формате Chrome trace.
+ *
+ */
+
+#ifndef RSH_TRACE_H
+#define RSH_TRACE_H
+
+#include "RshDefChk.h"
+
+#include <ostream>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Recorder of trace events
+ *
+ * Trace points are placed in SDK code with RSH_TRACE_SCOPE() macro:
+ * calls of RshMonitoredDevice (Connect, Init, Start, Stop, wait for
+ * buffer and GetData), file I/O of RshBufferType, loading of device
+ * libraries by RshDllClient and block generation of RshSimulator.
+ * Application can add its own trace points, for example around disk
+ * write of acquired data, to see on one timeline where time goes.\n
+ * Macros are empty unless RSH_TRACE is defined for whole project
+ * (-DRSH_TRACE), so release builds have no overhead. When enabled,
+ * each event takes two clock reads and a write to buffer of current
+ * thread, without locks and system calls. Buffer of each thread is a
+ * ring, so it keeps last events of live session
+ * (see SetThreadCapacity()).\n
+ * Recorded events are written with WriteChromeJson() in Chrome trace
+ * event format, which is opened by chrome://tracing and by Perfetto UI
+ * (ui.perfetto.dev).
+ *
+ * \remarks
+ * Names and categories of events must be string literals (pointers
+ * are stored, not text). Buffer of finished thread is given to next
+ * new thread, so memory is limited by number of threads recording at
+ * the same time, and events of both threads are shown in one track.
+ *
+ * \~russian
+ * \brief
+ * Запись событий трассировки
+ *
+ * Точки трассировки размещены в коде SDK с помощью макроса
+ * RSH_TRACE_SCOPE(): вызовы RshMonitoredDevice (Connect, Init, Start,
+ * Stop, ожидание буфера и GetData), файловые операции RshBufferType,
+ * загрузка библиотек устройств RshDllClient и создание блоков
+ * RshSimulator. Приложение может добавить свои точки, например вокруг
+ * записи данных на диск, чтобы на одной временной диаграмме видеть,
+ * на что уходит время.\n
+ * Макросы пусты, если RSH_TRACE не определен для всего проекта
+ * (-DRSH_TRACE), поэтому в рабочих сборках накладных расходов нет.
+ * Когда трассировка включена, каждое событие требует двух чтений
+ * часов и записи в буфер текущего потока, без блокировок и системных
+ * вызовов. Буфер каждого потока кольцевой, поэтому в нем остаются
+ * последние события работающего сеанса (см. SetThreadCapacity()).\n
+ * Записанные события сохраняются методом WriteChromeJson() в формате
+ * Chrome trace event, который открывается в chrome://tracing и в
+ * Perfetto UI (ui.perfetto.dev).
+ *
+ * \remarks
+ * Имена и категории событий должны быть строковыми литералами
+ * (сохраняются указатели, а не текст). Буфер завершившегося потока
+ * передается следующему новому потоку, поэтому расход памяти
+ * ограничен числом одновременно записывающих потоков, а события обоих
+ * потоков показываются на одной дорожке.
+ *
+ */
+class RshTrace
+{
+public:
+
+	//! Pause or resume recording, recording is on by default
+	static void Enable(bool enable);
+
+	//! True if events are recorded
+	static bool IsEnabled();
+
+	//! Ring size in events for threads which did not record yet (16384)
+	static void SetThreadCapacity(U32 events);
+
+	//! Name of calling thread in trace viewer
+	static void SetThreadName(const char* name);
+
+	//! Record event which started at \b begin and ended at \b end (RshTimestamp nanoseconds)
+	static void Complete(const char* category, const char* name, U64 begin, U64 end, U64 arg = 0);
+
+	//! Record point event at current time
+	static void Instant(const char* category, const char* name, U64 arg = 0);
+
+	//! Forget events recorded before this call
+	static void Clear();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Write events of all threads in Chrome trace JSON format
+	 *
+	 * Can be called while other threads record events.
+	 *
+	 * \param[out] out Output stream.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_FILE_CANTWRITE.
+	 *
+	 * \~russian
+	 * \brief
+	 * Запись событий всех потоков в формате Chrome trace JSON
+	 *
+	 * Может вызываться, пока другие потоки записывают события.
+	 *
+	 * \param[out] out Поток вывода.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_FILE_CANTWRITE.
+	 *
+	 */
+	static U32 WriteChromeJson(std::ostream& out);
+
+	//! Write events to file, see WriteChromeJson(std::ostream&)
+	static U32 WriteChromeJson(const char* fileName);
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Records event lasting from construction to destruction
+ *
+ * \~russian
+ * \brief
+ * Записывает событие от создания до уничтожения объекта
+ *
+ */
+class RshTraceScope
+{
+public:
+
+	RshTraceScope(const char* category, const char* name);
+	~RshTraceScope();
+
+	//! Value shown as argument of event
+	void SetArg(U64 arg);
+
+private:
+
+	RshTraceScope(const RshTraceScope&);
+	RshTraceScope& operator=(const RshTraceScope&);
+
+	const char* m_category;
+	const char* m_name;
+	U64 m_begin;
+	U64 m_arg;
+};
+
+#if defined(RSH_TRACE)
+	#define RSH_TRACE_CONCAT_IMPL(a, b) a##b
+	#define RSH_TRACE_CONCAT(a, b) RSH_TRACE_CONCAT_IMPL(a, b)
+	//! Record event from this line to end of scope
+	#define RSH_TRACE_SCOPE(category, name) RshTraceScope RSH_TRACE_CONCAT(rshTraceScope, __LINE__)(category, name)
+	//! Record point event
+	#define RSH_TRACE_INSTANT(category, name, arg) RshTrace::Instant(category, name, arg)
+	//! Name calling thread
+	#define RSH_TRACE_THREAD_NAME(name) RshTrace::SetThreadName(name)
+#else
+	#define RSH_TRACE_SCOPE(category, name)
+	#define RSH_TRACE_INSTANT(category, name, arg)
+	#define RSH_TRACE_THREAD_NAME(name)
+#endif
+
+#endif //RSH_TRACE_H
@@ -31,6 +31,9 @@
 #include "RshPortInfo.h"
 #include "RshBoardPortInfo.h"
 #include "RshTime.h"
+#include "RshLinkStatistics.h"
+#include "RshBlockInfo.h"
+#include "RshDeviceMetrics.h"
 
 //Init structures
 #include "RshChannel.h"
@@ -0,0 +1,371 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshUniDriver64.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Here you can find prototypes of the functions exported from RshUniDriver64
+ * library (revision ::RSH_UNIDRIVER_API_VERSION_ZERO_COPY of UniDriver C API).
+ *
+ * Library is built from unidriver/RshUniDriver64.cpp over RshDllClient and
+ * IRshDevice. It adds 64-bit buffer sizes, buffers in memory of calling
+ * program and blocks lent without copying. Functions use handles returned
+ * by UniDriverGetDeviceHandle64(), not handles of RshUniDriver.dll.
+ *
+ * \~russian
+ * \brief
+ * В данном файле описаны прототипы функций экспортируемых из библиотеки
+ * RshUniDriver64 (ревизия ::RSH_UNIDRIVER_API_VERSION_ZERO_COPY API UniDriver).
+ *
+ * Библиотека собирается из unidriver/RshUniDriver64.cpp поверх RshDllClient
+ * и IRshDevice. В ней добавлены 64-разрядные размеры буферов, буферы в памяти
+ * вызывающей программы и блоки, выдаваемые без копирования. Функции
+ * используют идентификаторы, полученные от UniDriverGetDeviceHandle64(), а не
+ * идентификаторы RshUniDriver.dll.
+ *
+ */
+
+#ifndef RSH_UNIDRIVER_64_H
+#define RSH_UNIDRIVER_64_H
+#include "RshUniDriverStructures.h"
+
+#if !defined(RSH_UNIDRIVER64_API)
+	#if defined(RSH_MSWINDOWS)
+		#define RSH_UNIDRIVER64_API __declspec(dllimport)
+	#else
+		#define RSH_UNIDRIVER64_API
+	#endif
+#endif
+
+//! Число внутренних буферов блоков на устройство (см. UniDriverBorrowBlock())
+#define RSH_UNIDRIVER64_BLOCKS 16
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+ /*!
+  * \brief
+  * Получение ревизии API библиотеки
+  *
+  * \param[in,out] version
+  * Указатель на переменную, в которую будет помещен номер ревизии.
+  *
+  * \returns
+  * ::RSH_API_SUCCESS или ::RSH_API_PARAMETER_ZEROADDRESS.
+  *
+  * Возвращает ::RSH_UNIDRIVER_API_VERSION_ZERO_COPY. Программы на других
+  * языках, загружающие библиотеку динамически, могут проверить ревизию
+  * перед использованием остальных функций.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverGetApiVersion(unsigned int* version);
+
+ /*!
+  * \brief
+  * Получение идентификатора драйвера
+  *
+  * \param[in] deviceName
+  * Строка с названием устройства (имя библиотеки абстракции).
+  *
+  * \param[in,out] deviceHandle
+  * Указатель на переменную, в которую будет помещен идентификатор драйвера.
+  *
+  * \returns
+  * ::RSH_API_SUCCESS или код ошибки.
+  *
+  * Аналог функции UniDriverGetDeviceHandle(). Объект с интерфейсом IRshDevice
+  * загружается методом RshDllClient::GetDeviceInterface() и хранится до вызова
+  * функции UniDriverCloseDeviceHandle64().
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverGetDeviceHandle64(const char* deviceName, unsigned int* deviceHandle);
+
+ /*!
+  * \brief
+  * Закрытие идентификатора драйвера
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \returns
+  * ::RSH_API_SUCCESS или ::RSH_API_PARAMETER_WRONGDEVICEHANDLE.
+  *
+  * Внутренние буферы блоков освобождаются, блоки, полученные функцией
+  * UniDriverBorrowBlock(), становятся недействительными. Когда закрыт
+  * последний идентификатор, библиотеки абстракции выгружаются.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverCloseDeviceHandle64(unsigned int deviceHandle);
+
+ /*!
+  * \brief
+  * Подключение к устройству по порядковому номеру
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \param[in] deviceIndex
+  * Порядковый номер устройства (начиная с 1).
+  *
+  * \param[in] mode
+  * Режим подключения (одна из констант перечисления ::RSH_CONNECT_MODES).
+  *
+  * \returns
+  * ::RSH_API_SUCCESS или код ошибки.
+  *
+  * Аналог функции UniDriverConnect().
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverConnect64(unsigned int deviceHandle, unsigned int deviceIndex, unsigned int mode);
+
+ /*!
+  * \brief
+  * Подключение к устройству по строковому ключу
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \param[in] key
+  * Строковый ключ (например, заводской номер или IP адрес устройства).
+  *
+  * \param[in] mode
+  * Режим подключения (одна из констант перечисления ::RSH_CONNECT_MODES).
+  *
+  * \returns
+  * ::RSH_API_SUCCESS или код ошибки.
+  *
+  * Аналог функции UniDriverConnectViaStringKey().
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverConnectViaStringKey64(unsigned int deviceHandle, const char* key, unsigned int mode);
+
+ /*!
+  * \brief
+  * Инициализация устройства
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \param[in] initializationMode
+  * Режим инициализации (одна из констант перечисления ::RSH_INIT_MODES).
+  *
+  * \param[in,out] initializationStructure
+  * Указатель на структуру URshInitDMA или URshInitMemory с заполненным полем type.
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_DATATYPENOTSUPPORTED или код ошибки.
+  *
+  * Аналог функции UniDriverInit() для устройств сбора данных. После вызова
+  * параметры в структуре исправлены так же, как в RshInitDMA или RshInitMemory.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverInit64(unsigned int deviceHandle, unsigned int initializationMode, void* initializationStructure);
+
+ /*!
+  * \brief
+  * Запуск сбора данных
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \returns
+  * ::RSH_API_SUCCESS или код ошибки.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverStart64(unsigned int deviceHandle);
+
+ /*!
+  * \brief
+  * Остановка сбора данных
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \returns
+  * ::RSH_API_SUCCESS или код ошибки.
+  *
+  * Все блоки, полученные функцией UniDriverBorrowBlock(), возвращаются
+  * библиотеке.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverStop64(unsigned int deviceHandle);
+
+ /*!
+  * \brief
+  * Ожидание готовности буфера с данными
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \param[in] timeout
+  * Время ожидания, мс.
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_EVENT_WAITTIMEOUT или код ошибки.
+  *
+  * Аналог функции UniDriverGet() с кодом ::RSH_GET_WAIT_BUFFER_READY_EVENT,
+  * вызывается перед UniDriverGetData64(). Функция UniDriverBorrowBlock()
+  * ожидает готовности блока сама.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverWaitBufferReady64(unsigned int deviceHandle, unsigned int timeout);
+
+ /*!
+  * \brief
+  * Создание буфера для данных с 64-разрядным размером
+  *
+  * \param[in,out] uRshBuffer
+  * Указатель на структуру URshBuffer64 с заполненными полями structSize и type.
+  *
+  * \param[in] desiredBufferSize
+  * Желаемый размер буфера в элементах
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_WRONGDATATYPE,
+  * ::RSH_API_MEMORY_ALLOCATIONERROR или код ошибки.
+  *
+  * Аналог функции UniDriverAllocateBuffer() без ограничения размера
+  * буфера 4G элементов. Память выделяется внутри библиотеки и
+  * освобождается функцией UniDriverFreeBuffer64().\n
+  * Поддерживаются типы rshBufferTypeU8 ... rshBufferTypeDouble.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverAllocateBuffer64(URshBuffer64* uRshBuffer, unsigned long long desiredBufferSize);
+
+ /*!
+  * \brief
+  * Регистрация памяти программы пользователя в качестве буфера данных
+  *
+  * \param[in,out] uRshBuffer
+  * Указатель на структуру URshBuffer64 с заполненными полями structSize и type.
+  *
+  * \param[in] memory
+  * Указатель на память, выделенную программой пользователя (например,
+  * данные массива numpy или массива LabVIEW).
+  *
+  * \param[in] elements
+  * Размер памяти в элементах типа, заданного полем type.
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_ZEROADDRESS,
+  * ::RSH_API_BUFFER_WRONGDATATYPE или код ошибки.
+  *
+  * Функция UniDriverGetData64() копирует полученные данные в эту память,
+  * поэтому программе не нужно копировать их из буфера библиотеки.
+  * В поле flags устанавливается ::URshBufferFlagUser.\n
+  * Библиотека не освобождает зарегистрированную память. Память должна
+  * оставаться доступной до вызова UniDriverFreeBuffer64(), после которого
+  * библиотека больше к ней не обращается.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverRegisterBuffer(URshBuffer64* uRshBuffer, void* memory, unsigned long long elements);
+
+ /*!
+  * \brief
+  * Удаление буфера данных с 64-разрядным размером
+  *
+  * \param[in,out] uRshBuffer
+  * Указатель на структуру URshBuffer64
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_NOTINITIALIZED или код ошибки.
+  *
+  * Память, выделенная функцией UniDriverAllocateBuffer64(), освобождается.
+  * Для памяти, зарегистрированной функцией UniDriverRegisterBuffer(),
+  * отменяется только регистрация, память остается во владении программы
+  * пользователя. После вызова поля id, ptr, size и psize равны нулю.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverFreeBuffer64(URshBuffer64* uRshBuffer);
+
+ /*!
+  * \brief
+  * Получение буфера с данными с 64-разрядным размером
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \param[in] getDataMode
+  * Дополнительные параметры (одна из констант перечисления ::RSH_DATA_MODES).
+  *
+  * \param[in,out] uRshBuffer
+  * Указатель на структуру URshBuffer64, созданную функцией
+  * UniDriverAllocateBuffer64() или UniDriverRegisterBuffer().
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_BUFFER_NOTINITIALIZED,
+  * ::RSH_API_BUFFER_INSUFFICIENTSIZE или код ошибки.
+  *
+  * Аналог функции UniDriverGetData(), поле size содержит количество
+  * полученных элементов.\n
+  * В буфер библиотеки данные помещаются драйвером без промежуточного
+  * буфера; если драйверу нужно больше места, память буфера выделяется
+  * заново и поля ptr и psize обновляются. В зарегистрированную память
+  * данные копируются один раз; если ее не хватает, возвращается
+  * ::RSH_API_BUFFER_INSUFFICIENTSIZE, а поле size содержит нужный размер.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverGetData64(unsigned int deviceHandle, unsigned int getDataMode, URshBuffer64* uRshBuffer);
+
+ /*!
+  * \brief
+  * Получение блока данных без копирования
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \param[in] getDataMode
+  * Дополнительные параметры (одна из констант перечисления ::RSH_DATA_MODES).
+  *
+  * \param[in,out] block
+  * Указатель на структуру URshBlock с заполненными полями structSize и type.
+  *
+  * \param[in] timeout
+  * Время ожидания готовности блока, мс.
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_EVENT_WAITTIMEOUT,
+  * ::RSH_API_BUFFER_WRONGDATATYPE, ::RSH_API_BUFFER_INSUFFICIENTSIZE или код ошибки.
+  *
+  * Функция ожидает готовности следующего блока, драйвер помещает его в
+  * свободный внутренний буфер библиотеки, и программе возвращается
+  * указатель на этот буфер без дальнейшего копирования. Блок не
+  * перезаписывается, пока не будет вызвана функция UniDriverReleaseBlock().\n
+  * Одновременно удерживается не более ::RSH_UNIDRIVER64_BLOCKS блоков
+  * на устройство. Если все они удерживаются, возвращается
+  * ::RSH_API_BUFFER_INSUFFICIENTSIZE, а сбор данных продолжается с
+  * потерей блоков (см. URshBlock::sequence).
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverBorrowBlock(unsigned int deviceHandle, unsigned int getDataMode, URshBlock* block, unsigned int timeout);
+
+ /*!
+  * \brief
+  * Возврат блока данных библиотеке
+  *
+  * \param[in] deviceHandle
+  * Идентификатор драйвера, полученный от UniDriverGetDeviceHandle64().
+  *
+  * \param[in,out] block
+  * Структура, заполненная функцией UniDriverBorrowBlock().
+  *
+  * \returns
+  * ::RSH_API_SUCCESS, ::RSH_API_PARAMETER_INVALID, если блок уже возвращен, или код ошибки.
+  *
+  * После вызова функции обращаться к данным по указателю ptr нельзя,
+  * библиотека использует буфер для следующих блоков. Поля id и ptr
+  * устанавливаются в ноль. Блоки можно возвращать в любом порядке.
+  *
+  */
+RSH_UNIDRIVER64_API unsigned __RSHCALLCONV UniDriverReleaseBlock(unsigned int deviceHandle, URshBlock* block);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //RSH_UNIDRIVER_64_H
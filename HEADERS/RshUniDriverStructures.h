@@ -44,6 +44,49 @@ typedef struct
 
 } URshBuffer;
 
+//! Ревизия API, в которой появились URshBuffer64, URshBlock и функции для работы с ними (см. RshUniDriver64.h)
+#define RSH_UNIDRIVER_API_VERSION_ZERO_COPY 2
+
+/////////////////////////////////////////////////////////////////////
+// Буфер данных с 64-разрядными размерами.
+// Данная структура используется в функции UniDriverGetData64.
+// Память может быть выделена библиотекой (UniDriverAllocateBuffer64)
+// или программой пользователя (UniDriverRegisterBuffer).
+//
+
+//! Буфер данных с 64-разрядными размерами
+typedef struct
+{
+	unsigned int		structSize; //!< размер структуры, sizeof(URshBuffer64); заполняется пользователем до вызова любой функции
+	RshDataTypes		type;       //!< тип данных буфера
+	unsigned int		flags;      //!< флаги URshBufferFlags, заполняются библиотекой
+	unsigned int		id;         //!< уникальный идентификатор буфера (поле нельзя трогать, оно предназначено только для служебного использования)
+	unsigned long long	size;       //!< количество элементов, полученных при последнем вызове UniDriverGetData64()
+	unsigned long long	psize;      //!< количество элементов в буфере
+	void*				ptr;        //!< указатель на буфер
+
+} URshBuffer64;
+
+/////////////////////////////////////////////////////////////////////
+// Блок данных, принадлежащий библиотеке.
+// Данная структура используется в функциях UniDriverBorrowBlock
+// и UniDriverReleaseBlock.
+//
+
+//! Блок данных, полученный без копирования
+typedef struct
+{
+	unsigned int		structSize; //!< размер структуры, sizeof(URshBlock); заполняется пользователем
+	RshDataTypes		type;       //!< тип данных блока, заполняется пользователем
+	unsigned int		id;         //!< идентификатор блока для UniDriverReleaseBlock() (поле нельзя трогать)
+	unsigned int		reserved;   //!< зарезервировано, 0
+	unsigned long long	size;       //!< количество элементов в блоке
+	unsigned long long	sequence;   //!< порядковый номер блока по данным драйвера (см. RshBlockInfo), 0 если недоступен
+	unsigned long long	timestamp;  //!< время завершения передачи блока в нс (см. RshBlockInfo), 0 если недоступно
+	const void*			ptr;        //!< указатель на данные, действителен до вызова UniDriverReleaseBlock()
+
+} URshBlock;
+
 /////////////////////////////////////////////////////////////////////
 // Данные структуры используютя для передачи данных
 // в функции UniDriverGet и некоторых других
@@ -374,6 +417,13 @@ enum URshInitGSPFAttenuation
 	URshInitGSPFAttenuation42dB = 0x7		//!< Ослабление 42дБ	
 };
 
+//! Константы для поля flags структуры URshBuffer64
+enum URshBufferFlags
+{
+	URshBufferFlagLibrary = 0x0,	//!< Память выделена библиотекой (UniDriverAllocateBuffer64)
+	URshBufferFlagUser = 0x1		//!< Память выделена программой пользователя и зарегистрирована (UniDriverRegisterBuffer)
+};
+
 #pragma pack(pop)
 
 #endif //RSH_UNIDRIVER_STRUCTURES_H
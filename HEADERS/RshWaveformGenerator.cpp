@@ -0,0 +1,345 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshWaveformGenerator.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshWaveformGenerator class.
+ *
+ * \~russian
+ * \brief
+ * Класс RshWaveformGenerator.
+ *
+ */
+
+#include "RshWaveformGenerator.h"
+#include "RshConsts.h"
+#include "RshFunctions.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+// sine table has 2^rshWaveTableBits points per period, plus guard point for interpolation
+const unsigned rshWaveTableBits = 12;
+const size_t rshWaveTableSize = static_cast<size_t>(1) << rshWaveTableBits;
+// samples are synthesized and quantized by blocks of this size
+const size_t rshWaveBlockSize = 1024;
+const double rshWaveTwoPi = 6.283185307179586476925286766559;
+const double rshWaveTwo32 = 4294967296.0;
+// generator output impedance, Ohm
+const double rshWaveOutputImpedance = 50.0;
+
+}
+
+RshWaveformGenerator::RshWaveformGenerator() :
+	m_sampleFrequency(0.0),
+	m_lsbPerVolt(0.0),
+	m_phase(0),
+	m_sample(0),
+	m_table(rshWaveTableSize + 1),
+	m_work(rshWaveBlockSize)
+{
+	for(size_t i = 0; i <= rshWaveTableSize; ++i)
+		m_table[i] = sin(rshWaveTwoPi * i / rshWaveTableSize);
+}
+
+U32 RshWaveformGenerator::SetOutput(double sampleFrequency, double rangeVolts, double loadOhm, U32 attenuator)
+{
+	if(sampleFrequency <= 0.0 || rangeVolts <= 0.0 || loadOhm < 0.0 || attenuator > RshInitGSPF::Attenuation42dB)
+		return RSH_API_PARAMETER_INVALID;
+
+	// full scale voltage at output: divider by output impedance and load, then 6dB per attenuator step
+	double fullScale = rangeVolts;
+	if(loadOhm > 0.0)
+		fullScale *= loadOhm / (loadOhm + rshWaveOutputImpedance);
+	fullScale *= pow(10.0, -6.0 * attenuator / 20.0);
+
+	m_sampleFrequency = sampleFrequency;
+	m_lsbPerVolt = 32768.0 / fullScale;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWaveformGenerator::SetOutput(IRshDevice* device, const RshInitGSPF& init, double loadOhm)
+{
+	if(device == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	RSH_DOUBLE range = 0.0;
+	U32 st = device->Get(RSH_GET_DEVICE_OUTPUT_RANGE_VOLTS, &range);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	return SetOutput(init.frequency, range, loadOhm, init.attenuator);
+}
+
+void RshWaveformGenerator::Reset()
+{
+	m_phase = 0;
+	m_sample = 0;
+}
+
+double RshWaveformGenerator::LsbPerVolt() const
+{
+	return m_lsbPerVolt;
+}
+
+U32 RshWaveformGenerator::Sine(RSH_BUFFER_S16& buffer, size_t count, double frequency, double amplitude, double offset)
+{
+	U32 st = Prepare(buffer, count);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	const U64 step = PhaseStep(frequency);
+	const double amp = amplitude * m_lsbPerVolt;
+	const double ofs = offset * m_lsbPerVolt;
+	double* work = &m_work[0];
+
+	for(size_t done = 0; done < count; done += rshWaveBlockSize)
+	{
+		size_t n = (count - done < rshWaveBlockSize) ? count - done : rshWaveBlockSize;
+		for(size_t i = 0; i < n; ++i)
+		{
+			work[i] = ofs + amp * Interpolate(m_phase);
+			m_phase += step;
+		}
+		Quantize(work, buffer.ptr + done, n);
+	}
+
+	m_sample += count;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWaveformGenerator::Square(RSH_BUFFER_S16& buffer, size_t count, double frequency, double amplitude, double duty, double offset)
+{
+	if(duty < 0.0 || duty > 1.0)
+		return RSH_API_PARAMETER_INVALID;
+
+	U32 st = Prepare(buffer, count);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	const U64 step = PhaseStep(frequency);
+	// phase below threshold is high level
+	const double dutyHi = floor(duty * rshWaveTwo32);
+	const U64 threshold = (duty >= 1.0) ? ~static_cast<U64>(0) : (static_cast<U64>(dutyHi) << 32);
+	const double hi = (offset + amplitude) * m_lsbPerVolt;
+	const double lo = (offset - amplitude) * m_lsbPerVolt;
+	double* work = &m_work[0];
+
+	for(size_t done = 0; done < count; done += rshWaveBlockSize)
+	{
+		size_t n = (count - done < rshWaveBlockSize) ? count - done : rshWaveBlockSize;
+		for(size_t i = 0; i < n; ++i)
+		{
+			work[i] = (m_phase < threshold) ? hi : lo;
+			m_phase += step;
+		}
+		Quantize(work, buffer.ptr + done, n);
+	}
+
+	m_sample += count;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWaveformGenerator::Chirp(RSH_BUFFER_S16& buffer, size_t count, double startFrequency, double stopFrequency, double amplitude, double offset)
+{
+	U32 st = Prepare(buffer, count);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	// phase step grows linearly; increment is fixed point too, so sweep does not drift
+	const U64 increment = CyclesToPhase((stopFrequency - startFrequency) / m_sampleFrequency / count);
+	U64 step = PhaseStep(startFrequency);
+	const double amp = amplitude * m_lsbPerVolt;
+	const double ofs = offset * m_lsbPerVolt;
+	double* work = &m_work[0];
+
+	for(size_t done = 0; done < count; done += rshWaveBlockSize)
+	{
+		size_t n = (count - done < rshWaveBlockSize) ? count - done : rshWaveBlockSize;
+		for(size_t i = 0; i < n; ++i)
+		{
+			work[i] = ofs + amp * Interpolate(m_phase);
+			m_phase += step;
+			step += increment;
+		}
+		Quantize(work, buffer.ptr + done, n);
+	}
+
+	m_sample += count;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWaveformGenerator::Multitone(RSH_BUFFER_S16& buffer, size_t count, const std::vector<RshWaveformTone>& tones, double offset)
+{
+	if(tones.empty())
+		return RSH_API_PARAMETER_INVALID;
+
+	U32 st = Prepare(buffer, count);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	const double ofs = offset * m_lsbPerVolt;
+	double* work = &m_work[0];
+
+	for(size_t done = 0; done < count; done += rshWaveBlockSize)
+	{
+		size_t n = (count - done < rshWaveBlockSize) ? count - done : rshWaveBlockSize;
+		for(size_t i = 0; i < n; ++i)
+			work[i] = ofs;
+
+		// tone phase is derived from sample counter, so it is continuous between calls
+		for(size_t t = 0; t < tones.size(); ++t)
+		{
+			const U64 step = PhaseStep(tones[t].frequency);
+			const double amp = tones[t].amplitude * m_lsbPerVolt;
+			U64 phase = CyclesToPhase(tones[t].phase / rshWaveTwoPi) + step * (m_sample + done);
+
+			for(size_t i = 0; i < n; ++i)
+			{
+				work[i] += amp * Interpolate(phase);
+				phase += step;
+			}
+		}
+		Quantize(work, buffer.ptr + done, n);
+	}
+
+	m_sample += count;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWaveformGenerator::Noise(RSH_BUFFER_S16& buffer, size_t count, double rms, double offset, U64 seed)
+{
+	if(rms < 0.0)
+		return RSH_API_PARAMETER_INVALID;
+
+	U32 st = Prepare(buffer, count);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	if(seed != 0)
+		m_random.Seed(seed);
+
+	const double sigma = rms * m_lsbPerVolt;
+	const double ofs = offset * m_lsbPerVolt;
+	double* work = &m_work[0];
+
+	for(size_t done = 0; done < count; done += rshWaveBlockSize)
+	{
+		size_t n = (count - done < rshWaveBlockSize) ? count - done : rshWaveBlockSize;
+		for(size_t i = 0; i < n; ++i)
+			work[i] = ofs + sigma * m_random.Gaussian();
+		Quantize(work, buffer.ptr + done, n);
+	}
+
+	m_sample += count;
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWaveformGenerator::Arbitrary(RSH_BUFFER_S16& buffer, const char* fileName, double scale, double offset)
+{
+	if(fileName == 0)
+		return RSH_API_FILE_NAMENOTDEFINED;
+	if(m_lsbPerVolt == 0.0)
+		return RSH_API_PARAMETER_NOTINITIALIZED;
+
+	FILE* f = fopen(fileName, "r");
+	if(f == 0)
+		return RSH_API_FILE_CANTOPEN;
+
+	std::vector<double> samples;
+	for(;;)
+	{
+		double value;
+		int res = fscanf(f, " %lf", &value);
+		if(res == 1)
+		{
+			samples.push_back((value * scale + offset) * m_lsbPerVolt);
+			continue;
+		}
+		if(res == EOF)
+			break;
+		// skip separator
+		int c = fgetc(f);
+		if(c != ',' && c != ';')
+		{
+			fclose(f);
+			return RSH_API_FILE_CANTREAD;
+		}
+	}
+	fclose(f);
+
+	if(samples.empty())
+		return RSH_API_FILE_CANTREAD;
+
+	size_t count = samples.size();
+	U32 st = Prepare(buffer, count);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	Quantize(&samples[0], buffer.ptr, count);
+	return RSH_API_SUCCESS;
+}
+
+U32 RshWaveformGenerator::Prepare(RSH_BUFFER_S16& buffer, size_t& count) const
+{
+	if(m_lsbPerVolt == 0.0)
+		return RSH_API_PARAMETER_NOTINITIALIZED;
+
+	if(count == 0)
+		count = buffer.PSize();
+	if(count == 0)
+		return RSH_API_BUFFER_ZEROSIZE;
+
+	if(buffer.PSize() < count)
+	{
+		U32 st = buffer.Allocate(count);
+		if(st != RSH_API_SUCCESS)
+			return st;
+	}
+
+	buffer.SetSize(count);
+	return RSH_API_SUCCESS;
+}
+
+U64 RshWaveformGenerator::PhaseStep(double frequency) const
+{
+	return CyclesToPhase(frequency / m_sampleFrequency);
+}
+
+U64 RshWaveformGenerator::CyclesToPhase(double cycles)
+{
+	// phase is fraction of period scaled to 2^64, so it wraps around naturally
+	cycles = fmod(cycles, 1.0);
+	if(cycles < 0.0)
+		cycles += 1.0;
+
+	const double hi = floor(cycles * rshWaveTwo32);
+	const double lo = floor((cycles * rshWaveTwo32 - hi) * rshWaveTwo32);
+	return (static_cast<U64>(hi) << 32) + static_cast<U64>(lo);
+}
+
+double RshWaveformGenerator::Interpolate(U64 phase) const
+{
+	// upper bits select table point, next 32 bits are position between points
+	const size_t index = static_cast<size_t>(phase >> (64 - rshWaveTableBits));
+	const double frac = static_cast<U32>(phase >> (32 - rshWaveTableBits)) * (1.0 / rshWaveTwo32);
+	return m_table[index] + (m_table[index + 1] - m_table[index]) * frac;
+}
+
+void RshWaveformGenerator::Quantize(const double* src, S16* dst, size_t count) const
+{
+	// round to nearest code and saturate to S16 range
+	for(size_t i = 0; i < count; ++i)
+	{
+		double v = floor(src[i] + 0.5);
+		v = (v > 32767.0) ? 32767.0 : v;
+		v = (v < -32768.0) ? -32768.0 : v;
+		dst[i] = static_cast<S16>(v);
+	}
+}
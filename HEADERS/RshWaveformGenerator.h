@@ -0,0 +1,201 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshWaveformGenerator.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * RshWaveformGenerator class.
+ *
+ * Fast waveform synthesis for GSPF generators.
+ *
+ * \~russian
+ * \brief
+ * Класс RshWaveformGenerator.
+ *
+ * Быстрый синтез сигналов для генераторов GSPF.
+ *
+ */
+
+#ifndef RSH_WAVEFORM_GENERATOR_H
+#define RSH_WAVEFORM_GENERATOR_H
+
+#include "RshDefChk.h"
+#include "RshBufferType.h"
+#include "RshInitGSPF.h"
+#include "IRshDevice.h"
+#include "RshRandom.h"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * One component of multitone signal
+ *
+ * \~russian
+ * \brief
+ * Одна составляющая многотонального сигнала
+ *
+ */
+struct RshWaveformTone
+{
+	//! Frequency, Hz
+	double frequency;
+	//! Amplitude, volts
+	double amplitude;
+	//! Initial phase, radians
+	double phase;
+
+	RshWaveformTone(double frequency = 0.0, double amplitude = 0.0, double phase = 0.0) :
+		frequency(frequency), amplitude(amplitude), phase(phase) {}
+};
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Waveform synthesis engine for GSPF generators
+ *
+ * Fills ::RSH_BUFFER_S16 upload buffer in place with DAC codes
+ * of the requested signal, amplitudes are given in volts at
+ * generator output. Periodic signals are produced by 64 bit
+ * phase accumulator (numerically controlled oscillator) with
+ * interpolated sine table, so no sin() call is made per sample.\n
+ * Oscillator phase is kept between calls, so waveform can be
+ * generated block by block without discontinuity.
+ *
+ * \remarks
+ * Call SetOutput() once after IRshDevice::Init(), so scaling
+ * takes actual sampling frequency, output range, load and attenuator
+ * into account.
+ *
+ * \~russian
+ * \brief
+ * Синтез сигналов для генераторов GSPF
+ *
+ * Заполняет буфер выгрузки ::RSH_BUFFER_S16 кодами ЦАП заданного
+ * сигнала, амплитуды задаются в вольтах на выходе генератора.
+ * Периодические сигналы формируются 64-битным накопителем фазы
+ * (цифровым генератором, NCO) с интерполяцией по таблице синуса,
+ * поэтому sin() не вызывается для каждого отсчета.\n
+ * Фаза генератора сохраняется между вызовами, поэтому сигнал можно
+ * формировать поблочно без разрывов.
+ *
+ * \remarks
+ * Вызовите SetOutput() один раз после IRshDevice::Init(), чтобы
+ * при масштабировании учитывались фактическая частота дискретизации,
+ * выходной диапазон, нагрузка и аттенюатор.
+ *
+ */
+class RshWaveformGenerator
+{
+public:
+
+	RshWaveformGenerator();
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Set output parameters
+	 *
+	 * \param[in] sampleFrequency DAC sampling frequency, Hz.
+	 * \param[in] rangeVolts Output range (::RSH_GET_DEVICE_OUTPUT_RANGE_VOLTS).
+	 * \param[in] loadOhm Load resistance, 0 - high impedance load.
+	 * Generator output impedance is 50 Ohm.
+	 * \param[in] attenuator One of RshInitGSPF::Attenuator values.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS or ::RSH_API_PARAMETER_INVALID.
+	 *
+	 * \~russian
+	 * \brief
+	 * Установка параметров выхода
+	 *
+	 * \param[in] sampleFrequency Частота дискретизации ЦАП, Гц.
+	 * \param[in] rangeVolts Выходной диапазон (::RSH_GET_DEVICE_OUTPUT_RANGE_VOLTS).
+	 * \param[in] loadOhm Сопротивление нагрузки, 0 - высокоомная нагрузка.
+	 * Выходное сопротивление генератора 50 Ом.
+	 * \param[in] attenuator Одно из значений RshInitGSPF::Attenuator.
+	 *
+	 * \return
+	 * ::RSH_API_SUCCESS или ::RSH_API_PARAMETER_INVALID.
+	 *
+	 */
+	U32 SetOutput(double sampleFrequency, double rangeVolts, double loadOhm = 0.0, U32 attenuator = RshInitGSPF::AttenuationOff);
+
+	//! Same as above, frequency and attenuator are taken from initialized structure, range is requested from device
+	U32 SetOutput(IRshDevice* device, const RshInitGSPF& init, double loadOhm = 0.0);
+
+	//! Reset oscillator phase and sample counter
+	void Reset();
+
+	//! Sine wave. \b count = 0 - fill whole buffer (RshBufferType::PSize()).
+	U32 Sine(RSH_BUFFER_S16& buffer, size_t count, double frequency, double amplitude, double offset = 0.0);
+
+	//! Square wave, \b duty is part of period with high level (0..1)
+	U32 Square(RSH_BUFFER_S16& buffer, size_t count, double frequency, double amplitude, double duty = 0.5, double offset = 0.0);
+
+	//! Linear frequency sweep from \b startFrequency to \b stopFrequency over \b count samples
+	U32 Chirp(RSH_BUFFER_S16& buffer, size_t count, double startFrequency, double stopFrequency, double amplitude, double offset = 0.0);
+
+	//! Sum of sine waves
+	U32 Multitone(RSH_BUFFER_S16& buffer, size_t count, const std::vector<RshWaveformTone>& tones, double offset = 0.0);
+
+	//! Gaussian white noise with given RMS value, \b seed = 0 - random seed
+	U32 Noise(RSH_BUFFER_S16& buffer, size_t count, double rms, double offset = 0.0, U64 seed = 0);
+
+	/*!
+	 *
+	 * \~english
+	 * \brief
+	 * Arbitrary waveform from text file
+	 *
+	 * File contains sample values in volts separated by spaces,
+	 * tabs, commas or new lines. Every value becomes one sample.
+	 *
+	 * \param[out] buffer Buffer is resized to number of samples in file.
+	 * \param[in] fileName File path.
+	 * \param[in] scale All values are multiplied by this coefficient.
+	 * \param[in] offset Added to all values after scaling, volts.
+	 *
+	 * \~russian
+	 * \brief
+	 * Сигнал произвольной формы из текстового файла
+	 *
+	 * Файл содержит значения отсчетов в вольтах, разделенные пробелами,
+	 * табуляцией, запятыми или переводами строки. Каждое значение - один отсчет.
+	 *
+	 * \param[out] buffer Размер буфера устанавливается по числу отсчетов в файле.
+	 * \param[in] fileName Путь к файлу.
+	 * \param[in] scale Все значения умножаются на этот коэффициент.
+	 * \param[in] offset Прибавляется ко всем значениям после масштабирования, вольт.
+	 *
+	 */
+	U32 Arbitrary(RSH_BUFFER_S16& buffer, const char* fileName, double scale = 1.0, double offset = 0.0);
+
+	//! DAC codes per volt at generator output
+	double LsbPerVolt() const;
+
+private:
+
+	U32 Prepare(RSH_BUFFER_S16& buffer, size_t& count) const;
+	U64 PhaseStep(double frequency) const;
+	static U64 CyclesToPhase(double cycles);
+	double Interpolate(U64 phase) const;
+	void Quantize(const double* src, S16* dst, size_t count) const;
+
+	double m_sampleFrequency;
+	double m_lsbPerVolt;
+	U64 m_phase;
+	U64 m_sample;
+	RshRandom m_random;
+	std::vector<double> m_table;
+	std::vector<double> m_work;
+};
+
+#endif //RSH_WAVEFORM_GENERATOR_H
@@ -0,0 +1,646 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshBenchmark.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Throughput and latency benchmarks of SDK.
+ *
+ * Non interactive program which measures SDK overhead, so new SDK
+ * versions can be compared on the same host. Suites:
+ * - getdata - duration of IRshDevice::GetData() call (copy and conversion
+ * of block to user buffer), device generates blocks as fast as they are taken;
+ * - latency - time from block completion (RshBlockInfo::timestamp) to
+ * return of GetData() at real sample rate, lost blocks are counted;
+ * - allocate, copy, convert - RshBufferType construction, Copy() and
+ * conversion of samples to volts;
+ * - crc - RshCRC32() of buffer;
+ * - file - RshBufferType::WriteBufferToFile();
+ * - load - RshDllClient::GetDeviceInterface() and RshDllClient::Free()
+ * of --library (SIMULATOR by default).
+ *
+ * Each case is repeated for every combination of block size (samples
+ * per channel), channel count and buffer type. getdata and latency use
+ * RshSimulator object by default; with --library device is loaded from
+ * board library (for example SIMULATOR or demo device) and connected
+ * with --connect key. One line per case is printed to standard output,
+ * as CSV with header (default) or JSON objects (--format=json).
+ * Times are in nanoseconds per operation, mbps is megabytes of user
+ * buffer per second of operation time (of wall time for latency suite),
+ * status is SDK error code of case.
+ *
+ * \code
+ * RshBenchmark [--suites=getdata,latency,allocate,copy,convert,crc,file,load]
+ *     [--sizes=1024,16384,262144] [--channels=1,4,16] [--types=s16,s32,float,double]
+ *     [--time=0.1] [--rate=10000000] [--format=csv|json] [--dir=/tmp/]
+ *     [--library=SIMULATOR] [--connect=1] [--boards=/usr/lib/RSH/boards/]
+ * \endcode
+ *
+ * Build (Linux):
+ * \code
+ * g++ -O2 -I../HEADERS RshBenchmark.cpp -o RshBenchmark -ldl -lpthread
+ * \endcode
+ *
+ * \~russian
+ * \brief
+ * Измерение пропускной способности и задержек SDK.
+ *
+ * Неинтерактивная программа, измеряющая накладные расходы SDK, чтобы
+ * можно было сравнивать новые версии SDK на одном компьютере. Наборы:
+ * - getdata - длительность вызова IRshDevice::GetData() (копирование и
+ * преобразование блока в буфер пользователя), устройство создает блоки
+ * с той скоростью, с которой их забирают;
+ * - latency - время от завершения блока (RshBlockInfo::timestamp) до
+ * возврата из GetData() при реальной частоте дискретизации, считаются
+ * потерянные блоки;
+ * - allocate, copy, convert - создание RshBufferType, Copy() и
+ * преобразование отсчетов в вольты;
+ * - crc - RshCRC32() буфера;
+ * - file - RshBufferType::WriteBufferToFile();
+ * - load - RshDllClient::GetDeviceInterface() и RshDllClient::Free()
+ * для --library (по умолчанию SIMULATOR).
+ *
+ * Каждый тест повторяется для всех сочетаний размера блока (отсчетов
+ * на канал), числа каналов и типа буфера. getdata и latency по
+ * умолчанию используют объект RshSimulator; с параметром --library
+ * устройство загружается из библиотеки (например, SIMULATOR или
+ * демо-устройство) и подключается с ключом --connect. Для каждого
+ * теста в стандартный вывод печатается строка в формате CSV с
+ * заголовком (по умолчанию) или объект JSON (--format=json).
+ * Времена в наносекундах на операцию, mbps - мегабайты буфера
+ * пользователя в секунду времени операций (реального времени для
+ * набора latency), status - код ошибки SDK.
+ *
+ * Параметры командной строки и сборка приведены выше.
+ *
+ */
+
+//Заголовочные файлы Rsh SDK. RshApi.cpp тоже включен с помощью #include для простоты
+#include "RshApi.h"
+#include "RshApi.cpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+// every case runs at least this number of operations
+#define RSH_BENCHMARK_MIN_ITERATIONS 5
+
+// and at most this number, so per operation times fit in memory
+#define RSH_BENCHMARK_MAX_ITERATIONS 1000000
+
+// blocks taken before measurement starts
+#define RSH_BENCHMARK_WARMUP_BLOCKS 2
+
+struct RshBenchmarkOptions
+{
+	RshBenchmarkOptions() :
+		time(0.1), rate(10000000.0), json(false), dir("/tmp/"), connect("1")
+	{}
+
+	std::vector<std::string> suites;
+	std::vector<size_t> sizes;
+	std::vector<U32> channels;
+	std::vector<std::string> types;
+	double time;
+	double rate;
+	bool json;
+	std::string dir;
+	std::string library;
+	std::string connect;
+	std::string boards;
+};
+
+// one line of report
+struct RshBenchmarkResult
+{
+	RshBenchmarkResult(const std::string& benchmarkName, const std::string& typeName, U32 channelCount, size_t sampleCount, size_t byteCount) :
+		benchmark(benchmarkName), type(typeName), channels(channelCount), samples(sampleCount),
+		bytes(byteCount), seconds(0.0), lost(0), status(RSH_API_SUCCESS)
+	{}
+
+	std::string benchmark;
+	std::string type;
+	U32 channels;
+	size_t samples;
+	size_t bytes;
+	// nanoseconds of each operation
+	std::vector<U64> times;
+	// time for throughput, sum of times if zero
+	double seconds;
+	U64 lost;
+	U32 status;
+};
+
+static RshBenchmarkOptions rshBenchmarkOptions;
+static bool rshBenchmarkHeader = false;
+// results of measured operations are accumulated here, so they are not optimized out
+static volatile U64 rshBenchmarkSink = 0;
+
+static std::vector<std::string> RshBenchmarkSplit(const std::string& text)
+{
+	std::vector<std::string> items;
+	size_t start = 0;
+	while(start <= text.size())
+	{
+		size_t end = text.find(',', start);
+		if(end == std::string::npos)
+			end = text.size();
+		if(end > start)
+			items.push_back(text.substr(start, end - start));
+		start = end + 1;
+	}
+	return items;
+}
+
+static bool RshBenchmarkIsSelected(const std::string& suite)
+{
+	return std::find(rshBenchmarkOptions.suites.begin(), rshBenchmarkOptions.suites.end(), suite) != rshBenchmarkOptions.suites.end();
+}
+
+static double RshBenchmarkPercentile(const std::vector<U64>& sorted, double fraction)
+{
+	if(sorted.empty())
+		return 0.0;
+	return static_cast<double>(sorted[static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5)]);
+}
+
+static void RshBenchmarkPrint(const RshBenchmarkResult& result)
+{
+	std::vector<U64> sorted(result.times);
+	std::sort(sorted.begin(), sorted.end());
+
+	double total = 0.0;
+	for(size_t i = 0; i < sorted.size(); ++i)
+		total += static_cast<double>(sorted[i]);
+	const double mean = sorted.empty() ? 0.0 : total / sorted.size();
+	const double seconds = (result.seconds > 0.0) ? result.seconds : total * 1e-9;
+	const double mbps = (seconds > 0.0) ? static_cast<double>(result.bytes) * sorted.size() / seconds * 1e-6 : 0.0;
+
+	if(rshBenchmarkOptions.json)
+	{
+		printf("{\"benchmark\":\"%s\",\"type\":\"%s\",\"channels\":%u,\"samples\":%lu,\"bytes\":%lu,"
+			"\"iterations\":%lu,\"mean_ns\":%.1f,\"p50_ns\":%.0f,\"p99_ns\":%.0f,\"max_ns\":%.0f,"
+			"\"mbps\":%.2f,\"lost\":%llu,\"status\":\"0x%X\"}\n",
+			result.benchmark.c_str(), result.type.c_str(), result.channels,
+			static_cast<unsigned long>(result.samples), static_cast<unsigned long>(result.bytes),
+			static_cast<unsigned long>(sorted.size()), mean, RshBenchmarkPercentile(sorted, 0.5),
+			RshBenchmarkPercentile(sorted, 0.99), RshBenchmarkPercentile(sorted, 1.0),
+			mbps, static_cast<unsigned long long>(result.lost), result.status);
+	}
+	else
+	{
+		if(!rshBenchmarkHeader)
+		{
+			printf("benchmark,type,channels,samples,bytes,iterations,mean_ns,p50_ns,p99_ns,max_ns,mbps,lost,status\n");
+			rshBenchmarkHeader = true;
+		}
+		printf("%s,%s,%u,%lu,%lu,%lu,%.1f,%.0f,%.0f,%.0f,%.2f,%llu,0x%X\n",
+			result.benchmark.c_str(), result.type.c_str(), result.channels,
+			static_cast<unsigned long>(result.samples), static_cast<unsigned long>(result.bytes),
+			static_cast<unsigned long>(sorted.size()), mean, RshBenchmarkPercentile(sorted, 0.5),
+			RshBenchmarkPercentile(sorted, 0.99), RshBenchmarkPercentile(sorted, 1.0),
+			mbps, static_cast<unsigned long long>(result.lost), result.status);
+	}
+	fflush(stdout);
+}
+
+// repeats operation until time is over, operation returns SDK status
+template<typename Operation>
+static void RshBenchmarkRun(Operation& operation, RshBenchmarkResult& result)
+{
+	const U64 duration = static_cast<U64>(rshBenchmarkOptions.time * 1e9);
+	const U64 start = RshTimestamp::Now().NanoSeconds();
+	for(size_t i = 0; i < RSH_BENCHMARK_MAX_ITERATIONS; ++i)
+	{
+		const U64 t0 = RshTimestamp::Now().NanoSeconds();
+		const U32 st = operation();
+		const U64 t1 = RshTimestamp::Now().NanoSeconds();
+		if(st != RSH_API_SUCCESS)
+		{
+			result.status = st;
+			break;
+		}
+		result.times.push_back(t1 - t0);
+		if(i + 1 >= RSH_BENCHMARK_MIN_ITERATIONS && t1 - start >= duration)
+			break;
+	}
+	RshBenchmarkPrint(result);
+}
+
+template<typename T, RshDataTypes dataCode>
+struct RshBenchmarkAllocate
+{
+	explicit RshBenchmarkAllocate(size_t bufferSize) : size(bufferSize) {}
+
+	U32 operator()()
+	{
+		RshBufferType<T, dataCode> buffer(size);
+		if(buffer.PSize() != size)
+			return RSH_API_MEMORY_ALLOCATIONERROR;
+		rshBenchmarkSink += static_cast<U64>(buffer[size - 1]);
+		return RSH_API_SUCCESS;
+	}
+
+	size_t size;
+};
+
+template<typename T, RshDataTypes dataCode>
+struct RshBenchmarkCopy
+{
+	RshBenchmarkCopy(const RshBufferType<T, dataCode>& sourceBuffer, RshBufferType<T, dataCode>& destinationBuffer) :
+		source(sourceBuffer), destination(destinationBuffer)
+	{}
+
+	U32 operator()()
+	{
+		destination.Copy(source);
+		return (destination.Size() == source.Size()) ? RSH_API_SUCCESS : RSH_API_BUFFER_WRONGSIZE;
+	}
+
+	const RshBufferType<T, dataCode>& source;
+	RshBufferType<T, dataCode>& destination;
+};
+
+// samples to volts, as application does with codes of ADC
+template<typename T, RshDataTypes dataCode>
+struct RshBenchmarkConvert
+{
+	RshBenchmarkConvert(const RshBufferType<T, dataCode>& sourceBuffer, RSH_BUFFER_DOUBLE& voltsBuffer, double coefficient) :
+		source(sourceBuffer), volts(voltsBuffer), scale(coefficient)
+	{}
+
+	U32 operator()()
+	{
+		const size_t count = source.Size();
+		const T* src = source.ptr;
+		double* dst = volts.ptr;
+		for(size_t i = 0; i < count; ++i)
+			dst[i] = static_cast<double>(src[i]) * scale;
+		volts.SetSize(count);
+		return RSH_API_SUCCESS;
+	}
+
+	const RshBufferType<T, dataCode>& source;
+	RSH_BUFFER_DOUBLE& volts;
+	double scale;
+};
+
+template<typename T, RshDataTypes dataCode>
+struct RshBenchmarkCrc
+{
+	explicit RshBenchmarkCrc(RshBufferType<T, dataCode>& sourceBuffer) : source(sourceBuffer) {}
+
+	U32 operator()()
+	{
+		rshBenchmarkSink += RshCRC32(reinterpret_cast<U8*>(source.ptr), source.ByteSize());
+		return RSH_API_SUCCESS;
+	}
+
+	RshBufferType<T, dataCode>& source;
+};
+
+template<typename T, RshDataTypes dataCode>
+struct RshBenchmarkFile
+{
+	RshBenchmarkFile(const RshBufferType<T, dataCode>& sourceBuffer, const std::string& fileName) :
+		source(sourceBuffer), name(fileName)
+	{}
+
+	U32 operator()()
+	{
+		return source.WriteBufferToFile(name);
+	}
+
+	const RshBufferType<T, dataCode>& source;
+	std::string name;
+};
+
+struct RshBenchmarkLoad
+{
+	U32 operator()()
+	{
+		RshDllClient client(rshBenchmarkOptions.boards.empty() ? 0 : rshBenchmarkOptions.boards.c_str(), 0);
+		IRshDevice* device = 0;
+		RshDllInterfaceKey key(rshBenchmarkOptions.library.empty() ? "SIMULATOR" : rshBenchmarkOptions.library.c_str(), device);
+		const U32 st = client.GetDeviceInterface(key);
+		client.Free();
+		return st;
+	}
+};
+
+template<typename T, RshDataTypes dataCode>
+static void RshBenchmarkBuffers(const std::string& typeName, U32 channels, size_t samples)
+{
+	const size_t size = samples * channels;
+	const size_t bytes = size * sizeof(T);
+
+	RshBufferType<T, dataCode> source(size);
+	RshFillBufferWithRandomNumbers(source, 1);
+	RshBufferType<T, dataCode> destination(size);
+	RSH_BUFFER_DOUBLE volts(size);
+
+	if(RshBenchmarkIsSelected("allocate"))
+	{
+		RshBenchmarkResult result("allocate", typeName, channels, samples, bytes);
+		RshBenchmarkAllocate<T, dataCode> operation(size);
+		RshBenchmarkRun(operation, result);
+	}
+
+	if(RshBenchmarkIsSelected("copy"))
+	{
+		RshBenchmarkResult result("copy", typeName, channels, samples, bytes);
+		RshBenchmarkCopy<T, dataCode> operation(source, destination);
+		RshBenchmarkRun(operation, result);
+	}
+
+	if(RshBenchmarkIsSelected("convert"))
+	{
+		// 1 V input range at gain 1, codes use all bits of type
+		const double scale = (std::numeric_limits<T>::is_integer) ? RshLsbToVoltCoef(1, 1.0, static_cast<U8>(sizeof(T) * 8)) : 1.0;
+		RshBenchmarkResult result("convert", typeName, channels, samples, bytes);
+		RshBenchmarkConvert<T, dataCode> operation(source, volts, scale);
+		RshBenchmarkRun(operation, result);
+	}
+
+	if(RshBenchmarkIsSelected("crc"))
+	{
+		RshBenchmarkResult result("crc", typeName, channels, samples, bytes);
+		RshBenchmarkCrc<T, dataCode> operation(source);
+		RshBenchmarkRun(operation, result);
+	}
+
+	if(RshBenchmarkIsSelected("file"))
+	{
+		const std::string name = rshBenchmarkOptions.dir + "RshBenchmark.tmp";
+		RshBenchmarkResult result("file", typeName, channels, samples, bytes);
+		RshBenchmarkFile<T, dataCode> operation(source, name);
+		RshBenchmarkRun(operation, result);
+		remove(name.c_str());
+	}
+}
+
+// acquisition with device in persistent mode, realTime selects latency suite
+template<typename T, RshDataTypes dataCode>
+static void RshBenchmarkAcquire(IRshDevice* device, bool realTime, const std::string& typeName, U32 channels, size_t samples)
+{
+	const size_t size = samples * channels;
+	RshBenchmarkResult result(realTime ? "latency" : "getdata", typeName, channels, samples, size * sizeof(T));
+
+	RshInitDMA p;
+	p.startType = RshInitDMA::Program;
+	p.dmaMode = RshInitDMA::Persistent;
+	p.bufferSize = static_cast<U32>(samples);
+	p.frequency = rshBenchmarkOptions.rate;
+	p.channels.SetSize(channels);
+	for(U32 c = 0; c < channels; ++c)
+		p.channels[c].control = RshChannel::Used;
+
+	RshBufferType<T, dataCode> buffer(size);
+	RshBlockInfo info;
+	// wait for one block is limited by block period
+	RSH_U32 waitTime(static_cast<U32>(std::min(samples / rshBenchmarkOptions.rate * 10e3 + 1000.0, 60e3)));
+
+	result.status = device->Init(&p);
+	if(result.status == RSH_API_SUCCESS)
+		result.status = device->Start();
+
+	const U64 duration = static_cast<U64>(rshBenchmarkOptions.time * 1e9);
+	U64 start = 0;
+	U64 lastSequence = 0;
+	for(size_t i = 0; result.status == RSH_API_SUCCESS && i < RSH_BENCHMARK_MAX_ITERATIONS; ++i)
+	{
+		result.status = device->Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &waitTime);
+		if(result.status != RSH_API_SUCCESS)
+			break;
+		const U64 t0 = RshTimestamp::Now().NanoSeconds();
+		result.status = device->GetData(&buffer);
+		const U64 t1 = RshTimestamp::Now().NanoSeconds();
+		if(result.status != RSH_API_SUCCESS)
+			break;
+
+		// block info is optional
+		if(device->Get(RSH_GET_BUFFER_BLOCK_INFO, &info) != RSH_API_SUCCESS)
+			info = RshBlockInfo();
+
+		if(i < RSH_BENCHMARK_WARMUP_BLOCKS)
+		{
+			start = t1;
+			lastSequence = info.sequence;
+			continue;
+		}
+
+		if(realTime)
+		{
+			if(info.timestamp == 0 || info.timestamp > t1)
+			{
+				result.status = RSH_API_FUNCTION_NOTSUPPORTED;
+				break;
+			}
+			result.times.push_back(t1 - info.timestamp);
+		}
+		else
+		{
+			result.times.push_back(t1 - t0);
+		}
+
+		if(lastSequence != 0 && info.sequence > lastSequence + 1)
+			result.lost += info.sequence - lastSequence - 1;
+		lastSequence = info.sequence;
+
+		if(result.times.size() >= RSH_BENCHMARK_MIN_ITERATIONS && t1 - start >= duration)
+		{
+			if(realTime)
+				result.seconds = (t1 - start) * 1e-9;
+			break;
+		}
+	}
+
+	device->Stop();
+	RshBenchmarkPrint(result);
+}
+
+template<typename T, RshDataTypes dataCode>
+static void RshBenchmarkType(IRshDevice* device, RshSimulator* simulator, const std::string& typeName)
+{
+	for(size_t c = 0; c < rshBenchmarkOptions.channels.size(); ++c)
+	{
+		for(size_t s = 0; s < rshBenchmarkOptions.sizes.size(); ++s)
+		{
+			const U32 channels = rshBenchmarkOptions.channels[c];
+			const size_t samples = rshBenchmarkOptions.sizes[s];
+
+			if(device != 0 && RshBenchmarkIsSelected("getdata"))
+			{
+				if(simulator != 0)
+					simulator->Configure("realtime=0");
+				RshBenchmarkAcquire<T, dataCode>(device, false, typeName, channels, samples);
+			}
+
+			if(device != 0 && RshBenchmarkIsSelected("latency"))
+			{
+				if(simulator != 0)
+					simulator->Configure("realtime=1");
+				RshBenchmarkAcquire<T, dataCode>(device, true, typeName, channels, samples);
+			}
+
+			RshBenchmarkBuffers<T, dataCode>(typeName, channels, samples);
+		}
+	}
+}
+
+static bool RshBenchmarkParse(int argc, char* argv[])
+{
+	RshBenchmarkOptions& o = rshBenchmarkOptions;
+	std::string suites = "getdata,latency,allocate,copy,convert,crc,file,load";
+	std::string sizes = "1024,16384,262144";
+	std::string channels = "1,4,16";
+	std::string types = "s16,s32,float,double";
+
+	for(int i = 1; i < argc; ++i)
+	{
+		const std::string arg(argv[i]);
+		const size_t eq = arg.find('=');
+		if(arg.compare(0, 2, "--") != 0 || eq == std::string::npos)
+			return false;
+		const std::string name = arg.substr(2, eq - 2);
+		const std::string value = arg.substr(eq + 1);
+
+		if(name == "suites")
+			suites = value;
+		else if(name == "sizes")
+			sizes = value;
+		else if(name == "channels")
+			channels = value;
+		else if(name == "types")
+			types = value;
+		else if(name == "time")
+			o.time = atof(value.c_str());
+		else if(name == "rate")
+			o.rate = atof(value.c_str());
+		else if(name == "format" && (value == "csv" || value == "json"))
+			o.json = (value == "json");
+		else if(name == "dir")
+			o.dir = value;
+		else if(name == "library")
+			o.library = value;
+		else if(name == "connect")
+			o.connect = value;
+		else if(name == "boards")
+			o.boards = value;
+		else
+			return false;
+	}
+
+	o.suites = RshBenchmarkSplit(suites);
+	o.types = RshBenchmarkSplit(types);
+
+	std::vector<std::string> items = RshBenchmarkSplit(sizes);
+	for(size_t i = 0; i < items.size(); ++i)
+	{
+		const long size = atol(items[i].c_str());
+		if(size <= 0)
+			return false;
+		o.sizes.push_back(static_cast<size_t>(size));
+	}
+
+	items = RshBenchmarkSplit(channels);
+	for(size_t i = 0; i < items.size(); ++i)
+	{
+		const long count = atol(items[i].c_str());
+		if(count <= 0 || count > 1024)
+			return false;
+		o.channels.push_back(static_cast<U32>(count));
+	}
+
+	if(!o.dir.empty() && o.dir[o.dir.size() - 1] != '/' && o.dir[o.dir.size() - 1] != '\\')
+		o.dir += '/';
+
+	return o.time > 0.0 && o.rate > 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+	if(!RshBenchmarkParse(argc, argv))
+	{
+		fprintf(stderr, "Usage: %s [--suites=getdata,latency,allocate,copy,convert,crc,file,load]\n"
+			"\t[--sizes=1024,16384,262144] [--channels=1,4,16] [--types=s8,s16,s32,float,double]\n"
+			"\t[--time=0.1] [--rate=10000000] [--format=csv|json] [--dir=/tmp/]\n"
+			"\t[--library=SIMULATOR] [--connect=1] [--boards=/usr/lib/RSH/boards/]\n", argv[0]);
+		return 1;
+	}
+	const RshBenchmarkOptions& o = rshBenchmarkOptions;
+
+	// device for getdata and latency suites
+	RshSimulator simulator;
+	RshDllClient client(o.boards.empty() ? 0 : o.boards.c_str(), 0);
+	IRshDevice* device = 0;
+	RshSimulator* localSimulator = 0;
+	if(RshBenchmarkIsSelected("getdata") || RshBenchmarkIsSelected("latency"))
+	{
+		U32 st = RSH_API_SUCCESS;
+		if(o.library.empty())
+		{
+			const U32 maxChannels = *std::max_element(o.channels.begin(), o.channels.end());
+			char options[64];
+			sprintf(options, "channels=%u", maxChannels);
+			RshDeviceKey key(1);
+			st = simulator.Connect(&key);
+			if(st == RSH_API_SUCCESS)
+				st = simulator.Configure(options);
+			device = &simulator;
+			localSimulator = &simulator;
+		}
+		else
+		{
+			RshDllInterfaceKey interfaceKey(o.library.c_str(), device);
+			st = client.GetDeviceInterface(interfaceKey);
+			if(st == RSH_API_SUCCESS)
+			{
+				// number connects by serial, other text is passed to device
+				const long number = atol(o.connect.c_str());
+				RshDeviceKey key = (number > 0) ? RshDeviceKey(static_cast<U32>(number)) : RshDeviceKey(o.connect.c_str());
+				st = device->Connect(&key);
+			}
+		}
+
+		if(st != RSH_API_SUCCESS)
+		{
+			fprintf(stderr, "Device is not available (0x%X), getdata and latency suites are skipped\n", st);
+			device = 0;
+		}
+	}
+
+	for(size_t t = 0; t < o.types.size(); ++t)
+	{
+		const std::string& type = o.types[t];
+		if(type == "s8")
+			RshBenchmarkType<S8, rshBufferTypeS8>(device, localSimulator, type);
+		else if(type == "s16")
+			RshBenchmarkType<S16, rshBufferTypeS16>(device, localSimulator, type);
+		else if(type == "s32")
+			RshBenchmarkType<S32, rshBufferTypeS32>(device, localSimulator, type);
+		else if(type == "float")
+			RshBenchmarkType<float, rshBufferTypeFloat>(device, localSimulator, type);
+		else if(type == "double")
+			RshBenchmarkType<double, rshBufferTypeDouble>(device, localSimulator, type);
+		else
+			fprintf(stderr, "Unknown type %s is skipped\n", type.c_str());
+	}
+
+	if(RshBenchmarkIsSelected("load"))
+	{
+		RshBenchmarkResult result("load", "-", 0, 0, 0);
+		RshBenchmarkLoad operation;
+		RshBenchmarkRun(operation, result);
+	}
+
+	client.Free();
+	return 0;
+}
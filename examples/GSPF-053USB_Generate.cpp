@@ -260,15 +260,16 @@ int main()
 		return SayGoodBye(Client, RSH_API_PARAMETER_INVALID, "RSH_CMPDOUBLE(DACMaxAmp, 0.0)");
 	}
 	
-	//Коэффициент для пересчета из вольт в МЗР
-	double amplitudeCoef = SignalAmplitude / DACMaxAmp;
+	//Генератор сигналов: пересчет из вольт в МЗР с учетом нагрузки и аттенюатора
+	RshWaveformGenerator waveform;
+	st = waveform.SetOutput(device, gspfPar, OutR);
+	if (st != RSH_API_SUCCESS)
+		return SayGoodBye(Client, st, "waveform.SetOutput()");
 
-	//Заполняем буфер данными
-	for(U32 i = 0; i < buffer.PSize(); ++i) 
-	{
-		S16 value = static_cast<S16>( amplitudeCoef * 32768 * sin(i * (2 * 3.1415926 * SignalFreq) / gspfPar.frequency) ); 
-		buffer.PushBack(value);
-	}
+	//Заполняем буфер данными (также доступны Square, Chirp, Multitone, Noise, Arbitrary)
+	st = waveform.Sine(buffer, buffer.PSize(), SignalFreq, SignalAmplitude);
+	if (st != RSH_API_SUCCESS)
+		return SayGoodBye(Client, st, "waveform.Sine()");
 
 	//Если нужно использовать только часть буфера, можно указать размер (не выделяя память заново)
 	// buffer.SetSize(new_size); //new_size должен быть меньше или равен buffer.PSize()
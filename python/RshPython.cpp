@@ -0,0 +1,1216 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshPython.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Python extension module "rsh".
+ *
+ * Gives access to devices from Python through RshDllClient and
+ * IRshDevice. Data buffers support buffer protocol, so numpy.asarray()
+ * makes array over buffer memory without copying. Global interpreter
+ * lock is released while waiting for data and in IRshDevice::GetData(),
+ * so other Python threads keep running during acquisition.
+ *
+ * Build (Linux):
+ * \code
+ * g++ -O2 -shared -fPIC -I../HEADERS $(python3-config --includes) RshPython.cpp \
+ *     -o rsh$(python3-config --extension-suffix) -ldl -lpthread
+ * \endcode
+ *
+ * Usage:
+ * \code
+ * import numpy, rsh
+ * client = rsh.Client()
+ * device = client.device("LAn10_12USB")
+ * device.connect(1)
+ * device.init_dma(frequency=1.0e+6, buffer_size=65536, channels=2)
+ * with device.stream("h", blocks=16) as stream:
+ *     for block in stream:
+ *         data = numpy.asarray(block).reshape(-1, 2)
+ *         ...
+ *         block.release()
+ * \endcode
+ *
+ * \~russian
+ * \brief
+ * Модуль расширения Python "rsh".
+ *
+ * Предоставляет доступ к устройствам из Python с помощью RshDllClient и
+ * IRshDevice. Буферы данных поддерживают buffer protocol, поэтому
+ * numpy.asarray() создает массив над памятью буфера без копирования.
+ * Глобальная блокировка интерпретатора освобождается на время ожидания
+ * данных и вызова IRshDevice::GetData(), поэтому другие потоки Python
+ * продолжают работать во время сбора.
+ *
+ * Сборка и пример использования приведены выше.
+ *
+ */
+
+#include <Python.h>
+
+//Заголовочные файлы Rsh SDK. RshApi.cpp тоже включен с помощью #include для простоты
+#include "RshApi.h"
+#include "RshApi.cpp"
+
+#include <string>
+#include <vector>
+
+// slot index which means "no slot"
+#define RSH_PYTHON_NO_SLOT 0xFFFFFFFF
+
+// poll interval of stream iterator while ring is empty, ms
+#define RSH_PYTHON_POLL_INTERVAL 1
+
+static PyObject* RshPyError = 0;
+
+// raise rsh.Error(code, description), exception has "code" attribute
+static PyObject* RshPyRaise(U32 code)
+{
+	std::string description;
+	if(RshError::GetErrorDescription(code, description, RSH_LANGUAGE_ENGLISH) != RSH_API_SUCCESS)
+		description = "Unknown error";
+
+	PyObject* exception = PyObject_CallFunction(RshPyError, "Is", static_cast<unsigned int>(code), description.c_str());
+	if(exception == 0)
+		return 0;
+	PyObject* value = PyLong_FromUnsignedLong(code);
+	if(value != 0)
+	{
+		PyObject_SetAttrString(exception, "code", value);
+		Py_DECREF(value);
+	}
+	PyErr_SetObject(RshPyError, exception);
+	Py_DECREF(exception);
+	return 0;
+}
+
+//====================================== STORAGE ======================================
+
+// RshBufferType of any element type, selected by buffer protocol format character
+class RshPyStorage
+{
+public:
+	virtual ~RshPyStorage() {}
+
+	virtual RshBaseType* Base() = 0;
+	virtual void* Data() = 0;
+	virtual size_t Size() const = 0;
+	virtual size_t Capacity() const = 0;
+	virtual U32 Allocate(size_t size) = 0;
+	virtual Py_ssize_t ItemSize() const = 0;
+
+	const char* Format() const { return m_format; }
+
+protected:
+	char m_format[2];
+};
+
+template<typename T, RshDataTypes dataCode>
+class RshPyStorageType : public RshPyStorage
+{
+public:
+	explicit RshPyStorageType(char format)
+	{
+		m_format[0] = format;
+		m_format[1] = 0;
+	}
+
+	RshBaseType* Base() { return &m_buffer; }
+	void* Data() { return m_buffer.ptr; }
+	size_t Size() const { return m_buffer.Size(); }
+	size_t Capacity() const { return m_buffer.PSize(); }
+	Py_ssize_t ItemSize() const { return sizeof(T); }
+
+	U32 Allocate(size_t size)
+	{
+		U32 st = m_buffer.Allocate(size == 0 ? 1 : size);
+		if(st == RSH_API_SUCCESS)
+			m_buffer.SetSize(size);
+		return st;
+	}
+
+private:
+	RshBufferType<T, dataCode> m_buffer;
+};
+
+// 0 if format is not supported
+static RshPyStorage* RshPyCreateStorage(char format)
+{
+	switch(format)
+	{
+	case 'b': return new RshPyStorageType<S8, rshBufferTypeS8>(format);
+	case 'B': return new RshPyStorageType<U8, rshBufferTypeU8>(format);
+	case 'h': return new RshPyStorageType<S16, rshBufferTypeS16>(format);
+	case 'H': return new RshPyStorageType<U16, rshBufferTypeU16>(format);
+	case 'i': return new RshPyStorageType<S32, rshBufferTypeS32>(format);
+	case 'I': return new RshPyStorageType<U32, rshBufferTypeU32>(format);
+	case 'q': return new RshPyStorageType<S64, rshBufferTypeS64>(format);
+	case 'Q': return new RshPyStorageType<U64, rshBufferTypeU64>(format);
+	case 'f': return new RshPyStorageType<float, rshBufferTypeFloat>(format);
+	case 'd': return new RshPyStorageType<double, rshBufferTypeDouble>(format);
+	default: return 0;
+	}
+}
+
+static RshPyStorage* RshPyCreateStorage(const char* format, size_t size)
+{
+	RshPyStorage* storage = (format != 0 && format[0] != 0 && format[1] == 0) ? RshPyCreateStorage(format[0]) : 0;
+	if(storage == 0)
+	{
+		PyErr_Format(PyExc_ValueError, "unsupported buffer format '%s', use one of bBhHiIqQfd", format ? format : "");
+		return 0;
+	}
+
+	U32 st = storage->Allocate(size);
+	if(st != RSH_API_SUCCESS)
+	{
+		delete storage;
+		RshPyRaise(st);
+		return 0;
+	}
+	return storage;
+}
+
+// one dimensional view over storage, shape is kept in view->internal
+static int RshPyFillView(PyObject* owner, RshPyStorage* storage, Py_buffer* view, int flags)
+{
+	Py_ssize_t* shape = static_cast<Py_ssize_t*>(PyMem_Malloc(sizeof(Py_ssize_t)));
+	if(shape == 0)
+	{
+		PyErr_NoMemory();
+		return -1;
+	}
+	*shape = static_cast<Py_ssize_t>(storage->Size());
+
+	view->obj = owner;
+	Py_INCREF(owner);
+	view->buf = storage->Data();
+	view->itemsize = storage->ItemSize();
+	view->len = *shape * view->itemsize;
+	view->readonly = 0;
+	view->ndim = 1;
+	view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(storage->Format()) : 0;
+	view->shape = (flags & PyBUF_ND) ? shape : 0;
+	view->strides = (flags & PyBUF_STRIDES) ? &view->itemsize : 0;
+	view->suboffsets = 0;
+	view->internal = shape;
+	return 0;
+}
+
+//====================================== BUFFER ======================================
+
+struct RshPyBuffer
+{
+	PyObject_HEAD
+	RshPyStorage* storage;
+	Py_ssize_t exports;
+};
+
+static PyTypeObject RshPyBufferType;
+
+static int RshPyBuffer_init(RshPyBuffer* self, PyObject* args, PyObject* kwds)
+{
+	static const char* keywords[] = { "format", "size", 0 };
+	const char* format = "h";
+	Py_ssize_t size = 0;
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "|sn", const_cast<char**>(keywords), &format, &size))
+		return -1;
+	if(size < 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "size must not be negative");
+		return -1;
+	}
+	if(self->exports != 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "buffer is exported");
+		return -1;
+	}
+
+	RshPyStorage* storage = RshPyCreateStorage(format, static_cast<size_t>(size));
+	if(storage == 0)
+		return -1;
+	delete self->storage;
+	self->storage = storage;
+	return 0;
+}
+
+static void RshPyBuffer_dealloc(RshPyBuffer* self)
+{
+	delete self->storage;
+	Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+static int RshPyBuffer_getbuffer(RshPyBuffer* self, Py_buffer* view, int flags)
+{
+	if(self->storage == 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "buffer is not initialized");
+		return -1;
+	}
+	if(RshPyFillView(reinterpret_cast<PyObject*>(self), self->storage, view, flags) != 0)
+		return -1;
+	++self->exports;
+	return 0;
+}
+
+static void RshPyBuffer_releasebuffer(RshPyBuffer* self, Py_buffer* view)
+{
+	PyMem_Free(view->internal);
+	--self->exports;
+}
+
+static Py_ssize_t RshPyBuffer_length(RshPyBuffer* self)
+{
+	return self->storage ? static_cast<Py_ssize_t>(self->storage->Size()) : 0;
+}
+
+static PyObject* RshPyBuffer_resize(RshPyBuffer* self, PyObject* args)
+{
+	Py_ssize_t size = 0;
+	if(!PyArg_ParseTuple(args, "n", &size))
+		return 0;
+	if(size < 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "size must not be negative");
+		return 0;
+	}
+	// arrays made over buffer would point to freed memory
+	if(self->exports != 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "buffer is exported");
+		return 0;
+	}
+	U32 st = self->storage->Allocate(static_cast<size_t>(size));
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	Py_RETURN_NONE;
+}
+
+static PyObject* RshPyBuffer_getformat(RshPyBuffer* self, void*)
+{
+	return PyUnicode_FromString(self->storage ? self->storage->Format() : "");
+}
+
+static PyObject* RshPyBuffer_getcapacity(RshPyBuffer* self, void*)
+{
+	return PyLong_FromSize_t(self->storage ? self->storage->Capacity() : 0);
+}
+
+static PyMethodDef RshPyBuffer_methods[] = {
+	{ "resize", reinterpret_cast<PyCFunction>(RshPyBuffer_resize), METH_VARARGS,
+		"resize(size)\n\nReallocate buffer for size elements. Not allowed while buffer is exported." },
+	{ 0, 0, 0, 0 }
+};
+
+static PyGetSetDef RshPyBuffer_getset[] = {
+	{ const_cast<char*>("format"), reinterpret_cast<getter>(RshPyBuffer_getformat), 0, const_cast<char*>("Element format (struct module notation)"), 0 },
+	{ const_cast<char*>("capacity"), reinterpret_cast<getter>(RshPyBuffer_getcapacity), 0, const_cast<char*>("Allocated number of elements"), 0 },
+	{ 0, 0, 0, 0, 0 }
+};
+
+static PySequenceMethods RshPyBuffer_sequence;
+static PyBufferProcs RshPyBuffer_bufferprocs;
+
+//====================================== CLIENT ======================================
+
+struct RshPyClient
+{
+	PyObject_HEAD
+	RshDllClient* client;
+};
+
+static PyTypeObject RshPyClientType;
+
+struct RshPyDevice
+{
+	PyObject_HEAD
+	IRshDevice* device;
+	PyObject* client;
+	// samples of all channels in one block after last init
+	size_t blockSize;
+	// stream which uses device, device methods are not thread safe
+	PyObject* stream;
+};
+
+static PyTypeObject RshPyDeviceType;
+
+static int RshPyClient_init(RshPyClient* self, PyObject* args, PyObject* kwds)
+{
+	static const char* keywords[] = { 0 };
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "", const_cast<char**>(keywords)))
+		return -1;
+	if(self->client == 0)
+		self->client = new RshDllClient();
+	return 0;
+}
+
+static void RshPyClient_dealloc(RshPyClient* self)
+{
+	// devices hold reference to client, so all of them are already released
+	if(self->client != 0)
+	{
+		self->client->Free();
+		delete self->client;
+	}
+	Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+static PyObject* RshPyClient_registered(RshPyClient* self, PyObject*)
+{
+	std::vector<std::string> names;
+	U32 st = self->client->GetRegisteredList(names);
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+
+	PyObject* list = PyList_New(static_cast<Py_ssize_t>(names.size()));
+	if(list == 0)
+		return 0;
+	for(size_t i = 0; i < names.size(); ++i)
+	{
+		PyObject* name = PyUnicode_FromString(names[i].c_str());
+		if(name == 0)
+		{
+			Py_DECREF(list);
+			return 0;
+		}
+		PyList_SET_ITEM(list, static_cast<Py_ssize_t>(i), name);
+	}
+	return list;
+}
+
+static PyObject* RshPyClient_device(RshPyClient* self, PyObject* args)
+{
+	const char* name = 0;
+	if(!PyArg_ParseTuple(args, "s", &name))
+		return 0;
+
+	IRshDevice* device = 0;
+	RshDllInterfaceKey key(name, device);
+	U32 st = self->client->GetDeviceInterface(key);
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+
+	RshPyDevice* result = PyObject_New(RshPyDevice, &RshPyDeviceType);
+	if(result == 0)
+		return 0;
+	result->device = device;
+	result->client = reinterpret_cast<PyObject*>(self);
+	Py_INCREF(self);
+	result->blockSize = 0;
+	result->stream = 0;
+	return reinterpret_cast<PyObject*>(result);
+}
+
+static PyMethodDef RshPyClient_methods[] = {
+	{ "registered", reinterpret_cast<PyCFunction>(RshPyClient_registered), METH_NOARGS,
+		"registered() -> list\n\nNames of registered device libraries." },
+	{ "device", reinterpret_cast<PyCFunction>(RshPyClient_device), METH_VARARGS,
+		"device(name) -> Device\n\nLoad device interface from library, for example device(\"LA2USB\")." },
+	{ 0, 0, 0, 0 }
+};
+
+//====================================== STREAM ======================================
+
+/*
+ * Background thread waits for blocks and gets them into preallocated
+ * slots. Indexes of filled slots go to "ready" ring, Python side returns
+ * slots to "free" ring when block is released. Each ring has one
+ * producer and one consumer (Python side is serialized by interpreter
+ * lock), so RshRingBuffer needs no locks. If all slots are held by
+ * Python, block is got into scratch slot and dropped. Slot of failed
+ * GetData() is kept in "failed" and returned to "free" ring by Python
+ * side after thread is joined.
+ */
+struct RshPyStream
+{
+	PyObject_HEAD
+	PyObject* owner;
+	IRshDevice* device;
+	U32 timeout;
+	std::vector<RshPyStorage*>* slots;
+	std::vector<RshBlockInfo>* infos;
+	RshPyStorage* scratch;
+	RshRingBuffer<U32>* ready;
+	RshRingBuffer<U32>* released;
+	RshThread* thread;
+	volatile bool running;
+	volatile U32 status;
+	volatile U64 received;
+	volatile U64 overruns;
+	volatile U64 lost;
+	U64 lastSequence;
+	U32 failed;
+};
+
+static PyTypeObject RshPyStreamType;
+
+struct RshPyBlock
+{
+	PyObject_HEAD
+	PyObject* stream;
+	U32 slot;
+	Py_ssize_t exports;
+	RshBlockInfo info;
+};
+
+static PyTypeObject RshPyBlockType;
+
+static void RshPyStream_routine(void* param)
+{
+	RshPyStream* self = static_cast<RshPyStream*>(param);
+
+	while(self->running)
+	{
+		RSH_U32 wait = self->timeout;
+		U32 st = self->device->Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait);
+		if(st == RSH_API_EVENT_WAITTIMEOUT)
+			continue;
+		if(st == RSH_API_SUCCESS)
+		{
+			U32 slot = RSH_PYTHON_NO_SLOT;
+			RshPyStorage* storage = self->released->Pop(slot) ? (*self->slots)[slot] : self->scratch;
+			st = self->device->GetData(storage->Base());
+			if(st == RSH_API_SUCCESS)
+			{
+				RshBlockInfo info;
+				if(self->device->Get(RSH_GET_BUFFER_BLOCK_INFO, &info) != RSH_API_SUCCESS)
+					info = RshBlockInfo();
+				if(info.sequence != 0)
+				{
+					if(self->lastSequence != 0 && info.sequence > self->lastSequence + 1)
+						self->lost += info.sequence - self->lastSequence - 1;
+					self->lastSequence = info.sequence;
+				}
+
+				++self->received;
+				if(slot == RSH_PYTHON_NO_SLOT)
+				{
+					++self->overruns;
+					continue;
+				}
+				(*self->infos)[slot] = info;
+				// ring has room for every slot, so push never fails
+				self->ready->Push(slot);
+				continue;
+			}
+			self->failed = slot;
+		}
+
+		// errors after stop request are result of stopping
+		if(self->running)
+			self->status = st;
+		break;
+	}
+	self->running = false;
+}
+
+static void RshPyStream_halt(RshPyStream* self)
+{
+	if(self->thread == 0 || !self->thread->IsRunning())
+		return;
+
+	self->running = false;
+	Py_BEGIN_ALLOW_THREADS
+	self->thread->Join();
+	self->device->Stop();
+	Py_END_ALLOW_THREADS
+
+	if(self->failed != RSH_PYTHON_NO_SLOT)
+	{
+		self->released->Push(self->failed);
+		self->failed = RSH_PYTHON_NO_SLOT;
+	}
+
+	RshPyDevice* owner = reinterpret_cast<RshPyDevice*>(self->owner);
+	if(owner->stream == reinterpret_cast<PyObject*>(self))
+		owner->stream = 0;
+}
+
+static void RshPyStream_dealloc(RshPyStream* self)
+{
+	// blocks hold reference to stream, so all slots are returned
+	RshPyStream_halt(self);
+	if(self->slots != 0)
+	{
+		for(size_t i = 0; i < self->slots->size(); ++i)
+			delete (*self->slots)[i];
+	}
+	delete self->slots;
+	delete self->infos;
+	delete self->scratch;
+	delete self->ready;
+	delete self->released;
+	delete self->thread;
+	Py_XDECREF(self->owner);
+	Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+static PyObject* RshPyStream_iter(PyObject* self)
+{
+	Py_INCREF(self);
+	return self;
+}
+
+static PyObject* RshPyStream_next(RshPyStream* self)
+{
+	U32 slot = RSH_PYTHON_NO_SLOT;
+	while(!self->ready->Pop(slot))
+	{
+		if(!self->running)
+		{
+			// blocks got before stop are returned first
+			if(self->ready->Pop(slot))
+				break;
+			if(self->status != RSH_API_SUCCESS)
+			{
+				const U32 status = self->status;
+				self->status = RSH_API_SUCCESS;
+				return RshPyRaise(status);
+			}
+			return 0;
+		}
+
+		Py_BEGIN_ALLOW_THREADS
+		__rshmssleep(RSH_PYTHON_POLL_INTERVAL);
+		Py_END_ALLOW_THREADS
+
+		if(PyErr_CheckSignals() != 0)
+			return 0;
+	}
+
+	RshPyBlock* block = PyObject_New(RshPyBlock, &RshPyBlockType);
+	if(block == 0)
+	{
+		self->released->Push(slot);
+		return 0;
+	}
+	block->stream = reinterpret_cast<PyObject*>(self);
+	Py_INCREF(self);
+	block->slot = slot;
+	block->exports = 0;
+	block->info = (*self->infos)[slot];
+	return reinterpret_cast<PyObject*>(block);
+}
+
+static PyObject* RshPyStream_stop(RshPyStream* self, PyObject*)
+{
+	RshPyStream_halt(self);
+	Py_RETURN_NONE;
+}
+
+static PyObject* RshPyStream_enter(PyObject* self, PyObject*)
+{
+	Py_INCREF(self);
+	return self;
+}
+
+static PyObject* RshPyStream_exit(RshPyStream* self, PyObject*)
+{
+	RshPyStream_halt(self);
+	Py_RETURN_FALSE;
+}
+
+static PyObject* RshPyStream_getrunning(RshPyStream* self, void*)
+{
+	return PyBool_FromLong(self->running ? 1 : 0);
+}
+
+static PyObject* RshPyStream_getreceived(RshPyStream* self, void*)
+{
+	return PyLong_FromUnsignedLongLong(self->received);
+}
+
+static PyObject* RshPyStream_getoverruns(RshPyStream* self, void*)
+{
+	return PyLong_FromUnsignedLongLong(self->overruns);
+}
+
+static PyObject* RshPyStream_getlost(RshPyStream* self, void*)
+{
+	return PyLong_FromUnsignedLongLong(self->lost);
+}
+
+static PyObject* RshPyStream_getpending(RshPyStream* self, void*)
+{
+	return PyLong_FromUnsignedLong(self->ready->Count());
+}
+
+static PyMethodDef RshPyStream_methods[] = {
+	{ "stop", reinterpret_cast<PyCFunction>(RshPyStream_stop), METH_NOARGS,
+		"stop()\n\nStop background thread and device. Blocks already got can still be iterated." },
+	{ "__enter__", RshPyStream_enter, METH_NOARGS, 0 },
+	{ "__exit__", reinterpret_cast<PyCFunction>(RshPyStream_exit), METH_VARARGS, 0 },
+	{ 0, 0, 0, 0 }
+};
+
+static PyGetSetDef RshPyStream_getset[] = {
+	{ const_cast<char*>("running"), reinterpret_cast<getter>(RshPyStream_getrunning), 0, const_cast<char*>("True until stop() or device error"), 0 },
+	{ const_cast<char*>("received"), reinterpret_cast<getter>(RshPyStream_getreceived), 0, const_cast<char*>("Blocks got from device"), 0 },
+	{ const_cast<char*>("overruns"), reinterpret_cast<getter>(RshPyStream_getoverruns), 0, const_cast<char*>("Blocks dropped because all slots were held by Python"), 0 },
+	{ const_cast<char*>("lost"), reinterpret_cast<getter>(RshPyStream_getlost), 0, const_cast<char*>("Blocks lost by driver (gaps in sequence numbers)"), 0 },
+	{ const_cast<char*>("pending"), reinterpret_cast<getter>(RshPyStream_getpending), 0, const_cast<char*>("Blocks waiting for iteration"), 0 },
+	{ 0, 0, 0, 0, 0 }
+};
+
+//====================================== BLOCK ======================================
+
+static void RshPyBlock_return(RshPyBlock* self)
+{
+	if(self->slot == RSH_PYTHON_NO_SLOT)
+		return;
+	reinterpret_cast<RshPyStream*>(self->stream)->released->Push(self->slot);
+	self->slot = RSH_PYTHON_NO_SLOT;
+}
+
+static void RshPyBlock_dealloc(RshPyBlock* self)
+{
+	RshPyBlock_return(self);
+	Py_XDECREF(self->stream);
+	Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+static int RshPyBlock_getbuffer(RshPyBlock* self, Py_buffer* view, int flags)
+{
+	if(self->slot == RSH_PYTHON_NO_SLOT)
+	{
+		PyErr_SetString(PyExc_BufferError, "block is released");
+		return -1;
+	}
+	RshPyStorage* storage = (*reinterpret_cast<RshPyStream*>(self->stream)->slots)[self->slot];
+	if(RshPyFillView(reinterpret_cast<PyObject*>(self), storage, view, flags) != 0)
+		return -1;
+	++self->exports;
+	return 0;
+}
+
+static void RshPyBlock_releasebuffer(RshPyBlock* self, Py_buffer* view)
+{
+	PyMem_Free(view->internal);
+	--self->exports;
+}
+
+static Py_ssize_t RshPyBlock_length(RshPyBlock* self)
+{
+	if(self->slot == RSH_PYTHON_NO_SLOT)
+		return 0;
+	return static_cast<Py_ssize_t>((*reinterpret_cast<RshPyStream*>(self->stream)->slots)[self->slot]->Size());
+}
+
+static PyObject* RshPyBlock_release(RshPyBlock* self, PyObject*)
+{
+	// slot memory is reused for next blocks
+	if(self->exports != 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "block is exported, delete arrays made from it first");
+		return 0;
+	}
+	RshPyBlock_return(self);
+	Py_RETURN_NONE;
+}
+
+static PyObject* RshPyBlock_enter(PyObject* self, PyObject*)
+{
+	Py_INCREF(self);
+	return self;
+}
+
+static PyObject* RshPyBlock_exit(RshPyBlock* self, PyObject*)
+{
+	if(self->exports == 0)
+		RshPyBlock_return(self);
+	Py_RETURN_FALSE;
+}
+
+static PyObject* RshPyBlock_getsequence(RshPyBlock* self, void*)
+{
+	return PyLong_FromUnsignedLongLong(self->info.sequence);
+}
+
+static PyObject* RshPyBlock_gettimestamp(RshPyBlock* self, void*)
+{
+	return PyLong_FromUnsignedLongLong(self->info.timestamp);
+}
+
+static PyObject* RshPyBlock_getreleased(RshPyBlock* self, void*)
+{
+	return PyBool_FromLong(self->slot == RSH_PYTHON_NO_SLOT ? 1 : 0);
+}
+
+static PyMethodDef RshPyBlock_methods[] = {
+	{ "release", reinterpret_cast<PyCFunction>(RshPyBlock_release), METH_NOARGS,
+		"release()\n\nReturn block memory to stream. Done automatically when block is deleted." },
+	{ "__enter__", RshPyBlock_enter, METH_NOARGS, 0 },
+	{ "__exit__", reinterpret_cast<PyCFunction>(RshPyBlock_exit), METH_VARARGS, 0 },
+	{ 0, 0, 0, 0 }
+};
+
+static PyGetSetDef RshPyBlock_getset[] = {
+	{ const_cast<char*>("sequence"), reinterpret_cast<getter>(RshPyBlock_getsequence), 0, const_cast<char*>("Driver sequence number, 0 if not available"), 0 },
+	{ const_cast<char*>("timestamp"), reinterpret_cast<getter>(RshPyBlock_gettimestamp), 0, const_cast<char*>("Transfer completion time in ns, 0 if not available"), 0 },
+	{ const_cast<char*>("released"), reinterpret_cast<getter>(RshPyBlock_getreleased), 0, const_cast<char*>("True after release()"), 0 },
+	{ 0, 0, 0, 0, 0 }
+};
+
+static PySequenceMethods RshPyBlock_sequence;
+static PyBufferProcs RshPyBlock_bufferprocs;
+
+//====================================== DEVICE ======================================
+
+static void RshPyDevice_dealloc(RshPyDevice* self)
+{
+	// stream holds reference to device, so it is already stopped
+	Py_XDECREF(self->client);
+	Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+static bool RshPyDevice_check(RshPyDevice* self)
+{
+	if(self->stream == 0)
+		return true;
+	PyErr_SetString(PyExc_RuntimeError, "device is used by stream, stop it first");
+	return false;
+}
+
+static PyObject* RshPyDevice_connect(RshPyDevice* self, PyObject* args)
+{
+	unsigned int index = 1;
+	if(!PyArg_ParseTuple(args, "|I", &index))
+		return 0;
+	if(!RshPyDevice_check(self))
+		return 0;
+
+	RshDeviceKey key(static_cast<U32>(index));
+	U32 st;
+	Py_BEGIN_ALLOW_THREADS
+	st = self->device->Connect(&key);
+	Py_END_ALLOW_THREADS
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	Py_RETURN_NONE;
+}
+
+// common part of init_dma() and init_memory()
+static PyObject* RshPyDevice_initialize(RshPyDevice* self, RshInitADC& init, int channels, unsigned int gain)
+{
+	if(!RshPyDevice_check(self))
+		return 0;
+	if(channels <= 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "channels must be positive");
+		return 0;
+	}
+
+	init.channels.SetSize(static_cast<size_t>(channels));
+	for(int i = 0; i < channels; ++i)
+	{
+		init.channels[i].SetUsed();
+		init.channels[i].gain = gain;
+	}
+
+	// parameters may be corrected by device
+	U32 st = self->device->Init(&init);
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+
+	RSH_U32 active = 0;
+	st = self->device->Get(RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER, &active);
+	if(st != RSH_API_SUCCESS)
+		active.data = static_cast<U32>(channels);
+	self->blockSize = static_cast<size_t>(init.bufferSize) * active.data;
+	return Py_BuildValue("(dI)", init.frequency, static_cast<unsigned int>(init.bufferSize));
+}
+
+static PyObject* RshPyDevice_init_dma(RshPyDevice* self, PyObject* args, PyObject* kwds)
+{
+	static const char* keywords[] = { "frequency", "buffer_size", "channels", "gain", "persistent", "start_type", 0 };
+	double frequency = 0.0;
+	unsigned int bufferSize = 0;
+	int channels = 1;
+	unsigned int gain = 1;
+	int persistent = 1;
+	unsigned int startType = RshInitADC::Program;
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "dI|iIpI", const_cast<char**>(keywords),
+		&frequency, &bufferSize, &channels, &gain, &persistent, &startType))
+		return 0;
+
+	RshInitDMA init;
+	init.startType = startType;
+	init.dmaMode = persistent ? RshInitDMA::Persistent : RshInitDMA::Single;
+	init.bufferSize = bufferSize;
+	init.frequency = frequency;
+	return RshPyDevice_initialize(self, init, channels, gain);
+}
+
+static PyObject* RshPyDevice_init_memory(RshPyDevice* self, PyObject* args, PyObject* kwds)
+{
+	static const char* keywords[] = { "frequency", "buffer_size", "channels", "gain", "start_type", 0 };
+	double frequency = 0.0;
+	unsigned int bufferSize = 0;
+	int channels = 1;
+	unsigned int gain = 1;
+	unsigned int startType = RshInitADC::Program;
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "dI|iII", const_cast<char**>(keywords),
+		&frequency, &bufferSize, &channels, &gain, &startType))
+		return 0;
+
+	RshInitMemory init;
+	init.startType = startType;
+	init.bufferSize = bufferSize;
+	init.frequency = frequency;
+	return RshPyDevice_initialize(self, init, channels, gain);
+}
+
+static PyObject* RshPyDevice_get(RshPyDevice* self, PyObject* args)
+{
+	unsigned int code = 0;
+	unsigned int value = 0;
+	if(!PyArg_ParseTuple(args, "I|I", &code, &value))
+		return 0;
+	if(!RshPyDevice_check(self))
+		return 0;
+
+	RSH_U32 result = static_cast<U32>(value);
+	U32 st = self->device->Get(code, &result);
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	return PyLong_FromUnsignedLong(result.data);
+}
+
+static PyObject* RshPyDevice_get_string(RshPyDevice* self, PyObject* args)
+{
+	unsigned int code = 0;
+	if(!PyArg_ParseTuple(args, "I", &code))
+		return 0;
+	if(!RshPyDevice_check(self))
+		return 0;
+
+	RSH_S8P result = 0;
+	U32 st = self->device->Get(code, &result);
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	const char* text = result.data ? reinterpret_cast<const char*>(result.data) : "";
+	return PyUnicode_DecodeLatin1(text, static_cast<Py_ssize_t>(strlen(text)), "replace");
+}
+
+static PyObject* RshPyDevice_is_capable(RshPyDevice* self, PyObject* args)
+{
+	unsigned int caps = 0;
+	if(!PyArg_ParseTuple(args, "I", &caps))
+		return 0;
+	if(!RshPyDevice_check(self))
+		return 0;
+
+	RSH_U32 value = static_cast<U32>(caps);
+	return PyBool_FromLong(self->device->Get(RSH_GET_DEVICE_IS_CAPABLE, &value) == RSH_API_SUCCESS ? 1 : 0);
+}
+
+static PyObject* RshPyDevice_start(RshPyDevice* self, PyObject*)
+{
+	if(!RshPyDevice_check(self))
+		return 0;
+	U32 st = self->device->Start();
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	Py_RETURN_NONE;
+}
+
+static PyObject* RshPyDevice_stop(RshPyDevice* self, PyObject*)
+{
+	if(!RshPyDevice_check(self))
+		return 0;
+	U32 st = self->device->Stop();
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	Py_RETURN_NONE;
+}
+
+static PyObject* RshPyDevice_wait(RshPyDevice* self, PyObject* args)
+{
+	unsigned int timeout = 1000;
+	if(!PyArg_ParseTuple(args, "|I", &timeout))
+		return 0;
+	if(!RshPyDevice_check(self))
+		return 0;
+
+	RSH_U32 wait = static_cast<U32>(timeout);
+	U32 st;
+	Py_BEGIN_ALLOW_THREADS
+	st = self->device->Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait);
+	Py_END_ALLOW_THREADS
+	if(st == RSH_API_EVENT_WAITTIMEOUT)
+		Py_RETURN_FALSE;
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	Py_RETURN_TRUE;
+}
+
+static PyObject* RshPyDevice_get_data(RshPyDevice* self, PyObject* args)
+{
+	RshPyBuffer* buffer = 0;
+	if(!PyArg_ParseTuple(args, "O!", &RshPyBufferType, &buffer))
+		return 0;
+	if(!RshPyDevice_check(self))
+		return 0;
+	if(buffer->storage == 0)
+		return RshPyRaise(RSH_API_BUFFER_NOTINITIALIZED);
+
+	// data is written to memory of arrays made from buffer, they see new block;
+	// buffer is counted as exported, so other threads can not resize it meanwhile
+	U32 st;
+	++buffer->exports;
+	Py_BEGIN_ALLOW_THREADS
+	st = self->device->GetData(buffer->storage->Base());
+	Py_END_ALLOW_THREADS
+	--buffer->exports;
+	if(st != RSH_API_SUCCESS)
+		return RshPyRaise(st);
+	Py_RETURN_NONE;
+}
+
+static PyObject* RshPyDevice_buffer(RshPyDevice* self, PyObject* args)
+{
+	const char* format = "h";
+	if(!PyArg_ParseTuple(args, "|s", &format))
+		return 0;
+	return PyObject_CallFunction(reinterpret_cast<PyObject*>(&RshPyBufferType), "sn", format, static_cast<Py_ssize_t>(self->blockSize));
+}
+
+static PyObject* RshPyDevice_stream(RshPyDevice* self, PyObject* args, PyObject* kwds)
+{
+	static const char* keywords[] = { "format", "size", "blocks", "timeout", 0 };
+	const char* format = "h";
+	Py_ssize_t size = 0;
+	unsigned int blocks = 8;
+	unsigned int timeout = 100;
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "|snII", const_cast<char**>(keywords), &format, &size, &blocks, &timeout))
+		return 0;
+	if(!RshPyDevice_check(self))
+		return 0;
+	if(size <= 0)
+		size = static_cast<Py_ssize_t>(self->blockSize);
+	if(size <= 0 || blocks == 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "size and blocks must be positive, call init_dma() to get default size");
+		return 0;
+	}
+
+	RshPyStream* stream = PyObject_New(RshPyStream, &RshPyStreamType);
+	if(stream == 0)
+		return 0;
+	stream->owner = reinterpret_cast<PyObject*>(self);
+	Py_INCREF(self);
+	stream->device = self->device;
+	stream->timeout = static_cast<U32>(timeout);
+	stream->slots = new std::vector<RshPyStorage*>(blocks, static_cast<RshPyStorage*>(0));
+	stream->infos = new std::vector<RshBlockInfo>(blocks);
+	stream->scratch = 0;
+	stream->ready = new RshRingBuffer<U32>(blocks);
+	stream->released = new RshRingBuffer<U32>(blocks);
+	stream->thread = new RshThread();
+	stream->running = false;
+	stream->status = RSH_API_SUCCESS;
+	stream->received = 0;
+	stream->overruns = 0;
+	stream->lost = 0;
+	stream->lastSequence = 0;
+	stream->failed = RSH_PYTHON_NO_SLOT;
+
+	PyObject* result = reinterpret_cast<PyObject*>(stream);
+	stream->scratch = RshPyCreateStorage(format, static_cast<size_t>(size));
+	if(stream->scratch == 0)
+	{
+		Py_DECREF(result);
+		return 0;
+	}
+	for(U32 i = 0; i < blocks; ++i)
+	{
+		RshPyStorage* storage = RshPyCreateStorage(format, static_cast<size_t>(size));
+		if(storage == 0)
+		{
+			Py_DECREF(result);
+			return 0;
+		}
+		(*stream->slots)[i] = storage;
+		stream->released->Push(i);
+	}
+
+	U32 st = self->device->Start();
+	if(st != RSH_API_SUCCESS)
+	{
+		Py_DECREF(result);
+		return RshPyRaise(st);
+	}
+
+	stream->running = true;
+	st = stream->thread->Start(&RshPyStream_routine, stream);
+	if(st != RSH_API_SUCCESS)
+	{
+		stream->running = false;
+		self->device->Stop();
+		Py_DECREF(result);
+		return RshPyRaise(st);
+	}
+
+	// stream keeps reference to device, so device does not own reference to stream
+	self->stream = result;
+	return result;
+}
+
+static PyMethodDef RshPyDevice_methods[] = {
+	{ "connect", reinterpret_cast<PyCFunction>(RshPyDevice_connect), METH_VARARGS,
+		"connect(index=1)\n\nConnect to device by its number, starting from 1." },
+	{ "init_dma", (PyCFunction)(void(*)(void))RshPyDevice_init_dma, METH_VARARGS | METH_KEYWORDS,
+		"init_dma(frequency, buffer_size, channels=1, gain=1, persistent=True, start_type=START_PROGRAM) -> (frequency, buffer_size)\n\n"
+		"Initialize device with RshInitDMA. First channels are used. Returns parameters corrected by device." },
+	{ "init_memory", (PyCFunction)(void(*)(void))RshPyDevice_init_memory, METH_VARARGS | METH_KEYWORDS,
+		"init_memory(frequency, buffer_size, channels=1, gain=1, start_type=START_PROGRAM) -> (frequency, buffer_size)\n\n"
+		"Initialize device with RshInitMemory." },
+	{ "get", reinterpret_cast<PyCFunction>(RshPyDevice_get), METH_VARARGS,
+		"get(code, value=0) -> int\n\nIRshDevice::Get() for codes with RSH_U32 parameter." },
+	{ "get_string", reinterpret_cast<PyCFunction>(RshPyDevice_get_string), METH_VARARGS,
+		"get_string(code) -> str\n\nIRshDevice::Get() for codes with RSH_S8P parameter." },
+	{ "is_capable", reinterpret_cast<PyCFunction>(RshPyDevice_is_capable), METH_VARARGS,
+		"is_capable(caps) -> bool\n\nCheck RSH_CAPS_* capability." },
+	{ "start", reinterpret_cast<PyCFunction>(RshPyDevice_start), METH_NOARGS, "start()" },
+	{ "stop", reinterpret_cast<PyCFunction>(RshPyDevice_stop), METH_NOARGS, "stop()" },
+	{ "wait", reinterpret_cast<PyCFunction>(RshPyDevice_wait), METH_VARARGS,
+		"wait(timeout=1000) -> bool\n\nWait for data ready event, False on timeout. Interpreter lock is released while waiting." },
+	{ "get_data", reinterpret_cast<PyCFunction>(RshPyDevice_get_data), METH_VARARGS,
+		"get_data(buffer)\n\nGet block into Buffer. Interpreter lock is released during transfer." },
+	{ "buffer", reinterpret_cast<PyCFunction>(RshPyDevice_buffer), METH_VARARGS,
+		"buffer(format='h') -> Buffer\n\nBuffer for one block of last init_dma() or init_memory()." },
+	{ "stream", (PyCFunction)(void(*)(void))RshPyDevice_stream, METH_VARARGS | METH_KEYWORDS,
+		"stream(format='h', size=0, blocks=8, timeout=100) -> Stream\n\n"
+		"Start device and get blocks in background thread. Iterating stream gives Block objects, "
+		"each of them holds one of 'blocks' slots until released. Size 0 means one block of last init." },
+	{ 0, 0, 0, 0 }
+};
+
+static PyObject* RshPyDevice_getblocksize(RshPyDevice* self, void*)
+{
+	return PyLong_FromSize_t(self->blockSize);
+}
+
+static PyGetSetDef RshPyDevice_getset[] = {
+	{ const_cast<char*>("block_size"), reinterpret_cast<getter>(RshPyDevice_getblocksize), 0, const_cast<char*>("Samples of all channels in one block after last init"), 0 },
+	{ 0, 0, 0, 0, 0 }
+};
+
+//====================================== MODULE ======================================
+
+static PyModuleDef RshPyModule = {
+	PyModuleDef_HEAD_INIT,
+	"rsh",
+	"Rudnev-Shilyaev devices SDK.",
+	-1,
+	0, 0, 0, 0, 0
+};
+
+static int RshPyReady(PyTypeObject& type, const char* name, Py_ssize_t size, destructor dealloc, const char* doc)
+{
+	type.tp_name = name;
+	type.tp_basicsize = size;
+	type.tp_dealloc = dealloc;
+	type.tp_flags = Py_TPFLAGS_DEFAULT;
+	type.tp_doc = doc;
+	return PyType_Ready(&type);
+}
+
+static int RshPyAddType(PyObject* module, const char* name, PyTypeObject& type)
+{
+	Py_INCREF(&type);
+	if(PyModule_AddObject(module, name, reinterpret_cast<PyObject*>(&type)) != 0)
+	{
+		Py_DECREF(&type);
+		return -1;
+	}
+	return 0;
+}
+
+PyMODINIT_FUNC PyInit_rsh(void)
+{
+	RshPyBuffer_sequence.sq_length = reinterpret_cast<lenfunc>(RshPyBuffer_length);
+	RshPyBuffer_bufferprocs.bf_getbuffer = reinterpret_cast<getbufferproc>(RshPyBuffer_getbuffer);
+	RshPyBuffer_bufferprocs.bf_releasebuffer = reinterpret_cast<releasebufferproc>(RshPyBuffer_releasebuffer);
+	RshPyBufferType.tp_as_sequence = &RshPyBuffer_sequence;
+	RshPyBufferType.tp_as_buffer = &RshPyBuffer_bufferprocs;
+	RshPyBufferType.tp_methods = RshPyBuffer_methods;
+	RshPyBufferType.tp_getset = RshPyBuffer_getset;
+	RshPyBufferType.tp_init = reinterpret_cast<initproc>(RshPyBuffer_init);
+	RshPyBufferType.tp_new = PyType_GenericNew;
+
+	RshPyClientType.tp_methods = RshPyClient_methods;
+	RshPyClientType.tp_init = reinterpret_cast<initproc>(RshPyClient_init);
+	RshPyClientType.tp_new = PyType_GenericNew;
+
+	RshPyDeviceType.tp_methods = RshPyDevice_methods;
+	RshPyDeviceType.tp_getset = RshPyDevice_getset;
+
+	RshPyStreamType.tp_iter = RshPyStream_iter;
+	RshPyStreamType.tp_iternext = reinterpret_cast<iternextfunc>(RshPyStream_next);
+	RshPyStreamType.tp_methods = RshPyStream_methods;
+	RshPyStreamType.tp_getset = RshPyStream_getset;
+
+	RshPyBlock_sequence.sq_length = reinterpret_cast<lenfunc>(RshPyBlock_length);
+	RshPyBlock_bufferprocs.bf_getbuffer = reinterpret_cast<getbufferproc>(RshPyBlock_getbuffer);
+	RshPyBlock_bufferprocs.bf_releasebuffer = reinterpret_cast<releasebufferproc>(RshPyBlock_releasebuffer);
+	RshPyBlockType.tp_as_sequence = &RshPyBlock_sequence;
+	RshPyBlockType.tp_as_buffer = &RshPyBlock_bufferprocs;
+	RshPyBlockType.tp_methods = RshPyBlock_methods;
+	RshPyBlockType.tp_getset = RshPyBlock_getset;
+
+	if(RshPyReady(RshPyBufferType, "rsh.Buffer", sizeof(RshPyBuffer), reinterpret_cast<destructor>(RshPyBuffer_dealloc),
+			"Buffer(format='h', size=0)\n\nData buffer (RshBufferType) with buffer protocol support.") < 0 ||
+		RshPyReady(RshPyClientType, "rsh.Client", sizeof(RshPyClient), reinterpret_cast<destructor>(RshPyClient_dealloc),
+			"Client()\n\nLoader of device libraries (RshDllClient).") < 0 ||
+		RshPyReady(RshPyDeviceType, "rsh.Device", sizeof(RshPyDevice), reinterpret_cast<destructor>(RshPyDevice_dealloc),
+			"Device interface (IRshDevice), made by Client.device().") < 0 ||
+		RshPyReady(RshPyStreamType, "rsh.Stream", sizeof(RshPyStream), reinterpret_cast<destructor>(RshPyStream_dealloc),
+			"Continuous acquisition in background thread, made by Device.stream().") < 0 ||
+		RshPyReady(RshPyBlockType, "rsh.Block", sizeof(RshPyBlock), reinterpret_cast<destructor>(RshPyBlock_dealloc),
+			"Block of stream with buffer protocol support.") < 0)
+		return 0;
+
+	PyObject* module = PyModule_Create(&RshPyModule);
+	if(module == 0)
+		return 0;
+
+	RshPyError = PyErr_NewExceptionWithDoc("rsh.Error", "SDK error, args are (code, description).", 0, 0);
+	if(RshPyError == 0 ||
+		PyModule_AddObject(module, "Error", RshPyError) != 0 ||
+		RshPyAddType(module, "Buffer", RshPyBufferType) != 0 ||
+		RshPyAddType(module, "Client", RshPyClientType) != 0 ||
+		RshPyAddType(module, "Device", RshPyDeviceType) != 0 ||
+		RshPyAddType(module, "Stream", RshPyStreamType) != 0 ||
+		RshPyAddType(module, "Block", RshPyBlockType) != 0)
+	{
+		Py_XDECREF(RshPyError);
+		Py_DECREF(module);
+		return 0;
+	}
+	// module keeps own reference to exception type
+	Py_INCREF(RshPyError);
+
+	PyModule_AddIntConstant(module, "START_PROGRAM", RshInitADC::Program);
+	PyModule_AddIntConstant(module, "START_TIMER", RshInitADC::Timer);
+	PyModule_AddIntConstant(module, "START_EXTERNAL", RshInitADC::External);
+	PyModule_AddIntConstant(module, "START_INTERNAL", RshInitADC::Internal);
+	PyModule_AddIntConstant(module, "START_MASTER", RshInitADC::Master);
+
+	PyModule_AddIntConstant(module, "GET_DEVICE_ACTIVE_CHANNELS_NUMBER", RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER);
+	PyModule_AddIntConstant(module, "GET_DEVICE_SERIAL_NUMBER", RSH_GET_DEVICE_SERIAL_NUMBER);
+	PyModule_AddIntConstant(module, "GET_DEVICE_DATA_BITS", RSH_GET_DEVICE_DATA_BITS);
+	PyModule_AddIntConstant(module, "GET_DEVICE_NAME_VERBOSE", RSH_GET_DEVICE_NAME_VERBOSE);
+	PyModule_AddIntConstant(module, "GET_LIBRARY_VERSION_STR", RSH_GET_LIBRARY_VERSION_STR);
+
+	PyModule_AddIntConstant(module, "CAPS_SOFT_PGATHERING_IS_AVAILABLE", RSH_CAPS_SOFT_PGATHERING_IS_AVAILABLE);
+	PyModule_AddIntConstant(module, "CAPS_DEVICE_BLOCK_TIMESTAMP", RSH_CAPS_DEVICE_BLOCK_TIMESTAMP);
+
+	PyModule_AddIntConstant(module, "API_SUCCESS", RSH_API_SUCCESS);
+	PyModule_AddIntConstant(module, "API_EVENT_WAITTIMEOUT", RSH_API_EVENT_WAITTIMEOUT);
+	return module;
+}
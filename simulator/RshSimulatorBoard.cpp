@@ -0,0 +1,155 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshSimulatorBoard.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Device abstraction library "SIMULATOR".
+ *
+ * Exports class factory of RshSimulator, so simulated device is loaded
+ * with RshDllClient::GetDeviceInterface() like any other device:
+ * \code
+ * IRshDevice* device = 0;
+ * RshDllInterfaceKey key("SIMULATOR", device);
+ * client.GetDeviceInterface(key);
+ * RshDeviceKey connectKey("channels=4;bits=14;signal=counter;jitter=100");
+ * device->Connect(&connectKey);
+ * \endcode
+ * Options are described in RshSimulator class. If factory parameter
+ * of RshDllInterfaceKey is not zero, it is used as options string too.
+ *
+ * Build and install (Linux):
+ * \code
+ * g++ -O2 -shared -fPIC -I../HEADERS RshSimulatorBoard.cpp -o libSIMULATOR.so -ldl -lpthread
+ * cp libSIMULATOR.so /usr/lib/RSH/boards/
+ * \endcode
+ *
+ * \~russian
+ * \brief
+ * Библиотека абстракции устройства "SIMULATOR".
+ *
+ * Экспортирует фабрику классов RshSimulator, поэтому имитатор устройства
+ * загружается методом RshDllClient::GetDeviceInterface() так же, как
+ * любое другое устройство (см. пример выше).
+ * Параметры описаны в классе RshSimulator. Если параметр фабрики
+ * в RshDllInterfaceKey не равен нулю, он также используется как
+ * строка параметров.
+ *
+ * Сборка и установка приведены выше.
+ *
+ */
+
+//Заголовочные файлы Rsh SDK. RshApi.cpp тоже включен с помощью #include для простоты
+#include "RshApi.h"
+#include "RshApi.cpp"
+
+#include <vector>
+
+/*!
+ *
+ * \~english
+ * \brief
+ * Class factory of simulated devices
+ *
+ * \~russian
+ * \brief
+ * Фабрика классов имитаторов устройств
+ *
+ */
+class RshSimulatorFactory : public IRshFactory
+{
+public:
+
+	RshSimulatorFactory() {}
+	~RshSimulatorFactory() { Free(); }
+
+	U32 __RSHCALLCONV CreateInstance(IN const char* libIName, OUT void** libInterface, IN void* factoryParameter = NULL)
+	{
+		if(libInterface == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+		if(libIName == 0 || std::string(libIName) != "IRshDevice")
+			return RSH_API_INTERFACE_DOESNOTMATCH;
+
+		RshSimulator* device = new RshSimulator();
+		if(factoryParameter != 0)
+		{
+			U32 st = device->Configure(static_cast<const char*>(factoryParameter));
+			if(st != RSH_API_SUCCESS)
+			{
+				delete device;
+				return st;
+			}
+		}
+
+		m_instances.push_back(device);
+		*libInterface = static_cast<IRshDevice*>(device);
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Release(IN OUT void** objectAddress)
+	{
+		if(objectAddress == 0 || *objectAddress == 0)
+			return RSH_API_PARAMETER_ZEROADDRESS;
+
+		std::vector<RshSimulator*>::iterator it = m_instances.begin();
+		for(; it != m_instances.end(); ++it)
+		{
+			if(static_cast<IRshDevice*>(*it) == *objectAddress)
+				break;
+		}
+		if(it == m_instances.end())
+			return RSH_API_PARAMETER_INVALID;
+
+		delete *it;
+		m_instances.erase(it);
+		*objectAddress = 0;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Free()
+	{
+		for(size_t i = 0; i < m_instances.size(); ++i)
+			delete m_instances[i];
+		m_instances.clear();
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Get(IN U32 code, IN OUT RshBaseType* address)
+	{
+		// library information is the same as of device object
+		if(code != RSH_GET_LIBRARY_FILENAME && code != RSH_GET_LIBRARY_VERSION_STR)
+			return RSH_API_FUNCTION_NOTSUPPORTED;
+		RshSimulator device;
+		return device.Get(code, address);
+	}
+
+private:
+
+	RshSimulatorFactory(const RshSimulatorFactory&);
+	RshSimulatorFactory& operator=(const RshSimulatorFactory&);
+
+	std::vector<RshSimulator*> m_instances;
+};
+
+#if defined(RSH_MSWINDOWS)
+
+// RshDllClient takes address of exported object "StaticFactory"
+extern "C" __declspec(dllexport) RshSimulatorFactory StaticFactory;
+RshSimulatorFactory StaticFactory;
+
+#elif defined(RSH_LINUX)
+
+static RshSimulatorFactory rshSimulatorFactory;
+
+// RshDllClient calls CreateFactory(boardsPath, librariesPath)
+extern "C" void* CreateFactory(const char* boardsPath, const char* librariesPath)
+{
+	(void)boardsPath;
+	(void)librariesPath;
+	return static_cast<IRshFactory*>(&rshSimulatorFactory);
+}
+
+#endif
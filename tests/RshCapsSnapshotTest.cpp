@@ -0,0 +1,312 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshCapsSnapshotTest.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Test of RshCapsSnapshot.
+ *
+ * Snapshot must answer cached queries as device does, give the same
+ * answers after Save() and Load(), and Acquire() must load saved file
+ * instead of probing. Truncated and damaged files must be rejected
+ * (and probed again by Acquire()) without reading out of loaded tables.
+ *
+ * \~russian
+ * \brief
+ * Тест RshCapsSnapshot.
+ *
+ * Снимок должен отвечать на кэшируемые запросы так же, как устройство,
+ * давать те же ответы после Save() и Load(), а Acquire() - загружать
+ * сохраненный файл вместо опроса. Обрезанные и поврежденные файлы должны
+ * отвергаться (и опрашиваться заново в Acquire()) без чтения за
+ * пределами загруженных таблиц.
+ *
+ */
+
+#include "RshApi.h"
+#include "RshApi.cpp"
+#include "RshTest.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#define RSH_TEST_FILE "RshCapsSnapshotTest.rshcaps"
+
+// simulator with lists of gains and frequencies, counting queries
+class RshTestDevice : public RshSimulator
+{
+public:
+
+	RshTestDevice() : gets(0)
+	{ }
+
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType* adr)
+	{
+		++gets;
+		if(mode == RSH_GET_DEVICE_GAIN_LIST)
+		{
+			RSH_BUFFER_U32& list = *static_cast<RSH_BUFFER_U32*>(adr);
+			list.Allocate(4);
+			for(U32 i = 0; i < 4; ++i)
+				list[i] = 1U << i;
+			list.SetSize(4);
+			return RSH_API_SUCCESS;
+		}
+		if(mode == RSH_GET_DEVICE_FREQUENCY_LIST)
+		{
+			RSH_BUFFER_DOUBLE& list = *static_cast<RSH_BUFFER_DOUBLE*>(adr);
+			list.Allocate(3);
+			list[0] = 1.0e+3;
+			list[1] = 1.0e+4;
+			list[2] = 1.0e+5;
+			list.SetSize(3);
+			return RSH_API_SUCCESS;
+		}
+		if(mode == RSH_GET_DEVICE_MIN_AMP_LSB)
+		{
+			static_cast<RSH_S32*>(adr)->data = -32768;
+			return RSH_API_SUCCESS;
+		}
+		return RshSimulator::Get(mode, adr);
+	}
+
+	int gets;
+};
+
+static bool RshTestReadFile(const std::string& fileName, std::vector<char>& bytes)
+{
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+	if(!file.is_open())
+		return false;
+	bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+static bool RshTestWriteFile(const std::string& fileName, const std::vector<char>& bytes, size_t size)
+{
+	std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(size != 0)
+		file.write(&bytes[0], static_cast<std::streamsize>(size));
+	file.close();
+	return !file.fail();
+}
+
+static void RshTestPutU32(std::vector<char>& bytes, size_t offset, U32 value)
+{
+	memcpy(&bytes[offset], &value, sizeof(value));
+}
+
+// position of field of cached entry in file, see RshCapsSnapshot.cpp
+static size_t RshTestEntry(U32 mode, U32 field)
+{
+	return sizeof(RshCapsSnapshotFileHeader) + ((mode & 0xFFFF) * 4 + field) * sizeof(U32);
+}
+
+// same answers to all cached queries as in other snapshot
+static bool RshTestSame(const RshCapsSnapshot& a, const RshCapsSnapshot& b)
+{
+	for(U32 caps = 0; caps < RSH_CAPS_MAX; ++caps)
+		if(a.IsCapable(caps) != b.IsCapable(caps))
+			return false;
+	for(U32 index = 0; index < RSH_CAPS_SNAPSHOT_ENTRIES; ++index)
+	{
+		const U32 mode = _RSH_GROUP_GET_DEVICE(0) | index;
+		if(!RshCapsSnapshot::IsCached(mode))
+			continue;
+		RSH_U32 wordA, wordB;
+		RSH_S32 signedA, signedB;
+		RSH_DOUBLE realA, realB;
+		RSH_BUFFER_U32 wordsA, wordsB;
+		RSH_BUFFER_DOUBLE realsA, realsB;
+		RSH_S8P textA(0), textB(0);
+		if(a.Get(mode, &wordA) != b.Get(mode, &wordB) || wordA.data != wordB.data ||
+			a.Get(mode, &signedA) != b.Get(mode, &signedB) || signedA.data != signedB.data ||
+			a.Get(mode, &realA) != b.Get(mode, &realB) || realA.data != realB.data ||
+			a.Get(mode, &wordsA) != b.Get(mode, &wordsB) || wordsA.Size() != wordsB.Size() ||
+			a.Get(mode, &realsA) != b.Get(mode, &realsB) || realsA.Size() != realsB.Size() ||
+			a.Get(mode, &textA) != b.Get(mode, &textB))
+			return false;
+		for(size_t i = 0; i < wordsA.Size(); ++i)
+			if(wordsA[i] != wordsB[i])
+				return false;
+		for(size_t i = 0; i < realsA.Size(); ++i)
+			if(realsA[i] != realsB[i])
+				return false;
+	}
+	return a.Name() == b.Name() && a.Serial() == b.Serial() && a.LibraryVersion() == b.LibraryVersion();
+}
+
+// all queries to snapshot loaded from damaged file, must not read out of its tables
+static void RshTestQueryAll(const RshCapsSnapshot& snapshot)
+{
+	RshCapsSnapshot empty;
+	RshTestSame(snapshot, empty);
+}
+
+static void RshTestRoundTrip()
+{
+	RshTestDevice device;
+	RshDeviceKey key("bits=14;range=2.5");
+	RSH_TEST_CHECK(device.Connect(&key) == RSH_API_SUCCESS);
+
+	RshCapsSnapshot snapshot;
+	RSH_U32 caps(RSH_CAPS_DEVICE_BLOCK_TIMESTAMP);
+	RSH_TEST_CHECK(snapshot.IsEmpty());
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) == RSH_API_DEVICE_NOTINITIALIZED);
+	RSH_TEST_CHECK(snapshot.Save(RSH_TEST_FILE) == RSH_API_DEVICE_NOTINITIALIZED);
+	RSH_TEST_CHECK(snapshot.Probe(0) == RSH_API_PARAMETER_ZEROADDRESS);
+	RSH_TEST_CHECK(snapshot.Probe(&device) == RSH_API_SUCCESS);
+
+	// answers are the same as of device
+	RSH_TEST_CHECK(snapshot.IsCapable(RSH_CAPS_DEVICE_BLOCK_TIMESTAMP) && !snapshot.IsCapable(RSH_CAPS_DEVICE_METRICS));
+	RSH_TEST_CHECK(!snapshot.IsCapable(RSH_CAPS_MAX));
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) == RSH_API_SUCCESS);
+	RSH_U32 metrics(RSH_CAPS_DEVICE_METRICS);
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_IS_CAPABLE, &metrics) == device.Get(RSH_GET_DEVICE_IS_CAPABLE, &metrics));
+	RSH_U32 bits;
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_DATA_BITS, &bits) == RSH_API_SUCCESS && bits.data == 14);
+	RSH_DOUBLE range;
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_INPUT_RANGE_VOLTS, &range) == RSH_API_SUCCESS && range.data == 2.5);
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_INPUT_RANGE_VOLTS, &bits) == RSH_API_PARAMETER_DATATYPENOTSUPPORTED);
+	RSH_BUFFER_U32 gains(2);
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_GAIN_LIST, &gains) == RSH_API_SUCCESS && gains.Size() == 4 && gains[3] == 8);
+	RSH_S32 lsb;
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_MIN_AMP_LSB, &lsb) == RSH_API_SUCCESS && lsb.data == -32768);
+	RSH_BUFFER_U32 sizes;
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_SIZE_LIST, &sizes) == device.Get(RSH_GET_DEVICE_SIZE_LIST, &sizes));
+	RSH_TEST_CHECK(!RshCapsSnapshot::IsCached(RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER));
+	RSH_TEST_CHECK(snapshot.Get(RSH_GET_DEVICE_ACTIVE_CHANNELS_NUMBER, &bits) == RSH_API_PARAMETER_INVALID);
+
+	RSH_TEST_CHECK(snapshot.Save(RSH_TEST_FILE) == RSH_API_SUCCESS);
+	RshCapsSnapshot loaded;
+	RSH_TEST_CHECK(loaded.Load(RSH_TEST_FILE) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(!loaded.IsEmpty());
+	RSH_TEST_CHECK(RshTestSame(snapshot, loaded));
+	RSH_TEST_CHECK(loaded.Load("RshCapsSnapshotTest.missing") == RSH_API_FILE_CANTOPEN && loaded.IsEmpty());
+}
+
+static void RshTestAcquire()
+{
+	RshTestDevice device;
+	RshDeviceKey key("bits=14;range=2.5");
+	RSH_TEST_CHECK(device.Connect(&key) == RSH_API_SUCCESS);
+
+	RshCapsSnapshot probed;
+	RSH_TEST_CHECK(probed.Acquire(&device, "") == RSH_API_FILE_NAMENOTDEFINED);
+	RSH_TEST_CHECK(probed.Acquire(&device, ".") == RSH_API_SUCCESS);
+	char suffix[32];
+	sprintf(suffix, "_%u.rshcaps", static_cast<unsigned int>(probed.Serial()));
+	const std::string fileName = "./" + RshCapsSnapshotFileName(probed.Name()) + suffix;
+
+	// only name, library version and serial number are asked
+	int gets = device.gets;
+	RshCapsSnapshot loaded;
+	RSH_TEST_CHECK(loaded.Acquire(&device, "./") == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(device.gets - gets == 3);
+	RSH_TEST_CHECK(RshTestSame(probed, loaded));
+
+	// damaged file is probed again and replaced
+	std::vector<char> bytes;
+	RSH_TEST_CHECK(RshTestReadFile(fileName, bytes));
+	RSH_TEST_CHECK(RshTestWriteFile(fileName, bytes, bytes.size() - 3));
+	gets = device.gets;
+	RshCapsSnapshot reprobed;
+	RSH_TEST_CHECK(reprobed.Acquire(&device, ".") == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(device.gets - gets > 3);
+	RSH_TEST_CHECK(RshTestSame(probed, reprobed));
+	gets = device.gets;
+	RSH_TEST_CHECK(loaded.Acquire(&device, ".") == RSH_API_SUCCESS && device.gets - gets == 3);
+
+	remove(fileName.c_str());
+}
+
+static void RshTestTruncated()
+{
+	std::vector<char> bytes;
+	RSH_TEST_CHECK(RshTestReadFile(RSH_TEST_FILE, bytes));
+
+	bool rejected = true;
+	RshCapsSnapshot snapshot;
+	RSH_U32 caps(RSH_CAPS_DEVICE_BLOCK_TIMESTAMP);
+	for(size_t size = 0; size < bytes.size(); ++size)
+	{
+		RshTestWriteFile(RSH_TEST_FILE, bytes, size);
+		rejected = rejected && snapshot.Load(RSH_TEST_FILE) == RSH_API_FILE_CANTREAD && snapshot.IsEmpty() &&
+			snapshot.Get(RSH_GET_DEVICE_IS_CAPABLE, &caps) == RSH_API_DEVICE_NOTINITIALIZED;
+	}
+	RSH_TEST_CHECK(rejected);
+
+	// longer file is damaged too
+	std::vector<char> longer = bytes;
+	longer.push_back(0);
+	RSH_TEST_CHECK(RshTestWriteFile(RSH_TEST_FILE, longer, longer.size()));
+	RSH_TEST_CHECK(snapshot.Load(RSH_TEST_FILE) == RSH_API_FILE_CANTREAD);
+
+	RSH_TEST_CHECK(RshTestWriteFile(RSH_TEST_FILE, bytes, bytes.size()));
+}
+
+// file with one U32 replaced must not be loaded
+static bool RshTestRejected(const std::vector<char>& bytes, size_t offset, U32 value)
+{
+	std::vector<char> damaged = bytes;
+	RshTestPutU32(damaged, offset, value);
+	RshTestWriteFile(RSH_TEST_FILE, damaged, damaged.size());
+	RshCapsSnapshot snapshot;
+	return snapshot.Load(RSH_TEST_FILE) == RSH_API_FILE_CANTREAD && snapshot.IsEmpty();
+}
+
+static void RshTestMalformed()
+{
+	std::vector<char> bytes;
+	RSH_TEST_CHECK(RshTestReadFile(RSH_TEST_FILE, bytes));
+
+	RSH_TEST_CHECK(RshTestRejected(bytes, 0, 0));
+	RSH_TEST_CHECK(RshTestRejected(bytes, offsetof(RshCapsSnapshotFileHeader, version), RSH_CAPS_SNAPSHOT_VERSION + 1));
+	RSH_TEST_CHECK(RshTestRejected(bytes, offsetof(RshCapsSnapshotFileHeader, headerSize), 8));
+	RSH_TEST_CHECK(RshTestRejected(bytes, offsetof(RshCapsSnapshotFileHeader, entrySize), 12));
+	RSH_TEST_CHECK(RshTestRejected(bytes, offsetof(RshCapsSnapshotFileHeader, nameSize), 0xFFFFFFFF));
+	RSH_TEST_CHECK(RshTestRejected(bytes, offsetof(RshCapsSnapshotFileHeader, words), 0x7FFFFFFF));
+
+	// values out of tables, unknown type, type other than of query, scalar without value
+	RSH_TEST_CHECK(RshTestRejected(bytes, RshTestEntry(RSH_GET_DEVICE_GAIN_LIST, 2), 0xFFFFFFFE));
+	RSH_TEST_CHECK(RshTestRejected(bytes, RshTestEntry(RSH_GET_DEVICE_GAIN_LIST, 3), 0xFFFFFFFF));
+	RSH_TEST_CHECK(RshTestRejected(bytes, RshTestEntry(RSH_GET_DEVICE_DATA_BITS, 0), 0x12345));
+	RSH_TEST_CHECK(RshTestRejected(bytes, RshTestEntry(RSH_GET_DEVICE_SERIAL_NUMBER, 0), rshDouble));
+	RSH_TEST_CHECK(RshTestRejected(bytes, RshTestEntry(RSH_GET_DEVICE_DATA_BITS, 3), 0));
+	RSH_TEST_CHECK(RshTestRejected(bytes, RshTestEntry(RSH_GET_DEVICE_INPUT_RANGE_VOLTS, 3), 2));
+
+	// damaged bytes give error or some values, never read out of tables
+	RshRandom random(5);
+	std::vector<char> damaged;
+	RshCapsSnapshot snapshot;
+	for(int n = 0; n < 2000; ++n)
+	{
+		damaged = bytes;
+		for(int k = 0; k < 4; ++k)
+			damaged[random.Next() % damaged.size()] ^= static_cast<char>(1 + random.Next() % 255);
+		RshTestWriteFile(RSH_TEST_FILE, damaged, damaged.size());
+		if(snapshot.Load(RSH_TEST_FILE) == RSH_API_SUCCESS)
+			RshTestQueryAll(snapshot);
+	}
+
+	RSH_TEST_CHECK(RshTestWriteFile(RSH_TEST_FILE, bytes, bytes.size()));
+	RSH_TEST_CHECK(snapshot.Load(RSH_TEST_FILE) == RSH_API_SUCCESS);
+}
+
+int main()
+{
+	RshTestRoundTrip();
+	RshTestAcquire();
+	RshTestTruncated();
+	RshTestMalformed();
+	remove(RSH_TEST_FILE);
+	return RSH_TEST_RESULT();
+}
@@ -0,0 +1,265 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshCompressorTest.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Test of RshCompressor.
+ *
+ * Records made by Compress() must give the same samples after
+ * Decompress() for all predictors, stored channels, extreme values
+ * and several threads. Truncated records must be reported as
+ * incomplete, and corrupted ones (including header with number of
+ * samples much larger than data) must be rejected without allocating
+ * memory for them.
+ *
+ * \~russian
+ * \brief
+ * Тест RshCompressor.
+ *
+ * Записи, сделанные методом Compress(), после Decompress() должны
+ * давать те же отсчеты для всех предсказателей, несжимаемых каналов,
+ * крайних значений и нескольких потоков. Обрезанные записи должны
+ * определяться как незавершенные, а поврежденные (в том числе с числом
+ * отсчетов в заголовке, намного большим данных) - отвергаться без
+ * выделения памяти под них.
+ *
+ */
+
+#include "RshApi.h"
+#include "RshApi.cpp"
+#include "RshTest.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// record layout, see RshCompressor.h
+#define RSH_TEST_HEADER_SIZE 24
+#define RSH_TEST_FLAG_ZSTD 0x2
+#define RSH_TEST_MODE_PACKED 0
+#define RSH_TEST_MODE_RAW 1
+
+template<typename T, RshDataTypes dataCode>
+static bool RshTestSame(const RshBufferType<T, dataCode>& a, const RshBufferType<T, dataCode>& b)
+{
+	if(a.Size() != b.Size())
+		return false;
+	for(size_t i = 0; i < a.Size(); ++i)
+		if(a[i] != b[i])
+			return false;
+	return true;
+}
+
+static void RshTestCopy(const RSH_BUFFER_U8& source, RSH_BUFFER_U8& copy)
+{
+	copy.Allocate(source.Size());
+	memcpy(copy.ptr, source.ptr, source.Size());
+	copy.SetSize(source.Size());
+}
+
+static void RshTestPutU32(U8* dst, U32 value)
+{
+	for(int i = 0; i < 4; ++i)
+		dst[i] = static_cast<U8>(value >> (8 * i));
+}
+
+// noise on baseline, sine, full range random and constant channels
+static void RshTestSignal(RshRandom& random, RSH_BUFFER_S16& buffer, U32 frames)
+{
+	buffer.Allocate(4 * frames);
+	for(U32 i = 0; i < frames; ++i)
+	{
+		buffer[4 * i] = static_cast<S16>((100 + static_cast<int>(random.Next() % 16)) << 2);
+		buffer[4 * i + 1] = static_cast<S16>(30000 * sin(i * 0.003));
+		buffer[4 * i + 2] = static_cast<S16>(random.Next());
+		buffer[4 * i + 3] = -5;
+	}
+	buffer.SetSize(4 * frames);
+}
+
+static void RshTestRoundTrip(U32 backend)
+{
+	RshRandom random(1);
+	for(U32 threads = 1; threads <= 3; threads += 2)
+	{
+		RshCompressor compressor(4);
+		RshCompressor decompressor;
+		compressor.SetThreads(threads);
+		decompressor.SetThreads(threads);
+		RSH_TEST_CHECK(compressor.SetBackend(backend) == RSH_API_SUCCESS);
+
+		// records written one after another are read back with next position
+		std::vector<RSH_BUFFER_S16> blocks(3);
+		std::vector<U8> stream;
+		RSH_BUFFER_U8 record;
+		for(size_t b = 0; b < blocks.size(); ++b)
+		{
+			RshTestSignal(random, blocks[b], 10000 + 37 * static_cast<U32>(b));
+			RSH_TEST_CHECK(compressor.Compress(blocks[b], record) == RSH_API_SUCCESS);
+			stream.insert(stream.end(), record.ptr, record.ptr + record.Size());
+		}
+		RSH_TEST_CHECK(compressor.Ratio() > 1.0);
+
+		RSH_BUFFER_U8 input(stream.size());
+		memcpy(input.ptr, &stream[0], stream.size());
+		input.SetSize(stream.size());
+		size_t offset = 0;
+		for(size_t b = 0; b < blocks.size(); ++b)
+		{
+			RSH_BUFFER_S16 output;
+			size_t next = 0;
+			RSH_TEST_CHECK(decompressor.Decompress(input, output, offset, &next) == RSH_API_SUCCESS);
+			RSH_TEST_CHECK(RshTestSame(blocks[b], output));
+			offset = next;
+		}
+		RSH_TEST_CHECK(offset == input.Size());
+	}
+}
+
+static void RshTestTypes()
+{
+	RshCompressor compressor;
+	RSH_BUFFER_U8 record;
+
+	RSH_BUFFER_U32 u32(1001), u32out;
+	for(U32 i = 0; i < 1001; ++i)
+		u32[i] = (i % 3 == 0) ? 0xFFFFFFFF : ((i % 3 == 1) ? 0 : 0x80000000);
+	u32.SetSize(1001);
+	RSH_TEST_CHECK(compressor.Compress(u32, record) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(compressor.Decompress(record, u32out) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(RshTestSame(u32, u32out));
+
+	RSH_BUFFER_S32 s32(777), s32out;
+	for(S32 i = 0; i < 777; ++i)
+		s32[i] = (i & 1) ? 2147483647 : (-2147483647 - 1);
+	s32.SetSize(777);
+	RSH_TEST_CHECK(compressor.Compress(s32, record) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(compressor.Decompress(record, s32out) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(RshTestSame(s32, s32out));
+
+	// record of other type is not decompressed
+	RSH_BUFFER_S16 s16out;
+	RSH_TEST_CHECK(compressor.Decompress(record, s16out) == RSH_API_BUFFER_WRONGDATATYPE);
+
+	RSH_BUFFER_S16 empty(0), emptyOut;
+	RSH_TEST_CHECK(compressor.Compress(empty, record) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(compressor.Decompress(record, emptyOut) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(emptyOut.Size() == 0);
+
+	RSH_BUFFER_DOUBLE real(4);
+	real.SetSize(4);
+	RSH_TEST_CHECK(compressor.Compress(real, record) == RSH_API_PARAMETER_DATATYPENOTSUPPORTED);
+}
+
+static void RshTestTruncated()
+{
+	RshRandom random(2);
+	RSH_BUFFER_S16 block;
+	RshTestSignal(random, block, 300);
+	RshCompressor compressor(4);
+	RSH_BUFFER_U8 record;
+	RSH_TEST_CHECK(compressor.Compress(block, record) == RSH_API_SUCCESS);
+
+	bool incomplete = true;
+	RSH_BUFFER_U8 part;
+	RSH_BUFFER_S16 output;
+	for(size_t size = 0; size < record.Size(); ++size)
+	{
+		RshTestCopy(record, part);
+		part.SetSize(size);
+		incomplete = incomplete && compressor.Decompress(part, output) == RSH_API_BUFFER_NOTCOMPLETED;
+	}
+	RSH_TEST_CHECK(incomplete);
+	RSH_TEST_CHECK(compressor.Decompress(record, output, record.Size() + 1) == RSH_API_BUFFER_NOTCOMPLETED);
+}
+
+// one channel record with number of samples replaced by huge one
+static void RshTestHugeFrames(const RSH_BUFFER_S16& block, U8 mode)
+{
+	RshCompressor compressor;
+	RSH_BUFFER_U8 record;
+	RSH_TEST_CHECK(compressor.Compress(block, record) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(record.Size() > RSH_TEST_HEADER_SIZE + 4 && record[RSH_TEST_HEADER_SIZE + 4] == mode);
+
+	RSH_BUFFER_U8 corrupted;
+	RSH_BUFFER_S16 output;
+	const U32 frames[] = { 0xFFFFFFFF, 0x7FFFFFFF, static_cast<U32>(block.Size() + 1), static_cast<U32>(block.Size() + 64) };
+	for(size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); ++i)
+	{
+		RshTestCopy(record, corrupted);
+		RshTestPutU32(corrupted.ptr + 12, frames[i]);
+		RSH_TEST_CHECK(compressor.Decompress(corrupted, output) == RSH_API_BUFFER_PROCESSING_ERROR);
+	}
+}
+
+static void RshTestMalformed()
+{
+	RshRandom random(3);
+	RSH_BUFFER_S16 noise(3000);
+	for(U32 i = 0; i < 3000; ++i)
+		noise[i] = static_cast<S16>(random.Next() % 100);
+	noise.SetSize(3000);
+	RSH_BUFFER_S16 full(3000);
+	for(U32 i = 0; i < 3000; ++i)
+		full[i] = static_cast<S16>(random.Next());
+	full.SetSize(3000);
+
+	RshTestHugeFrames(noise, RSH_TEST_MODE_PACKED);
+	RshTestHugeFrames(full, RSH_TEST_MODE_RAW);
+
+	RshCompressor compressor;
+	RSH_BUFFER_U8 record, corrupted;
+	RSH_BUFFER_S16 output;
+	RSH_TEST_CHECK(compressor.Compress(noise, record) == RSH_API_SUCCESS);
+
+	RshTestCopy(record, corrupted);
+	corrupted[0] ^= 0xFF;
+	RSH_TEST_CHECK(compressor.Decompress(corrupted, output) == RSH_API_BUFFER_PROCESSING_ERROR);
+
+	// zero channels, channel size out of payload
+	RshTestCopy(record, corrupted);
+	RshTestPutU32(corrupted.ptr + 8, 0);
+	RSH_TEST_CHECK(compressor.Decompress(corrupted, output) == RSH_API_BUFFER_PROCESSING_ERROR);
+	RshTestCopy(record, corrupted);
+	RshTestPutU32(corrupted.ptr + RSH_TEST_HEADER_SIZE, 0xFFFFFFF0);
+	RSH_TEST_CHECK(compressor.Decompress(corrupted, output) == RSH_API_BUFFER_PROCESSING_ERROR);
+
+	// zstd payload which cannot be unpacked from stored size
+	RshTestCopy(record, corrupted);
+	corrupted[6] |= RSH_TEST_FLAG_ZSTD;
+	RshTestPutU32(corrupted.ptr + 20, 0xFFFFFFFF);
+	const U32 st = compressor.Decompress(corrupted, output);
+	RSH_TEST_CHECK(st == RSH_API_BUFFER_PROCESSING_ERROR || st == RSH_API_DLL_WASNOTLOADED);
+
+	// damaged data must not be read out of record
+	U32 detected = 0;
+	for(int n = 0; n < 2000; ++n)
+	{
+		RshTestCopy(record, corrupted);
+		corrupted[RSH_TEST_HEADER_SIZE + random.Next() % (record.Size() - RSH_TEST_HEADER_SIZE)] ^= static_cast<U8>(1 + random.Next() % 255);
+		if(compressor.Decompress(corrupted, output) != RSH_API_SUCCESS)
+			++detected;
+	}
+	RSH_TEST_CHECK(detected > 0);
+
+	// record is still decompressed after errors
+	RSH_TEST_CHECK(compressor.Decompress(record, output) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(RshTestSame(noise, output));
+}
+
+int main()
+{
+	RshTestRoundTrip(RshCompressor::None);
+	if(RshCompressor::IsBackendAvailable(RshCompressor::Zstd))
+		RshTestRoundTrip(RshCompressor::Zstd);
+	else
+		printf("zstd is not available, backend is not tested\n");
+	RshTestTypes();
+	RshTestTruncated();
+	RshTestMalformed();
+	return RSH_TEST_RESULT();
+}
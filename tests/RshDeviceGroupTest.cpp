@@ -0,0 +1,265 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshDeviceGroupTest.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Test of RshDeviceGroup.
+ *
+ * Devices with ::RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH are emulated, with
+ * and without ::RSH_GET_BUFFER_BLOCK_INFO (as all board libraries).
+ * Slaves must be armed before master and stopped after it, frames must
+ * be gathered from devices without block info as is, and devices with
+ * sequence numbers must be aligned after lost blocks.
+ *
+ * \~russian
+ * \brief
+ * Тест RshDeviceGroup.
+ *
+ * Эмулируются устройства с ::RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH, с
+ * поддержкой ::RSH_GET_BUFFER_BLOCK_INFO и без нее (как все библиотеки
+ * устройств). Ведомые устройства должны запускаться до ведущего и
+ * останавливаться после него, кадры устройств без сведений о блоках -
+ * собираться как есть, а устройства с порядковыми номерами -
+ * выравниваться после потери блоков.
+ *
+ */
+
+#include "RshApi.h"
+#include "RshApi.cpp"
+#include "RshTest.h"
+
+#include <set>
+#include <vector>
+
+// order of Start() and Stop() calls of all devices, positive for start
+static std::vector<int> rshTestCalls;
+
+// device which acquires one block per slot, first sample of block is its slot
+class RshTestBoard : public IRshDevice
+{
+public:
+
+	RshTestBoard(int id, bool blockInfo, bool slaveMaster = true) :
+		startType(0), slot(0), m_id(id), m_blockInfo(blockInfo), m_slaveMaster(slaveMaster),
+		m_running(false), m_failStart(false), m_sequence(0)
+	{ }
+
+	U32 __RSHCALLCONV Connect(IN RshBaseType*, IN U32) { return RSH_API_SUCCESS; }
+
+	U32 __RSHCALLCONV Init(IN OUT RshBaseType* structure, IN U32)
+	{
+		startType = static_cast<RshInitADC*>(structure)->startType;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Start()
+	{
+		if(m_failStart)
+			return RSH_API_DEVICE_CANTSTART;
+		rshTestCalls.push_back(m_id);
+		m_running = true;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Stop()
+	{
+		rshTestCalls.push_back(-m_id);
+		m_running = false;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV GetData(IN OUT RshBaseType* buffer, IN U32)
+	{
+		if(!m_running)
+			return RSH_API_DEVICE_WASNOTSTARTED;
+		// lost slots are acquired by other devices but not by this one
+		while(m_lost.count(slot) != 0)
+		{
+			++slot;
+			++m_sequence;
+		}
+		RSH_BUFFER_S16& data = *static_cast<RSH_BUFFER_S16*>(buffer);
+		data[0] = static_cast<S16>(slot);
+		data.SetSize(1);
+		++slot;
+		++m_sequence;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType* adr)
+	{
+		switch(mode)
+		{
+		case RSH_GET_DEVICE_IS_CAPABLE:
+			return (m_slaveMaster && static_cast<RSH_U32*>(adr)->data == RSH_CAPS_DEVICE_SLAVE_MASTER_SWITCH) ?
+				static_cast<U32>(RSH_API_SUCCESS) : static_cast<U32>(RSH_API_DEVICE_FUNCTION_NOTSUPPORTED);
+		case RSH_GET_WAIT_BUFFER_READY_EVENT:
+			return m_running ? static_cast<U32>(RSH_API_SUCCESS) : static_cast<U32>(RSH_API_EVENT_WAITFAILED);
+		case RSH_GET_BUFFER_BLOCK_INFO:
+			if(!m_blockInfo)
+				return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+			static_cast<RshBlockInfo*>(adr)->sequence = m_sequence;
+			static_cast<RshBlockInfo*>(adr)->timestamp = 1000 + m_sequence * 100;
+			return RSH_API_SUCCESS;
+		default:
+			return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+		}
+	}
+
+	void Lose(U32 lostSlot) { m_lost.insert(lostSlot); }
+	void FailStart() { m_failStart = true; }
+
+	U32 startType;
+	U32 slot;
+
+private:
+
+	int m_id;
+	bool m_blockInfo;
+	bool m_slaveMaster;
+	bool m_running;
+	bool m_failStart;
+	U64 m_sequence;
+	std::set<U32> m_lost;
+};
+
+class RshTestFrame
+{
+public:
+
+	explicit RshTestFrame(size_t devices) : m_data(devices)
+	{
+		for(size_t i = 0; i < devices; ++i)
+		{
+			m_data[i].Allocate(1);
+			pointers.push_back(&m_data[i]);
+		}
+	}
+
+	// all blocks of frame acquired in the same slot
+	bool Same(S16 slot) const
+	{
+		for(size_t i = 0; i < m_data.size(); ++i)
+			if(m_data[i].Size() != 1 || m_data[i][0] != slot)
+				return false;
+		return true;
+	}
+
+	std::vector<RshBaseType*> pointers;
+
+private:
+
+	std::vector<RSH_BUFFER_S16> m_data;
+};
+
+static void RshTestInit(RshDeviceGroup& group)
+{
+	for(U32 i = 0; i < group.Devices(); ++i)
+	{
+		RshInitADC init;
+		init.startType = RshInitADC::Program;
+		RSH_TEST_CHECK(group.Init(i, &init) == RSH_API_SUCCESS);
+	}
+}
+
+static void RshTestWithoutBlockInfo()
+{
+	RshTestBoard slave1(1, false), master(2, false), slave2(3, false);
+	RshDeviceGroup group;
+	RSH_TEST_CHECK(group.Start() == RSH_API_PARAMETER_NOTINITIALIZED);
+	RSH_TEST_CHECK(group.Add(&slave1, RshDeviceGroup::Slave) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(group.Add(&master, RshDeviceGroup::Master) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(group.Add(&slave2, RshDeviceGroup::Slave) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(group.Add(&slave2, RshDeviceGroup::Master) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(group.MasterIndex() == 1);
+
+	RshTestInit(group);
+	RSH_TEST_CHECK(slave1.startType == RshInitADC::Master && slave2.startType == RshInitADC::Master);
+	RSH_TEST_CHECK(master.startType == RshInitADC::Program);
+
+	// slaves armed first, master started last and stopped first
+	rshTestCalls.clear();
+	RSH_TEST_CHECK(group.Start() == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(rshTestCalls.size() == 3 && rshTestCalls[0] == 1 && rshTestCalls[1] == 3 && rshTestCalls[2] == 2);
+
+	RshTestFrame frame(3);
+	bool same = true;
+	for(S16 n = 0; n < 10; ++n)
+		same = same && group.GetFrame(frame.pointers) == RSH_API_SUCCESS && frame.Same(n);
+	RSH_TEST_CHECK(same);
+	RSH_TEST_CHECK(group.Frames() == 10 && group.Realignments() == 0);
+	for(U32 i = 0; i < 3; ++i)
+		RSH_TEST_CHECK(group.LostBlocks(i) == 0 && group.SkippedBlocks(i) == 0 && group.LastBlock(i).sequence == 0);
+	RSH_TEST_CHECK(group.Skew() == 0 && group.Drift(0) == 0);
+
+	rshTestCalls.clear();
+	RSH_TEST_CHECK(group.Stop() == RSH_API_SUCCESS && !group.IsStarted());
+	RSH_TEST_CHECK(rshTestCalls.size() == 3 && rshTestCalls[0] == -2);
+	RSH_TEST_CHECK(group.GetFrame(frame.pointers) == RSH_API_DEVICE_WASNOTSTARTED);
+}
+
+static void RshTestAlignment()
+{
+	RshTestBoard master(1, true), slave(2, true), plain(3, false);
+	RshDeviceGroup group;
+	group.Add(&master, RshDeviceGroup::Master);
+	group.Add(&slave, RshDeviceGroup::Slave);
+	group.Add(&plain, RshDeviceGroup::Slave);
+	RshTestInit(group);
+
+	// slave loses slot 3, master is skipped to it, device without block info is taken as is
+	slave.Lose(3);
+	RSH_TEST_CHECK(group.Start() == RSH_API_SUCCESS);
+	RshTestFrame frame(2);
+	RshTestFrame all(3);
+	for(S16 n = 0; n < 3; ++n)
+		RSH_TEST_CHECK(group.GetFrame(all.pointers) == RSH_API_SUCCESS && all.Same(n));
+	RSH_TEST_CHECK(group.GetFrame(all.pointers) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(group.LostBlocks(1) == 1 && group.SkippedBlocks(0) == 1 && group.SkippedBlocks(2) == 0);
+	RSH_TEST_CHECK(group.LostBlocks(2) == 0 && group.Realignments() == 1);
+	RSH_TEST_CHECK(master.slot == 5 && slave.slot == 5 && plain.slot == 4);
+	RSH_TEST_CHECK(group.LastBlock(0).sequence == group.LastBlock(1).sequence && group.LastBlock(2).sequence == 0);
+	group.Stop();
+
+	// blocks lost before first frame are found from sequence right after start
+	RshTestBoard first(4, true), second(5, true);
+	RshDeviceGroup pair;
+	pair.Add(&first, RshDeviceGroup::Master);
+	pair.Add(&second, RshDeviceGroup::Slave);
+	RshTestInit(pair);
+	second.Lose(0);
+	RSH_TEST_CHECK(pair.Start() == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(pair.GetFrame(frame.pointers) == RSH_API_SUCCESS && frame.Same(1));
+	RSH_TEST_CHECK(pair.LostBlocks(1) == 1 && pair.SkippedBlocks(0) == 1);
+}
+
+static void RshTestErrors()
+{
+	// slave without master-slave link can not be initialized
+	RshTestBoard master(1, false), slave(2, false, false);
+	RshDeviceGroup group;
+	group.Add(&master, RshDeviceGroup::Master);
+	group.Add(&slave, RshDeviceGroup::Slave);
+	RshInitADC init;
+	RSH_TEST_CHECK(group.Init(1, &init) == RSH_API_DEVICE_FUNCTION_NOTSUPPORTED);
+	RSH_TEST_CHECK(group.Init(2, &init) == RSH_API_PARAMETER_OUTOFRANGE);
+	RSH_TEST_CHECK(group.Init(0, 0) == RSH_API_PARAMETER_ZEROADDRESS);
+
+	// master fails to start, armed slave is stopped
+	master.FailStart();
+	rshTestCalls.clear();
+	RSH_TEST_CHECK(group.Start() == RSH_API_DEVICE_CANTSTART && !group.IsStarted());
+	RSH_TEST_CHECK(rshTestCalls.size() == 2 && rshTestCalls[0] == 2 && rshTestCalls[1] == -2);
+}
+
+int main()
+{
+	RshTestWithoutBlockInfo();
+	RshTestAlignment();
+	RshTestErrors();
+	return RSH_TEST_RESULT();
+}
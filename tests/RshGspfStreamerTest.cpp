@@ -0,0 +1,167 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshGspfStreamerTest.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Test of RshGspfStreamer.
+ *
+ * Generator without ::RSH_CAPS_DEVICE_STREAMING_PLAYBACK (as all board
+ * libraries) is emulated: queued samples must be played in order in
+ * RshInitGSPF::PlayOnce mode, underruns filled with zeros, and device
+ * must stay stopped after Stop() even if it is called while worker
+ * thread uploads next half.
+ *
+ * \~russian
+ * \brief
+ * Тест RshGspfStreamer.
+ *
+ * Эмулируется генератор без ::RSH_CAPS_DEVICE_STREAMING_PLAYBACK (как
+ * все библиотеки устройств): отсчеты из очереди должны проигрываться по
+ * порядку в режиме RshInitGSPF::PlayOnce, опустошение очереди
+ * заполняться нулями, а устройство должно оставаться остановленным после
+ * Stop(), даже если он вызван во время передачи следующей половины.
+ *
+ */
+
+#include "RshApi.h"
+#include "RshApi.cpp"
+#include "RshTest.h"
+
+#include <vector>
+
+// generator which plays uploaded half in playMs and takes uploadMs to upload it
+class RshTestGenerator : public IRshDevice
+{
+public:
+
+	RshTestGenerator(U32 playMs, U32 uploadMs) :
+		control(0), running(0), starts(0), m_playMs(playMs), m_uploadMs(uploadMs)
+	{ }
+
+	U32 __RSHCALLCONV Connect(IN RshBaseType*, IN U32) { return RSH_API_SUCCESS; }
+
+	U32 __RSHCALLCONV Init(IN OUT RshBaseType* structure, IN U32)
+	{
+		control = static_cast<RshInitGSPF*>(structure)->control;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Start()
+	{
+		__rshatomicadd32(&starts, 1);
+		running = 1;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Stop()
+	{
+		running = 0;
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV GetData(IN OUT RshBaseType* buffer, IN U32)
+	{
+		if(m_uploadMs != 0)
+			__rshmssleep(m_uploadMs);
+		const RSH_BUFFER_S16& half = *static_cast<RSH_BUFFER_S16*>(buffer);
+		for(size_t i = 0; i < half.Size(); ++i)
+			played.push_back(half[i]);
+		return RSH_API_SUCCESS;
+	}
+
+	U32 __RSHCALLCONV Get(IN U32 mode, IN OUT RshBaseType*)
+	{
+		if(mode != RSH_GET_WAIT_BUFFER_READY_EVENT)
+			return RSH_API_DEVICE_FUNCTION_NOTSUPPORTED;
+		if(running == 0)
+			return RSH_API_EVENT_WAITFAILED;
+		__rshmssleep(m_playMs);
+		return RSH_API_SUCCESS;
+	}
+
+	U32 control;
+	volatile U32 running;
+	volatile U32 starts;
+	std::vector<S16> played;
+
+private:
+
+	U32 m_playMs;
+	U32 m_uploadMs;
+};
+
+static void RshTestPlayback()
+{
+	const U32 halfSize = 256;
+	RshTestGenerator generator(2, 0);
+	RshGspfStreamer streamer(4096);
+
+	RSH_BUFFER_S16 block(halfSize);
+	block.SetSize(halfSize);
+	for(U32 n = 0; n < 8; ++n)
+	{
+		for(U32 i = 0; i < halfSize; ++i)
+			block[i] = static_cast<S16>(n * halfSize + i + 1);
+		RSH_TEST_CHECK(streamer.Push(block) == RSH_API_SUCCESS);
+	}
+	// queue of 4096 samples has no space for block of 4096 more
+	RSH_BUFFER_S16 large(4096);
+	large.SetSize(4096);
+	RSH_TEST_CHECK(streamer.Push(large) == RSH_API_BUFFER_INSUFFICIENTSIZE);
+
+	RshInitGSPF init;
+	RSH_TEST_CHECK(streamer.Start(&generator, init, halfSize) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(!streamer.IsGapless());
+	RSH_TEST_CHECK((generator.control & RshInitGSPF::PlayLoop) == 0);
+
+	// all queued halves and then some underruns
+	for(int wait = 0; wait < 500 && streamer.BlocksUploaded() < 12; ++wait)
+		__rshmssleep(2);
+	RSH_TEST_CHECK(streamer.Stop() == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(generator.running == 0);
+	RSH_TEST_CHECK(streamer.LastError() == RSH_API_SUCCESS);
+
+	const size_t queued = 8 * halfSize;
+	RSH_TEST_CHECK(generator.played.size() >= queued + halfSize);
+	RSH_TEST_CHECK(generator.played.size() == streamer.BlocksUploaded() * halfSize);
+	bool inOrder = true;
+	for(size_t i = 0; i < generator.played.size(); ++i)
+		inOrder = inOrder && generator.played[i] == (i < queued ? static_cast<S16>(i + 1) : 0);
+	RSH_TEST_CHECK(inOrder);
+	// half prepared when Stop() came is not uploaded but may be counted
+	const U64 underruns = streamer.BlocksUploaded() - 8;
+	RSH_TEST_CHECK(streamer.Underruns() == underruns || streamer.Underruns() == underruns + 1);
+	RSH_TEST_CHECK(streamer.UnderrunSamples() == streamer.Underruns() * halfSize);
+	RSH_TEST_CHECK(streamer.Queued() == 0);
+}
+
+static void RshTestStopWhileUploading()
+{
+	// worker spends most of the time in upload, so Stop() usually comes during it
+	RshTestGenerator generator(0, 3);
+	RshGspfStreamer streamer(1024);
+	RshInitGSPF init;
+
+	bool stopped = true;
+	for(int n = 0; n < 50; ++n)
+	{
+		RSH_TEST_CHECK(streamer.Start(&generator, init, 64) == RSH_API_SUCCESS);
+		__rshmssleep(1 + n % 7);
+		streamer.Stop();
+		const U32 starts = generator.starts;
+		__rshmssleep(5);
+		stopped = stopped && generator.running == 0 && generator.starts == starts;
+	}
+	RSH_TEST_CHECK(stopped);
+}
+
+int main()
+{
+	RshTestPlayback();
+	RshTestStopWhileUploading();
+	return RSH_TEST_RESULT();
+}
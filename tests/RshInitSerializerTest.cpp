@@ -0,0 +1,290 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshInitSerializerTest.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Test of RshInitSerializer.
+ *
+ * Structures written in binary and JSON form must be read back
+ * unchanged, data of older and newer versions must be read with
+ * missing fields kept and unknown ones skipped. Truncated and damaged
+ * data must be rejected without reading out of it.
+ *
+ * \~russian
+ * \brief
+ * Тест RshInitSerializer.
+ *
+ * Структуры, записанные в двоичной форме и в JSON, должны читаться без
+ * изменений, данные старых и новых версий - читаться с сохранением
+ * отсутствующих полей и пропуском неизвестных. Обрезанные и
+ * поврежденные данные должны отвергаться без чтения за их пределами.
+ *
+ */
+
+#include "RshApi.h"
+#include "RshApi.cpp"
+#include "RshTest.h"
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static bool RshTestSame(const RshInitDMA& a, const RshInitDMA& b)
+{
+	if(a.startType != b.startType || a.bufferSize != b.bufferSize || a.frequency != b.frequency ||
+		a.threshold != b.threshold || a.controlSynchro != b.controlSynchro || a.dmaMode != b.dmaMode ||
+		a.control != b.control || a.frequencyFrame != b.frequencyFrame || a.channels.Size() != b.channels.Size())
+		return false;
+	for(size_t i = 0; i < a.channels.Size(); ++i)
+		if(a.channels[i].gain != b.channels[i].gain || a.channels[i].control != b.channels[i].control ||
+			a.channels[i].adjustment != b.channels[i].adjustment)
+			return false;
+	return true;
+}
+
+static void RshTestFill(RshInitDMA& init)
+{
+	init.startType = RshInitDMA::External;
+	init.bufferSize = 12345;
+	init.frequency = 1.0 / 3.0 * 1.0e+6;
+	init.threshold = -0.1;
+	init.controlSynchro = 7;
+	init.dmaMode = RshInitDMA::Persistent;
+	init.control = 0xFFFFFFFF;
+	init.frequencyFrame = 1.0e-300;
+	init.channels.SetSize(4);
+	for(U32 i = 0; i < 4; ++i)
+	{
+		init.channels[i].gain = i + 1;
+		init.channels[i].control = RshChannel::Used;
+		init.channels[i].adjustment = 0.1 * i;
+	}
+}
+
+static void RshTestRoundTrip()
+{
+	RshInitDMA dma;
+	RshTestFill(dma);
+	std::vector<U8> data;
+	RSH_TEST_CHECK(RshInitSerializer::Write(dma, data) == RSH_API_SUCCESS);
+	RshInitDMA binary;
+	RSH_TEST_CHECK(RshInitSerializer::Read(data, binary) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(RshTestSame(dma, binary));
+
+	std::ostringstream json;
+	RSH_TEST_CHECK(RshInitSerializer::WriteJson(dma, json) == RSH_API_SUCCESS);
+	RshInitDMA text;
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson(json.str().c_str(), text) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(RshTestSame(dma, text));
+
+	// data of other structure type
+	RshInitMemory memory;
+	RSH_TEST_CHECK(RshInitSerializer::Read(data, memory) == RSH_API_PARAMETER_DATATYPENOTSUPPORTED);
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson(json.str().c_str(), memory) == RSH_API_PARAMETER_DATATYPENOTSUPPORTED);
+
+	memory.channelSynchro.gain = 3;
+	memory.channelSynchro.control = 5;
+	memory.preHistory = 11;
+	memory.packetNumber = 9;
+	memory.channels.SetSize(1);
+	memory.channels[0].gain = 8;
+	RSH_TEST_CHECK(RshInitSerializer::Write(memory, data) == RSH_API_SUCCESS);
+	RshInitMemory memoryBinary;
+	RSH_TEST_CHECK(RshInitSerializer::Read(data, memoryBinary) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(memoryBinary.channelSynchro.gain == 3 && memoryBinary.channelSynchro.control == 5 &&
+		memoryBinary.preHistory == 11 && memoryBinary.packetNumber == 9 &&
+		memoryBinary.channels.Size() == 1 && memoryBinary.channels[0].gain == 8);
+	json.str("");
+	RSH_TEST_CHECK(RshInitSerializer::WriteJson(memory, json) == RSH_API_SUCCESS);
+	RshInitMemory memoryText;
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson(json.str().c_str(), memoryText) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(memoryText.channelSynchro.gain == 3 && memoryText.preHistory == 11 && memoryText.channels[0].gain == 8);
+
+	RshInitGSPF gspf;
+	gspf.frequency = 123.5;
+	gspf.attenuator = 2;
+	RSH_TEST_CHECK(RshInitSerializer::Write(gspf, data) == RSH_API_SUCCESS);
+	RshInitGSPF gspfRead;
+	RSH_TEST_CHECK(RshInitSerializer::Read(data, gspfRead) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(gspfRead.frequency == 123.5 && gspfRead.attenuator == 2);
+
+	RshInitTimer timer;
+	timer.timer2Count = 77;
+	RSH_TEST_CHECK(RshInitSerializer::Write(timer, data) == RSH_API_SUCCESS);
+	RshInitTimer timerRead;
+	RSH_TEST_CHECK(RshInitSerializer::Read(data, timerRead) == RSH_API_SUCCESS && timerRead.timer2Count == 77);
+
+	RshInitDAC dac;
+	dac.voltage = -2.5;
+	json.str("");
+	RSH_TEST_CHECK(RshInitSerializer::WriteJson(dac, json) == RSH_API_SUCCESS);
+	RshInitDAC dacRead;
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson(json.str().c_str(), dacRead) == RSH_API_SUCCESS && dacRead.voltage == -2.5);
+
+	RshInitPort port;
+	port.portValue = 0xAB;
+	RSH_TEST_CHECK(RshInitSerializer::Write(port, data) == RSH_API_SUCCESS);
+	RshInitPort portRead;
+	RSH_TEST_CHECK(RshInitSerializer::Read(data, portRead) == RSH_API_SUCCESS && portRead.portValue == 0xAB);
+
+	RSH_BUFFER_CHANNEL table(3);
+	table.SetSize(3);
+	table[2].adjustment = 4.25;
+	json.str("");
+	RSH_TEST_CHECK(RshInitSerializer::WriteJson(table, json) == RSH_API_SUCCESS);
+	RSH_BUFFER_CHANNEL tableRead;
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson(json.str().c_str(), tableRead) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(tableRead.Size() == 3 && tableRead[2].adjustment == 4.25);
+
+	RshDeviceKey key("name");
+	RSH_TEST_CHECK(!RshInitSerializer::IsSupported(key._type));
+	RSH_TEST_CHECK(RshInitSerializer::Write(key, data) == RSH_API_PARAMETER_DATATYPENOTSUPPORTED);
+}
+
+static void RshTestVersions()
+{
+	RshInitDMA dma;
+	RshTestFill(dma);
+	std::vector<U8> data;
+	RSH_TEST_CHECK(RshInitSerializer::Write(dma, data) == RSH_API_SUCCESS);
+
+	// older version wrote only startType and bufferSize
+	std::vector<U8> older(data.begin(), data.begin() + 12);
+	const U8 body[] = { 8, 0, 0, 0, 9, 0, 0, 0, 5, 0, 0, 0 };
+	older.insert(older.end(), body, body + sizeof(body));
+	RshInitDMA olderRead;
+	olderRead.frequency = 77.0;
+	RSH_TEST_CHECK(RshInitSerializer::Read(older, olderRead) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(olderRead.startType == 9 && olderRead.bufferSize == 5 && olderRead.frequency == 77.0);
+
+	// newer version added fields after existing ones
+	std::vector<U8> newer = data;
+	U32 size = 0;
+	memcpy(&size, &newer[12], 4);
+	size += 8;
+	memcpy(&newer[12], &size, 4);
+	newer.insert(newer.end(), 8, static_cast<U8>(0xEE));
+	RshInitDMA newerRead;
+	RSH_TEST_CHECK(RshInitSerializer::Read(newer, newerRead) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(RshTestSame(dma, newerRead));
+
+	RshInitDMA text;
+	text.frequencyFrame = 42.0;
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("{\"bufferSize\": 10, \"future\": [1, {\"a\": null}], \"dmaMode\": 1}", text) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(text.bufferSize == 10 && text.dmaMode == 1 && text.frequencyFrame == 42.0);
+}
+
+static void RshTestTruncated()
+{
+	RshInitDMA dma;
+	RshTestFill(dma);
+	std::vector<U8> data;
+	RSH_TEST_CHECK(RshInitSerializer::Write(dma, data) == RSH_API_SUCCESS);
+
+	bool rejected = true;
+	for(size_t size = 0; size < data.size(); ++size)
+	{
+		std::vector<U8> part(data.begin(), data.begin() + size);
+		RshInitDMA read;
+		rejected = rejected && RshInitSerializer::Read(part, read) == RSH_API_PARAMETER_INVALID;
+	}
+	RSH_TEST_CHECK(rejected);
+
+	std::ostringstream json;
+	RSH_TEST_CHECK(RshInitSerializer::WriteJson(dma, json) == RSH_API_SUCCESS);
+	const std::string text = json.str();
+	const size_t end = text.rfind('}');
+	rejected = true;
+	for(size_t size = 0; size <= end; ++size)
+	{
+		RshInitDMA read;
+		rejected = rejected && RshInitSerializer::ReadJson(text.substr(0, size).c_str(), read) == RSH_API_PARAMETER_INVALID;
+	}
+	RSH_TEST_CHECK(rejected);
+}
+
+static void RshTestMalformed()
+{
+	RshInitDMA dma;
+	RshTestFill(dma);
+	std::vector<U8> data;
+	RSH_TEST_CHECK(RshInitSerializer::Write(dma, data) == RSH_API_SUCCESS);
+
+	RshInitDMA read;
+	RSH_TEST_CHECK(RshInitSerializer::Read(0, 10, read) == RSH_API_PARAMETER_ZEROADDRESS);
+	std::vector<U8> damaged = data;
+	damaged[0] = 0;
+	RSH_TEST_CHECK(RshInitSerializer::Read(damaged, read) == RSH_API_PARAMETER_INVALID);
+
+	// structure size and channel count larger than data
+	damaged = data;
+	const U32 huge = 0x7FFFFFFF;
+	memcpy(&damaged[12], &huge, 4);
+	RSH_TEST_CHECK(RshInitSerializer::Read(damaged, read) == RSH_API_PARAMETER_INVALID);
+	damaged = data;
+	memcpy(&damaged[32], &huge, 4);
+	RSH_TEST_CHECK(RshInitSerializer::Read(damaged, read) == RSH_API_PARAMETER_INVALID);
+
+	// damaged bytes give error or some values, never read out of data
+	RshRandom random(4);
+	for(int n = 0; n < 5000; ++n)
+	{
+		damaged = data;
+		damaged[12 + random.Next() % (data.size() - 12)] ^= static_cast<U8>(1 + random.Next() % 255);
+		RshInitSerializer::Read(damaged, read);
+	}
+
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("{\"bufferSize\": -1}", read) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("{\"bufferSize\": 1.5}", read) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("{\"bufferSize\": 1", read) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("{\"bufferSize\": \"1\\", read) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("{\"type\": \"x\"}", read) == RSH_API_PARAMETER_DATATYPENOTSUPPORTED);
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("[]", read) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson("", read) == RSH_API_PARAMETER_INVALID);
+	const std::string deep(1000, '[');
+	RSH_TEST_CHECK(RshInitSerializer::ReadJson(deep.c_str(), read) == RSH_API_PARAMETER_INVALID);
+
+	std::ostringstream json;
+	RSH_TEST_CHECK(RshInitSerializer::WriteJson(dma, json) == RSH_API_SUCCESS);
+	const std::string text = json.str();
+	for(int n = 0; n < 5000; ++n)
+	{
+		std::string changed = text;
+		changed[random.Next() % text.size()] = "{}[]\":,-.0e\\ x"[random.Next() % 15];
+		RshInitSerializer::ReadJson(changed.c_str(), read);
+	}
+}
+
+static void RshTestCompare()
+{
+	RshInitDMA active;
+	RshTestFill(active);
+	RshInitDMA next;
+	RshTestFill(next);
+	std::vector<std::string> changed;
+	RSH_TEST_CHECK(RshInitSerializer::Compare(active, next, changed) == RSH_API_SUCCESS && changed.empty());
+
+	next.frequency = 2.0e+6;
+	next.channels[1].gain = 10;
+	RSH_TEST_CHECK(RshInitSerializer::Compare(active, next, changed) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(changed.size() == 2 && changed[0] == "frequency" && changed[1] == "channels[1].gain");
+
+	RshInitMemory memory;
+	RSH_TEST_CHECK(RshInitSerializer::Compare(active, memory, changed) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(changed.size() == 1 && changed[0] == "type");
+}
+
+int main()
+{
+	RshTestRoundTrip();
+	RshTestVersions();
+	RshTestTruncated();
+	RshTestMalformed();
+	RshTestCompare();
+	return RSH_TEST_RESULT();
+}
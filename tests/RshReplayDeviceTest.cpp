@@ -0,0 +1,341 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshReplayDeviceTest.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Test of RshRecordingDevice and RshReplayDevice.
+ *
+ * Stream of RshSimulator recorded to file must be replayed with the
+ * same samples and sequence numbers. Looped replay of recording which
+ * does not start from sequence 1 must continue numbers without jumps.
+ * Truncated and malformed files must be rejected or read up to damaged
+ * record, without reading out of file.
+ *
+ * \~russian
+ * \brief
+ * Тест RshRecordingDevice и RshReplayDevice.
+ *
+ * Поток RshSimulator, записанный в файл, должен воспроизводиться с
+ * теми же отсчетами и порядковыми номерами. При циклическом
+ * воспроизведении записи, начинающейся не с номера 1, номера должны
+ * продолжаться без скачков. Обрезанные и поврежденные файлы должны
+ * отвергаться или читаться до поврежденной записи, без чтения за
+ * пределами файла.
+ *
+ */
+
+#include "RshApi.h"
+#include "RshApi.cpp"
+#include "RshTest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#define RSH_TEST_FILE "RshReplayDeviceTest.rec"
+
+// recording file made by hand, see RshRecordingDevice.h
+class RshTestRecording
+{
+public:
+
+	RshTestRecording()
+	{
+		RshRecordingFileHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, RSH_RECORDING_MAGIC, sizeof(header.magic));
+		header.version = RSH_RECORDING_VERSION;
+		header.headerSize = sizeof(header);
+		Append(&header, sizeof(header));
+	}
+
+	void Init(U32 bufferSize, U32 channels)
+	{
+		RshRecordingInit init;
+		memset(&init, 0, sizeof(init));
+		init.bufferSize = bufferSize;
+		init.dmaMode = RshInitDMA::Persistent;
+		init.channels = channels;
+		init.frequency = 1.0e+6;
+		std::vector<RshRecordingChannel> list(channels);
+		for(U32 c = 0; c < channels; ++c)
+		{
+			list[c].gain = 1;
+			list[c].control = RshChannel::Used;
+			list[c].adjustment = 0.0;
+		}
+		Record(RshRecordingKindInit, &init, sizeof(init), channels ? &list[0] : 0, channels * sizeof(RshRecordingChannel));
+	}
+
+	void Start()
+	{
+		RshRecordingStart start;
+		start.time = 0;
+		Record(RshRecordingKindStart, &start, sizeof(start), 0, 0);
+	}
+
+	// samples of block are its sequence number plus index
+	void Block(U64 sequence, U64 ready, U32 elements)
+	{
+		RshRecordingBlock block;
+		memset(&block, 0, sizeof(block));
+		block.ready = ready;
+		block.sequence = sequence;
+		block.dataType = rshBufferTypeS16;
+		block.elementSize = sizeof(S16);
+		block.elements = elements;
+		std::vector<S16> samples(elements);
+		for(U32 i = 0; i < elements; ++i)
+			samples[i] = static_cast<S16>(sequence + i);
+		Record(RshRecordingKindBlock, &block, sizeof(block), elements ? &samples[0] : 0, elements * sizeof(S16));
+	}
+
+	void Record(U32 kind, const void* header, size_t headerSize, const void* data, size_t dataSize)
+	{
+		RshRecordingRecord record;
+		record.kind = kind;
+		record.reserved = 0;
+		record.size = headerSize + dataSize;
+		Append(&record, sizeof(record));
+		Append(header, headerSize);
+		Append(data, dataSize);
+		bytes.resize(bytes.size() + (8 - bytes.size() % 8) % 8, 0);
+	}
+
+	bool Save(size_t size) const
+	{
+		std::ofstream file(RSH_TEST_FILE, std::ios::out | std::ios::binary | std::ios::trunc);
+		if(size != 0)
+			file.write(reinterpret_cast<const char*>(&bytes[0]), static_cast<std::streamsize>(size));
+		file.close();
+		return !file.fail();
+	}
+
+	bool Save() const
+	{
+		return Save(bytes.size());
+	}
+
+	std::vector<U8> bytes;
+
+private:
+
+	void Append(const void* data, size_t size)
+	{
+		const U8* p = static_cast<const U8*>(data);
+		if(size != 0)
+			bytes.insert(bytes.end(), p, p + size);
+	}
+};
+
+static void RshTestRoundTrip()
+{
+	RshSimulator simulator;
+	RshRecordingDevice recorder(&simulator);
+	RshDeviceKey key("channels=2;buffers=16;signal=counter;realtime=0");
+	RSH_TEST_CHECK(recorder.Connect(&key) == RSH_API_SUCCESS);
+
+	RshInitDMA init;
+	init.startType = RshInitDMA::Program;
+	init.dmaMode = RshInitDMA::Persistent;
+	init.bufferSize = 500;
+	init.frequency = 1.0e+6;
+	init.channels.SetSize(2);
+	init.channels[0].control = init.channels[1].control = RshChannel::Used;
+	init.channels[1].gain = 2;
+	RSH_TEST_CHECK(recorder.Init(&init) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(recorder.Open(RSH_TEST_FILE) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(recorder.Start() == RSH_API_SUCCESS);
+
+	const int blocks = 20;
+	RSH_BUFFER_S16 buffer(1000);
+	RSH_U32 wait(1000);
+	std::vector<std::vector<S16> > recorded;
+	std::vector<U64> sequences;
+	for(int n = 0; n < blocks; ++n)
+	{
+		RSH_TEST_CHECK(recorder.Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait) == RSH_API_SUCCESS);
+		RSH_TEST_CHECK(recorder.GetData(&buffer) == RSH_API_SUCCESS);
+		recorded.push_back(std::vector<S16>(buffer.ptr, buffer.ptr + buffer.Size()));
+		RshBlockInfo info;
+		RSH_TEST_CHECK(simulator.Get(RSH_GET_BUFFER_BLOCK_INFO, &info) == RSH_API_SUCCESS);
+		sequences.push_back(info.sequence);
+	}
+	recorder.Stop();
+	RSH_TEST_CHECK(recorder.Blocks() == static_cast<U64>(blocks));
+	RSH_TEST_CHECK(recorder.Close() == RSH_API_SUCCESS);
+
+	RshReplayDevice replay;
+	RshDeviceKey fileKey(RSH_TEST_FILE);
+	RSH_TEST_CHECK(replay.Connect(&fileKey) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(replay.Blocks() == static_cast<U64>(blocks) && replay.Starts() == 1);
+	RshInitDMA restored;
+	RSH_TEST_CHECK(replay.Init(&restored) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(restored.bufferSize == 500 && restored.frequency == 1.0e+6 && restored.channels.Size() == 2 && restored.channels[1].gain == 2);
+	RSH_TEST_CHECK(replay.SetSpeed(0.0) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(replay.Start() == RSH_API_SUCCESS);
+
+	bool same = true;
+	for(int n = 0; n < blocks; ++n)
+	{
+		RSH_TEST_CHECK(replay.Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait) == RSH_API_SUCCESS);
+		RSH_TEST_CHECK(replay.GetData(&buffer) == RSH_API_SUCCESS);
+		RshBlockInfo info;
+		RSH_TEST_CHECK(replay.Get(RSH_GET_BUFFER_BLOCK_INFO, &info) == RSH_API_SUCCESS);
+		same = same && std::vector<S16>(buffer.ptr, buffer.ptr + buffer.Size()) == recorded[n] && info.sequence == sequences[n];
+	}
+	RSH_TEST_CHECK(same);
+	// stream is over, as device which stopped
+	RSH_TEST_CHECK(replay.Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait) == RSH_API_DEVICE_WASNOTSTARTED);
+	RSH_TEST_CHECK(replay.GetData(&buffer) == RSH_API_DEVICE_CANTGETDATA);
+
+	// buffer of other type
+	RSH_TEST_CHECK(replay.Start() == RSH_API_SUCCESS);
+	RSH_BUFFER_S32 other(1000);
+	RSH_TEST_CHECK(replay.GetData(&other) == RSH_API_BUFFER_WRONGDATATYPE);
+	replay.Stop();
+}
+
+static void RshTestLoop()
+{
+	// recording opened after start of device, with gap after 1001
+	RshTestRecording recording;
+	recording.Init(16, 1);
+	recording.Start();
+	const U64 recorded[] = { 1000, 1001, 1003, 1004 };
+	for(U64 i = 0; i < 4; ++i)
+		recording.Block(recorded[i], 1000 * (i + 1), 16);
+	RSH_TEST_CHECK(recording.Save());
+
+	RshReplayDevice replay;
+	RSH_TEST_CHECK(replay.Open(RSH_TEST_FILE) == RSH_API_SUCCESS);
+	RshInitDMA init;
+	RSH_TEST_CHECK(replay.Init(&init) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(replay.SetSpeed(0.0) == RSH_API_SUCCESS);
+	replay.SetLoop(true);
+	RSH_TEST_CHECK(replay.Start() == RSH_API_SUCCESS);
+
+	// before first block sequence precedes first recorded one
+	RshBlockInfo info;
+	RSH_TEST_CHECK(replay.Get(RSH_GET_BUFFER_BLOCK_INFO, &info) == RSH_API_SUCCESS && info.sequence == 999);
+
+	RSH_BUFFER_S16 buffer(16);
+	RSH_U32 wait(1000);
+	bool continued = true;
+	bool samples = true;
+	for(U64 pass = 0; pass < 3; ++pass)
+	{
+		for(U64 i = 0; i < 4; ++i)
+		{
+			RSH_TEST_CHECK(replay.Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait) == RSH_API_SUCCESS);
+			RSH_TEST_CHECK(replay.GetData(&buffer) == RSH_API_SUCCESS);
+			RSH_TEST_CHECK(replay.Get(RSH_GET_BUFFER_BLOCK_INFO, &info) == RSH_API_SUCCESS);
+			continued = continued && info.sequence == recorded[i] + 5 * pass;
+			samples = samples && buffer.Size() == 16 && buffer[1] == static_cast<S16>(recorded[i] + 1);
+		}
+	}
+	RSH_TEST_CHECK(continued);
+	RSH_TEST_CHECK(samples);
+	replay.Stop();
+}
+
+static void RshTestTruncated()
+{
+	RshTestRecording recording;
+	recording.Init(64, 2);
+	recording.Start();
+	for(U64 i = 0; i < 5; ++i)
+		recording.Block(i + 1, 1000 * (i + 1), 64);
+
+	// each cut gives error or blocks which are complete in file
+	bool valid = true;
+	U64 previous = 0;
+	RSH_BUFFER_S16 buffer(64);
+	RSH_U32 wait(1000);
+	for(size_t size = 0; size <= recording.bytes.size(); ++size)
+	{
+		RSH_TEST_CHECK(recording.Save(size));
+		RshReplayDevice replay;
+		const U32 st = replay.Open(RSH_TEST_FILE);
+		if(size < sizeof(RshRecordingFileHeader))
+		{
+			valid = valid && st != RSH_API_SUCCESS;
+			continue;
+		}
+		valid = valid && st == RSH_API_SUCCESS && replay.Blocks() >= previous && replay.Blocks() <= 5;
+		previous = replay.Blocks();
+
+		RshInitDMA init;
+		replay.SetSpeed(0.0);
+		if(replay.Init(&init) != RSH_API_SUCCESS || replay.Start() != RSH_API_SUCCESS)
+			continue;
+		for(U64 n = 0; n < replay.Blocks(); ++n)
+			valid = valid && replay.Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait) == RSH_API_SUCCESS && replay.GetData(&buffer) == RSH_API_SUCCESS;
+		replay.Stop();
+	}
+	RSH_TEST_CHECK(valid);
+	RSH_TEST_CHECK(previous == 5);
+}
+
+static void RshTestMalformed()
+{
+	RshReplayDevice replay;
+	RSH_TEST_CHECK(replay.Open("RshReplayDeviceTest.none") != RSH_API_SUCCESS);
+	RshInitDMA init;
+	RSH_TEST_CHECK(replay.Init(&init) == RSH_API_DEVICE_NOTINITIALIZED);
+
+	RshTestRecording good;
+	good.Init(16, 1);
+	good.Start();
+	good.Block(1, 1000, 16);
+
+	// magic, version and header size
+	const size_t fields[] = { 0, 8, 12 };
+	for(size_t f = 0; f < sizeof(fields) / sizeof(fields[0]); ++f)
+	{
+		RshTestRecording bad = good;
+		bad.bytes[fields[f]] ^= 0x5A;
+		RSH_TEST_CHECK(bad.Save());
+		RSH_TEST_CHECK(replay.Open(RSH_TEST_FILE) == RSH_API_FILE_CANTREAD);
+	}
+
+	// block with more samples than its payload, record larger than file
+	RshTestRecording bad = good;
+	RshRecordingBlock block;
+	memset(&block, 0, sizeof(block));
+	block.sequence = 2;
+	block.dataType = rshBufferTypeS16;
+	block.elementSize = sizeof(S16);
+	block.elements = 0xFFFFFFFFFFFFULL;
+	bad.Record(RshRecordingKindBlock, &block, sizeof(block), 0, 0);
+	block.elementSize = 0;
+	block.elements = 1;
+	bad.Record(RshRecordingKindBlock, &block, sizeof(block), 0, 0);
+	RshRecordingInit wrongInit;
+	memset(&wrongInit, 0, sizeof(wrongInit));
+	wrongInit.channels = 0x7FFFFFFF;
+	bad.Record(RshRecordingKindInit, &wrongInit, sizeof(wrongInit), 0, 0);
+	const size_t last = bad.bytes.size();
+	bad.Block(3, 3000, 16);
+	RshRecordingRecord& record = *reinterpret_cast<RshRecordingRecord*>(&bad.bytes[last]);
+	record.size = 0xFFFFFFFFFFFFFFF0ULL;
+	RSH_TEST_CHECK(bad.Save());
+	RSH_TEST_CHECK(replay.Open(RSH_TEST_FILE) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(replay.Blocks() == 1);
+	RSH_TEST_CHECK(replay.Init(&init) == RSH_API_SUCCESS && init.channels.Size() == 1);
+}
+
+int main()
+{
+	RshTestRoundTrip();
+	RshTestLoop();
+	RshTestTruncated();
+	RshTestMalformed();
+	remove(RSH_TEST_FILE);
+	return RSH_TEST_RESULT();
+}
@@ -0,0 +1,51 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshTest.h
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Checks used by SDK tests.
+ *
+ * Each test is separate non interactive program which includes
+ * RshApi.cpp, prints failed checks and returns number of failures,
+ * so zero exit code means success. Build and run (Linux):
+ * \code
+ * g++ -O2 -I../HEADERS RshGspfStreamerTest.cpp -o RshGspfStreamerTest -ldl -lpthread && ./RshGspfStreamerTest
+ * \endcode
+ *
+ * \~russian
+ * \brief
+ * Проверки, используемые тестами SDK.
+ *
+ * Каждый тест - отдельная неинтерактивная программа, включающая
+ * RshApi.cpp, которая печатает невыполненные проверки и возвращает
+ * их число, поэтому нулевой код возврата означает успех. Сборка и
+ * запуск приведены выше.
+ *
+ */
+
+#ifndef RSH_TEST_H
+#define RSH_TEST_H
+
+#include <cstdio>
+
+static int rshTestFailures = 0;
+
+//! Print expression and location if it is false, test continues
+#define RSH_TEST_CHECK(expression) \
+	do { \
+		if(!(expression)) \
+		{ \
+			++rshTestFailures; \
+			printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #expression); \
+		} \
+	} while(0)
+
+//! Print result of test and return it from main()
+#define RSH_TEST_RESULT() \
+	(printf(rshTestFailures == 0 ? "PASSED\n" : "FAILED %d checks\n", rshTestFailures), rshTestFailures)
+
+#endif //RSH_TEST_H
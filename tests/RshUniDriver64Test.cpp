@@ -0,0 +1,194 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshUniDriver64Test.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Test of RshUniDriver64 library (unidriver/RshUniDriver64.cpp).
+ *
+ * RshSimulator with counter signal is attached as device. Data of
+ * library buffers, registered memory and borrowed blocks must follow
+ * the counter, borrowed blocks must stay untouched until released,
+ * and wrong handles, buffers and blocks must be rejected.
+ *
+ * \~russian
+ * \brief
+ * Тест библиотеки RshUniDriver64 (unidriver/RshUniDriver64.cpp).
+ *
+ * В качестве устройства подключается RshSimulator с сигналом счетчика.
+ * Данные буферов библиотеки, зарегистрированной памяти и выданных блоков
+ * должны соответствовать счетчику, выданные блоки не должны меняться до
+ * возврата, а неверные идентификаторы, буферы и блоки - отвергаться.
+ *
+ */
+
+// RshApi.h and RshApi.cpp are included by library source
+#include "../unidriver/RshUniDriver64.cpp"
+#include "RshTest.h"
+
+#include <vector>
+
+#define RSH_TEST_BLOCK_SIZE 256
+
+// samples of block number "block" (from 0) of counter signal on one channel
+static bool RshTestCounter(const S16* data, U64 size, U64 block)
+{
+	if(data == 0 || size != RSH_TEST_BLOCK_SIZE)
+		return false;
+	for(U64 i = 0; i < size; ++i)
+		if(data[i] != static_cast<S16>(block * RSH_TEST_BLOCK_SIZE + i))
+			return false;
+	return true;
+}
+
+static void RshTestBuffers()
+{
+	unsigned int version = 0;
+	RSH_TEST_CHECK(UniDriverGetApiVersion(&version) == RSH_API_SUCCESS && version == RSH_UNIDRIVER_API_VERSION_ZERO_COPY);
+
+	URshBuffer64 buffer = URshBuffer64();
+	buffer.type = rshBufferTypeS16;
+	RSH_TEST_CHECK(UniDriverAllocateBuffer64(&buffer, 100) == RSH_API_PARAMETER_INVALID);
+	buffer.structSize = sizeof(URshBuffer64);
+	buffer.type = rshBufferTypeChannel;
+	RSH_TEST_CHECK(UniDriverAllocateBuffer64(&buffer, 100) == RSH_API_BUFFER_WRONGDATATYPE);
+	buffer.type = rshBufferTypeS16;
+	RSH_TEST_CHECK(UniDriverAllocateBuffer64(&buffer, 0xFFFFFFFFFFFFFFFFULL) == RSH_API_MEMORY_ALLOCATIONERROR);
+	RSH_TEST_CHECK(UniDriverAllocateBuffer64(&buffer, 100) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(buffer.id != 0 && buffer.ptr != 0 && buffer.psize == 100 && buffer.flags == URshBufferFlagLibrary);
+
+	std::vector<S16> memory(10);
+	URshBuffer64 user = URshBuffer64();
+	user.structSize = sizeof(URshBuffer64);
+	user.type = rshBufferTypeS16;
+	RSH_TEST_CHECK(UniDriverRegisterBuffer(&user, 0, 10) == RSH_API_PARAMETER_ZEROADDRESS);
+	RSH_TEST_CHECK(UniDriverRegisterBuffer(&user, &memory[0], 10) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(user.id != buffer.id && user.ptr == &memory[0] && user.psize == 10 && user.flags == URshBufferFlagUser);
+
+	URshBuffer64 copy = user;
+	RSH_TEST_CHECK(UniDriverFreeBuffer64(&user) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(user.id == 0 && user.ptr == 0 && user.psize == 0);
+	RSH_TEST_CHECK(UniDriverFreeBuffer64(&copy) == RSH_API_BUFFER_NOTINITIALIZED);
+	RSH_TEST_CHECK(UniDriverFreeBuffer64(&buffer) == RSH_API_SUCCESS);
+}
+
+static void RshTestInit(unsigned int handle)
+{
+	URshInitDMA init = URshInitDMA();
+	init.type = rshInitPort;
+	RSH_TEST_CHECK(UniDriverInit64(handle, RSH_INIT_MODE_INIT, &init) == RSH_API_PARAMETER_DATATYPENOTSUPPORTED);
+
+	init.type = rshInitDMA;
+	init.startType = URshStartTypeProgram;
+	init.dmaMode = URshInitDmaDmaModePersistent;
+	init.bufferSize = RSH_TEST_BLOCK_SIZE;
+	init.frequency = 1.0e+12;
+	init.channels[0].control = URshChanControlUsed;
+	init.channels[0].gain = 1;
+	// corrected sample rate is returned in structure
+	RSH_TEST_CHECK(UniDriverInit64(handle, RSH_INIT_MODE_INIT, &init) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(init.frequency == 1.0e+9 && init.bufferSize == RSH_TEST_BLOCK_SIZE);
+}
+
+static void RshTestGetData(unsigned int handle)
+{
+	URshBuffer64 buffer = URshBuffer64();
+	buffer.structSize = sizeof(URshBuffer64);
+	buffer.type = rshBufferTypeS16;
+	RSH_TEST_CHECK(UniDriverGetData64(handle, RSH_DATA_MODE_NO_FLAGS, &buffer) == RSH_API_BUFFER_NOTINITIALIZED);
+	RSH_TEST_CHECK(UniDriverAllocateBuffer64(&buffer, 1) == RSH_API_SUCCESS);
+
+	// buffer of library grows to block size
+	RSH_TEST_CHECK(UniDriverWaitBufferReady64(handle, 1000) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(UniDriverGetData64(handle, RSH_DATA_MODE_NO_FLAGS, &buffer) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(buffer.psize >= RSH_TEST_BLOCK_SIZE && RshTestCounter(static_cast<S16*>(buffer.ptr), buffer.size, 0));
+
+	std::vector<S16> memory(RSH_TEST_BLOCK_SIZE);
+	URshBuffer64 user = URshBuffer64();
+	user.structSize = sizeof(URshBuffer64);
+	user.type = rshBufferTypeS16;
+	UniDriverRegisterBuffer(&user, &memory[0], memory.size());
+	RSH_TEST_CHECK(UniDriverWaitBufferReady64(handle, 1000) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(UniDriverGetData64(handle, RSH_DATA_MODE_NO_FLAGS, &user) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(RshTestCounter(&memory[0], user.size, 1));
+	UniDriverFreeBuffer64(&user);
+
+	// too small memory is not written, needed size is returned
+	std::vector<S16> small(10, -1);
+	UniDriverRegisterBuffer(&user, &small[0], small.size());
+	RSH_TEST_CHECK(UniDriverWaitBufferReady64(handle, 1000) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(UniDriverGetData64(handle, RSH_DATA_MODE_NO_FLAGS, &user) == RSH_API_BUFFER_INSUFFICIENTSIZE);
+	RSH_TEST_CHECK(user.size == RSH_TEST_BLOCK_SIZE && small[0] == -1);
+	UniDriverFreeBuffer64(&user);
+	UniDriverFreeBuffer64(&buffer);
+}
+
+static void RshTestBorrow(unsigned int handle)
+{
+	URshBlock block = URshBlock();
+	block.type = rshBufferTypeS16;
+	RSH_TEST_CHECK(UniDriverBorrowBlock(handle, RSH_DATA_MODE_NO_FLAGS, &block, 1000) == RSH_API_PARAMETER_INVALID);
+	block.structSize = sizeof(URshBlock);
+	block.type = rshBufferTypeChannel;
+	RSH_TEST_CHECK(UniDriverBorrowBlock(handle, RSH_DATA_MODE_NO_FLAGS, &block, 1000) == RSH_API_BUFFER_WRONGDATATYPE);
+	block.type = rshBufferTypeS16;
+
+	// all internal buffers are held, blocks follow each other
+	std::vector<URshBlock> held(RSH_UNIDRIVER64_BLOCKS, block);
+	bool borrowed = true;
+	for(U32 i = 0; i < RSH_UNIDRIVER64_BLOCKS; ++i)
+		borrowed = borrowed && UniDriverBorrowBlock(handle, RSH_DATA_MODE_NO_FLAGS, &held[i], 1000) == RSH_API_SUCCESS;
+	RSH_TEST_CHECK(borrowed);
+	const U64 first = held[0].sequence;
+	bool counter = first > 0;
+	for(U32 i = 0; i < RSH_UNIDRIVER64_BLOCKS; ++i)
+		counter = counter && held[i].sequence == first + i && RshTestCounter(static_cast<const S16*>(held[i].ptr), held[i].size, first - 1 + i);
+	RSH_TEST_CHECK(counter);
+	RSH_TEST_CHECK(UniDriverBorrowBlock(handle, RSH_DATA_MODE_NO_FLAGS, &block, 1000) == RSH_API_BUFFER_INSUFFICIENTSIZE);
+
+	// released buffer is used for next block, others are not changed
+	URshBlock copy = held[3];
+	RSH_TEST_CHECK(UniDriverReleaseBlock(handle, &held[3]) == RSH_API_SUCCESS && held[3].ptr == 0 && held[3].id == 0);
+	RSH_TEST_CHECK(UniDriverReleaseBlock(handle, &held[3]) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(UniDriverReleaseBlock(handle, &copy) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(UniDriverBorrowBlock(handle, RSH_DATA_MODE_NO_FLAGS, &block, 1000) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(block.ptr == copy.ptr && block.id != copy.id && block.sequence == first + RSH_UNIDRIVER64_BLOCKS);
+	RSH_TEST_CHECK(RshTestCounter(static_cast<const S16*>(held[2].ptr), held[2].size, first + 1));
+	RSH_TEST_CHECK(UniDriverReleaseBlock(handle, &copy) == RSH_API_PARAMETER_INVALID);
+
+	// stop returns all blocks
+	RSH_TEST_CHECK(UniDriverStop64(handle) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(UniDriverReleaseBlock(handle, &held[0]) == RSH_API_PARAMETER_INVALID);
+	RSH_TEST_CHECK(UniDriverReleaseBlock(handle, &block) == RSH_API_PARAMETER_INVALID);
+	// internal buffers are free again, blocks left in device ring may still be taken
+	RSH_TEST_CHECK(UniDriverBorrowBlock(handle, RSH_DATA_MODE_NO_FLAGS, &block, 10) != RSH_API_BUFFER_INSUFFICIENTSIZE);
+}
+
+static void RshTestDevice()
+{
+	RshSimulator simulator;
+	unsigned int handle = 0;
+	RSH_TEST_CHECK(RshUniDriverAttach(&simulator, false, &handle) == RSH_API_SUCCESS && handle != 0);
+	RSH_TEST_CHECK(UniDriverConnectViaStringKey64(handle, "channels=1;bits=16;buffers=64;signal=counter;realtime=0", RSH_CONNECT_MODE_BASE) == RSH_API_SUCCESS);
+
+	RshTestInit(handle);
+	RSH_TEST_CHECK(UniDriverStart64(handle) == RSH_API_SUCCESS);
+	RshTestGetData(handle);
+	RshTestBorrow(handle);
+
+	RSH_TEST_CHECK(UniDriverCloseDeviceHandle64(handle) == RSH_API_SUCCESS);
+	RSH_TEST_CHECK(UniDriverCloseDeviceHandle64(handle) == RSH_API_PARAMETER_WRONGDEVICEHANDLE);
+	RSH_TEST_CHECK(UniDriverStart64(handle) == RSH_API_PARAMETER_WRONGDEVICEHANDLE);
+	RSH_TEST_CHECK(UniDriverStart64(0) == RSH_API_PARAMETER_WRONGDEVICEHANDLE);
+	RSH_TEST_CHECK(UniDriverConnect64(handle + 1, 1, RSH_CONNECT_MODE_BASE) == RSH_API_PARAMETER_WRONGDEVICEHANDLE);
+}
+
+int main()
+{
+	RshTestBuffers();
+	RshTestDevice();
+	return RSH_TEST_RESULT();
+}
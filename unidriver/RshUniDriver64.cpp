@@ -0,0 +1,597 @@
+/*!
+ * \copyright JSC "Rudnev-Shilyaev"
+ *
+ * \file RshUniDriver64.cpp
+ * \date 19.10.2026
+ * \version 1.0 [SDK 2.1]
+ *
+ * \~english
+ * \brief
+ * Library "RshUniDriver64", C interface to devices.
+ *
+ * Implements functions of RshUniDriver64.h over RshDllClient and
+ * IRshDevice, so programs in other languages (LabVIEW, Python ctypes,
+ * C#) get 64-bit buffer sizes, buffers in their own memory and blocks
+ * lent without copying:
+ * \code
+ * unsigned int handle = 0;
+ * UniDriverGetDeviceHandle64("LAn10_12USB", &handle);
+ * UniDriverConnect64(handle, 1, RSH_CONNECT_MODE_BASE);
+ * UniDriverInit64(handle, RSH_INIT_MODE_INIT, &init); // URshInitDMA
+ * UniDriverStart64(handle);
+ * // UniDriverWaitBufferReady64() and UniDriverGetData64() copy data to buffer,
+ * // UniDriverBorrowBlock() lends internal buffer
+ * URshBlock block = { sizeof(URshBlock), rshBufferTypeS16 };
+ * while(UniDriverBorrowBlock(handle, RSH_DATA_MODE_NO_FLAGS, &block, 1000) == RSH_API_SUCCESS)
+ * {
+ *     // block.ptr, block.size, block.sequence
+ *     UniDriverReleaseBlock(handle, &block);
+ * }
+ * UniDriverStop64(handle);
+ * UniDriverCloseDeviceHandle64(handle);
+ * \endcode
+ *
+ * Build and install (Linux):
+ * \code
+ * g++ -O2 -shared -fPIC -I../HEADERS RshUniDriver64.cpp -o libRshUniDriver64.so -ldl -lpthread
+ * cp libRshUniDriver64.so /usr/lib/
+ * \endcode
+ *
+ * \~russian
+ * \brief
+ * Библиотека "RshUniDriver64", интерфейс C для работы с устройствами.
+ *
+ * Реализует функции RshUniDriver64.h поверх RshDllClient и IRshDevice,
+ * поэтому программы на других языках (LabVIEW, Python ctypes, C#)
+ * получают 64-разрядные размеры буферов, буферы в собственной памяти и
+ * блоки без копирования (см. пример выше).
+ *
+ * Сборка и установка приведены выше.
+ *
+ */
+
+//Заголовочные файлы Rsh SDK. RshApi.cpp тоже включен с помощью #include для простоты
+#include "RshApi.h"
+#include "RshApi.cpp"
+
+#if defined(RSH_MSWINDOWS)
+	#define RSH_UNIDRIVER64_API __declspec(dllexport)
+#endif
+#include "RshUniDriver64.h"
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+//====================================== STORAGE ======================================
+
+// RshBufferType of any element type, selected by URshBuffer64::type or URshBlock::type
+class RshUniDriverStorage
+{
+public:
+	virtual ~RshUniDriverStorage() {}
+
+	virtual RshBaseType* Base() = 0;
+	virtual void* Data() = 0;
+	virtual size_t Size() const = 0;
+	virtual size_t Capacity() const = 0;
+	virtual size_t ItemSize() const = 0;
+	virtual U32 Allocate(size_t size) = 0;
+};
+
+template<typename T, RshDataTypes dataCode>
+class RshUniDriverStorageType : public RshUniDriverStorage
+{
+public:
+	RshBaseType* Base() { return &m_buffer; }
+	void* Data() { return m_buffer.ptr; }
+	size_t Size() const { return m_buffer.Size(); }
+	size_t Capacity() const { return m_buffer.PSize(); }
+	size_t ItemSize() const { return sizeof(T); }
+
+	U32 Allocate(size_t size)
+	{
+		return m_buffer.Allocate(size == 0 ? 1 : size);
+	}
+
+private:
+	RshBufferType<T, dataCode> m_buffer;
+};
+
+// 0 if type is not supported
+static RshUniDriverStorage* RshUniDriverCreateStorage(U32 type)
+{
+	switch(type)
+	{
+	case rshBufferTypeU8: return new RshUniDriverStorageType<U8, rshBufferTypeU8>();
+	case rshBufferTypeS8: return new RshUniDriverStorageType<S8, rshBufferTypeS8>();
+	case rshBufferTypeU16: return new RshUniDriverStorageType<U16, rshBufferTypeU16>();
+	case rshBufferTypeS16: return new RshUniDriverStorageType<S16, rshBufferTypeS16>();
+	case rshBufferTypeU32: return new RshUniDriverStorageType<U32, rshBufferTypeU32>();
+	case rshBufferTypeS32: return new RshUniDriverStorageType<S32, rshBufferTypeS32>();
+	case rshBufferTypeU64: return new RshUniDriverStorageType<U64, rshBufferTypeU64>();
+	case rshBufferTypeS64: return new RshUniDriverStorageType<S64, rshBufferTypeS64>();
+	case rshBufferTypeFloat: return new RshUniDriverStorageType<float, rshBufferTypeFloat>();
+	case rshBufferTypeDouble: return new RshUniDriverStorageType<double, rshBufferTypeDouble>();
+	default: return 0;
+	}
+}
+
+//====================================== TABLES ======================================
+
+// URshBuffer64, memory is 0 for buffer allocated by library
+struct RshUniDriverBuffer
+{
+	RshUniDriverStorage* storage;
+	void* memory;
+	U64 elements;
+};
+
+// internal buffer of URshBlock, id is 0 while buffer is free
+struct RshUniDriverBlock
+{
+	RshUniDriverStorage* storage;
+	U32 id;
+};
+
+struct RshUniDriverDevice
+{
+	IRshDevice* device;
+	bool library;
+	U32 lastId;
+	RshUniDriverBlock blocks[RSH_UNIDRIVER64_BLOCKS];
+	RshMutex mutex;
+};
+
+static RshMutex rshUniDriverMutex;
+// loads devices for all handles, so one library is loaded once
+static RshDllClient* rshUniDriverClient = 0;
+static U32 rshUniDriverLibraryDevices = 0;
+// device handle is index + 1, closed handles are 0
+static std::vector<RshUniDriverDevice*> rshUniDriverDevices;
+static std::map<U32, RshUniDriverBuffer> rshUniDriverBuffers;
+static U32 rshUniDriverLastBuffer = 0;
+
+// library is false for device made by program (tests), which is not owned
+static U32 RshUniDriverAttach(IRshDevice* device, bool library, unsigned int* deviceHandle)
+{
+	RshUniDriverDevice* entry = new RshUniDriverDevice();
+	entry->device = device;
+	entry->library = library;
+	entry->lastId = 0;
+	for(U32 i = 0; i < RSH_UNIDRIVER64_BLOCKS; ++i)
+	{
+		entry->blocks[i].storage = 0;
+		entry->blocks[i].id = 0;
+	}
+
+	RshMutexLocker lock(rshUniDriverMutex);
+	rshUniDriverDevices.push_back(entry);
+	*deviceHandle = static_cast<unsigned int>(rshUniDriverDevices.size());
+	return RSH_API_SUCCESS;
+}
+
+// handle must not be closed while other calls with it are in progress
+static RshUniDriverDevice* RshUniDriverFind(unsigned int deviceHandle)
+{
+	RshMutexLocker lock(rshUniDriverMutex);
+	if(deviceHandle == 0 || deviceHandle > rshUniDriverDevices.size())
+		return 0;
+	return rshUniDriverDevices[deviceHandle - 1];
+}
+
+// 0 if buffer was not made by UniDriverAllocateBuffer64() or UniDriverRegisterBuffer()
+static RshUniDriverBuffer* RshUniDriverFindBuffer(const URshBuffer64* uRshBuffer)
+{
+	RshMutexLocker lock(rshUniDriverMutex);
+	std::map<U32, RshUniDriverBuffer>::iterator it = rshUniDriverBuffers.find(uRshBuffer->id);
+	if(it == rshUniDriverBuffers.end() || it->second.storage->Base()->_type != static_cast<U32>(uRshBuffer->type))
+		return 0;
+	return &it->second;
+}
+
+static U32 RshUniDriverAddBuffer(URshBuffer64* uRshBuffer, RshUniDriverStorage* storage, void* memory, U64 elements)
+{
+	RshUniDriverBuffer buffer;
+	buffer.storage = storage;
+	buffer.memory = memory;
+	buffer.elements = elements;
+
+	RshMutexLocker lock(rshUniDriverMutex);
+	if(++rshUniDriverLastBuffer == 0)
+		++rshUniDriverLastBuffer;
+	rshUniDriverBuffers[rshUniDriverLastBuffer] = buffer;
+	uRshBuffer->id = rshUniDriverLastBuffer;
+	return RSH_API_SUCCESS;
+}
+
+//====================================== INITIALIZATION ======================================
+
+// fields of RshInitADC, same in URshInitDMA and URshInitMemory
+template<class U>
+static void RshUniDriverToInit(const U& from, RshInitADC& to)
+{
+	to.startType = from.startType;
+	to.bufferSize = from.bufferSize;
+	to.frequency = from.frequency;
+	to.threshold = from.threshold;
+	to.controlSynchro = from.controlSynchro;
+	to.channels.SetSize(RSH_MAX_LIST_SIZE);
+	for(U32 i = 0; i < RSH_MAX_LIST_SIZE; ++i)
+	{
+		to.channels[i].gain = from.channels[i].gain;
+		to.channels[i].control = from.channels[i].control;
+		to.channels[i].adjustment = from.channels[i].adjustment;
+	}
+}
+
+template<class U>
+static void RshUniDriverFromInit(const RshInitADC& from, U& to)
+{
+	to.startType = from.startType;
+	to.bufferSize = from.bufferSize;
+	to.frequency = from.frequency;
+	to.threshold = from.threshold;
+	to.controlSynchro = from.controlSynchro;
+	for(U32 i = 0; i < RSH_MAX_LIST_SIZE && i < from.channels.Size(); ++i)
+	{
+		to.channels[i].gain = from.channels[i].gain;
+		to.channels[i].control = from.channels[i].control;
+		to.channels[i].adjustment = from.channels[i].adjustment;
+	}
+}
+
+static U32 RshUniDriverInitDMA(IRshDevice* device, U32 mode, URshInitDMA& structure)
+{
+	RshInitDMA init;
+	RshUniDriverToInit(structure, init);
+	init.dmaMode = structure.dmaMode;
+	init.control = structure.control;
+	init.frequencyFrame = structure.frequencyFrame;
+
+	const U32 st = device->Init(&init, mode);
+
+	RshUniDriverFromInit(init, structure);
+	structure.dmaMode = init.dmaMode;
+	structure.control = init.control;
+	structure.frequencyFrame = init.frequencyFrame;
+	return st;
+}
+
+static U32 RshUniDriverInitMemory(IRshDevice* device, U32 mode, URshInitMemory& structure)
+{
+	RshInitMemory init;
+	RshUniDriverToInit(structure, init);
+	init.control = structure.control;
+	init.preHistory = structure.preHistory;
+	init.startDelay = structure.startDelay;
+	init.hysteresis = structure.hysteresis;
+	init.packetNumber = structure.packetNumber;
+	init.channelSynchro.gain = structure.channelSynchro.gain;
+	init.channelSynchro.control = structure.channelSynchro.control;
+
+	const U32 st = device->Init(&init, mode);
+
+	RshUniDriverFromInit(init, structure);
+	structure.control = init.control;
+	structure.preHistory = init.preHistory;
+	structure.startDelay = init.startDelay;
+	structure.hysteresis = init.hysteresis;
+	structure.packetNumber = init.packetNumber;
+	structure.channelSynchro.gain = init.channelSynchro.gain;
+	structure.channelSynchro.control = init.channelSynchro.control;
+	return st;
+}
+
+//====================================== EXPORTS ======================================
+
+unsigned __RSHCALLCONV UniDriverGetApiVersion(unsigned int* version)
+{
+	if(version == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	*version = RSH_UNIDRIVER_API_VERSION_ZERO_COPY;
+	return RSH_API_SUCCESS;
+}
+
+unsigned __RSHCALLCONV UniDriverGetDeviceHandle64(const char* deviceName, unsigned int* deviceHandle)
+{
+	if(deviceName == 0 || deviceHandle == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	IRshDevice* device = 0;
+	{
+		RshMutexLocker lock(rshUniDriverMutex);
+		if(rshUniDriverClient == 0)
+			rshUniDriverClient = new RshDllClient();
+		RshDllInterfaceKey key(deviceName, device);
+		U32 st = rshUniDriverClient->GetDeviceInterface(key);
+		if(st != RSH_API_SUCCESS)
+			return st;
+		++rshUniDriverLibraryDevices;
+	}
+	return RshUniDriverAttach(device, true, deviceHandle);
+}
+
+unsigned __RSHCALLCONV UniDriverCloseDeviceHandle64(unsigned int deviceHandle)
+{
+	RshUniDriverDevice* entry = 0;
+	{
+		RshMutexLocker lock(rshUniDriverMutex);
+		if(deviceHandle == 0 || deviceHandle > rshUniDriverDevices.size() || rshUniDriverDevices[deviceHandle - 1] == 0)
+			return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+		entry = rshUniDriverDevices[deviceHandle - 1];
+		rshUniDriverDevices[deviceHandle - 1] = 0;
+
+		// device objects are deleted by factories of unloaded libraries
+		if(entry->library && --rshUniDriverLibraryDevices == 0)
+		{
+			rshUniDriverClient->Free();
+			delete rshUniDriverClient;
+			rshUniDriverClient = 0;
+		}
+	}
+
+	for(U32 i = 0; i < RSH_UNIDRIVER64_BLOCKS; ++i)
+		delete entry->blocks[i].storage;
+	delete entry;
+	return RSH_API_SUCCESS;
+}
+
+unsigned __RSHCALLCONV UniDriverConnect64(unsigned int deviceHandle, unsigned int deviceIndex, unsigned int mode)
+{
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+	RshDeviceKey key(static_cast<U32>(deviceIndex));
+	return entry->device->Connect(&key, mode);
+}
+
+unsigned __RSHCALLCONV UniDriverConnectViaStringKey64(unsigned int deviceHandle, const char* key, unsigned int mode)
+{
+	if(key == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+	RshDeviceKey deviceKey(key);
+	return entry->device->Connect(&deviceKey, mode);
+}
+
+unsigned __RSHCALLCONV UniDriverInit64(unsigned int deviceHandle, unsigned int initializationMode, void* initializationStructure)
+{
+	if(initializationStructure == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+
+	switch(static_cast<URshBaseType*>(initializationStructure)->type)
+	{
+	case rshInitDMA:
+		return RshUniDriverInitDMA(entry->device, initializationMode, *static_cast<URshInitDMA*>(initializationStructure));
+	case rshInitMemory:
+		return RshUniDriverInitMemory(entry->device, initializationMode, *static_cast<URshInitMemory*>(initializationStructure));
+	default:
+		return RSH_API_PARAMETER_DATATYPENOTSUPPORTED;
+	}
+}
+
+unsigned __RSHCALLCONV UniDriverStart64(unsigned int deviceHandle)
+{
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+	return entry->device->Start();
+}
+
+unsigned __RSHCALLCONV UniDriverStop64(unsigned int deviceHandle)
+{
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+
+	const U32 st = entry->device->Stop();
+
+	RshMutexLocker lock(entry->mutex);
+	for(U32 i = 0; i < RSH_UNIDRIVER64_BLOCKS; ++i)
+		entry->blocks[i].id = 0;
+	return st;
+}
+
+unsigned __RSHCALLCONV UniDriverWaitBufferReady64(unsigned int deviceHandle, unsigned int timeout)
+{
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+	RSH_U32 wait = timeout;
+	return entry->device->Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait);
+}
+
+unsigned __RSHCALLCONV UniDriverAllocateBuffer64(URshBuffer64* uRshBuffer, unsigned long long desiredBufferSize)
+{
+	if(uRshBuffer == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(uRshBuffer->structSize < sizeof(URshBuffer64))
+		return RSH_API_PARAMETER_INVALID;
+
+	RshUniDriverStorage* storage = RshUniDriverCreateStorage(uRshBuffer->type);
+	if(storage == 0)
+		return RSH_API_BUFFER_WRONGDATATYPE;
+	// size_t of 32 bit platforms can not hold all 64-bit sizes
+	if(desiredBufferSize > static_cast<size_t>(-1) / storage->ItemSize())
+	{
+		delete storage;
+		return RSH_API_MEMORY_ALLOCATIONERROR;
+	}
+	U32 st = storage->Allocate(static_cast<size_t>(desiredBufferSize));
+	if(st != RSH_API_SUCCESS)
+	{
+		delete storage;
+		return st;
+	}
+
+	RshUniDriverAddBuffer(uRshBuffer, storage, 0, 0);
+	uRshBuffer->flags = URshBufferFlagLibrary;
+	uRshBuffer->size = 0;
+	uRshBuffer->psize = storage->Capacity();
+	uRshBuffer->ptr = storage->Data();
+	return RSH_API_SUCCESS;
+}
+
+unsigned __RSHCALLCONV UniDriverRegisterBuffer(URshBuffer64* uRshBuffer, void* memory, unsigned long long elements)
+{
+	if(uRshBuffer == 0 || memory == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(uRshBuffer->structSize < sizeof(URshBuffer64))
+		return RSH_API_PARAMETER_INVALID;
+
+	// storage receives data from device, then data is copied to memory
+	RshUniDriverStorage* storage = RshUniDriverCreateStorage(uRshBuffer->type);
+	if(storage == 0)
+		return RSH_API_BUFFER_WRONGDATATYPE;
+
+	RshUniDriverAddBuffer(uRshBuffer, storage, memory, elements);
+	uRshBuffer->flags = URshBufferFlagUser;
+	uRshBuffer->size = 0;
+	uRshBuffer->psize = elements;
+	uRshBuffer->ptr = memory;
+	return RSH_API_SUCCESS;
+}
+
+unsigned __RSHCALLCONV UniDriverFreeBuffer64(URshBuffer64* uRshBuffer)
+{
+	if(uRshBuffer == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+
+	RshUniDriverStorage* storage = 0;
+	{
+		RshMutexLocker lock(rshUniDriverMutex);
+		std::map<U32, RshUniDriverBuffer>::iterator it = rshUniDriverBuffers.find(uRshBuffer->id);
+		if(it == rshUniDriverBuffers.end())
+			return RSH_API_BUFFER_NOTINITIALIZED;
+		storage = it->second.storage;
+		rshUniDriverBuffers.erase(it);
+	}
+	delete storage;
+
+	uRshBuffer->id = 0;
+	uRshBuffer->size = 0;
+	uRshBuffer->psize = 0;
+	uRshBuffer->ptr = 0;
+	return RSH_API_SUCCESS;
+}
+
+unsigned __RSHCALLCONV UniDriverGetData64(unsigned int deviceHandle, unsigned int getDataMode, URshBuffer64* uRshBuffer)
+{
+	if(uRshBuffer == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+	RshUniDriverBuffer* buffer = RshUniDriverFindBuffer(uRshBuffer);
+	if(buffer == 0)
+		return RSH_API_BUFFER_NOTINITIALIZED;
+
+	RshUniDriverStorage* storage = buffer->storage;
+	U32 st = entry->device->GetData(storage->Base(), getDataMode);
+	if(st != RSH_API_SUCCESS)
+		return st;
+
+	uRshBuffer->size = storage->Size();
+	if(buffer->memory == 0)
+	{
+		// device may allocate memory of buffer again
+		uRshBuffer->psize = storage->Capacity();
+		uRshBuffer->ptr = storage->Data();
+		return RSH_API_SUCCESS;
+	}
+
+	if(uRshBuffer->size > buffer->elements)
+		return RSH_API_BUFFER_INSUFFICIENTSIZE;
+	std::memcpy(buffer->memory, storage->Data(), storage->Size() * storage->ItemSize());
+	return RSH_API_SUCCESS;
+}
+
+unsigned __RSHCALLCONV UniDriverBorrowBlock(unsigned int deviceHandle, unsigned int getDataMode, URshBlock* block, unsigned int timeout)
+{
+	if(block == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	if(block->structSize < sizeof(URshBlock))
+		return RSH_API_PARAMETER_INVALID;
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+
+	// buffer is taken before waiting, so other threads borrow other buffers
+	RshUniDriverBlock* slot = 0;
+	U32 id = 0;
+	{
+		RshMutexLocker lock(entry->mutex);
+		for(U32 i = 0; i < RSH_UNIDRIVER64_BLOCKS && slot == 0; ++i)
+			if(entry->blocks[i].id == 0)
+				slot = &entry->blocks[i];
+		if(slot == 0)
+			return RSH_API_BUFFER_INSUFFICIENTSIZE;
+
+		if(slot->storage == 0 || slot->storage->Base()->_type != static_cast<U32>(block->type))
+		{
+			RshUniDriverStorage* storage = RshUniDriverCreateStorage(block->type);
+			if(storage == 0)
+				return RSH_API_BUFFER_WRONGDATATYPE;
+			delete slot->storage;
+			slot->storage = storage;
+		}
+
+		if(++entry->lastId == 0)
+			++entry->lastId;
+		id = slot->id = entry->lastId;
+	}
+
+	RSH_U32 wait = timeout;
+	U32 st = entry->device->Get(RSH_GET_WAIT_BUFFER_READY_EVENT, &wait);
+	if(st == RSH_API_SUCCESS)
+		st = entry->device->GetData(slot->storage->Base(), getDataMode);
+	if(st != RSH_API_SUCCESS)
+	{
+		RshMutexLocker lock(entry->mutex);
+		if(slot->id == id)
+			slot->id = 0;
+		return st;
+	}
+
+	RshBlockInfo info;
+	if(entry->device->Get(RSH_GET_BUFFER_BLOCK_INFO, &info) != RSH_API_SUCCESS)
+		info = RshBlockInfo();
+
+	block->id = id;
+	block->reserved = 0;
+	block->size = slot->storage->Size();
+	block->sequence = info.sequence;
+	block->timestamp = info.timestamp;
+	block->ptr = slot->storage->Data();
+	return RSH_API_SUCCESS;
+}
+
+unsigned __RSHCALLCONV UniDriverReleaseBlock(unsigned int deviceHandle, URshBlock* block)
+{
+	if(block == 0)
+		return RSH_API_PARAMETER_ZEROADDRESS;
+	RshUniDriverDevice* entry = RshUniDriverFind(deviceHandle);
+	if(entry == 0)
+		return RSH_API_PARAMETER_WRONGDEVICEHANDLE;
+	if(block->id == 0)
+		return RSH_API_PARAMETER_INVALID;
+
+	RshMutexLocker lock(entry->mutex);
+	for(U32 i = 0; i < RSH_UNIDRIVER64_BLOCKS; ++i)
+	{
+		if(entry->blocks[i].id == block->id)
+		{
+			entry->blocks[i].id = 0;
+			block->id = 0;
+			block->ptr = 0;
+			return RSH_API_SUCCESS;
+		}
+	}
+	return RSH_API_PARAMETER_INVALID;
+}